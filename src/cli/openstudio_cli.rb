@@ -1280,6 +1280,9 @@ class Measure
     if options[:update_all]
       measure_manager = MeasureManager.new($logger)
 
+      # checksum the files of all measures at once, in parallel, so each measure below only reads the cache
+      OpenStudio::BCLMeasure.updateFileChecksumCaches(OpenStudio::toPath(directory))
+
       # loop over all directories
       result = []
       Dir.glob("#{directory}/*/").each do |measure_dir|
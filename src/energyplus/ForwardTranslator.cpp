@@ -66,6 +66,7 @@
 #include "../utilities/core/Logger.hpp"
 #include "../utilities/core/Assert.hpp"
 #include "../utilities/core/FilesystemHelpers.hpp"
+#include "../utilities/core/System.hpp"
 #include "../utilities/geometry/BoundingBox.hpp"
 #include "../utilities/time/Time.hpp"
 #include "../utilities/plot/ProgressBar.hpp"
@@ -84,6 +85,7 @@
 
 #include "../utilities/idd/IddEnums.hpp"
 
+#include <atomic>
 #include <thread>
 
 #include <sstream>
@@ -108,17 +110,32 @@ namespace energyplus {
     m_excludeSQliteOutputReport = false;
     m_excludeHTMLOutputReport = false;
     m_excludeVariableDictionary = false;
+    m_numThreads = 1;
+    m_cloneModel = true;
   }
 
   Workspace ForwardTranslator::translateModel(const Model& model, ProgressBar* progressBar) {
-    Model modelCopy = model.clone(true).cast<Model>();
-
     m_progressBar = progressBar;
     if (m_progressBar) {
       m_progressBar->setMinimum(0);
       m_progressBar->setMaximum(model.numObjects());
     }
 
+    // translate the model itself and undo whatever the translation changed, falling back to a copy if the
+    // model is already journaling
+    Model modelToTranslate = model;
+    if (!m_cloneModel && modelToTranslate.startJournal()) {
+      try {
+        Workspace result = translateModelPrivate(modelToTranslate, true);
+        modelToTranslate.rollbackJournal();
+        return result;
+      } catch (...) {
+        modelToTranslate.rollbackJournal();
+        throw;
+      }
+    }
+
+    Model modelCopy = model.clone(true).cast<Model>();
     return translateModelPrivate(modelCopy, true);
   }
 
@@ -179,6 +196,14 @@ namespace energyplus {
     m_excludeVariableDictionary = excludeVariableDictionary;
   }
 
+  void ForwardTranslator::setCloneModel(bool cloneModel) {
+    m_cloneModel = cloneModel;
+  }
+
+  void ForwardTranslator::setNumThreads(unsigned numThreads) {
+    m_numThreads = numThreads;
+  }
+
   Workspace ForwardTranslator::translateModelPrivate(model::Model& model, bool fullModelTranslation) {
     reset();
 
@@ -490,6 +515,9 @@ namespace energyplus {
       }
     }
 
+    // objects of the pretranslated types are not modified past this point, translate them on other threads ahead of the serial walk
+    pretranslateModelObjects(model);
+
     translateConstructions(model);
     translateSchedules(model);
 
@@ -556,6 +584,9 @@ namespace energyplus {
     OS_ASSERT(vo);
     workspace.removeObject(vo->handle());
 
+    // objects that were pretranslated but never reached are not translated serially either
+    m_pretranslatedModelObjects.clear();
+
     workspace.setFastNaming(true);
     workspace.addObjects(m_idfObjects);
     workspace.setFastNaming(false);
@@ -605,8 +636,44 @@ namespace energyplus {
       return boost::optional<IdfObject>(objInMap->second);
     }
 
-    LOG(Trace, "Translating " << modelObject.briefDescription() << ".");
+    // objects translated ahead of time by pretranslateModelObjects() are spliced in, otherwise translate now
+    if (!splicePretranslatedModelObject(modelObject, retVal)) {
+      LOG(Trace, "Translating " << modelObject.briefDescription() << ".");
+
+      if (!translateModelObjectByType(modelObject, retVal)) {
+        return retVal;
+      }
+    }
+
+    if (retVal) {
+      m_map.insert(make_pair(modelObject.handle(), retVal.get()));
+
+      if (m_progressBar) {
+        m_progressBar->setValue((int)m_map.size());
+      }
+    }
+
+    // is this redundant?
+    // ETH@20120112 Yes.
+    OptionalParentObject opo = modelObject.optionalCast<ParentObject>();
+    if (opo) {
+      ModelObjectVector children = opo->children();
+      IddObjectTypeVector types = iddObjectsToTranslate();
+
+      // sort these objects as well
+      std::sort(children.begin(), children.end(), ChildSorter(types));
+
+      for (auto& elem : children) {
+        if (std::find(types.begin(), types.end(), elem.iddObject().type()) != types.end()) {
+          translateAndMapModelObject(elem);
+        }
+      }
+    }
+
+    return retVal;
+  }
 
+  bool ForwardTranslator::translateModelObjectByType(ModelObject& modelObject, boost::optional<IdfObject>& retVal) {
     switch (modelObject.iddObject().type().value()) {
       case openstudio::IddObjectType::OS_AdditionalProperties: {
         // no op
@@ -835,7 +902,7 @@ namespace energyplus {
       }
       case openstudio::IddObjectType::OS_BuildingStory: {
         // no-op
-        return retVal;
+        return false;
       }
       case openstudio::IddObjectType::OS_CentralHeatPumpSystem: {
         model::CentralHeatPumpSystem mo = modelObject.cast<CentralHeatPumpSystem>();
@@ -844,7 +911,7 @@ namespace energyplus {
       }
       case openstudio::IddObjectType::OS_CentralHeatPumpSystem_Module: {
         // no-op
-        return retVal;
+        return false;
       }
       case openstudio::IddObjectType::OS_Chiller_Absorption: {
         auto mo = modelObject.cast<ChillerAbsorption>();
@@ -873,7 +940,7 @@ namespace energyplus {
       }
       case openstudio::IddObjectType::OS_ClimateZones: {
         // no-op
-        return retVal;
+        return false;
       }
       case openstudio::IddObjectType::OS_Construction_CfactorUndergroundWall: {
         model::CFactorUndergroundWallConstruction construction = modelObject.cast<CFactorUndergroundWallConstruction>();
@@ -932,7 +999,7 @@ namespace energyplus {
         break;
       }
       case openstudio::IddObjectType::OS_Coil_Cooling_DX_MultiSpeed_StageData: {
-        return retVal;
+        return false;
       }
       case openstudio::IddObjectType::OS_Coil_Cooling_DX_TwoSpeed: {
         model::CoilCoolingDXTwoSpeed coil = modelObject.cast<CoilCoolingDXTwoSpeed>();
@@ -972,11 +1039,11 @@ namespace energyplus {
       }
       case openstudio::IddObjectType::OS_Coil_Cooling_LowTemperatureRadiant_ConstantFlow: {
         // no-op
-        return retVal;
+        return false;
       }
       case openstudio::IddObjectType::OS_Coil_Cooling_LowTemperatureRadiant_VariableFlow: {
         // no-op
-        return retVal;
+        return false;
       }
       case openstudio::IddObjectType::OS_Coil_Cooling_Water: {
         model::CoilCoolingWater coil = modelObject.cast<CoilCoolingWater>();
@@ -1050,15 +1117,15 @@ namespace energyplus {
       }
       case openstudio::IddObjectType::OS_Coil_Heating_Gas_MultiStage_StageData: {
         // no-op
-        return retVal;
+        return false;
       }
       case openstudio::IddObjectType::OS_Coil_Heating_LowTemperatureRadiant_ConstantFlow: {
         // no-op
-        return retVal;
+        return false;
       }
       case openstudio::IddObjectType::OS_Coil_Heating_LowTemperatureRadiant_VariableFlow: {
         // no-op
-        return retVal;
+        return false;
       }
       case openstudio::IddObjectType::OS_Coil_Heating_DX_VariableRefrigerantFlow: {
         model::CoilHeatingDXVariableRefrigerantFlow coil = modelObject.cast<CoilHeatingDXVariableRefrigerantFlow>();
@@ -1090,7 +1157,7 @@ namespace energyplus {
       }
       case openstudio::IddObjectType::OS_Coil_Heating_Water_Baseboard_Radiant: {
         // no-op
-        return retVal;
+        return false;
       }
       case openstudio::IddObjectType::OS_CoilPerformance_DX_Cooling: {
         auto mo = modelObject.cast<CoilPerformanceDXCooling>();
@@ -1134,23 +1201,23 @@ namespace energyplus {
       }
       case openstudio::IddObjectType::OS_ComponentData: {
         // no-op
-        return retVal;
+        return false;
       }
       case openstudio::IddObjectType::OS_ComponentCost_Adjustments: {
         LOG(Warn, "OS:ComponentCost:Adjustments '" << modelObject.name().get() << "' not translated to EnergyPlus.");
-        return retVal;
+        return false;
       }
       case openstudio::IddObjectType::OS_Connection: {
         // no-op
-        return retVal;
+        return false;
       }
       case openstudio::IddObjectType::OS_Connector_Mixer: {
         // no-op
-        return retVal;
+        return false;
       }
       case openstudio::IddObjectType::OS_Connector_Splitter: {
         // no-op
-        return retVal;
+        return false;
       }
       case openstudio::IddObjectType::OS_Construction: {
         model::Construction construction = modelObject.cast<Construction>();
@@ -1323,11 +1390,11 @@ namespace energyplus {
       }
       case openstudio::IddObjectType::OS_SizingPeriod_WeatherFileConditionType: {
         LOG(Warn, "OS_SizingPeriod_WeatherFileConditionType is not currently translated");
-        return retVal;
+        return false;
       }
       case openstudio::IddObjectType::OS_SizingPeriod_WeatherFileDays: {
         LOG(Warn, "OS_SizingPeriod_WeatherFileDays is not currently translated");
-        return retVal;
+        return false;
       }
       case openstudio::IddObjectType::OS_Sizing_Plant: {
         model::SizingPlant sizingPlant = modelObject.cast<SizingPlant>();
@@ -1357,19 +1424,19 @@ namespace energyplus {
       }
       case openstudio::IddObjectType::OS_DefaultConstructionSet: {
         // no-op
-        return retVal;
+        return false;
       }
       case openstudio::IddObjectType::OS_DefaultScheduleSet: {
         // no-op
-        return retVal;
+        return false;
       }
       case openstudio::IddObjectType::OS_DefaultSurfaceConstructions: {
         // no-op
-        return retVal;
+        return false;
       }
       case openstudio::IddObjectType::OS_DefaultSubSurfaceConstructions: {
         // no-op
-        return retVal;
+        return false;
       }
       case openstudio::IddObjectType::OS_DesignSpecification_OutdoorAir: {
         model::DesignSpecificationOutdoorAir designSpecificationOutdoorAir = modelObject.cast<DesignSpecificationOutdoorAir>();
@@ -1632,7 +1699,7 @@ namespace energyplus {
       }
       case openstudio::IddObjectType::OS_Facility: {
         // no-op
-        return retVal;
+        return false;
       }
       case openstudio::IddObjectType::OS_Fan_ComponentModel: {
         model::FanComponentModel fan = modelObject.cast<FanComponentModel>();
@@ -1935,7 +2002,7 @@ namespace energyplus {
       case openstudio::IddObjectType::OS_LifeCycleCost_UsePriceEscalation: {
         // DLM: these objects can be created from LifeCycleCostParameters
         LOG(Warn, "OS:LifeCycleCost:UsePriceEscalation '" << modelObject.name().get() << "' not translated to EnergyPlus.");
-        return retVal;
+        return false;
       }
       case openstudio::IddObjectType::OS_LightingDesignDay: {
         // no-op
@@ -2288,7 +2355,7 @@ namespace energyplus {
       }
       case openstudio::IddObjectType::OS_Rendering_Color: {
         // no-op
-        return retVal;
+        return false;
       }
       case openstudio::IddObjectType::OS_RunPeriod: {
         model::RunPeriod runPeriod = modelObject.cast<RunPeriod>();
@@ -2603,11 +2670,11 @@ namespace energyplus {
       }
       case openstudio::IddObjectType::OS_StandardsInformation_Construction: {
         // no-op
-        return retVal;
+        return false;
       }
       case openstudio::IddObjectType::OS_StandardsInformation_Material: {
         // no-op
-        return retVal;
+        return false;
       }
       case openstudio::IddObjectType::OS_SteamEquipment: {
         model::SteamEquipment steamEquipment = modelObject.cast<SteamEquipment>();
@@ -2762,7 +2829,7 @@ namespace energyplus {
       }
       case openstudio::IddObjectType::OS_WeatherFile: {
         // no-op
-        return retVal;
+        return false;
       }
       case openstudio::IddObjectType::OS_WeatherProperty_SkyTemperature: {
         model::SkyTemperature mo = modelObject.cast<SkyTemperature>();
@@ -2815,7 +2882,7 @@ namespace energyplus {
       }
       case openstudio::IddObjectType::OS_YearDescription: {
         // no-op
-        return retVal;
+        return false;
       }
       case openstudio::IddObjectType::OS_ZoneAirContaminantBalance: {
         auto mo = modelObject.cast<ZoneAirContaminantBalance>();
@@ -2980,36 +3047,145 @@ namespace energyplus {
       //If no case statement log a warning
       default: {
         LOG(Warn, "Unknown IddObjectType: '" << modelObject.iddObject().name() << "'");
-        return retVal;
+        return false;
       }
     }
 
-    if (retVal) {
-      m_map.insert(make_pair(modelObject.handle(), retVal.get()));
+    return true;
+  }
 
-      if (m_progressBar) {
-        m_progressBar->setValue((int)m_map.size());
-      }
-    }
+  std::vector<IddObjectType> ForwardTranslator::pretranslatedIddObjectTypes() {
+    // types whose translators only create new IdfObjects from their own fields, they do not translate other
+    // model objects or touch any translator state other than m_idfObjects and m_map
+    static const std::vector<IddObjectType> result{IddObjectType::OS_Curve_Bicubic,
+                                                   IddObjectType::OS_Curve_Biquadratic,
+                                                   IddObjectType::OS_Curve_Cubic,
+                                                   IddObjectType::OS_Curve_DoubleExponentialDecay,
+                                                   IddObjectType::OS_Curve_Exponent,
+                                                   IddObjectType::OS_Curve_ExponentialDecay,
+                                                   IddObjectType::OS_Curve_ExponentialSkewNormal,
+                                                   IddObjectType::OS_Curve_FanPressureRise,
+                                                   IddObjectType::OS_Curve_Functional_PressureDrop,
+                                                   IddObjectType::OS_Curve_Linear,
+                                                   IddObjectType::OS_Curve_QuadLinear,
+                                                   IddObjectType::OS_Curve_QuintLinear,
+                                                   IddObjectType::OS_Curve_Quadratic,
+                                                   IddObjectType::OS_Curve_QuadraticLinear,
+                                                   IddObjectType::OS_Curve_Quartic,
+                                                   IddObjectType::OS_Curve_RectangularHyperbola1,
+                                                   IddObjectType::OS_Curve_RectangularHyperbola2,
+                                                   IddObjectType::OS_Curve_Sigmoid,
+                                                   IddObjectType::OS_Curve_Triquadratic,
+                                                   IddObjectType::OS_Table_MultiVariableLookup,
+                                                   IddObjectType::OS_Material,
+                                                   IddObjectType::OS_Material_AirGap,
+                                                   IddObjectType::OS_Material_InfraredTransparent,
+                                                   IddObjectType::OS_Material_NoMass,
+                                                   IddObjectType::OS_MaterialProperty_GlazingSpectralData,
+                                                   IddObjectType::OS_MaterialProperty_MoisturePenetrationDepth_Settings,
+                                                   IddObjectType::OS_WindowMaterial_Blind,
+                                                   IddObjectType::OS_WindowMaterial_Gas,
+                                                   IddObjectType::OS_WindowMaterial_GasMixture,
+                                                   IddObjectType::OS_WindowMaterial_Glazing,
+                                                   IddObjectType::OS_WindowMaterial_Glazing_RefractionExtinctionMethod,
+                                                   IddObjectType::OS_WindowMaterial_Screen,
+                                                   IddObjectType::OS_WindowMaterial_Shade,
+                                                   IddObjectType::OS_WindowMaterial_SimpleGlazingSystem,
+                                                   IddObjectType::OS_Schedule_Constant};
+    return result;
+  }
 
-    // is this redundant?
-    // ETH@20120112 Yes.
-    OptionalParentObject opo = modelObject.optionalCast<ParentObject>();
-    if (opo) {
-      ModelObjectVector children = opo->children();
-      IddObjectTypeVector types = iddObjectsToTranslate();
+  void ForwardTranslator::pretranslateModelObjects(const model::Model& model) {
+    unsigned numThreads = m_numThreads;
+    if (numThreads == 0) {
+      numThreads = System::numberOfProcessors();
+    }
+    if (numThreads < 2) {
+      return;
+    }
 
-      // sort these objects as well
-      std::sort(children.begin(), children.end(), ChildSorter(types));
+    std::vector<ModelObject> modelObjects;
+    for (const IddObjectType& iddObjectType : pretranslatedIddObjectTypes()) {
+      for (const WorkspaceObject& workspaceObject : model.getObjectsByType(iddObjectType)) {
+        if (m_map.find(workspaceObject.handle()) == m_map.end()) {
+          modelObjects.push_back(workspaceObject.cast<ModelObject>());
+        }
+      }
+    }
+    if (modelObjects.size() < 2) {
+      return;
+    }
+    numThreads = std::min<unsigned>(numThreads, modelObjects.size());
+
+    // each thread translates with its own translator so that m_idfObjects, m_map and the log sink are not shared. Every
+    // worker runs on a spawned thread, since the main translator's log sink takes every message from the calling thread.
+    // The model objects and their IddObjects are shared but only read: the pretranslated types never touch other
+    // objects, numeric fields are parsed when they are set and the IDD name field is resolved when the IddObject is
+    // built, so none of these const reads fills a cache
+    std::vector<std::vector<std::pair<Handle, PretranslatedModelObject>>> results(numThreads);
+    std::atomic<unsigned> next(0);
+    auto worker = [&modelObjects, &results, &next](unsigned t) {
+      ForwardTranslator translator;
+      for (unsigned i = next++; i < modelObjects.size(); i = next++) {
+        ModelObject& modelObject = modelObjects[i];
+        translator.m_idfObjects.clear();
+        translator.m_map.clear();
+        translator.m_logSink.resetStringStream();
+
+        PretranslatedModelObject pretranslated;
+        if (!translator.translateModelObjectByType(modelObject, pretranslated.result)) {
+          continue;
+        }
 
-      for (auto& elem : children) {
-        if (std::find(types.begin(), types.end(), elem.iddObject().type()) != types.end()) {
-          translateAndMapModelObject(elem);
+        // anything unexpected is left for the serial translation, which reproduces it in order (logging its messages again)
+        if (translator.m_map.size() > 1) {
+          continue;
         }
+        if (!translator.m_map.empty()) {
+          if (translator.m_map.begin()->first != modelObject.handle()) {
+            continue;
+          }
+          pretranslated.mapped = translator.m_map.begin()->second;
+        }
+
+        pretranslated.idfObjects = translator.m_idfObjects;
+        // kept so the messages reach this translator's warnings() and errors() in order, without logging them again
+        pretranslated.logMessages = translator.m_logSink.logMessages();
+        results[t].push_back(std::make_pair(modelObject.handle(), pretranslated));
       }
+    };
+
+    std::vector<std::thread> threads;
+    for (unsigned t = 0; t < numThreads; ++t) {
+      threads.emplace_back(worker, t);
+    }
+    for (std::thread& thread : threads) {
+      thread.join();
     }
 
-    return retVal;
+    for (std::vector<std::pair<Handle, PretranslatedModelObject>>& result : results) {
+      m_pretranslatedModelObjects.insert(result.begin(), result.end());
+    }
+  }
+
+  bool ForwardTranslator::splicePretranslatedModelObject(const ModelObject& modelObject, boost::optional<IdfObject>& retVal) {
+    auto it = m_pretranslatedModelObjects.find(modelObject.handle());
+    if (it == m_pretranslatedModelObjects.end()) {
+      return false;
+    }
+
+    // same IdfObjects in the same position as if the object had been translated here
+    m_idfObjects.insert(m_idfObjects.end(), it->second.idfObjects.begin(), it->second.idfObjects.end());
+    if (it->second.mapped) {
+      m_map.insert(make_pair(modelObject.handle(), it->second.mapped.get()));
+    }
+    retVal = it->second.result;
+    if (!it->second.logMessages.empty()) {
+      m_logSink.appendLogMessages(it->second.logMessages);
+    }
+
+    m_pretranslatedModelObjects.erase(it);
+    return true;
   }
 
   std::string ForwardTranslator::stripOS2(const string& s) {
@@ -3685,6 +3861,8 @@ namespace energyplus {
 
     m_map.clear();
 
+    m_pretranslatedModelObjects.clear();
+
     m_anyNumberScheduleTypeLimits.reset();
 
     m_alwaysOnSchedule.reset();
@@ -530,6 +530,17 @@ namespace energyplus {
    *  Use this at your own risks */
     void setExcludeVariableDictionary(bool excludeVariableDictionary);
 
+    /** cloneModel is enabled by default, translateModel then works on a copy of the model. If disabled, the model
+   *  itself is translated and every change the translator makes to it is rolled back afterwards, which avoids
+   *  copying the whole model. Objects removed along the way come back with the same handles, but anything
+   *  observing the model sees the intermediate changes. */
+    void setCloneModel(bool cloneModel);
+
+    /** Translate curves, materials and constant schedules on up to numThreads threads before the rest of the model,
+   *  a numThreads of 0 uses all processors. The default of 1 translates everything on the calling thread.
+   *  The resulting Workspace is the same regardless of numThreads. */
+    void setNumThreads(unsigned numThreads);
+
    private:
     REGISTER_LOGGER("openstudio.energyplus.ForwardTranslator");
 
@@ -552,6 +563,17 @@ namespace energyplus {
 
     boost::optional<IdfObject> translateAndMapModelObject(model::ModelObject& modelObject);
 
+    /** Calls the type specific translator for modelObject, returns false if its children should not be translated. */
+    bool translateModelObjectByType(model::ModelObject& modelObject, boost::optional<IdfObject>& retVal);
+
+    /** Translates objects of pretranslatedIddObjectTypes() in parallel into m_pretranslatedModelObjects. */
+    void pretranslateModelObjects(const model::Model& model);
+
+    /** If modelObject was pretranslated, appends its IdfObjects to m_idfObjects, maps it and returns true. */
+    bool splicePretranslatedModelObject(const model::ModelObject& modelObject, boost::optional<IdfObject>& retVal);
+
+    static std::vector<IddObjectType> pretranslatedIddObjectTypes();
+
     boost::optional<IdfObject> translateAirConditionerVariableRefrigerantFlow(model::AirConditionerVariableRefrigerantFlow& modelObject);
 
     boost::optional<IdfObject> translateAirflowNetworkSimulationControl(model::AirflowNetworkSimulationControl& modelObject);
@@ -1546,6 +1568,16 @@ namespace energyplus {
 
     std::vector<IdfObject> m_idfObjects;
 
+    struct PretranslatedModelObject
+    {
+      boost::optional<IdfObject> result;
+      boost::optional<IdfObject> mapped;
+      std::vector<IdfObject> idfObjects;
+      std::vector<LogMessage> logMessages;
+    };
+
+    std::map<openstudio::Handle, PretranslatedModelObject> m_pretranslatedModelObjects;
+
     boost::optional<IdfObject> m_anyNumberScheduleTypeLimits;
 
     StringStreamLogSink m_logSink;
@@ -1558,6 +1590,8 @@ namespace energyplus {
     bool m_excludeSQliteOutputReport;  // exclude Output:Sqlite
     bool m_excludeHTMLOutputReport;    // exclude Output:Table:SummaryReports
     bool m_excludeVariableDictionary;  // exclude Output:VariableDictionary
+    unsigned m_numThreads;
+    bool m_cloneModel;
   };
 
 }  // namespace energyplus
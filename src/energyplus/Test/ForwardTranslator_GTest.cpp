@@ -63,6 +63,8 @@
 #include "../../model/CoilCoolingDXSingleSpeed.hpp"
 #include "../../model/CoilCoolingDXSingleSpeed_Impl.hpp"
 #include "../../model/StandardOpaqueMaterial.hpp"
+#include "../../model/ScheduleConstant.hpp"
+#include "../../model/TableMultiVariableLookup.hpp"
 #include "../../model/Construction.hpp"
 #include "../../model/OutputVariable.hpp"
 #include "../../model/OutputVariable_Impl.hpp"
@@ -75,6 +77,7 @@
 #include "../../utilities/core/Checksum.hpp"
 #include "../../utilities/core/UUID.hpp"
 #include "../../utilities/core/Logger.hpp"
+#include "../../utilities/core/StringStreamLogSink.hpp"
 #include "../../utilities/sql/SqlFile.hpp"
 #include "../../utilities/idf/IdfFile.hpp"
 #include "../../utilities/idf/IdfObject.hpp"
@@ -92,6 +95,8 @@
 
 #include <resources.hxx>
 
+#include <algorithm>
+#include <map>
 #include <sstream>
 
 #include <vector>
@@ -146,6 +151,163 @@ TEST_F(EnergyPlusFixture, ForwardTranslator_ExampleModel) {
   // workspace.save(toPath("./example.idf"), true);
 }
 
+TEST_F(EnergyPlusFixture, ForwardTranslator_NumThreads) {
+  Model model = exampleModel();
+  for (int i = 0; i < 20; ++i) {
+    CurveQuadratic curve(model);
+    curve.setCoefficient2x(0.1 * i);
+    StandardOpaqueMaterial material(model);
+    material.setThickness(0.01 * (i + 1));
+  }
+
+  ForwardTranslator serialTranslator;
+  Workspace serialWorkspace = serialTranslator.translateModel(model);
+  std::stringstream serialIdf;
+  serialWorkspace.toIdfFile().print(serialIdf);
+
+  for (unsigned numThreads : {0u, 2u, 4u}) {
+    ForwardTranslator parallelTranslator;
+    parallelTranslator.setNumThreads(numThreads);
+    Workspace parallelWorkspace = parallelTranslator.translateModel(model);
+    EXPECT_EQ(serialTranslator.errors().size(), parallelTranslator.errors().size());
+    EXPECT_EQ(serialTranslator.warnings().size(), parallelTranslator.warnings().size());
+    EXPECT_EQ(serialWorkspace.objects().size(), parallelWorkspace.objects().size());
+
+    std::stringstream parallelIdf;
+    parallelWorkspace.toIdfFile().print(parallelIdf);
+    EXPECT_EQ(serialIdf.str(), parallelIdf.str()) << "numThreads = " << numThreads;
+  }
+}
+
+TEST_F(EnergyPlusFixture, ForwardTranslator_NumThreads_LoadedModel) {
+  // objects read back from text have never been queried, so the worker threads are the first to read them
+  Model original = exampleModel();
+  for (int i = 0; i < 50; ++i) {
+    CurveQuadratic curve(original);
+    curve.setCoefficient1Constant(0.5 * i);
+    curve.setCoefficient3xPOW2(-0.01 * i);
+    StandardOpaqueMaterial material(original);
+    material.setThickness(0.01 * (i + 1));
+    ScheduleConstant schedule(original);
+    schedule.setValue(i);
+  }
+  std::stringstream osm;
+  original.toIdfFile().print(osm);
+
+  std::string serialIdf;
+  for (unsigned numThreads : {1u, 8u}) {
+    std::stringstream is(osm.str());
+    OptionalIdfFile idfFile = IdfFile::load(is, IddFileType::OpenStudio);
+    ASSERT_TRUE(idfFile);
+    Model model(*idfFile);
+
+    ForwardTranslator translator;
+    translator.setNumThreads(numThreads);
+    Workspace workspace = translator.translateModel(model);
+    std::stringstream idf;
+    workspace.toIdfFile().print(idf);
+    if (numThreads == 1u) {
+      serialIdf = idf.str();
+    } else {
+      EXPECT_EQ(serialIdf, idf.str());
+    }
+  }
+}
+
+TEST_F(EnergyPlusFixture, ForwardTranslator_NumThreads_Messages) {
+  // tables that are missing points log an error from the worker threads, which must show up once and in serial order
+  Model model = exampleModel();
+  for (int i = 0; i < 20; ++i) {
+    CurveQuadratic curve(model);
+    curve.setCoefficient2x(0.1 * i);
+    TableMultiVariableLookup table(model, 2);
+    table.setName("Incomplete Table " + std::to_string(i));
+    table.addPoint(1.0, 1.0, 0.5 * i);
+    table.addPoint(2.0, 2.0, 0.5 * i + 1.0);
+  }
+
+  auto messageText = [](const std::vector<LogMessage>& messages) {
+    std::vector<std::string> result;
+    for (const LogMessage& message : messages) {
+      result.push_back(message.logChannel() + " " + std::to_string(message.logLevel()) + " " + message.logMessage());
+    }
+    return result;
+  };
+
+  StringStreamLogSink globalSink;
+  globalSink.setLogLevel(Warn);
+  globalSink.setChannelRegex(boost::regex("openstudio\\.energyplus\\.ForwardTranslator"));
+
+  ForwardTranslator serialTranslator;
+  serialTranslator.setNumThreads(1);
+  Workspace serialWorkspace = serialTranslator.translateModel(model);
+  std::stringstream serialIdf;
+  serialWorkspace.toIdfFile().print(serialIdf);
+  std::vector<std::string> serialErrors = messageText(serialTranslator.errors());
+  std::vector<std::string> serialWarnings = messageText(serialTranslator.warnings());
+  std::vector<std::string> serialGlobal = messageText(globalSink.logMessages());
+  EXPECT_GE(serialErrors.size(), 20u);
+
+  for (unsigned numThreads : {2u, 8u}) {
+    globalSink.resetStringStream();
+    ForwardTranslator parallelTranslator;
+    parallelTranslator.setNumThreads(numThreads);
+    Workspace parallelWorkspace = parallelTranslator.translateModel(model);
+    std::stringstream parallelIdf;
+    parallelWorkspace.toIdfFile().print(parallelIdf);
+    EXPECT_EQ(serialIdf.str(), parallelIdf.str()) << "numThreads = " << numThreads;
+    EXPECT_EQ(serialErrors, messageText(parallelTranslator.errors())) << "numThreads = " << numThreads;
+    EXPECT_EQ(serialWarnings, messageText(parallelTranslator.warnings())) << "numThreads = " << numThreads;
+
+    // sinks that take every thread see each message once, not in order
+    std::vector<std::string> parallelGlobal = messageText(globalSink.logMessages());
+    std::vector<std::string> expectedGlobal = serialGlobal;
+    std::sort(parallelGlobal.begin(), parallelGlobal.end());
+    std::sort(expectedGlobal.begin(), expectedGlobal.end());
+    EXPECT_EQ(expectedGlobal, parallelGlobal) << "numThreads = " << numThreads;
+  }
+}
+
+TEST_F(EnergyPlusFixture, ForwardTranslator_CloneModel) {
+  Model model = exampleModel();
+  std::map<Handle, std::string> modelBefore;
+  for (const WorkspaceObject& object : model.objects()) {
+    std::stringstream ss;
+    object.idfObject().print(ss);
+    modelBefore[object.handle()] = ss.str();
+  }
+
+  ForwardTranslator cloningTranslator;
+  Workspace cloned = cloningTranslator.translateModel(model);
+  std::stringstream clonedIdf;
+  cloned.toIdfFile().print(clonedIdf);
+
+  ForwardTranslator inPlaceTranslator;
+  inPlaceTranslator.setCloneModel(false);
+  Workspace inPlace = inPlaceTranslator.translateModel(model);
+  std::stringstream inPlaceIdf;
+  inPlace.toIdfFile().print(inPlaceIdf);
+
+  EXPECT_EQ(clonedIdf.str(), inPlaceIdf.str());
+  EXPECT_EQ(cloningTranslator.warnings().size(), inPlaceTranslator.warnings().size());
+  EXPECT_EQ(cloningTranslator.errors().size(), inPlaceTranslator.errors().size());
+
+  // the model is left as it was
+  ASSERT_EQ(modelBefore.size(), model.objects().size());
+  for (const WorkspaceObject& object : model.objects()) {
+    ASSERT_TRUE(modelBefore.find(object.handle()) != modelBefore.end());
+    std::stringstream ss;
+    object.idfObject().print(ss);
+    EXPECT_EQ(modelBefore[object.handle()], ss.str());
+  }
+
+  // translating again gives the same result
+  Workspace again = inPlaceTranslator.translateModel(model);
+  std::stringstream againIdf;
+  again.toIdfFile().print(againIdf);
+  EXPECT_EQ(clonedIdf.str(), againIdf.str());
+}
+
 TEST_F(EnergyPlusFixture, ForwardTranslatorTest_TranslateAirLoopHVAC) {
   openstudio::model::Model model;
   EXPECT_TRUE(model.getOptionalUniqueModelObject<Version>()) << "Blank model does not include a Version object.";
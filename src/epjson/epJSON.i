@@ -12,6 +12,9 @@
 // Ignore stuff that takes/returns Json::Value
 %ignore openstudio::epJSON::toJSON;
 %ignore openstudio::epJSON::loadJSON;
+%ignore openstudio::epJSON::writeJSON;
+%ignore openstudio::epJSON::toIdfFile;
+%ignore openstudio::epJSON::toWorkspace;
 
 %include <utilities/core/CommonInclude.i>
 %import <utilities/core/CommonImport.i>
@@ -14,6 +14,17 @@
 
 #include <json/json.h>
 #include <fmt/format.h>
+
+#include <algorithm>
+#include <cmath>
+#include <ctime>
+#include <istream>
+#include <iterator>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <unordered_map>
 #include <vector>
 #include <string_view>
 
@@ -56,11 +67,7 @@ enum class JSONValueType
   NumberOrString
 };
 
-const std::string& toJSONFieldName(std::map<std::string, std::string>& fieldNames, const std::string& fieldNameInput) {
-
-  if (const auto& cached_value = fieldNames.find(fieldNameInput); cached_value != fieldNames.end()) {
-    return cached_value->second;
-  }
+std::string toJSONFieldName(const std::string& fieldNameInput) {
 
   auto fieldName = boost::to_lower_copy(fieldNameInput);
   boost::replace_all(fieldName, " ", "_");
@@ -76,10 +83,6 @@ const std::string& toJSONFieldName(std::map<std::string, std::string>& fieldName
   boost::replace_all(fieldName, "__", "_");
   boost::replace_all(fieldName, ":", "_");
 
-  const auto cache_value = [&](const auto& input, const auto& value) -> const auto& {
-    return fieldNames.emplace(input, value).first->second;
-  };
-
   using namespace std::literals::string_view_literals;
 
   static constexpr std::array<std::pair<std::string_view, std::string_view>, 3> manualFixPairs{{
@@ -90,10 +93,10 @@ const std::string& toJSONFieldName(std::map<std::string, std::string>& fieldName
 
   if (auto it = std::find_if(manualFixPairs.cbegin(), manualFixPairs.cend(), [&fieldName](const auto& p) { return p.first == fieldName; });
       it != manualFixPairs.cend()) {
-    return cache_value(fieldNameInput, it->second);
+    return std::string{it->second};
   }
 
-  return cache_value(fieldNameInput, fieldName);
+  return fieldName;
 }
 
 /** Locate the properties for a given object:
@@ -132,61 +135,216 @@ JSONValueType schemaPropertyTypeDecode(const Json::Value& type) {
   return JSONValueType::NumberOrString;
 }
 
-/** Locate the properties for a given field of an object.
+/** A field of an epJSON schema object, with what the translation needs from the schema resolved once */
+struct SchemaField
+{
+  std::string name;
+  JSONValueType type = JSONValueType::NumberOrString;
+  bool hasEnum = false;
+  // 'enum' choices of a ChoiceType field, as (lower case, schema casing)
+  std::vector<std::pair<std::string, std::string>> enumChoices;
+  // 'anyOf' > 'enum' choices of a RealType field, as (lower case, schema casing)
+  std::vector<std::pair<std::string, std::string>> anyOfChoices;
+};
+
+/** An epJSON schema object, with its fields indexed like the fields of the IddObject */
+struct SchemaObject
+{
+  std::string typeDescription;
+  bool isFluidPropertiesName = false;
+  // name of the array holding the extensible groups, if the schema stores them in one
+  std::string groupName;
+  bool isArrayGroup = false;
+  // by field index, for the non extensible fields
+  std::vector<SchemaField> fields;
+  // by field index in the extensible group if isArrayGroup, else by field index past the non extensible fields
+  std::vector<SchemaField> extensibleFields;
+  // index in fields and in extensibleFields by epJSON field name, for the reverse translation
+  std::unordered_map<std::string, unsigned> fieldIndices;
+  std::unordered_map<std::string, unsigned> extensibleFieldIndices;
+};
+
+/** Locate the properties for a given field of an object and resolve its type and enumeration choices.
  * - group_name can be empty, or it's the name of the extensible group.
  * - field_name is the name of the field
- * - field_property_name is something like 'type', 'anyOf', or 'enum'
  *
  * if group_name is empty:
- *  getSchemaObjectProperties > [field_name] > [field_property_name]
+ *  getSchemaObjectProperties > [field_name]
  * else:
- *  getSchemaObjectProperties > [group_name] > items > properties > [field_name] > [field_property_name]
+ *  getSchemaObjectProperties > [group_name] > items > properties > [field_name]
  */
-const Json::Value& getSchemaObjectFieldProperty(const Json::Value& schema, const std::string& type_description, const std::string& group_name,
-                                                const std::string& field_name, const std::string& field_property_name) {
+SchemaField compileSchemaField(const Json::Value& objectProperties, const std::string& group_name, const std::string& field_name,
+                               const openstudio::IddFieldType fieldType) {
+  const auto& fieldProperties = group_name.empty() ? safeLookupValue(objectProperties, field_name)
+                                                   : safeLookupValue(objectProperties, group_name, "items", "properties", field_name);
+
+  SchemaField result;
+  result.name = field_name;
+  result.type = schemaPropertyTypeDecode(safeLookupValue(fieldProperties, "type"));
+  if (result.type == JSONValueType::NumberOrString) {
+    LOG_FREE(LogLevel::Warn, "epJSONTranslator",
+             "Unknown value passed to schemaPropertyTypeDecode, returning generic 'NumberOrString' Option. "
+               << "Occurred for group_name=" << group_name << ", field_name=" << field_name);
+  }
 
-  const auto& objectProperties = getSchemaObjectProperties(schema, type_description);
+  if (fieldType == openstudio::IddFieldType::ChoiceType) {
+    const auto& enumOptions = safeLookupValue(fieldProperties, "enum");
+    result.hasEnum = !enumOptions.isNull();
+    for (const auto& enumOption : enumOptions) {
+      if (enumOption.isString()) {
+        const auto& enumStr = enumOption.asString();
+        result.enumChoices.emplace_back(boost::to_lower_copy(enumStr), enumStr);
+      }
+    }
+  } else if (fieldType == openstudio::IddFieldType::RealType) {
+    const auto& anyOf = safeLookupValue(fieldProperties, "anyOf");
+    if (anyOf.isArray()) {
+      for (const auto& possibleValues : anyOf) {
+        if (!possibleValues.isObject()) {
+          continue;
+        }
+        const auto& enumOptions = possibleValues["enum"];
+        if (enumOptions.isArray()) {
+          for (const auto& enumOption : enumOptions) {
+            if (enumOption.isString()) {
+              const auto& enumStr = enumOption.asString();
+              result.anyOfChoices.emplace_back(boost::to_lower_copy(enumStr), enumStr);
+            }
+          }
+        }
+      }
+    }
+  }
+
+  return result;
+}
+
+void indexSchemaFieldNames(SchemaObject& schemaObject) {
+  for (unsigned idx = 0; idx < schemaObject.fields.size(); ++idx) {
+    if (!schemaObject.fields[idx].name.empty()) {
+      schemaObject.fieldIndices.emplace(schemaObject.fields[idx].name, idx);
+    }
+  }
+  for (unsigned idx = 0; idx < schemaObject.extensibleFields.size(); ++idx) {
+    schemaObject.extensibleFieldIndices.emplace(schemaObject.extensibleFields[idx].name, idx);
+  }
+}
+
+SchemaObject compileSchemaObject(const Json::Value& schema, const openstudio::IddObject& iddObject) {
+  SchemaObject result;
+  result.typeDescription = iddObject.type().valueDescription();
+  result.isFluidPropertiesName = result.typeDescription.find("FluidProperties:Name") != std::string::npos;
+
+  const auto& objectProperties = getSchemaObjectProperties(schema, result.typeDescription);
+
+  const auto nonextensibleFields = iddObject.nonextensibleFields();
+  result.fields.resize(nonextensibleFields.size());
+  for (unsigned idx = 0; idx < nonextensibleFields.size(); ++idx) {
+    const auto& iddField = nonextensibleFields[idx];
+    if (iddField.isNameField()) {
+      // the name is the key of the object
+      continue;
+    }
+    result.fields[idx] = compileSchemaField(objectProperties, "", toJSONFieldName(iddField.name()), iddField.properties().type);
+  }
+
+  const auto extensibleGroup = iddObject.extensibleGroup();
+  if (extensibleGroup.empty()) {
+    indexSchemaFieldNames(result);
+    return result;
+  }
+
+  // the extensible groups go in the first array property, if any
+  for (const auto& propertyName : objectProperties.getMemberNames()) {
+    const auto& type = safeLookupValue(objectProperties, propertyName, "type");
+    if (type.isString() && type.asString() == "array") {
+      result.groupName = propertyName;
+      result.isArrayGroup = true;
+      break;
+    }
+  }
 
-  if (group_name.empty()) {
-    return safeLookupValue(objectProperties, field_name, field_property_name);
+  if (result.isArrayGroup) {
+    for (const auto& iddField : extensibleGroup) {
+      result.extensibleFields.push_back(
+        compileSchemaField(objectProperties, result.groupName, toJSONFieldName(iddField.name()), iddField.properties().type));
+    }
   } else {
-    return safeLookupValue(objectProperties, group_name, "items", "properties", field_name, field_property_name);
+    // use the index of the field inside of the IddObject to look up what its name should be
+    // inside of the epJSON schema
+    //
+    // This is (partially) necessary because OpenStudio treats all groups as extensible.
+    const auto& legacyFieldNames = getSchemaFieldNames(schema, result.typeDescription);
+    for (auto idx = nonextensibleFields.size(); idx < legacyFieldNames.size(); ++idx) {
+      const auto& lookedUpFieldName = legacyFieldNames[static_cast<int>(idx)];
+      OS_ASSERT(lookedUpFieldName.isString());
+      const auto& iddField = extensibleGroup[(idx - nonextensibleFields.size()) % extensibleGroup.size()];
+      result.extensibleFields.push_back(compileSchemaField(objectProperties, "", lookedUpFieldName.asString(), iddField.properties().type));
+    }
   }
+
+  indexSchemaFieldNames(result);
+  return result;
 }
 
-/** Find the 'type' property of a field and convert that to enum.*/
-JSONValueType getSchemaObjectFieldPropertyType(const Json::Value& schema, const std::string& type_description, const std::string& group_name,
-                                               const std::string& field_name) {
-  JSONValueType type = schemaPropertyTypeDecode(getSchemaObjectFieldProperty(schema, type_description, group_name, field_name, "type"));
-  if (type == JSONValueType::NumberOrString) {
-    LOG_FREE(LogLevel::Warn, "epJSONTranslator",
-             "Unknown value passed to schemaPropertyTypeDecode, returning generic 'NumberOrString' Option. "
-               << "Occurred for group_name=" << group_name << ", field_name=" << field_name);
+/** The epJSON schema, compiled one object type at a time as they are first translated. Safe to share between threads */
+class CompiledSchema
+{
+ public:
+  explicit CompiledSchema(Json::Value schema) : m_schema(std::move(schema)) {}
+
+  const SchemaObject& object(const openstudio::IddObject& iddObject) const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto& result = m_objects[iddObject.type().value()];
+    if (!result) {
+      result = std::make_unique<const SchemaObject>(compileSchemaObject(m_schema, iddObject));
+    }
+    return *result;
+  }
+
+ private:
+  Json::Value m_schema;
+  mutable std::mutex m_mutex;
+  mutable std::unordered_map<int, std::unique_ptr<const SchemaObject>> m_objects;
+};
+
+/** The compiled schema at schemaPath, loaded once per process and again only if the file changes */
+std::shared_ptr<const CompiledSchema> compiledSchema(const openstudio::path& schemaPath) {
+  static std::mutex mutex;
+  static std::map<openstudio::path, std::pair<std::time_t, std::shared_ptr<const CompiledSchema>>> schemas;
+
+  const std::time_t lastWriteTime = openstudio::filesystem::exists(schemaPath) ? openstudio::filesystem::last_write_time(schemaPath) : 0;
+
+  std::lock_guard<std::mutex> lock(mutex);
+  auto& [cachedWriteTime, schema] = schemas[schemaPath];
+  if (!schema || cachedWriteTime != lastWriteTime) {
+    Json::Value root = loadJSON(schemaPath);
+    if (root.isNull()) {
+      LOG_FREE(LogLevel::Error, "epJSONTranslator", "Schema is invalid at path=" << schemaPath);
+      schemas.erase(schemaPath);
+      return nullptr;
+    }
+    schema = std::make_shared<const CompiledSchema>(std::move(root));
+    cachedWriteTime = lastWriteTime;
   }
-  return type;
+  return schema;
 }
 
 /** epJSON (unlike IDF) is case sensitive, so this routine find the correct 'enum' choice casing
  * It applies to fieldType = 'ChoiceType' or 'RealType' (since RealType can also be `anyOf` with values like 'Autosize' 'Autocalculate'))
  * eg: if given value='autosize', will convert it to 'Autosize' so that EnergyPlus' InputParser does recognize it */
-std::string fixupEnumerationValue(const Json::Value& schema, const std::string& value, const std::string& type_description,
-                                  const std::string& group_name, const std::string& field_name, const openstudio::IddFieldType fieldType) {
+std::string fixupEnumerationValue(const SchemaField& schemaField, const std::string& value, const openstudio::IddFieldType fieldType) {
 
   if (fieldType == openstudio::IddFieldType::ChoiceType) {
-    const auto& fieldProperty = getSchemaObjectFieldProperty(schema, type_description, group_name, field_name, "enum");
-    const auto lower = boost::to_lower_copy(value);
-
-    if (fieldProperty.isNull()) {
-      LOG_FREE(LogLevel::Error, "epJSONTranslator", "Unable to find enum value for " << value << " in " << group_name << "::" << field_name)
+    if (!schemaField.hasEnum) {
+      LOG_FREE(LogLevel::Error, "epJSONTranslator", "Unable to find enum value for " << value << " in " << schemaField.name)
       return value;
     }
 
-    for (const auto& enumOption : fieldProperty) {
-      if (enumOption.isString()) {
-        const auto& enumStr = enumOption.asString();
-        if (boost::to_lower_copy(enumStr) == lower) {
-          return enumStr;
-        }
+    const auto lower = boost::to_lower_copy(value);
+    for (const auto& [lowerEnumStr, enumStr] : schemaField.enumChoices) {
+      if (lowerEnumStr == lower) {
+        return enumStr;
       }
     }
 
@@ -195,30 +353,17 @@ std::string fixupEnumerationValue(const Json::Value& schema, const std::string&
   }
 
   if (fieldType == openstudio::IddFieldType::RealType) {
-
-    const auto& fieldProperty = getSchemaObjectFieldProperty(schema, type_description, group_name, field_name, "anyOf");
-
-    if (fieldProperty.isArray()) {
+    if (!schemaField.anyOfChoices.empty()) {
       const auto lower = boost::to_lower_copy(value);
 
-      for (const auto& possibleValues : fieldProperty) {
-        const auto& enumOptions = possibleValues["enum"];
-        if (enumOptions.isArray()) {
-          for (const auto& enumOption : enumOptions) {
-            if (enumOption.isString()) {
-              const auto& enumStr = enumOption.asString();
-              const auto lowerEnumStr = boost::to_lower_copy(enumStr);
-
-              if (lowerEnumStr == lower) {
-                return enumStr;
-              }
+      for (const auto& [lowerEnumStr, enumStr] : schemaField.anyOfChoices) {
+        if (lowerEnumStr == lower) {
+          return enumStr;
+        }
 
-              if (lowerEnumStr.find("auto") == 0 && lower.find("auto") == 0) {
-                // it's the "auto" option, return it
-                return enumStr;
-              }
-            }
-          }
+        if (lowerEnumStr.find("auto") == 0 && lower.find("auto") == 0) {
+          // it's the "auto" option, return it
+          return enumStr;
         }
       }
     }
@@ -231,36 +376,820 @@ std::string fixupEnumerationValue(const Json::Value& schema, const std::string&
   return value;
 }
 
-/* Find name of an extensible group and cache it */
-auto getGroupName(std::map<std::pair<std::string, std::string>, std::pair<std::string, bool>>& group_names,
-                  std::map<std::string, std::string>& field_names, const Json::Value& schema, const std::string& type_description,
-                  const std::string& group_name) -> const auto& {
+const SchemaField& unknownSchemaField() {
+  static const SchemaField result;
+  return result;
+}
+
+template <typename FieldsType, typename Visitor>
+bool visitField(const SchemaField& schemaField, const openstudio::IddField& iddField, const FieldsType& field, const unsigned idx, Visitor&& visitor) {
+  switch (schemaField.type) {
+    case JSONValueType::String: {
+      const auto fieldString = field.getString(idx);
+      if (fieldString && !fieldString->empty()) {
+        visitor(fixupEnumerationValue(schemaField, *fieldString, iddField.properties().type));
+        return true;
+      }
+    }
+      [[fallthrough]];
+    case JSONValueType::Number:
+    case JSONValueType::NumberOrString: {
+      const auto fieldDouble = field.getDouble(idx);
+
+      if (fieldDouble) {
+        const auto fieldInt = field.getInt(idx);
 
-  const auto key = std::pair{type_description, group_name};
+        if (fieldInt && static_cast<double>(*fieldInt) == *fieldDouble) {
+          if (iddField.name().find("Number") != std::string::npos) {
+            visitor(*fieldInt);
+            return true;
+          }
+        }
 
-  if (const auto cached = group_names.find(key); cached != group_names.end()) {
-    return cached->second;
+        visitor(*fieldDouble);
+        return true;
+      }
+    }
+      [[fallthrough]];
+    case JSONValueType::Array:
+    case JSONValueType::Object:
+      break;
   }
 
-  const auto cache_result = [&](const auto& name, const bool is_array) -> const auto& {
-    return group_names.emplace(key, std::pair{name, is_array}).first->second;
-  };
+  {
+    const auto fieldString = field.getString(idx);
+    if (fieldString && !fieldString->empty()) {
+      visitor(fixupEnumerationValue(schemaField, *fieldString, iddField.properties().type));
 
-  const auto& objectProperties = getSchemaObjectProperties(schema, type_description);
+      return true;
+    }
+  }
 
-  for (const auto& propertyName : objectProperties.getMemberNames()) {
-    const auto& type = safeLookupValue(objectProperties, propertyName, "type");
-    if (type.isString()) {
-      if (type.asString() == "array") {
-        return cache_result(propertyName, true);
+  return false;
+}
+
+/** Key of the object inside of its type group */
+std::string objectKey(const SchemaObject& schemaObject, const openstudio::IdfObject& obj, std::map<std::string, int>& type_counts) {
+  if (!schemaObject.isFluidPropertiesName) {
+    if (const auto name = obj.name()) {
+      return *name;
+    }
+    if (auto defaultedName = obj.nameString(true); !defaultedName.empty()) {
+      return defaultedName;
+    }
+  }
+  return fmt::format("{} {}", schemaObject.typeDescription, ++type_counts[schemaObject.typeDescription]);
+}
+
+/** Translates the fields of obj, handing them to sink which either builds a Json::Value or writes them out.
+ *  The extensible groups go first, in an array of objects if the schema has one for them */
+template <typename Sink>
+void translateFields(const SchemaObject& schemaObject, const openstudio::IdfObject& obj, Sink& sink) {
+  const auto iddObject = obj.iddObject();
+
+  if (schemaObject.isFluidPropertiesName) {
+    if (const auto name = obj.name()) {
+      sink.value("fluid_name", *name);
+    }
+  }
+
+  const auto groups = obj.extensibleGroups();
+  if (!groups.empty()) {
+    const auto extensibleGroup = iddObject.extensibleGroup();
+
+    if (schemaObject.isArrayGroup) {
+      sink.beginArray(schemaObject.groupName);
+    }
+
+    std::size_t cur_group_number = 0;
+    for (const auto& g : groups) {
+      ++cur_group_number;
+      if (schemaObject.isArrayGroup) {
+        sink.beginArrayItem();
+      }
+
+      for (unsigned int idx = 0; idx < g.numFields(); ++idx) {
+        const auto& iddField = extensibleGroup[idx];
+        const auto fieldIndex = schemaObject.isArrayGroup ? idx : (cur_group_number - 1) * extensibleGroup.size() + idx;
+        OS_ASSERT(fieldIndex < schemaObject.extensibleFields.size());
+        const auto& schemaField = schemaObject.extensibleFields[fieldIndex];
+
+        [[maybe_unused]] const auto fieldAdded =
+          visitField(schemaField, iddField, g, idx, [&sink, &schemaField](const auto& value) { sink.value(schemaField.name, value); });
+      }
+
+      if (schemaObject.isArrayGroup) {
+        sink.endArrayItem();
       }
     }
+
+    if (schemaObject.isArrayGroup) {
+      sink.endArray();
+    }
   }
 
-  // group name is irrelevant if it's not an array group
-  return cache_result("", false);
+  for (unsigned int idx = 0; idx < obj.numFields(); ++idx) {
+    const auto& iddField = iddObject.getField(idx);
+
+    if (iddField->isNameField()) {
+      // skip name, we already got that
+      continue;
+    }
+
+    if (iddObject.isExtensibleField(idx)) {
+      // skip extensible field, we already dealt with that
+      continue;
+    }
+
+    const auto& schemaField = idx < schemaObject.fields.size() ? schemaObject.fields[idx] : unknownSchemaField();
+    visitField(schemaField, iddField.get(), obj, idx, [&sink, &schemaField](const auto& value) { sink.value(schemaField.name, value); });
+  }
 }
 
+/** Sink for translateFields that fills in a Json::Value */
+class JsonValueSink
+{
+ public:
+  explicit JsonValueSink(Json::Value& json_object) : m_json_object(json_object) {}
+
+  void beginArray(const std::string& name) {
+    m_array = &m_json_object[name];
+  }
+
+  void beginArrayItem() {
+    m_item = &m_array->append(Json::Value{Json::objectValue});
+  }
+
+  void endArrayItem() {
+    m_item = nullptr;
+  }
+
+  void endArray() {
+    m_array = nullptr;
+  }
+
+  template <typename T>
+  void value(const std::string& name, const T& value) {
+    (m_item ? *m_item : m_json_object)[name] = value;
+  }
+
+ private:
+  Json::Value& m_json_object;
+  Json::Value* m_array = nullptr;
+  Json::Value* m_item = nullptr;
+};
+
+/** Writes JSON text through a buffer, formatted with one member or element per line */
+class JsonStreamWriter
+{
+ public:
+  explicit JsonStreamWriter(std::ostream& os) : m_os(os) {
+    m_buffer.reserve(BufferSize + 4096);
+  }
+
+  void beginObject() {
+    beginContainer('{');
+  }
+
+  void endObject() {
+    endContainer('}');
+  }
+
+  void beginArray() {
+    beginContainer('[');
+  }
+
+  void endArray() {
+    endContainer(']');
+  }
+
+  void key(std::string_view key) {
+    newElement();
+    writeString(key);
+    m_buffer += ": ";
+    m_afterKey = true;
+  }
+
+  void value(std::string_view value) {
+    newElement();
+    writeString(value);
+  }
+
+  void value(int value) {
+    newElement();
+    fmt::format_to(std::back_inserter(m_buffer), "{}", value);
+  }
+
+  void value(double value) {
+    newElement();
+    if (std::isnan(value)) {
+      m_buffer += "null";
+    } else if (std::isinf(value)) {
+      m_buffer += value < 0 ? "-1e+9999" : "1e+9999";
+    } else {
+      const auto start = m_buffer.size();
+      fmt::format_to(std::back_inserter(m_buffer), "{}", value);
+      // keep it a real number, like Json::Value does
+      if (m_buffer.find_first_of(".eE", start) == std::string::npos) {
+        m_buffer += ".0";
+      }
+    }
+  }
+
+  /** Writes out whatever is buffered, returns false if the stream failed */
+  bool flush() {
+    m_os.write(m_buffer.data(), static_cast<std::streamsize>(m_buffer.size()));
+    m_buffer.clear();
+    return static_cast<bool>(m_os);
+  }
+
+ private:
+  static constexpr std::size_t BufferSize = 1 << 20;
+
+  void beginContainer(char open) {
+    newElement();
+    m_buffer += open;
+    m_empty.push_back(true);
+  }
+
+  void endContainer(char close) {
+    const bool empty = m_empty.back();
+    m_empty.pop_back();
+    if (!empty) {
+      m_buffer += '\n';
+      m_buffer.append(2 * m_empty.size(), ' ');
+    }
+    m_buffer += close;
+    if (m_buffer.size() > BufferSize) {
+      flush();
+    }
+  }
+
+  // comma, new line and indentation before a member or an element, nothing before the value of a member
+  void newElement() {
+    if (m_afterKey) {
+      m_afterKey = false;
+      return;
+    }
+    if (m_empty.empty()) {
+      return;
+    }
+    if (!m_empty.back()) {
+      m_buffer += ',';
+    }
+    m_empty.back() = false;
+    m_buffer += '\n';
+    m_buffer.append(2 * m_empty.size(), ' ');
+  }
+
+  void writeString(std::string_view str) {
+    m_buffer += '"';
+    for (const char c : str) {
+      switch (c) {
+        case '"':
+          m_buffer += "\\\"";
+          break;
+        case '\\':
+          m_buffer += "\\\\";
+          break;
+        case '\b':
+          m_buffer += "\\b";
+          break;
+        case '\f':
+          m_buffer += "\\f";
+          break;
+        case '\n':
+          m_buffer += "\\n";
+          break;
+        case '\r':
+          m_buffer += "\\r";
+          break;
+        case '\t':
+          m_buffer += "\\t";
+          break;
+        default:
+          if (static_cast<unsigned char>(c) < 0x20) {
+            fmt::format_to(std::back_inserter(m_buffer), "\\u{:04x}", static_cast<unsigned>(c));
+          } else {
+            m_buffer += c;
+          }
+      }
+    }
+    m_buffer += '"';
+  }
+
+  std::ostream& m_os;
+  std::string m_buffer;
+  // one entry per open container, true until it gets its first member or element
+  std::vector<bool> m_empty;
+  bool m_afterKey = false;
+};
+
+/** Sink for translateFields that writes to a JsonStreamWriter */
+class JsonStreamSink
+{
+ public:
+  explicit JsonStreamSink(JsonStreamWriter& writer) : m_writer(writer) {}
+
+  void beginArray(const std::string& name) {
+    m_writer.key(name);
+    m_writer.beginArray();
+  }
+
+  void beginArrayItem() {
+    m_writer.beginObject();
+  }
+
+  void endArrayItem() {
+    m_writer.endObject();
+  }
+
+  void endArray() {
+    m_writer.endArray();
+  }
+
+  template <typename T>
+  void value(const std::string& name, const T& value) {
+    m_writer.key(name);
+    m_writer.value(value);
+  }
+
+ private:
+  JsonStreamWriter& m_writer;
+};
+
+/** Reads JSON text from a stream and reports it to a handler as it goes (SAX style), without building a document.
+ *  The handler has startObject(), endObject(), startArray(), endArray(), key(std::string), string(std::string),
+ *  number(std::string) with the number as written, boolean(bool) and null(), each returning false to stop reading. */
+template <typename Handler>
+class JsonEventReader
+{
+ public:
+  JsonEventReader(std::istream& is, Handler& handler) : m_buffer(is.rdbuf()), m_handler(handler) {}
+
+  /** Reads one JSON value, returns false if the text is not valid JSON or the handler stopped */
+  bool parse() {
+    if (!m_buffer) {
+      return error("No input");
+    }
+    if (!parseValue(0)) {
+      return false;
+    }
+    skipWhitespace();
+    if (peek() != EndOfFile) {
+      return error("Unexpected text after the end of the document");
+    }
+    return true;
+  }
+
+ private:
+  using Traits = std::char_traits<char>;
+  static constexpr Traits::int_type EndOfFile = Traits::eof();
+  static constexpr unsigned MaxDepth = 256;
+
+  Traits::int_type peek() {
+    return m_buffer->sgetc();
+  }
+
+  Traits::int_type get() {
+    ++m_offset;
+    return m_buffer->sbumpc();
+  }
+
+  bool error(const std::string& message) {
+    LOG_FREE(LogLevel::Error, "epJSONTranslator", "Invalid JSON at character " << m_offset << ": " << message);
+    return false;
+  }
+
+  void skipWhitespace() {
+    for (auto c = peek(); c == ' ' || c == '\n' || c == '\r' || c == '\t'; c = peek()) {
+      get();
+    }
+  }
+
+  bool parseValue(unsigned depth) {
+    skipWhitespace();
+    switch (peek()) {
+      case '{':
+        return parseObject(depth);
+      case '[':
+        return parseArray(depth);
+      case '"': {
+        std::string value;
+        return parseString(value) && m_handler.string(std::move(value));
+      }
+      case 't':
+        return parseLiteral("true") && m_handler.boolean(true);
+      case 'f':
+        return parseLiteral("false") && m_handler.boolean(false);
+      case 'n':
+        return parseLiteral("null") && m_handler.null();
+      default:
+        return parseNumber();
+    }
+  }
+
+  bool parseObject(unsigned depth) {
+    if (depth >= MaxDepth) {
+      return error("Too deeply nested");
+    }
+    get();
+    if (!m_handler.startObject()) {
+      return false;
+    }
+    skipWhitespace();
+    if (peek() == '}') {
+      get();
+      return m_handler.endObject();
+    }
+    while (true) {
+      skipWhitespace();
+      if (peek() != '"') {
+        return error("Expected a member name");
+      }
+      std::string key;
+      if (!parseString(key) || !m_handler.key(std::move(key))) {
+        return false;
+      }
+      skipWhitespace();
+      if (get() != ':') {
+        return error("Expected ':'");
+      }
+      if (!parseValue(depth + 1)) {
+        return false;
+      }
+      skipWhitespace();
+      const auto c = get();
+      if (c == '}') {
+        return m_handler.endObject();
+      }
+      if (c != ',') {
+        return error("Expected ',' or '}'");
+      }
+    }
+  }
+
+  bool parseArray(unsigned depth) {
+    if (depth >= MaxDepth) {
+      return error("Too deeply nested");
+    }
+    get();
+    if (!m_handler.startArray()) {
+      return false;
+    }
+    skipWhitespace();
+    if (peek() == ']') {
+      get();
+      return m_handler.endArray();
+    }
+    while (true) {
+      if (!parseValue(depth + 1)) {
+        return false;
+      }
+      skipWhitespace();
+      const auto c = get();
+      if (c == ']') {
+        return m_handler.endArray();
+      }
+      if (c != ',') {
+        return error("Expected ',' or ']'");
+      }
+    }
+  }
+
+  bool parseLiteral(std::string_view literal) {
+    for (const char expected : literal) {
+      if (get() != expected) {
+        return error(fmt::format("Expected '{}'", literal));
+      }
+    }
+    return true;
+  }
+
+  bool parseNumber() {
+    std::string text;
+    const auto digits = [this, &text]() {
+      bool any = false;
+      for (auto c = peek(); c >= '0' && c <= '9'; c = peek()) {
+        text += static_cast<char>(get());
+        any = true;
+      }
+      return any;
+    };
+
+    if (peek() == '-') {
+      text += static_cast<char>(get());
+    }
+    if (!digits()) {
+      return error("Expected a value");
+    }
+    if (peek() == '.') {
+      text += static_cast<char>(get());
+      if (!digits()) {
+        return error("Expected digits after '.'");
+      }
+    }
+    if (peek() == 'e' || peek() == 'E') {
+      text += static_cast<char>(get());
+      if (peek() == '+' || peek() == '-') {
+        text += static_cast<char>(get());
+      }
+      if (!digits()) {
+        return error("Expected digits in exponent");
+      }
+    }
+    return m_handler.number(std::move(text));
+  }
+
+  bool parseHex4(unsigned& codeUnit) {
+    codeUnit = 0;
+    for (int i = 0; i < 4; ++i) {
+      const auto c = get();
+      codeUnit <<= 4;
+      if (c >= '0' && c <= '9') {
+        codeUnit += c - '0';
+      } else if (c >= 'a' && c <= 'f') {
+        codeUnit += c - 'a' + 10;
+      } else if (c >= 'A' && c <= 'F') {
+        codeUnit += c - 'A' + 10;
+      } else {
+        return error("Invalid \\u escape");
+      }
+    }
+    return true;
+  }
+
+  static void appendUtf8(std::string& out, unsigned codePoint) {
+    if (codePoint < 0x80) {
+      out += static_cast<char>(codePoint);
+    } else if (codePoint < 0x800) {
+      out += static_cast<char>(0xC0 | (codePoint >> 6));
+      out += static_cast<char>(0x80 | (codePoint & 0x3F));
+    } else if (codePoint < 0x10000) {
+      out += static_cast<char>(0xE0 | (codePoint >> 12));
+      out += static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+      out += static_cast<char>(0x80 | (codePoint & 0x3F));
+    } else {
+      out += static_cast<char>(0xF0 | (codePoint >> 18));
+      out += static_cast<char>(0x80 | ((codePoint >> 12) & 0x3F));
+      out += static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+      out += static_cast<char>(0x80 | (codePoint & 0x3F));
+    }
+  }
+
+  bool parseString(std::string& out) {
+    get();
+    while (true) {
+      const auto c = get();
+      if (c == EndOfFile) {
+        return error("Unterminated string");
+      }
+      if (c == '"') {
+        return true;
+      }
+      if (c != '\\') {
+        out += static_cast<char>(c);
+        continue;
+      }
+      switch (get()) {
+        case '"':
+          out += '"';
+          break;
+        case '\\':
+          out += '\\';
+          break;
+        case '/':
+          out += '/';
+          break;
+        case 'b':
+          out += '\b';
+          break;
+        case 'f':
+          out += '\f';
+          break;
+        case 'n':
+          out += '\n';
+          break;
+        case 'r':
+          out += '\r';
+          break;
+        case 't':
+          out += '\t';
+          break;
+        case 'u': {
+          unsigned codePoint = 0;
+          if (!parseHex4(codePoint)) {
+            return false;
+          }
+          if (codePoint >= 0xD800 && codePoint < 0xDC00) {
+            // high surrogate, must be followed by the low one
+            unsigned low = 0;
+            if (get() != '\\' || get() != 'u' || !parseHex4(low) || low < 0xDC00 || low >= 0xE000) {
+              return error("Invalid surrogate pair");
+            }
+            codePoint = 0x10000 + ((codePoint - 0xD800) << 10) + (low - 0xDC00);
+          }
+          appendUtf8(out, codePoint);
+          break;
+        }
+        default:
+          return error("Invalid escape sequence");
+      }
+    }
+  }
+
+  std::streambuf* m_buffer;
+  Handler& m_handler;
+  std::size_t m_offset = 0;
+};
+
+/** Handler for JsonEventReader that adds each epJSON object to an IdfFile as soon as it has been read:
+ *  { "Type": { "Name": { "field": value, "extensible_group_name": [ { "field": value } ] } } } */
+class IdfFileBuilder
+{
+ public:
+  IdfFileBuilder(const CompiledSchema& schema, openstudio::IdfFile& idfFile) : m_schema(schema), m_idfFile(idfFile) {}
+
+  bool key(std::string key) {
+    m_key = std::move(key);
+    return true;
+  }
+
+  bool startObject() {
+    m_containers.push_back('{');
+    const auto depth = m_containers.size();
+    if (depth == 2) {
+      beginType();
+    } else if (depth == 3 && m_schemaObject) {
+      beginObject();
+    } else if (depth == 5 && m_object && m_inGroupArray) {
+      ++m_groupIndex;
+    }
+    return true;
+  }
+
+  bool endObject() {
+    const auto depth = m_containers.size();
+    if (depth == 3 && m_object) {
+      m_typeObjects.emplace_back(generatedKeyNumber(), *m_object);
+      m_object.reset();
+    } else if (depth == 2 && m_schemaObject) {
+      endType();
+    }
+    m_containers.pop_back();
+    return true;
+  }
+
+  bool startArray() {
+    m_containers.push_back('[');
+    if (m_containers.size() == 4 && m_object) {
+      m_inGroupArray = m_schemaObject->isArrayGroup && (m_key == m_schemaObject->groupName);
+      m_groupIndex = -1;
+      if (!m_inGroupArray) {
+        LOG_FREE(LogLevel::Warn, "epJSONTranslator", "Ignoring unknown array '" << m_key << "' in " << m_schemaObject->typeDescription);
+      }
+    }
+    return true;
+  }
+
+  bool endArray() {
+    if (m_containers.size() == 4) {
+      m_inGroupArray = false;
+    }
+    m_containers.pop_back();
+    return true;
+  }
+
+  bool string(std::string value) {
+    return scalar(value);
+  }
+
+  bool number(std::string value) {
+    return scalar(value);
+  }
+
+  bool boolean(bool value) {
+    LOG_FREE(LogLevel::Warn, "epJSONTranslator", "Ignoring boolean value " << value << " for '" << m_key << "'");
+    return true;
+  }
+
+  bool null() {
+    return true;
+  }
+
+ private:
+  void beginType() {
+    m_schemaObject = nullptr;
+    m_iddObject.reset();
+    m_typeObjects.clear();
+    if (m_key == "Version") {
+      // the IdfFile has its own version object
+      m_readingVersion = true;
+      return;
+    }
+    m_readingVersion = false;
+    m_iddObject = m_idfFile.iddFile().getObject(m_key);
+    if (!m_iddObject) {
+      LOG_FREE(LogLevel::Warn, "epJSONTranslator", "Ignoring objects of unknown type '" << m_key << "'");
+      return;
+    }
+    m_schemaObject = &m_schema.object(*m_iddObject);
+  }
+
+  void endType() {
+    // toJSON numbers objects it cannot key by name in the order they come, keep that order
+    std::stable_sort(m_typeObjects.begin(), m_typeObjects.end(), [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; });
+    for (const auto& [number, object] : m_typeObjects) {
+      m_idfFile.addObject(object);
+    }
+    m_typeObjects.clear();
+    m_schemaObject = nullptr;
+  }
+
+  void beginObject() {
+    m_object = openstudio::IdfObject(*m_iddObject);
+    m_objectKey = m_key;
+    if (m_iddObject->hasNameField() && !m_schemaObject->isFluidPropertiesName) {
+      m_object->setName(m_objectKey);
+    }
+  }
+
+  // N if the object key is the "Type N" toJSON makes up for objects without a name, else 0
+  unsigned generatedKeyNumber() const {
+    const auto& type = m_schemaObject->typeDescription;
+    if (m_objectKey.size() <= type.size() + 1 || m_objectKey.compare(0, type.size(), type) != 0 || m_objectKey[type.size()] != ' ') {
+      return 0;
+    }
+    unsigned result = 0;
+    for (auto it = m_objectKey.begin() + type.size() + 1; it != m_objectKey.end(); ++it) {
+      if (*it < '0' || *it > '9') {
+        return 0;
+      }
+      result = 10 * result + static_cast<unsigned>(*it - '0');
+    }
+    return result;
+  }
+
+  bool scalar(const std::string& value) {
+    const auto depth = m_containers.size();
+    if (m_readingVersion && depth == 3 && m_key == "version_identifier") {
+      const auto version = m_idfFile.version();
+      if (value != fmt::format("{}.{}", version.major(), version.minor())) {
+        LOG_FREE(LogLevel::Warn, "epJSONTranslator", "Translating epJSON version " << value << " with the schema for version " << version.str());
+      }
+    } else if (depth == 3 && m_object) {
+      setField(value);
+    } else if (depth == 5 && m_object && m_inGroupArray) {
+      const auto it = m_schemaObject->extensibleFieldIndices.find(m_key);
+      if (it == m_schemaObject->extensibleFieldIndices.end()) {
+        LOG_FREE(LogLevel::Warn, "epJSONTranslator", "Ignoring unknown field '" << m_key << "' in " << m_schemaObject->typeDescription);
+      } else {
+        setString(m_schemaObject->fields.size() + m_groupIndex * m_schemaObject->extensibleFields.size() + it->second, value);
+      }
+    }
+    return true;
+  }
+
+  void setField(const std::string& value) {
+    // EnergyPlus writes idf_order, idf_max_fields and idf_max_extensible_fields when it converts an IDF, they have no IDF field
+    if (m_key.compare(0, 4, "idf_") == 0) {
+      return;
+    }
+    if (m_schemaObject->isFluidPropertiesName && m_key == "fluid_name") {
+      m_object->setName(value);
+    } else if (const auto it = m_schemaObject->fieldIndices.find(m_key); it != m_schemaObject->fieldIndices.end()) {
+      setString(it->second, value);
+    } else if (const auto ext = m_schemaObject->extensibleFieldIndices.find(m_key);
+               !m_schemaObject->isArrayGroup && ext != m_schemaObject->extensibleFieldIndices.end()) {
+      setString(m_schemaObject->fields.size() + ext->second, value);
+    } else {
+      LOG_FREE(LogLevel::Warn, "epJSONTranslator", "Ignoring unknown field '" << m_key << "' in " << m_schemaObject->typeDescription);
+    }
+  }
+
+  void setString(std::size_t index, const std::string& value) {
+    if (!m_object->setString(static_cast<unsigned>(index), value)) {
+      LOG_FREE(LogLevel::Warn, "epJSONTranslator",
+               "Unable to set '" << m_key << "' to '" << value << "' in " << m_schemaObject->typeDescription << " '" << m_objectKey << "'");
+    }
+  }
+
+  const CompiledSchema& m_schema;
+  openstudio::IdfFile& m_idfFile;
+  // '{' or '[' for each open container, the document itself is the first one
+  std::vector<char> m_containers;
+  std::string m_key;
+  bool m_readingVersion = false;
+  boost::optional<openstudio::IddObject> m_iddObject;
+  const SchemaObject* m_schemaObject = nullptr;
+  // objects of the current type, with generatedKeyNumber
+  std::vector<std::pair<unsigned, openstudio::IdfObject>> m_typeObjects;
+  boost::optional<openstudio::IdfObject> m_object;
+  std::string m_objectKey;
+  bool m_inGroupArray = false;
+  int m_groupIndex = -1;
+};
+
 openstudio::path defaultSchemaPath(openstudio::IddFileType filetype) {
   openstudio::path schemaPath;
   if (filetype == openstudio::IddFileType::EnergyPlus) {
@@ -286,27 +1215,6 @@ Json::Value loadJSON(const openstudio::path& path) {
   return root;
 }
 
-std::string getFieldName(const bool is_array, const IddObject& iddObject, const Json::Value& schema, const std::string& type_description,
-                         const std::size_t group_number, const std::size_t field_number, std::string_view field_name) {
-  if (is_array) {
-    return std::string{field_name};
-  }
-
-  // Legacy IDD field names
-  const auto& fieldNames = getSchemaFieldNames(schema, type_description);
-
-  // use the index of the field inside of the IddObject to look up what its name should be
-  // inside of the epJSON schema
-  //
-  // This is (partially) necessary because OpenStudio treats all groups as extensible.
-  const auto& lookedUpFieldName =
-    fieldNames[static_cast<int>((group_number - 1) * iddObject.extensibleGroup().size() + field_number + iddObject.nonextensibleFields().size())];
-
-  LOG_FREE(LogLevel::Error, "epJSONTranslator", "Unable to look up field name for input field" << field_name)
-  OS_ASSERT(lookedUpFieldName.isString());
-  return lookedUpFieldName.asString();
-}
-
 Json::Value toJSON(const openstudio::IdfFile& idf, const openstudio::path& schemaPath) {
 
   openstudio::path schemaToLoad = schemaPath;
@@ -317,19 +1225,15 @@ Json::Value toJSON(const openstudio::IdfFile& idf, const openstudio::path& schem
     }
   }
 
+  const auto schema = compiledSchema(schemaToLoad);
+  if (!schema) {
+    return Json::Value::null;
+  }
+
   std::map<std::string, int> type_counts;
 
   Json::Value result;
 
-  std::map<std::pair<std::string, std::string>, std::pair<std::string, bool>> group_names;
-  std::map<std::string, std::string> field_names;
-
-  Json::Value schema = loadJSON(schemaToLoad);
-  if (schema.isNull()) {
-    LOG_FREE(LogLevel::Error, "epJSONTranslator", "Schema is invalid at path=" << schemaToLoad);
-    return Json::Value::null;
-  }
-
   result["Version"]["Version 1"]["version_identifier"] = fmt::format("{}.{}", idf.version().major(), idf.version().minor());
 
   for (const auto& obj : idf.objects()) {
@@ -338,141 +1242,140 @@ Json::Value toJSON(const openstudio::IdfFile& idf, const openstudio::path& schem
       continue;
     }
 
-    const auto& type_description = obj.iddObject().type().valueDescription();
-
-    const auto& name = obj.name();
-    const auto& defaultedName = obj.nameString(true);
-
-    auto& json_group = result[type_description];
+    const auto& schemaObject = schema->object(obj.iddObject());
 
-    const bool is_fluid_properties_name = type_description.find("FluidProperties:Name") != std::string::npos;
-
-    const auto& usable_json_object_name = [&]() {
-      if (name && !is_fluid_properties_name) {
-        return *name;
-      } else {
-        if (!defaultedName.empty() && !is_fluid_properties_name) {
-          return defaultedName;
-        } else {
-          return fmt::format("{} {}", type_description, ++type_counts[type_description]);
-        }
-      }
-    }();
-
-    auto& json_object = json_group[usable_json_object_name];
+    auto& json_object = result[schemaObject.typeDescription][objectKey(schemaObject, obj, type_counts)];
     json_object = Json::Value(Json::objectValue);
 
-    if (name && is_fluid_properties_name) {
-      json_object["fluid_name"] = *name;
-    }
-
-    const auto visitField = [&schema, &type_description](auto&& visitor, const openstudio::IddField& iddField, const std::string& group_name,
-                                                         const auto& fieldName, const auto& field, const auto idx) -> bool {
-      const auto jsonFieldType = getSchemaObjectFieldPropertyType(schema, type_description, group_name, fieldName);
+    JsonValueSink sink(json_object);
+    translateFields(schemaObject, obj, sink);
+  }
+  return result;
+}
 
-      switch (jsonFieldType) {
-        case JSONValueType::String: {
-          const auto fieldString = field.getString(idx);
-          if (fieldString && !fieldString->empty()) {
-            visitor(fixupEnumerationValue(schema, *fieldString, type_description, group_name, fieldName, iddField.properties().type));
-            return true;
-          }
-        }
-        case JSONValueType::Number:
-        case JSONValueType::NumberOrString: {
-          const auto fieldDouble = field.getDouble(idx);
-
-          if (fieldDouble) {
-            const auto fieldInt = field.getInt(idx);
-
-            if (fieldInt && static_cast<double>(*fieldInt) == *fieldDouble) {
-              if (iddField.name().find("Number") != std::string::npos) {
-                visitor(*fieldInt);
-                return true;
-              }
-            }
+Json::Value toJSON(const openstudio::Workspace& workspace, const openstudio::path& schemaPath) {
+  return toJSON(workspace.toIdfFile(), schemaPath);
+}
 
-            visitor(*fieldDouble);
-            return true;
-          }
-        }
-        case JSONValueType::Array:
-        case JSONValueType::Object:
-          break;
-      }
+std::string toJSONString(const openstudio::IdfFile& idfFile, const openstudio::path& schemaPath) {
+  return toJSON(idfFile, schemaPath).toStyledString();
+}
 
-      {
-        const auto fieldString = field.getString(idx);
-        if (fieldString && !fieldString->empty()) {
-          visitor(fixupEnumerationValue(schema, *fieldString, type_description, group_name, fieldName, iddField.properties().type));
+std::string toJSONString(const openstudio::Workspace& workspace, const openstudio::path& schemaPath) {
+  return toJSON(workspace, schemaPath).toStyledString();
+}
 
-          return true;
-        }
-      }
+bool writeJSON(const openstudio::Workspace& workspace, std::ostream& os, const openstudio::path& schemaPath) {
 
+  openstudio::path schemaToLoad = schemaPath;
+  if (schemaToLoad.empty()) {
+    schemaToLoad = defaultSchemaPath(workspace.iddFileType());
+    if (schemaToLoad.empty()) {
       return false;
-    };
-
-    std::size_t cur_group_number = 0;
-
-    for (const auto& g : obj.extensibleGroups()) {
-      ++cur_group_number;
-      // get first field and try to make a group name out of it
-      const auto& [group_name, is_array_group] =
-        openstudio::epJSON::getGroupName(group_names, field_names, schema, type_description, obj.iddObject().extensibleGroup()[0].name());
-
-      auto& containing_json = [&json_object, &group_name = group_name, is_array_group = is_array_group ]() -> auto& {
-        if (is_array_group) {
-          auto& array_obj = json_object[group_name];
-          return array_obj.append(Json::Value{Json::objectValue});
-        } else {
-          return json_object;
-        }
-      }
-      ();
-
-      for (unsigned int idx = 0; idx < g.numFields(); ++idx) {
-        const auto& iddField = obj.iddObject().extensibleGroup()[idx];
+    }
+  }
 
-        const auto fieldName = getFieldName(is_array_group, obj.iddObject(), schema, type_description, cur_group_number, idx,
-                                            toJSONFieldName(field_names, iddField.name()));
+  const auto schema = compiledSchema(schemaToLoad);
+  if (!schema) {
+    return false;
+  }
 
-        [[maybe_unused]] const auto fieldAdded = visitField([&containing_json, &fieldName](const auto& value) { containing_json[fieldName] = value; },
-                                                            iddField, group_name, fieldName, g, idx);
-      }
+  // Same order as toJSON: objects keyed by type then by name, the last object wins if a name is repeated
+  const auto objects = workspace.objects(true);
+  std::map<std::string, int> type_counts;
+  std::map<std::string, std::map<std::string, const openstudio::WorkspaceObject*>> keyedObjects;
+  keyedObjects["Version"];
+  for (const auto& obj : objects) {
+    if (obj.iddObject().type().value() == openstudio::IddObjectType::CommentOnly) {
+      continue;
     }
+    const auto& schemaObject = schema->object(obj.iddObject());
+    keyedObjects[schemaObject.typeDescription][objectKey(schemaObject, obj, type_counts)] = &obj;
+  }
 
-    for (unsigned int idx = 0; idx < obj.numFields(); ++idx) {
-      const auto& iddField = obj.iddObject().getField(idx);
+  JsonStreamWriter writer(os);
+  JsonStreamSink sink(writer);
+
+  writer.beginObject();
+  for (const auto& [type_description, objectsByKey] : keyedObjects) {
+    writer.key(type_description);
+    writer.beginObject();
+    if (type_description == "Version") {
+      writer.key("Version 1");
+      writer.beginObject();
+      writer.key("version_identifier");
+      writer.value(fmt::format("{}.{}", workspace.version().major(), workspace.version().minor()));
+      writer.endObject();
+    }
+    for (const auto& [key, obj] : objectsByKey) {
+      writer.key(key);
+      writer.beginObject();
+      translateFields(schema->object(obj->iddObject()), *obj, sink);
+      writer.endObject();
+    }
+    writer.endObject();
+  }
+  writer.endObject();
 
-      const auto& fieldName = toJSONFieldName(field_names, iddField->name());
+  return writer.flush();
+}
 
-      if (iddField->isNameField()) {
-        // skip name, we already got that
-        continue;
-      }
+bool saveJSON(const openstudio::Workspace& workspace, const openstudio::path& path, const openstudio::path& schemaPath) {
+  openstudio::filesystem::ofstream ofs(path, std::ios_base::binary | std::ios_base::trunc);
+  if (!ofs.is_open()) {
+    LOG_FREE(LogLevel::Error, "epJSONTranslator", "Unable to open " << path << " for writing");
+    return false;
+  }
+  const bool result = writeJSON(workspace, ofs, schemaPath) && static_cast<bool>(ofs << '\n');
+  ofs.close();
+  return result;
+}
 
-      if (obj.iddObject().isExtensibleField(idx)) {
-        // skip extensible field, we already dealt with that
-        continue;
-      }
+boost::optional<openstudio::IdfFile> toIdfFile(std::istream& is, const openstudio::path& schemaPath) {
 
-      visitField([&json_object, &fieldName](const auto& value) { json_object[fieldName] = value; }, iddField.get(), "", fieldName, obj, idx);
+  openstudio::path schemaToLoad = schemaPath;
+  if (schemaToLoad.empty()) {
+    schemaToLoad = defaultSchemaPath(openstudio::IddFileType::EnergyPlus);
+    if (schemaToLoad.empty()) {
+      return boost::none;
     }
   }
+
+  const auto schema = compiledSchema(schemaToLoad);
+  if (!schema) {
+    return boost::none;
+  }
+
+  openstudio::IdfFile result(openstudio::IddFileType::EnergyPlus);
+  IdfFileBuilder builder(*schema, result);
+  JsonEventReader<IdfFileBuilder> reader(is, builder);
+  if (!reader.parse()) {
+    return boost::none;
+  }
   return result;
 }
 
-Json::Value toJSON(const openstudio::Workspace& workspace, const openstudio::path& schemaPath) {
-  return toJSON(workspace.toIdfFile(), schemaPath);
+boost::optional<openstudio::IdfFile> loadIdfFile(const openstudio::path& path, const openstudio::path& schemaPath) {
+  openstudio::filesystem::ifstream ifs(path, std::ios_base::binary);
+  if (!ifs.is_open()) {
+    LOG_FREE(LogLevel::Error, "epJSONTranslator", "Unable to open " << path << " for reading");
+    return boost::none;
+  }
+  return toIdfFile(ifs, schemaPath);
 }
 
-std::string toJSONString(const openstudio::IdfFile& idfFile, const openstudio::path& schemaPath) {
-  return toJSON(idfFile, schemaPath).toStyledString();
+boost::optional<openstudio::Workspace> toWorkspace(std::istream& is, const openstudio::path& schemaPath) {
+  if (auto idfFile = toIdfFile(is, schemaPath)) {
+    return openstudio::Workspace(*idfFile);
+  }
+  return boost::none;
 }
 
-std::string toJSONString(const openstudio::Workspace& workspace, const openstudio::path& schemaPath) {
-  return toJSON(workspace, schemaPath).toStyledString();
+boost::optional<openstudio::Workspace> loadWorkspace(const openstudio::path& path, const openstudio::path& schemaPath) {
+  if (auto idfFile = loadIdfFile(path, schemaPath)) {
+    return openstudio::Workspace(*idfFile);
+  }
+  return boost::none;
 }
 
 }  // namespace openstudio::epJSON
@@ -29,11 +29,14 @@
 #ifndef EPJSON_TRANSLATOR_HPP
 #define EPJSON_TRANSLATOR_HPP
 
+#include <iosfwd>
 #include <string>
 #include "epJSONAPI.hpp"
 
 #include "../utilities/core/Filesystem.hpp"
 
+#include <boost/optional.hpp>
+
 namespace Json {
 class Value;
 }
@@ -56,6 +59,24 @@ EPJSON_API std::string toJSONString(const openstudio::IdfFile& inputFile, const
 EPJSON_API Json::Value toJSON(const openstudio::Workspace& workspace, const openstudio::path& schemaPath = openstudio::path());
 EPJSON_API std::string toJSONString(const openstudio::Workspace& workspace, const openstudio::path& schemaPath = openstudio::path());
 
+/** Writes the epJSON translation of workspace to os object by object, without building the Json::Value document.
+ *  The content is the same as toJSON, the schema is compiled once per process. Returns false on failure. */
+EPJSON_API bool writeJSON(const openstudio::Workspace& workspace, std::ostream& os, const openstudio::path& schemaPath = openstudio::path());
+
+/** Saves the epJSON translation of workspace to path, see writeJSON */
+EPJSON_API bool saveJSON(const openstudio::Workspace& workspace, const openstudio::path& path,
+                         const openstudio::path& schemaPath = openstudio::path());
+
+/** Translates the epJSON read from is back to an IdfFile. The text is parsed as a stream of events and objects are added
+ *  type by type as they are read, the document is never held in memory as a whole. Returns none if the JSON is invalid. */
+EPJSON_API boost::optional<openstudio::IdfFile> toIdfFile(std::istream& is, const openstudio::path& schemaPath = openstudio::path());
+EPJSON_API boost::optional<openstudio::IdfFile> loadIdfFile(const openstudio::path& path, const openstudio::path& schemaPath = openstudio::path());
+
+/** Translates the epJSON read from is back to a Workspace, see toIdfFile */
+EPJSON_API boost::optional<openstudio::Workspace> toWorkspace(std::istream& is, const openstudio::path& schemaPath = openstudio::path());
+EPJSON_API boost::optional<openstudio::Workspace> loadWorkspace(const openstudio::path& path,
+                                                                const openstudio::path& schemaPath = openstudio::path());
+
 }  // namespace openstudio::epJSON
 
 #endif
@@ -43,6 +43,7 @@
 
 #include "../../utilities/core/ApplicationPathHelpers.hpp"
 #include "../../utilities/core/PathHelpers.hpp"
+#include "../../utilities/core/StringStreamLogSink.hpp"
 
 #include <utilities/idd/GroundHeatExchanger_ResponseFactors_FieldEnums.hxx>
 #include <utilities/idd/UnitarySystemPerformance_Multispeed_FieldEnums.hxx>
@@ -52,6 +53,7 @@
 #include <json/json.h>
 #include <resources.hxx>
 #include <algorithm>
+#include <sstream>
 
 openstudio::path setupIdftoEPJSONTest(const openstudio::path& location) {
   const auto basename = openstudio::toPath(openstudio::filesystem::basename(location));
@@ -402,6 +404,96 @@ TEST_F(epJSONFixture, canTranslateWorkspaceToJSON) {
   EXPECT_TRUE(str1.size() > 100);
 }
 
+TEST_F(epJSONFixture, writeJSONMatchesToJSON) {
+  auto m = openstudio::model::exampleModel();
+  openstudio::energyplus::ForwardTranslator ft;
+  openstudio::Workspace w = ft.translateModel(m);
+
+  // a name that needs escaping
+  openstudio::WorkspaceObject material = w.addObject(openstudio::IdfObject(openstudio::IddObjectType::Material)).get();
+  material.setName("Quoted \"Material\"\tName");
+
+  std::stringstream ss;
+  ASSERT_TRUE(openstudio::epJSON::writeJSON(w, ss));
+
+  Json::Value streamed;
+  Json::CharReaderBuilder builder;
+  std::string errs;
+  ASSERT_TRUE(Json::parseFromStream(builder, ss, &streamed, &errs)) << errs;
+
+  const auto dom = openstudio::epJSON::toJSON(w);
+  ASSERT_TRUE(dom);
+  EXPECT_TRUE(equal(dom, streamed));
+  EXPECT_EQ(dom.getMemberNames(), streamed.getMemberNames());
+  EXPECT_TRUE(streamed["Material"].isMember("Quoted \"Material\"\tName"));
+
+  // the compiled schema is reused, translating again gives the same result
+  std::stringstream ss2;
+  ASSERT_TRUE(openstudio::epJSON::writeJSON(w, ss2));
+  EXPECT_EQ(ss.str(), ss2.str());
+
+  const auto path = openstudio::filesystem::complete(openstudio::toPath("epjson_tests/writeJSONMatchesToJSON.epJSON"));
+  openstudio::filesystem::create_directories(path.parent_path());
+  ASSERT_TRUE(openstudio::epJSON::saveJSON(w, path));
+  EXPECT_TRUE(equal(dom, openstudio::epJSON::loadJSON(path)));
+}
+
+TEST_F(epJSONFixture, toIdfFileRoundTrip) {
+  auto m = openstudio::model::exampleModel();
+  openstudio::energyplus::ForwardTranslator ft;
+  openstudio::Workspace w = ft.translateModel(m);
+
+  const auto json = openstudio::epJSON::toJSON(w);
+  std::stringstream ss(json.toStyledString());
+  const auto idf = openstudio::epJSON::toIdfFile(ss);
+  ASSERT_TRUE(idf);
+  EXPECT_EQ(w.objects().size(), idf->objects().size());
+  EXPECT_TRUE(equal(json, openstudio::epJSON::toJSON(*idf)));
+
+  // the streamed output reads back the same
+  std::stringstream streamed;
+  ASSERT_TRUE(openstudio::epJSON::writeJSON(w, streamed));
+  const auto w2 = openstudio::epJSON::toWorkspace(streamed);
+  ASSERT_TRUE(w2);
+  EXPECT_EQ(w.objects().size(), w2->objects().size());
+  EXPECT_TRUE(equal(json, openstudio::epJSON::toJSON(*w2)));
+
+  const auto location = completeIDFPath("RefBldgMediumOfficeNew2004_Chicago.idf");
+  const auto refIdf = openstudio::IdfFile::load(location);
+  ASSERT_TRUE(refIdf);
+  const auto refJson = openstudio::epJSON::toJSON(*refIdf);
+  std::stringstream refSs(refJson.toStyledString());
+  const auto refRoundTrip = openstudio::epJSON::toIdfFile(refSs);
+  ASSERT_TRUE(refRoundTrip);
+  EXPECT_TRUE(equal(refJson, openstudio::epJSON::toJSON(*refRoundTrip)));
+}
+
+TEST_F(epJSONFixture, toIdfFileInvalidJSON) {
+  for (const std::string text : {"", "{", R"({"Zone": {"Zone 1": {"x_origin": 1.0,}}})", R"({"Zone": []} extra)", R"({"Zone": {"Zone 1": tru}})"}) {
+    std::stringstream ss(text);
+    EXPECT_FALSE(openstudio::epJSON::toIdfFile(ss)) << text;
+  }
+
+  openstudio::StringStreamLogSink sink;
+  sink.setLogLevel(openstudio::Warn);
+  sink.setChannelRegex(boost::regex("epJSONTranslator"));
+
+  // the idf_* keys EnergyPlus adds when converting an IDF are skipped without a warning
+  std::stringstream ss(R"({"Zone": {"Zone \u00e9\ud83d\ude00": {"idf_max_extensible_fields": 0, "idf_max_fields": 3, "idf_order": 1,)"
+                       R"( "x_origin": -1.5e1, "unknown_field": "x"}}, "NotAType": {"A": {}}})");
+  const auto idf = openstudio::epJSON::toIdfFile(ss);
+  ASSERT_TRUE(idf);
+  const auto messages = sink.logMessages();
+  ASSERT_EQ(2u, messages.size());
+  EXPECT_EQ("Ignoring unknown field 'unknown_field' in Zone", messages[0].logMessage());
+  EXPECT_EQ("Ignoring objects of unknown type 'NotAType'", messages[1].logMessage());
+  const auto zones = idf->getObjectsByType(openstudio::IddObjectType::Zone);
+  ASSERT_EQ(1u, zones.size());
+  EXPECT_EQ("Zone \xC3\xA9\xF0\x9F\x98\x80", zones[0].nameString());
+  ASSERT_TRUE(zones[0].getDouble(2));
+  EXPECT_EQ(-15.0, zones[0].getDouble(2).get());
+}
+
 TEST_F(epJSONFixture, CustomCases) {
 
   // Test for #4264, part 1
@@ -0,0 +1,102 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2021, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+
+#include "../utilities/idd/IddFile.hpp"
+#include "../utilities/core/Filesystem.hpp"
+
+#include <boost/program_options.hpp>
+
+#include <iostream>
+#include <exception>
+
+/** GenerateIddSnapshots converts IDD text files into the binary snapshot format read by
+ *  IddFile::loadSnapshot, so that these files can be embedded and loaded at run time without
+ *  any text parsing. Arguments are pairs of input IDD path and output snapshot path. */
+int main(int argc, char* argv[]) {
+  try {
+    boost::program_options::options_description opts("Options", 100);
+    opts.add_options()("help,h", "prints help message")(
+      "file,f", boost::program_options::value<std::vector<std::string>>(),
+      "input IDD path followed by output snapshot path; ex. OpenStudio.idd OpenStudio.iddsnap");
+    boost::program_options::positional_options_description posOpts;
+    posOpts.add("file", -1);
+
+    boost::program_options::variables_map vm;
+    boost::program_options::store(boost::program_options::command_line_parser(argc, argv).options(opts).positional(posOpts).run(), vm);
+    boost::program_options::notify(vm);
+
+    if (vm.count("help") || !vm.count("file")) {
+      std::cout << opts;
+      std::cout << "At least one pair of input IDD and output snapshot paths is required." << '\n';
+      return vm.count("help") ? 0 : 1;
+    }
+
+    std::vector<std::string> files = vm["file"].as<std::vector<std::string>>();
+    if (files.size() % 2 != 0) {
+      std::cout << "Expected pairs of input IDD and output snapshot paths, but got an odd number of paths." << '\n';
+      return 1;
+    }
+
+    for (unsigned i = 0, n = files.size(); i < n; i += 2) {
+      openstudio::path inPath = openstudio::toPath(files[i]);
+      openstudio::path outPath = openstudio::toPath(files[i + 1]);
+
+      openstudio::filesystem::ifstream inFile(inPath);
+      if (!inFile) {
+        std::cout << "Unable to open IDD file " << inPath.string() << "." << '\n';
+        return 1;
+      }
+      boost::optional<openstudio::IddFile> iddFile = openstudio::IddFile::load(inFile);
+      if (!iddFile) {
+        std::cout << "Unable to parse IDD file " << inPath.string() << "." << '\n';
+        return 1;
+      }
+
+      if (outPath.has_parent_path()) {
+        openstudio::filesystem::create_directories(outPath.parent_path());
+      }
+      openstudio::filesystem::ofstream outFile(outPath, std::ios_base::binary);
+      if (!outFile) {
+        std::cout << "Unable to open snapshot file " << outPath.string() << " for writing." << '\n';
+        return 1;
+      }
+      iddFile->saveSnapshot(outFile);
+      outFile.close();
+
+      std::cout << "Wrote snapshot of " << inPath.string() << " (" << iddFile->objects().size() << " objects) to " << outPath.string() << "."
+                << '\n';
+    }
+
+  } catch (std::exception& e) {
+    std::cout << e.what() << '\n';
+    return 1;
+  }
+  return 0;
+}
@@ -110,108 +110,196 @@ namespace isomodel {
     vectorInit(vec, 1);
   }
 
+  namespace {
+    /// sizes result to match size without preserving its contents, so that a preallocated result is reused
+    void fit(Vector& result, size_t size) {
+      if (result.size() != size) {
+        result.resize(size, false);
+      }
+    }
+  }  // namespace
+
   /// array-scalar product
-  Vector mult(const double* v1, const double s1, int size) {
-    Vector vp = Vector(size);
+  void mult(const double* v1, const double s1, int size, Vector& result) {
+    fit(result, size);
     for (int i = 0; i < size; i++) {
-      vp[i] = v1[i] * s1;
+      result[i] = v1[i] * s1;
     }
-    return vp;
   }
   /// vector-scalar product
-  Vector mult(const Vector& v1, const double s1) {
-    Vector vp = Vector(v1.size());
+  void mult(const Vector& v1, const double s1, Vector& result) {
+    fit(result, v1.size());
     for (size_t i = 0; i < v1.size(); i++) {
-      vp[i] = v1[i] * s1;
+      result[i] = v1[i] * s1;
     }
-    return vp;
   }
   /// vector-array product
-  Vector mult(const Vector& v1, const double* v2) {
-    Vector vp = Vector(v1.size());
+  void mult(const Vector& v1, const double* v2, Vector& result) {
+    fit(result, v1.size());
     for (size_t i = 0; i < v1.size(); i++) {
-      vp[i] = v1[i] * v2[i];
+      result[i] = v1[i] * v2[i];
     }
-    return vp;
   }
   /// vector-vector product
-  Vector mult(const Vector& v1, const Vector& v2) {
+  void mult(const Vector& v1, const Vector& v2, Vector& result) {
     assert(v1.size() == v2.size());
-    Vector vp = Vector(v1.size());
+    fit(result, v1.size());
     for (size_t i = 0; i < v1.size(); i++) {
-      vp[i] = v1[i] * v2[i];
+      result[i] = v1[i] * v2[i];
     }
-    return vp;
   }
   ///Vector-scalar division
-  Vector div(const Vector& v1, const double s1) {
-    Vector vp = Vector(v1.size());
+  void div(const Vector& v1, const double s1, Vector& result) {
+    fit(result, v1.size());
     for (size_t i = 0; i < v1.size(); i++) {
       if (s1 == 0)
-        vp[i] = std::numeric_limits<double>::max();
+        result[i] = std::numeric_limits<double>::max();
       else
-        vp[i] = v1[i] / s1;
+        result[i] = v1[i] / s1;
     }
-    return vp;
   }
-  Vector div(const double s1, const Vector& v1) {
-    Vector vp = Vector(v1.size());
+  void div(const double s1, const Vector& v1, Vector& result) {
+    fit(result, v1.size());
     for (size_t i = 0; i < v1.size(); i++) {
       if (v1[i] == 0)
-        vp[i] = std::numeric_limits<double>::max();
+        result[i] = std::numeric_limits<double>::max();
       else
-        vp[i] = s1 / v1[i];
+        result[i] = s1 / v1[i];
     }
-    return vp;
   }
   ///vector-vector division
-  Vector div(const Vector& v1, const Vector& v2) {
+  void div(const Vector& v1, const Vector& v2, Vector& result) {
     assert(v1.size() == v2.size());
-    Vector vp = Vector(v1.size());
+    fit(result, v1.size());
     for (size_t i = 0; i < v1.size(); i++) {
       if (v2[i] == 0)
-        vp[i] = std::numeric_limits<double>::max();
+        result[i] = std::numeric_limits<double>::max();
       else
-        vp[i] = v1[i] / v2[i];
+        result[i] = v1[i] / v2[i];
     }
-    return vp;
   }
-  Vector sum(const Vector& v1, const Vector& v2) {
+  void sum(const Vector& v1, const Vector& v2, Vector& result) {
     assert(v1.size() == v2.size());
-
-    Vector vs = Vector(v1.size());
+    fit(result, v1.size());
     for (size_t i = 0; i < v1.size(); i++) {
-      vs[i] = v1[i] + v2[i];
+      result[i] = v1[i] + v2[i];
     }
-    return vs;
   }
-  Vector sum(const Vector& v1, const double v2) {
-    Vector vs = Vector(v1.size());
+  void sum(const Vector& v1, const double v2, Vector& result) {
+    fit(result, v1.size());
     for (size_t i = 0; i < v1.size(); i++) {
-      vs[i] = v1[i] + v2;
+      result[i] = v1[i] + v2;
     }
-    return vs;
   }
-  Vector dif(const Vector& v1, const Vector& v2) {
+  void dif(const Vector& v1, const Vector& v2, Vector& result) {
     assert(v1.size() == v2.size());
-    Vector vd = Vector(v1.size());
+    fit(result, v1.size());
     for (size_t i = 0; i < v1.size(); i++) {
-      vd[i] = v1[i] - v2[i];
+      result[i] = v1[i] - v2[i];
     }
-    return vd;
   }
-  Vector dif(const Vector& v1, const double v2) {
-    Vector vd = Vector(v1.size());
+  void dif(const Vector& v1, const double v2, Vector& result) {
+    fit(result, v1.size());
     for (size_t i = 0; i < v1.size(); i++) {
-      vd[i] = v1[i] - v2;
+      result[i] = v1[i] - v2;
     }
-    return vd;
   }
-  Vector dif(const double v1, const Vector& v2) {
-    Vector vd = Vector(v2.size());
+  void dif(const double v1, const Vector& v2, Vector& result) {
+    fit(result, v2.size());
     for (size_t i = 0; i < v2.size(); i++) {
-      vd[i] = v1 - v2[i];
+      result[i] = v1 - v2[i];
+    }
+  }
+  void maximum(const Vector& v1, const Vector& v2, Vector& result) {
+    assert(v1.size() == v2.size());
+    fit(result, v1.size());
+    for (size_t i = 0; i < v1.size(); i++) {
+      result[i] = std::max(v1[i], v2[i]);
+    }
+  }
+  void maximum(const Vector& v1, double val, Vector& result) {
+    fit(result, v1.size());
+    for (size_t i = 0; i < v1.size(); i++) {
+      result[i] = std::max(v1[i], val);
     }
+  }
+  void minimum(const Vector& v1, double val, Vector& result) {
+    fit(result, v1.size());
+    for (size_t i = 0; i < v1.size(); i++) {
+      result[i] = std::min(v1[i], val);
+    }
+  }
+  void abs(const Vector& v1, Vector& result) {
+    fit(result, v1.size());
+    for (size_t i = 0; i < v1.size(); i++) {
+      result[i] = ::fabs(v1[i]);
+    }
+  }
+  void pow(const Vector& v1, const double xp, Vector& result) {
+    fit(result, v1.size());
+    for (size_t i = 0; i < v1.size(); i++) {
+      result[i] = std::pow(v1[i], xp);
+    }
+  }
+
+  Vector mult(const double* v1, const double s1, int size) {
+    Vector vp;
+    mult(v1, s1, size, vp);
+    return vp;
+  }
+  Vector mult(const Vector& v1, const double s1) {
+    Vector vp;
+    mult(v1, s1, vp);
+    return vp;
+  }
+  Vector mult(const Vector& v1, const double* v2) {
+    Vector vp;
+    mult(v1, v2, vp);
+    return vp;
+  }
+  Vector mult(const Vector& v1, const Vector& v2) {
+    Vector vp;
+    mult(v1, v2, vp);
+    return vp;
+  }
+  Vector div(const Vector& v1, const double s1) {
+    Vector vp;
+    div(v1, s1, vp);
+    return vp;
+  }
+  Vector div(const double s1, const Vector& v1) {
+    Vector vp;
+    div(s1, v1, vp);
+    return vp;
+  }
+  Vector div(const Vector& v1, const Vector& v2) {
+    Vector vp;
+    div(v1, v2, vp);
+    return vp;
+  }
+  Vector sum(const Vector& v1, const Vector& v2) {
+    Vector vs;
+    sum(v1, v2, vs);
+    return vs;
+  }
+  Vector sum(const Vector& v1, const double v2) {
+    Vector vs;
+    sum(v1, v2, vs);
+    return vs;
+  }
+  Vector dif(const Vector& v1, const Vector& v2) {
+    Vector vd;
+    dif(v1, v2, vd);
+    return vd;
+  }
+  Vector dif(const Vector& v1, const double v2) {
+    Vector vd;
+    dif(v1, v2, vd);
+    return vd;
+  }
+  Vector dif(const double v1, const Vector& v2) {
+    Vector vd;
+    dif(v1, v2, vd);
     return vd;
   }
   double maximum(const Vector& v1) {
@@ -222,18 +310,13 @@ namespace isomodel {
     return max;
   }
   Vector maximum(const Vector& v1, const Vector& v2) {
-    assert(v1.size() == v2.size());
-    Vector vx = Vector(v1.size());
-    for (size_t i = 0; i < v1.size(); i++) {
-      vx[i] = std::max(v1[i], v2[i]);
-    }
+    Vector vx;
+    maximum(v1, v2, vx);
     return vx;
   }
   Vector maximum(const Vector& v1, double val) {
-    Vector vx = Vector(v1.size());
-    for (size_t i = 0; i < v1.size(); i++) {
-      vx[i] = std::max(v1[i], val);
-    }
+    Vector vx;
+    maximum(v1, val, vx);
     return vx;
   }
   double minimum(const Vector& v1) {
@@ -244,24 +327,18 @@ namespace isomodel {
     return min;
   }
   Vector minimum(const Vector& v1, double val) {
-    Vector vn = Vector(v1.size());
-    for (size_t i = 0; i < v1.size(); i++) {
-      vn[i] = std::min(v1[i], val);
-    }
+    Vector vn;
+    minimum(v1, val, vn);
     return vn;
   }
   Vector abs(const Vector& v1) {
-    Vector va = Vector(v1.size());
-    for (size_t i = 0; i < v1.size(); i++) {
-      va[i] = ::fabs(v1[i]);
-    }
+    Vector va;
+    abs(v1, va);
     return va;
   }
   Vector pow(const Vector& v1, const double xp) {
-    Vector va = Vector(v1.size());
-    for (size_t i = 0; i < v1.size(); i++) {
-      va[i] = std::pow(v1[i], xp);
-    }
+    Vector va;
+    pow(v1, xp, va);
     return va;
   }
 
@@ -335,8 +412,8 @@ namespace isomodel {
                                          const Vector& clockHourOccupied, const Vector& clockHourUnoccupied, Vector& v_hrs_sun_down_mo,
                                          Vector& frac_Pgh_wk_nt, Vector& frac_Pgh_wke_day, Vector& frac_Pgh_wke_nt, Vector& v_Tdbt_nt) const {
 
-    Matrix m_mhEgh = location->weather()->mhEgh();
-    Matrix m_mhdbt = location->weather()->mhdbt();
+    const Matrix& m_mhEgh = location->weather()->mhEgh();
+    const Matrix& m_mhdbt = location->weather()->mhdbt();
 
     // TODO: unreadVariable
     // Vector v_Tdbt_Day = prod(m_mhdbt, clockHourOccupied);
@@ -367,7 +444,10 @@ v_Egh_nt=(M_mhEgh*v_nt_hrs_yesno)./sum(v_nt_hrs_yesno);  %monthly avg Egh during
     Vector v_Wgh_wk_nt = mult(v_Egh_nt, weekdayUnoccupiedMegaseconds);
     Vector v_Wgh_wke_day = mult(v_Egh_day, weekendOccupiedMegaseconds);
     Vector v_Wgh_wke_nt = mult(v_Egh_nt, weekendUnoccupiedMegaseconds);
-    Vector v_Wgh_tot = sum(sum(v_Wgh_wk_day, v_Wgh_wk_nt), sum(v_Wgh_wke_day, v_Wgh_wke_nt));
+    Vector v_Wgh_tot = sum(v_Wgh_wk_day, v_Wgh_wk_nt);
+    // v_Wgh_wk_day is only needed for the total, so it holds the weekend part of the sum
+    sum(v_Wgh_wke_day, v_Wgh_wke_nt, v_Wgh_wk_day);
+    sum(v_Wgh_tot, v_Wgh_wk_day, v_Wgh_tot);
     /**
 v_Wgh_wk_day=v_Egh_day.*v_Msec_wk_day; % monthly avg Egh energy (Wgh) during the week days
 v_Wgh_wk_nt=v_Egh_nt.*v_Msec_wk_nt;  %monthly avg Wgh during week nights
@@ -375,9 +455,9 @@ v_Wgh_wke_day=v_Egh_day.*v_Msec_wke_day; %monthly avg Wgh during weekend days
 v_Wgh_wke_nt=v_Egh_nt.*v_Msec_wke_nt; %monthly avg Wgh during weekend nights
 v_Wgh_tot=v_Wgh_wk_day+v_Wgh_wk_nt+v_Wgh_wke_day+v_Wgh_wke_nt; %Egh_avg_total MJ/m2
 */
-    frac_Pgh_wk_nt = div(v_Wgh_wk_nt, v_Wgh_tot);
-    frac_Pgh_wke_day = div(v_Wgh_wke_day, v_Wgh_tot);
-    frac_Pgh_wke_nt = div(v_Wgh_wke_nt, v_Wgh_tot);
+    div(v_Wgh_wk_nt, v_Wgh_tot, frac_Pgh_wk_nt);
+    div(v_Wgh_wke_day, v_Wgh_tot, frac_Pgh_wke_day);
+    div(v_Wgh_wke_nt, v_Wgh_tot, frac_Pgh_wke_nt);
     /**
 
 %FRAC_PGH_DAYTIME=v_Wgh_wk_day./v_Wgh_tot; %frac_Egh_occ
@@ -500,8 +580,8 @@ Q_illum_occ=In.cond_flr_area*lpd_occ*F_C*F_O*(t_lt_D*F_D + t_lt_N)/1000;  % find
     double t_unocc = hoursInYear - t_lt_D - t_lt_N;
     Q_illum_unocc = structure->floorArea() * lpd_unocc * t_unocc / 1000.0;
     Q_illum_tot_yr = Q_illum_occ + Q_illum_unocc;
-    v_Q_illum_tot = mult(monthFractionOfYear, Q_illum_tot_yr, 12);
-    v_Q_illum_ext_tot = mult(v_hrs_sun_down_mo, lights->exteriorEnergy() / 1000.0);
+    mult(monthFractionOfYear, Q_illum_tot_yr, 12, v_Q_illum_tot);
+    mult(v_hrs_sun_down_mo, lights->exteriorEnergy() / 1000.0, v_Q_illum_ext_tot);
     /*
  t_unocc=hrs_ina_yr - t_lt_D - t_lt_N;  % find the number of unoccupied lighting hours in the year
  Q_illum_unocc = In.cond_flr_area*lpd_unocc*t_unocc/1000;  % find the total annual lighting energy for unoccupied times in kWh
@@ -520,9 +600,11 @@ v_Q_illum_ext_tot=v_hrs_sun_down_mo*In.E_lt_ext/1000;  %etotal exterior monthly
     v_wall_A = structure->wallArea();
     v_win_A = structure->windowArea();
     v_wall_U = structure->wallUniform();
-    Vector v_win_U = structure->windowUniform();
+    const Vector& v_win_U = structure->windowUniform();
 
-    Vector v_env_UA = sum(mult(v_wall_A, v_wall_U), mult(v_win_A, v_win_U));
+    Vector v_env_UA = mult(v_wall_A, v_wall_U);
+    Vector v_win_UA = mult(v_win_A, v_win_U);
+    sum(v_env_UA, v_win_UA, v_env_UA);
     double H_D = sum(v_env_UA);
     /*
   %% compute envelope parameters as per ISO 13790 8.3
@@ -623,11 +705,13 @@ v_win_SDF_frac=ones(size(v_win_SDF)); % SDF fraction to include in HX; Fixed at
 
 v_win_F_shgl = v_win_SDF.*v_win_SDF_frac;
 */
-    Vector v_g_gln = structure->windowNormalIncidenceSolarEnergyTransmittance();
+    const Vector& v_g_gln = structure->windowNormalIncidenceSolarEnergyTransmittance();
     double n_win_F_W = 0.9;
     Vector v_g_gl = mult(v_g_gln, n_win_F_W);
 
-    v_win_A_sol = mult(mult(mult(v_win_F_shgl, v_g_gl), v_win_ff), v_win_A);
+    mult(v_win_F_shgl, v_g_gl, v_win_A_sol);
+    mult(v_win_A_sol, v_win_ff, v_win_A_sol);
+    mult(v_win_A_sol, v_win_A, v_win_A_sol);
 
 #ifdef DEBUG_ISO_MODEL_SIMULATION
     printVector("v_g_gln", v_g_gln);
@@ -651,12 +735,14 @@ v_win_A_sol=v_win_F_shgl.*v_g_gl.*(1-v_win_ff).*v_win_A;
 
     // double n_v_env_form_factors[]={0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 1};
     double n_R_sc_ext = 0.04;
-    v_wall_R_sc = Vector(vsize);
+    v_wall_R_sc.resize(vsize, false);
     for (int i = 0; i < vsize; i++) {
       v_wall_R_sc[i] = n_R_sc_ext;
     }
-    v_win_hr = mult(v_wall_emiss, 5.0);
-    v_wall_A_sol = mult(mult(mult(v_wall_alpha_sc, v_wall_R_sc), v_wall_U), v_wall_A);
+    mult(v_wall_emiss, 5.0, v_win_hr);
+    mult(v_wall_alpha_sc, v_wall_R_sc, v_wall_A_sol);
+    mult(v_wall_A_sol, v_wall_U, v_wall_A_sol);
+    mult(v_wall_A_sol, v_wall_A, v_wall_A_sol);
     /*
 n_v_env_form_factors=[0.5 0.5 0.5 0.5 0.5 0.5 0.5 0.5 1]; %formfactor_to_sky.  Walls are all 0.5, roof is 1.0
 n_R_sc_ext=0.04;  % vertical wall external convection surface heat resistance as per ISO 6946
@@ -751,7 +837,10 @@ end
     }
     double n_v_env_form_factors[] = {0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 0.5, 1};
 
-    Vector v_wall_phi_r = mult(mult(mult(mult(v_wall_R_sc, v_wall_U), v_wall_A), v_win_hr), theta_er);
+    Vector v_wall_phi_r = mult(v_wall_R_sc, v_wall_U);
+    mult(v_wall_phi_r, v_wall_A, v_wall_phi_r);
+    mult(v_wall_phi_r, v_win_hr, v_wall_phi_r);
+    mult(v_wall_phi_r, theta_er, v_wall_phi_r);
     Vector v_wall_phi_sol(12);
     for (size_t i = 0; i < v_win_phi_sol.size(); i++) {
       for (size_t j = 0; j < temp.size(); j++) {
@@ -763,9 +852,9 @@ end
     printVector("v_wall_phi_r", v_wall_phi_r);
     printVector("v_win_phi_sol", v_win_phi_sol);
     printVector("v_wall_phi_sol", v_wall_phi_sol);
-    Vector v_phi_sol = sum(v_win_phi_sol, v_wall_phi_sol);
-    printVector("v_phi_sol", v_phi_sol);
-    v_E_sol = mult(v_phi_sol, megasecondsInMonth);
+    sum(v_win_phi_sol, v_wall_phi_sol, v_E_sol);
+    printVector("v_phi_sol", v_E_sol);
+    mult(v_E_sol, megasecondsInMonth, v_E_sol);
     /*
 theta_er=ones(size(1,9))*11;  % average difference between air temp and sky temp = 11K as per 11.4.6
 
@@ -871,16 +960,20 @@ phi_I_tot = phi_I_occ + phi_I_app + phi_I_lt;
     printVector("v_W_int_wk_nt", v_W_int_wk_nt);
     printVector("v_W_int_wke_day", v_W_int_wke_day);
     printVector("v_W_int_wke_nt", v_W_int_wke_nt);
-    Vector v_W_sol_wk_nt = mult(v_E_sol, frac_Pgh_wk_nt);
-    Vector v_W_sol_wke_day = mult(v_E_sol, frac_Pgh_wke_day);
-    Vector v_W_sol_wke_nt = mult(v_E_sol, frac_Pgh_wke_nt);
-    printVector("v_W_sol_wk_nt", v_W_sol_wk_nt);
-    printVector("v_W_sol_wke_day", v_W_sol_wke_day);
-    printVector("v_W_sol_wke_nt", v_W_sol_wke_nt);
-
-    v_P_tot_wk_nt = div(sum(v_W_int_wk_nt, v_W_sol_wk_nt), weekdayUnoccupiedMegaseconds);
-    v_P_tot_wke_day = div(sum(v_W_int_wke_day, v_W_sol_wke_day), weekendOccupiedMegaseconds);
-    v_P_tot_wke_nt = div(sum(v_W_int_wke_nt, v_W_sol_wke_nt), weekendUnoccupiedMegaseconds);
+
+    // the solar gains are computed in place in the outputs before the internal gains are added
+    mult(v_E_sol, frac_Pgh_wk_nt, v_P_tot_wk_nt);
+    printVector("v_W_sol_wk_nt", v_P_tot_wk_nt);
+    sum(v_W_int_wk_nt, v_P_tot_wk_nt, v_P_tot_wk_nt);
+    div(v_P_tot_wk_nt, weekdayUnoccupiedMegaseconds, v_P_tot_wk_nt);
+    mult(v_E_sol, frac_Pgh_wke_day, v_P_tot_wke_day);
+    printVector("v_W_sol_wke_day", v_P_tot_wke_day);
+    sum(v_W_int_wke_day, v_P_tot_wke_day, v_P_tot_wke_day);
+    div(v_P_tot_wke_day, weekendOccupiedMegaseconds, v_P_tot_wke_day);
+    mult(v_E_sol, frac_Pgh_wke_nt, v_P_tot_wke_nt);
+    printVector("v_W_sol_wke_nt", v_P_tot_wke_nt);
+    sum(v_W_int_wke_nt, v_P_tot_wke_nt, v_P_tot_wke_nt);
+    div(v_P_tot_wke_nt, weekendUnoccupiedMegaseconds, v_P_tot_wke_nt);
     /*
   %% Unoccupied time heat gains in MJ
 v_W_int_wk_nt=In.cond_flr_area.*phi_int_wk_nt.*v_Msec_wk_nt;  %internal heat gain for "week" "night"
@@ -1238,8 +1331,17 @@ if T_cl_ctrl_flag ==1  % if the HVAC cooling controls are on
     */
     }
 
-    Vector v_Th_wk_avg = sum(sum(mult(v_Th_wk_day, frac_hrs_wk_day), mult(v_Th_wk_nt, frac_hrs_wk_nt)), mult(v_Th_wke_avg, frac_hrs_wke_tot));
-    Vector v_Tc_wk_avg = sum(sum(mult(v_Tc_wk_day, frac_hrs_wk_day), mult(v_Tc_wk_nt, frac_hrs_wk_nt)), mult(v_Tc_wke_avg, frac_hrs_wke_tot));
+    Vector v_T_part(12);
+    Vector v_Th_wk_avg = mult(v_Th_wk_day, frac_hrs_wk_day);
+    mult(v_Th_wk_nt, frac_hrs_wk_nt, v_T_part);
+    sum(v_Th_wk_avg, v_T_part, v_Th_wk_avg);
+    mult(v_Th_wke_avg, frac_hrs_wke_tot, v_T_part);
+    sum(v_Th_wk_avg, v_T_part, v_Th_wk_avg);
+    Vector v_Tc_wk_avg = mult(v_Tc_wk_day, frac_hrs_wk_day);
+    mult(v_Tc_wk_nt, frac_hrs_wk_nt, v_T_part);
+    sum(v_Tc_wk_avg, v_T_part, v_Tc_wk_avg);
+    mult(v_Tc_wke_avg, frac_hrs_wke_tot, v_T_part);
+    sum(v_Tc_wk_avg, v_T_part, v_Tc_wk_avg);
 
     //v_Th_avg(v_Th_wk_avg);
     //v_Tc_avg(v_Tc_wk_avg);
@@ -1321,29 +1423,30 @@ tot_env_A=sum(In.wall_area)+sum(In.win_area);
     double h_stack = n_zone_frac * vent_zone_height;
     double n_stack_exp = 0.667;  //% reset the pressure exponent to 0.667 for this part of the calc
     double n_stack_coeff = 0.0146;
-    Vector dbtDiff = dif(location->weather()->mdbt(), v_Th_avg);
-    printVector("dbtDiff", dbtDiff);
-    Vector dbtDiffAbs = abs(dbtDiff);
-    printVector("dbtDiffAbs", dbtDiffAbs);
-    Vector dbtHStack = mult(dbtDiffAbs, h_stack);
-    printVector("dbtHstack", dbtHStack);
-    Vector dbtPowered = pow(dbtHStack, n_stack_exp);
-    printVector("dbtPowered", dbtPowered);
-    Vector dbtMultQ4 = mult(dbtPowered, n_stack_coeff * v_Q4pa);
-    printVector("dbtMultQ4", dbtMultQ4);
-
-    Vector v_qv_stack_ht = maximum(dbtMultQ4, 0.001);  //%qv_stack_heating m3/h/m2
-    dbtDiff = dif(location->weather()->mdbt(), v_Tc_avg);
-    printVector("dbtDiff", dbtDiff);
-    dbtDiffAbs = abs(dbtDiff);
-    printVector("dbtDiffAbs", dbtDiffAbs);
-    dbtHStack = mult(dbtDiffAbs, h_stack);
-    printVector("dbtHstack", dbtHStack);
-    dbtPowered = pow(dbtHStack, n_stack_exp);
-    printVector("dbtPowered", dbtPowered);
-    dbtMultQ4 = mult(dbtPowered, n_stack_coeff * v_Q4pa);
-    printVector("dbtMultQ4", dbtMultQ4);
-    Vector v_qv_stack_cl = maximum(dbtMultQ4, 0.001);  //%qv_stack_cooling
+    // each step of the stack flow calculation is done in place in dbtStack
+    Vector dbtStack = dif(location->weather()->mdbt(), v_Th_avg);
+    printVector("dbtDiff", dbtStack);
+    abs(dbtStack, dbtStack);
+    printVector("dbtDiffAbs", dbtStack);
+    mult(dbtStack, h_stack, dbtStack);
+    printVector("dbtHstack", dbtStack);
+    pow(dbtStack, n_stack_exp, dbtStack);
+    printVector("dbtPowered", dbtStack);
+    mult(dbtStack, n_stack_coeff * v_Q4pa, dbtStack);
+    printVector("dbtMultQ4", dbtStack);
+
+    Vector v_qv_stack_ht = maximum(dbtStack, 0.001);  //%qv_stack_heating m3/h/m2
+    dif(location->weather()->mdbt(), v_Tc_avg, dbtStack);
+    printVector("dbtDiff", dbtStack);
+    abs(dbtStack, dbtStack);
+    printVector("dbtDiffAbs", dbtStack);
+    mult(dbtStack, h_stack, dbtStack);
+    printVector("dbtHstack", dbtStack);
+    pow(dbtStack, n_stack_exp, dbtStack);
+    printVector("dbtPowered", dbtStack);
+    mult(dbtStack, n_stack_coeff * v_Q4pa, dbtStack);
+    printVector("dbtMultQ4", dbtStack);
+    Vector v_qv_stack_cl = maximum(dbtStack, 0.001);  //%qv_stack_cooling
     printVector("v_qv_stack_ht", v_qv_stack_ht);
     printVector("v_qv_stack_cl", v_qv_stack_cl);
 
@@ -1371,32 +1474,40 @@ v_qv_stack_cl=max(n_stack_coeff.*v_Q4pa*(h_stack.*abs(W.mdbt-v_Tc_avg)).^n_stack
     double n_wind_coeff = 0.0769;
     double n_dCp = 0.75;  // % conventional value for cp difference between windward and leeward sides for low rise buildings as per 15242
 
-    Vector v_qv_wind_ht =
-      mult(mult(pow(mult(mult(location->weather()->mwind(), location->weather()->mwind()), n_dCp * location->terrain()), n_wind_exp), v_Q4pa),
-           n_wind_coeff);  // % qv_wind_heating
-    Vector v_qv_wind_cl =
-      mult(mult(pow(mult(mult(location->weather()->mwind(), location->weather()->mwind()), n_dCp * location->terrain()), n_wind_exp), v_Q4pa),
-           n_wind_coeff);  // % qv_wind_cooling
+    Vector v_qv_wind_ht = mult(location->weather()->mwind(), location->weather()->mwind());
+    mult(v_qv_wind_ht, n_dCp * location->terrain(), v_qv_wind_ht);
+    pow(v_qv_wind_ht, n_wind_exp, v_qv_wind_ht);
+    mult(v_qv_wind_ht, v_Q4pa, v_qv_wind_ht);
+    mult(v_qv_wind_ht, n_wind_coeff, v_qv_wind_ht);  // % qv_wind_heating
+    const Vector& v_qv_wind_cl = v_qv_wind_ht;       // % qv_wind_cooling
 
     printVector("v_qv_wind_ht", v_qv_wind_ht);
     printVector("v_qv_wind_cl", v_qv_wind_cl);
 
     double n_sw_coeff = 0.14;
-    Vector v_qv_ht_max = maximum(v_qv_stack_ht, v_qv_wind_ht);
-    Vector v_qv_cl_max = maximum(v_qv_stack_cl, v_qv_wind_cl);
-    printVector("v_qv_ht_max", v_qv_ht_max);
-    printVector("v_qv_cl_max", v_qv_cl_max);
-
-    Vector v_qv_sw_ht = sum(v_qv_ht_max, div(mult(mult(v_qv_stack_ht, v_qv_wind_ht), n_sw_coeff), v_Q4pa));  // %qv_sw_heat m3/h/m2
-    Vector v_qv_sw_cl = sum(v_qv_cl_max, div(mult(mult(v_qv_stack_cl, v_qv_wind_cl), n_sw_coeff), v_Q4pa));  // %qv_sw_cool m3/h/m2
+    // one scratch vector holds the heating and then the cooling maximum
+    Vector v_qv_max = maximum(v_qv_stack_ht, v_qv_wind_ht);
+    printVector("v_qv_ht_max", v_qv_max);
+
+    Vector v_qv_sw_ht = mult(v_qv_stack_ht, v_qv_wind_ht);
+    mult(v_qv_sw_ht, n_sw_coeff, v_qv_sw_ht);
+    div(v_qv_sw_ht, v_Q4pa, v_qv_sw_ht);
+    sum(v_qv_max, v_qv_sw_ht, v_qv_sw_ht);  // %qv_sw_heat m3/h/m2
+    maximum(v_qv_stack_cl, v_qv_wind_cl, v_qv_max);
+    printVector("v_qv_cl_max", v_qv_max);
+    Vector v_qv_sw_cl = mult(v_qv_stack_cl, v_qv_wind_cl);
+    mult(v_qv_sw_cl, n_sw_coeff, v_qv_sw_cl);
+    div(v_qv_sw_cl, v_Q4pa, v_qv_sw_cl);
+    sum(v_qv_max, v_qv_sw_cl, v_qv_sw_cl);  // %qv_sw_cool m3/h/m2
 
     printVector("v_qv_sw_ht", v_qv_sw_ht);
     printVector("v_qv_sw_cl", v_qv_sw_cl);
 
-    Vector v_qv_inf_ht = sum(v_qv_sw_ht, std::max(0.0, -qv_diff));  // %q_inf_heat m3/h/m2
-    Vector v_qv_inf_cl = sum(v_qv_sw_cl, std::max(0.0, -qv_diff));  // %q_inf_cool m3/h/m2
-    printVector("v_qv_inf_ht", v_qv_inf_ht);
-    printVector("v_qv_inf_cl", v_qv_inf_cl);
+    // infiltration and then the total air flow are accumulated in place in the v_qv_sw_* vectors
+    sum(v_qv_sw_ht, std::max(0.0, -qv_diff), v_qv_sw_ht);  // %q_inf_heat m3/h/m2
+    sum(v_qv_sw_cl, std::max(0.0, -qv_diff), v_qv_sw_cl);  // %q_inf_cool m3/h/m2
+    printVector("v_qv_inf_ht", v_qv_sw_ht);
+    printVector("v_qv_inf_cl", v_qv_sw_cl);
 
     /*
 % calculate infiltration from wind
@@ -1454,20 +1565,22 @@ else
 end
 */
     double initVal = ventilation->type() == 3 ? 0 : (vent_op_frac * qv_supp * vent_outdoor_frac * (1 - vent_ht_recov));
-    Vector v_qv_mve_ht(12);
-    Vector v_qv_mve_cl(12);
-    for (size_t i = 0; i < v_qv_mve_ht.size(); i++) {
-      v_qv_mve_cl[i] = v_qv_mve_ht[i] = initVal;
+    // the mechanical ventilation rate is the same when heating and cooling
+    Vector v_qv_mve(12);
+    for (size_t i = 0; i < v_qv_mve.size(); i++) {
+      v_qv_mve[i] = initVal;
     }
-    Vector v_qve_ht = sum(v_qv_inf_ht, v_qv_mve_ht);
-    Vector v_qve_cl = sum(v_qv_inf_cl, v_qv_mve_cl);
-    printVector("v_qve_ht", v_qve_ht);
-    printVector("v_qve_cl", v_qve_cl);
+    sum(v_qv_sw_ht, v_qv_mve, v_qv_sw_ht);
+    sum(v_qv_sw_cl, v_qv_mve, v_qv_sw_cl);
+    printVector("v_qve_ht", v_qv_sw_ht);
+    printVector("v_qve_cl", v_qv_sw_cl);
 
     double n_rhoc_air = 1200;
 
-    v_Hve_ht = div(mult(v_qve_ht, n_rhoc_air), 3600.0);
-    v_Hve_cl = div(mult(v_qve_cl, n_rhoc_air), 3600.0);
+    mult(v_qv_sw_ht, n_rhoc_air, v_Hve_ht);
+    div(v_Hve_ht, 3600.0, v_Hve_ht);
+    mult(v_qv_sw_cl, n_rhoc_air, v_Hve_cl);
+    div(v_Hve_cl, 3600.0, v_Hve_cl);
     /*
 if In.vent_type==3
     v_qv_mve_ht=zeros(12,1); %qv_me_heating for calc
@@ -1495,16 +1608,21 @@ v_Hve_cl = n_rhoc_air*v_qve_cl/3600; % Hve (W/K/m2)  cooling
   void SimModel::heatingAndCooling(const Vector& v_E_sol, const Vector& v_Th_avg, const Vector& v_Hve_ht, const Vector& v_Tc_avg,
                                    const Vector& v_Hve_cl, double tau, double H_tr, double phi_I_tot, double frac_hrs_wk_day, Vector& v_Qfan_tot,
                                    Vector& v_Qneed_ht, Vector& v_Qneed_cl, double& Qneed_ht_yr, double& Qneed_cl_yr) const {
-    Vector temp = mult(megasecondsInMonth, phi_I_tot, 12);
-    Vector v_tot_mo_ht_gain = sum(temp, v_E_sol);
+    Vector v_tot_mo_ht_gain = mult(megasecondsInMonth, phi_I_tot, 12);
+    sum(v_tot_mo_ht_gain, v_E_sol, v_tot_mo_ht_gain);
 
     double a_H0 = 1;
     double tau_H0 = 15;
     double a_H = a_H0 + tau / tau_H0;
 
-    Vector v_QT_ht = mult(mult(dif(v_Th_avg, location->weather()->mdbt()), megasecondsInMonth), H_tr);
-    Vector v_QV_ht = mult(mult(mult(v_Hve_ht, structure->floorArea()), dif(v_Th_avg, location->weather()->mdbt())), megasecondsInMonth);
-    Vector v_Qtot_ht = sum(v_QT_ht, v_QV_ht);
+    Vector v_dT = dif(v_Th_avg, location->weather()->mdbt());
+    // v_Qtot_ht starts out as the transmission loss QT and v_QV is reused for cooling
+    Vector v_Qtot_ht = mult(v_dT, megasecondsInMonth);
+    mult(v_Qtot_ht, H_tr, v_Qtot_ht);
+    Vector v_QV = mult(v_Hve_ht, structure->floorArea());
+    mult(v_QV, v_dT, v_QV);
+    mult(v_QV, megasecondsInMonth, v_QV);
+    sum(v_Qtot_ht, v_QV, v_Qtot_ht);
     /*
   %% Heating and Cooling Needs
 
@@ -1523,13 +1641,15 @@ v_QT_ht = H_tr.*(v_Th_avg-v_mdbt).*v_Msec_ina_mo;  %QT = transmission loss (MJ)
 v_QV_ht = v_Hve_ht*In.cond_flr_area.*(v_Th_avg-v_mdbt).*v_Msec_ina_mo; % QV in MJ
 v_Qtot_ht = v_QT_ht+v_QV_ht ; %QL_total total heat loss in MJ
 */
-    Vector v_gamma_H_ht = div(v_tot_mo_ht_gain, sum(v_Qtot_ht, std::numeric_limits<double>::min()));
+    Vector v_gamma_H_ht = sum(v_Qtot_ht, std::numeric_limits<double>::min());
+    div(v_tot_mo_ht_gain, v_gamma_H_ht, v_gamma_H_ht);
     Vector v_eta_g_H(12);
     for (size_t i = 0; i < v_eta_g_H.size(); i++) {
       v_eta_g_H[i] = v_gamma_H_ht(i) > 0 ? (1 - std::pow(v_gamma_H_ht[i], a_H)) / (1 - std::pow(v_gamma_H_ht[i], (a_H + 1)))
                                          : 1 / (v_gamma_H_ht(i) + std::numeric_limits<double>::min());
     }
-    v_Qneed_ht = dif(v_Qtot_ht, mult(v_eta_g_H, v_tot_mo_ht_gain));
+    mult(v_eta_g_H, v_tot_mo_ht_gain, v_Qneed_ht);
+    dif(v_Qtot_ht, v_Qneed_ht, v_Qneed_ht);
     Qneed_ht_yr = sum(v_Qneed_ht);
 
     /*
@@ -1551,12 +1671,16 @@ v_Qneed_ht = v_Qtot_ht - v_eta_g_H.*v_tot_mo_ht_gain; %QNH = QL,H - eta_G_H.*Q_G
 Qneed_ht_yr = sum(v_Qneed_ht);
    */
 
-    Vector v_QT_cl = mult(mult(dif(v_Tc_avg, location->weather()->mdbt()), H_tr), megasecondsInMonth);  // % QT for cooling in MJ
-    Vector v_QV_cl =
-      mult(mult(mult(v_Hve_cl, structure->floorArea()), dif(v_Tc_avg, location->weather()->mdbt())), megasecondsInMonth);  // % QT for coolin in MJ
-    Vector v_Qtot_cl = sum(v_QT_cl, v_QV_cl);  // % QL = QT + QV for cooling = total cooling heat loss in MJ
+    dif(v_Tc_avg, location->weather()->mdbt(), v_dT);
+    Vector v_Qtot_cl = mult(v_dT, H_tr);
+    mult(v_Qtot_cl, megasecondsInMonth, v_Qtot_cl);  // % QT for cooling in MJ
+    mult(v_Hve_cl, structure->floorArea(), v_QV);
+    mult(v_QV, v_dT, v_QV);
+    mult(v_QV, megasecondsInMonth, v_QV);  // % QT for coolin in MJ
+    sum(v_Qtot_cl, v_QV, v_Qtot_cl);       // % QL = QT + QV for cooling = total cooling heat loss in MJ
 
-    Vector v_gamma_H_cl = div(v_Qtot_cl, sum(v_tot_mo_ht_gain, std::numeric_limits<double>::min()));  //  %gamma_C = heat loss ratio Qloss/Qgain
+    Vector v_gamma_H_cl = sum(v_tot_mo_ht_gain, std::numeric_limits<double>::min());
+    div(v_Qtot_cl, v_gamma_H_cl, v_gamma_H_cl);  //  %gamma_C = heat loss ratio Qloss/Qgain
 
     //% compute the cooling gain utilization factor eta_g_cl
     Vector v_eta_g_CL(12);
@@ -1571,7 +1695,8 @@ Qneed_ht_yr = sum(v_Qneed_ht);
       v_eta_g_CL[i] = v_gamma_H_cl(i) > 0.0 ? (1.0 - std::pow(v_gamma_H_cl[i], a_H)) / (1.0 - std::pow(v_gamma_H_cl[i], (a_H + 1.0))) : 1.0;
     }
 
-    v_Qneed_cl = dif(v_tot_mo_ht_gain, mult(v_eta_g_CL, v_Qtot_cl));  // % QNC = Q_G_C - eta*Q_L_C = total cooling need
+    mult(v_eta_g_CL, v_Qtot_cl, v_Qneed_cl);
+    dif(v_tot_mo_ht_gain, v_Qneed_cl, v_Qneed_cl);  // % QNC = Q_G_C - eta*Q_L_C = total cooling need
     Qneed_cl_yr = sum(v_Qneed_cl);
     /*
 % n_a_C0 = 1; %a_C_0 building cooling reference constant
@@ -1613,19 +1738,28 @@ T_sup_cl = In.cl_tset_occ-n_dT_supp_cl;  %cool air supply temp - assume 7C lower
 n_rhoC_a = 1.22521.*0.001012; % rho*Cp for air (MJ/m3/K)
 */
 
-    Vector v_Vair_ht = div(v_Qneed_ht, sum(mult(dif(T_sup_ht, v_Th_avg), n_rhoC_a), std::numeric_limits<double>::min()));
-    Vector v_Vair_cl = div(v_Qneed_cl, sum(mult(dif(v_Tc_avg, T_sup_cl), n_rhoC_a), std::numeric_limits<double>::min()));
+    Vector v_Vair_ht = dif(T_sup_ht, v_Th_avg);
+    mult(v_Vair_ht, n_rhoC_a, v_Vair_ht);
+    sum(v_Vair_ht, std::numeric_limits<double>::min(), v_Vair_ht);
+    div(v_Qneed_ht, v_Vair_ht, v_Vair_ht);
+    Vector v_Vair_cl = dif(v_Tc_avg, T_sup_cl);
+    mult(v_Vair_cl, n_rhoC_a, v_Vair_cl);
+    sum(v_Vair_cl, std::numeric_limits<double>::min(), v_Vair_cl);
+    div(v_Qneed_cl, v_Vair_cl, v_Vair_cl);
     ventilation->fanPower();
     ventilation->fanControlFactor();
     structure->floorArea();
     printVector("v_Vair_ht", v_Vair_ht);
     printVector("v_Vair_cl", v_Vair_cl);
 
-    Vector v_Vair_tot = maximum(sum(v_Vair_ht, v_Vair_cl),
-                                div(mult(megasecondsInMonth, ventilation->supplyRate() * frac_hrs_wk_day, 12), 1000));  //% compute air flow in m3
-    printVector("v_Vair_tot", v_Vair_tot);
-    Vector fanPower = mult(v_Vair_tot, ventilation->fanPower() * ventilation->fanControlFactor());
-    printVector("fanPower", fanPower);
+    Vector v_Vair_min = mult(megasecondsInMonth, ventilation->supplyRate() * frac_hrs_wk_day, 12);
+    div(v_Vair_min, 1000, v_Vair_min);
+    // the total air flow is accumulated in v_Vair_ht and the fan power is computed in place in v_Qfan_tot
+    sum(v_Vair_ht, v_Vair_cl, v_Vair_ht);
+    maximum(v_Vair_ht, v_Vair_min, v_Vair_ht);  //% compute air flow in m3
+    printVector("v_Vair_tot", v_Vair_ht);
+    mult(v_Vair_ht, ventilation->fanPower() * ventilation->fanControlFactor(), v_Qfan_tot);
+    printVector("fanPower", v_Qfan_tot);
 
 #ifdef DEBUG_ISO_MODEL_SIMULATION
     LOG(Trace, "ventilation->fanPower() = " << ventilation->fanPower());
@@ -1633,7 +1767,8 @@ n_rhoC_a = 1.22521.*0.001012; % rho*Cp for air (MJ/m3/K)
     LOG(Trace, "structure->floorArea() = " << structure->floorArea());
 #endif
 
-    v_Qfan_tot = div(div(fanPower, structure->floorArea()), 3600);  //% compute fan energy in kWh/m2
+    div(v_Qfan_tot, structure->floorArea(), v_Qfan_tot);
+    div(v_Qfan_tot, 3600, v_Qfan_tot);  //% compute fan energy in kWh/m2
 
     /*
 v_Vair_ht = v_Qneed_ht./(n_rhoC_a.*(T_sup_ht -v_Th_avg)+eps);  %compute volume of air moved for heating
@@ -1696,8 +1831,10 @@ a_cl_loss=In.cool_loss_factor;
     double eta_dist_ht = 1.0 / (1.0 + a_ht_loss + f_waste / f_dem_ht);  //% overall distribution efficiency for heating
     double eta_dist_cl = 1.0 / (1.0 + a_cl_loss + f_waste / f_dem_cl);  //%overall distrubtion efficiency for cooling
 
-    Vector v_Qloss_ht_dist = div(mult(v_Qneed_ht, (1 - eta_dist_ht)), eta_dist_ht);
-    Vector v_Qloss_cl_dist = div(mult(v_Qneed_cl, (1 - eta_dist_cl)), eta_dist_cl);
+    Vector v_Qloss_ht_dist = mult(v_Qneed_ht, (1 - eta_dist_ht));
+    div(v_Qloss_ht_dist, eta_dist_ht, v_Qloss_ht_dist);
+    Vector v_Qloss_cl_dist = mult(v_Qneed_cl, (1 - eta_dist_cl));
+    div(v_Qloss_cl_dist, eta_dist_cl, v_Qloss_cl_dist);
     printVector("v_Qloss_ht_dist", v_Qloss_ht_dist);
     printVector("v_Qloss_cl_dist", v_Qloss_cl_dist);
     /*
@@ -1720,17 +1857,19 @@ v_Qloss_cl_dist = v_Qneed_cl*(1-eta_dist_cl)/eta_dist_cl;  %losses from HVAC coo
     // TODO: always true right now
     // cppcheck-suppress knownConditionTrueFalse
     if (DH_YesNo == 1) {
-      v_Qht_DH = sum(v_Qneed_ht, v_Qloss_ht_dist);
+      sum(v_Qneed_ht, v_Qloss_ht_dist, v_Qht_DH);
     } else {
-      v_Qht_sys = div(sum(v_Qloss_ht_dist, v_Qneed_ht), heating->efficiency() + std::numeric_limits<double>::min());
+      sum(v_Qloss_ht_dist, v_Qneed_ht, v_Qht_sys);
+      div(v_Qht_sys, heating->efficiency() + std::numeric_limits<double>::min(), v_Qht_sys);
     }
 
     // TODO: always true right now
     // cppcheck-suppress knownConditionTrueFalse
     if (DC_YesNo == 1) {
-      v_Qcool_DC = sum(v_Qneed_cl, v_Qloss_cl_dist);
+      sum(v_Qneed_cl, v_Qloss_cl_dist, v_Qcool_DC);
     } else {
-      v_Qcl_sys = div(sum(v_Qloss_cl_dist, v_Qneed_cl), IEER + std::numeric_limits<double>::min());
+      sum(v_Qloss_cl_dist, v_Qneed_cl, v_Qcl_sys);
+      div(v_Qcl_sys, IEER + std::numeric_limits<double>::min(), v_Qcl_sys);
     }
     printVector("v_Qht_sys", v_Qht_sys);
     printVector("v_Qht_DH", v_Qht_DH);
@@ -1755,28 +1894,30 @@ end
 
 
 */
-    Vector v_Qcl_DC_elec = div(mult(v_Qcool_DC, 1 - n_eta_DC_frac_abs), n_eta_DC_COP * n_eta_DC_network);
-    Vector v_Qcl_DC_abs = div(mult(v_Qcool_DC, 1 - n_frac_DC_free), n_eta_DC_COP_abs);
-    printVector("v_Qcl_DC_elec", v_Qcl_DC_elec);
-    printVector("v_Qcl_DC_abs", v_Qcl_DC_abs);
-
+    // the district cooling energies are computed in place in the cooling outputs
+    mult(v_Qcool_DC, 1 - n_eta_DC_frac_abs, v_Qcl_elec_tot);
+    div(v_Qcl_elec_tot, n_eta_DC_COP * n_eta_DC_network, v_Qcl_elec_tot);
+    mult(v_Qcool_DC, 1 - n_frac_DC_free, v_Qcl_gas_tot);
+    div(v_Qcl_gas_tot, n_eta_DC_COP_abs, v_Qcl_gas_tot);
+    printVector("v_Qcl_DC_elec", v_Qcl_elec_tot);
+    printVector("v_Qcl_DC_abs", v_Qcl_gas_tot);
+
+    // v_Qht_DH holds the total district heating energy from here on
     // cppcheck-suppress invalidFunctionArg
-    Vector v_Qht_DH_total = div(mult(v_Qht_DH, 1 - n_frac_DH_free), n_eta_DH_sys * n_eta_DH_network);
-    v_Qcl_elec_tot = sum(v_Qcl_sys, v_Qcl_DC_elec);
-    v_Qcl_gas_tot = v_Qcl_DC_abs;
-    printVector("v_Qht_DH_total", v_Qht_DH_total);
+    mult(v_Qht_DH, 1 - n_frac_DH_free, v_Qht_DH);
+    div(v_Qht_DH, n_eta_DH_sys * n_eta_DH_network, v_Qht_DH);
+    sum(v_Qcl_sys, v_Qcl_elec_tot, v_Qcl_elec_tot);
+    printVector("v_Qht_DH_total", v_Qht_DH);
     printVector("v_Qcl_elec_tot", v_Qcl_elec_tot);
     printVector("v_Qcl_gas_tot", v_Qcl_gas_tot);
 
-    //Vector v_Qelec_ht,v_Qgas_ht;
-
     if (heating->energyType() == 1) {
-      v_Qelec_ht = v_Qht_sys;
-      v_Qgas_ht = v_Qht_DH_total;
+      v_Qelec_ht.swap(v_Qht_sys);
+      v_Qgas_ht.swap(v_Qht_DH);
     } else {
-      v_Qelec_ht = Vector(12);
+      v_Qelec_ht.resize(12, false);
       zero(v_Qelec_ht);
-      v_Qgas_ht = sum(v_Qht_sys, v_Qht_DH_total);
+      sum(v_Qht_sys, v_Qht_DH, v_Qgas_ht);
     }
     printVector("v_Qelec_ht", v_Qelec_ht);
     printVector("v_Qgas_ht", v_Qgas_ht);
@@ -1816,10 +1957,13 @@ v_Qcl_gas_tot = v_Qcl_DC_abs; % total gas cooliing energy
     Vector v_Q_pumps = mult(megasecondsInMonth, n_E_pumps, 12);
     double Q_pumps_yr = sum(v_Q_pumps);
 
-    Vector v_frac_ht_mode = div(v_Qneed_ht, sum(v_Qneed_ht, v_Qneed_cl));
-    double frac_ht_total = sum(v_frac_ht_mode);
+    Vector v_Qneed_tot = sum(v_Qneed_ht, v_Qneed_cl);
+    // v_Q_pumps_ht starts out as the heating mode fraction
+    Vector v_Q_pumps_ht = div(v_Qneed_ht, v_Qneed_tot);
+    double frac_ht_total = sum(v_Q_pumps_ht);
     double Q_pumps_ht = Q_pumps_yr * heating->pumpControlReduction() * structure->floorArea();
-    Vector v_Q_pumps_ht = div(mult(v_frac_ht_mode, Q_pumps_ht), frac_ht_total);
+    mult(v_Q_pumps_ht, Q_pumps_ht, v_Q_pumps_ht);
+    div(v_Q_pumps_ht, frac_ht_total, v_Q_pumps_ht);
     /*
        n_E_pumps = 0.25;  % specific power of systems pumps + control systems in W/m2
        v_Q_pumps=n_E_pumps*v_Msec_ina_mo;  % energy per month for pumps + control if running continuously in MJ/m2/mo
@@ -1836,10 +1980,12 @@ v_Qcl_gas_tot = v_Qcl_DC_abs; % total gas cooliing energy
        %v_Q_pump_mo=Q_pumps_yr*In.pump_heat_ctrl_factor*In.cond_flr_area.*v_frac_ht_mode;
 
 */
-    Vector v_frac_cl_mode = div(v_Qneed_cl, sum(v_Qneed_ht, v_Qneed_cl));
-    double frac_cl_total = sum(v_frac_cl_mode);
+    // v_Q_pumps_cl starts out as the cooling mode fraction
+    Vector v_Q_pumps_cl = div(v_Qneed_cl, v_Qneed_tot);
+    double frac_cl_total = sum(v_Q_pumps_cl);
     double Q_pumps_cl = Q_pumps_yr * cooling->pumpControlReduction() * structure->floorArea();
-    Vector v_Q_pumps_cl = div(mult(v_frac_cl_mode, Q_pumps_cl), frac_cl_total);
+    mult(v_Q_pumps_cl, Q_pumps_cl, v_Q_pumps_cl);
+    div(v_Q_pumps_cl, frac_cl_total, v_Q_pumps_cl);
 
     /*
        v_frac_cl_mode = v_Qneed_cl./(v_Qneed_ht+v_Qneed_cl);% fraction of time system is in cooling mode
@@ -1850,13 +1996,16 @@ v_Qcl_gas_tot = v_Qcl_DC_abs; % total gas cooliing energy
        %v_frac_pump_cl = v_Qneed_cl./(v_Qneed_ht+v_Qneed_cl);% cooling pump operation factor
 
 */
-    Vector v_frac_tot = div(sum(v_Qneed_ht, v_Qneed_cl), Qneed_ht_yr + Qneed_cl_yr);
+    // v_Qneed_tot is not needed after this, so the total pump operational factor reuses it
+    Vector& v_frac_tot = v_Qneed_tot;
+    div(v_Qneed_tot, Qneed_ht_yr + Qneed_cl_yr, v_frac_tot);
     double frac_total = sum(v_frac_tot);
     double Q_pumps_tot = Q_pumps_ht + Q_pumps_cl;
     if (Q_pumps_ht == 0 || Q_pumps_cl == 0) {
-      v_Q_pump_tot = sum(v_Q_pumps_ht, v_Q_pumps_cl);
+      sum(v_Q_pumps_ht, v_Q_pumps_cl, v_Q_pump_tot);
     } else {
-      v_Q_pump_tot = div(mult(v_frac_tot, Q_pumps_tot), frac_total);
+      mult(v_frac_tot, Q_pumps_tot, v_Q_pump_tot);
+      div(v_Q_pump_tot, frac_total, v_Q_pump_tot);
     }
     /*
        v_frac_tot = (v_Qneed_ht+v_Qneed_cl)/(Qneed_ht_yr+Qneed_cl_yr); % total pump operational factor
@@ -1914,26 +2063,28 @@ Q_dhw_yr = In.DHW_demand*(n_dhw_tset-n_dhw_tsupply).*n_CP_h20; % total annual en
 
 
 */
-    Vector v_MonthlyDemand = mult(daysInMonth, Q_dhw_yr, 12);
-    Vector v_frac_MonthlyDemand_yr = div(v_MonthlyDemand, daysInYear);
-    Vector v_Qe_demand = div(v_frac_MonthlyDemand_yr, heating->hotWaterDistributionEfficiency());
-    Vector v_Q_dhw_demand = div(v_Qe_demand, kWh2MJ);
-    Vector v_Q_dhw_need = maximum(div(dif(v_Q_dhw_demand, v_Q_dhw_solar), heating->hotWaterSystemEfficiency()), 0);
-    Vector Z(v_Q_dhw_need.size());
-    printVector("v_MonthlyDemand", v_MonthlyDemand);
-    printVector("v_frac_MonthlyDemand_yr", v_frac_MonthlyDemand_yr);
-    printVector("v_Qe_demand", v_Qe_demand);
-    printVector("v_Q_dhw_demand", v_Q_dhw_demand);
+    // each step from the monthly demand to the supply need is done in place in v_Q_dhw_need
+    Vector v_Q_dhw_need = mult(daysInMonth, Q_dhw_yr, 12);
+    printVector("v_MonthlyDemand", v_Q_dhw_need);
+    div(v_Q_dhw_need, daysInYear, v_Q_dhw_need);
+    printVector("v_frac_MonthlyDemand_yr", v_Q_dhw_need);
+    div(v_Q_dhw_need, heating->hotWaterDistributionEfficiency(), v_Q_dhw_need);
+    printVector("v_Qe_demand", v_Q_dhw_need);
+    div(v_Q_dhw_need, kWh2MJ, v_Q_dhw_need);
+    printVector("v_Q_dhw_demand", v_Q_dhw_need);
+    dif(v_Q_dhw_need, v_Q_dhw_solar, v_Q_dhw_need);
+    div(v_Q_dhw_need, heating->hotWaterSystemEfficiency(), v_Q_dhw_need);
+    maximum(v_Q_dhw_need, 0, v_Q_dhw_need);
     printVector("v_Q_dhw_need", v_Q_dhw_need);
-    zero(Z);
-    printVector("Z", Z);
 
     if (heating->hotWaterEnergyType() == 1) {
-      v_Q_dhw_elec = v_Q_dhw_need;
-      v_Q_dhw_gas = Z;
+      v_Q_dhw_elec.swap(v_Q_dhw_need);
+      v_Q_dhw_gas.resize(12, false);
+      zero(v_Q_dhw_gas);
     } else {
-      v_Q_dhw_gas = v_Q_dhw_need;
-      v_Q_dhw_elec = Z;
+      v_Q_dhw_gas.swap(v_Q_dhw_need);
+      v_Q_dhw_elec.resize(12, false);
+      zero(v_Q_dhw_elec);
     }
     printVector("v_Q_dhw_gas", v_Q_dhw_gas);
     printVector("v_Q_dhw_elec", v_Q_dhw_elec);
@@ -2201,8 +2352,10 @@ end
     double E_plug_gas =
       building->gasApplianceHeatGainOccupied() * frac_hrs_wk_day + building->gasApplianceHeatGainUnoccupied() * (1.0 - frac_hrs_wk_day);
 
-    Vector v_Q_plug_elec = div(mult(hoursInMonth, E_plug_elec, 12), 1000.0);
-    Vector v_Q_plug_gas = div(mult(hoursInMonth, E_plug_gas, 12), 1000.0);
+    Vector v_Q_plug_elec = mult(hoursInMonth, E_plug_elec, 12);
+    div(v_Q_plug_elec, 1000.0, v_Q_plug_elec);
+    Vector v_Q_plug_gas = mult(hoursInMonth, E_plug_gas, 12);
+    div(v_Q_plug_gas, 1000.0, v_Q_plug_gas);
     printVector("v_Q_plug_elec", v_Q_plug_elec);
     printVector("v_Q_plug_gas", v_Q_plug_gas);
 
@@ -2216,13 +2369,16 @@ v_Q_plug_elec = E_plug_elec*v_hrs_ina_mo/1000; % Electric plugload kWh/m2
 v_Q_plug_gas = E_plug_gas*v_hrs_ina_mo/1000; % gas plugload kWh/m2
 
 */
-    Vector Eelec_ht = div(div(v_Qelec_ht, structure->floorArea()), kWh2MJ);      //% Total monthly electric usage for heating
-    Vector Eelec_cl = div(div(v_Qcl_elec_tot, structure->floorArea()), kWh2MJ);  //% Total monthly electric usage for cooling
-    Vector Eelec_int_lt = div(v_Q_illum_tot, structure->floorArea());            //% Total monthly electric usage density for interior lighting
-    Vector Eelec_ext_lt = div(v_Q_illum_ext_tot, structure->floorArea());        //% Total monthly electric usage for exterior lights
-    Vector Eelec_fan = v_Qfan_tot;                                               //%Total monthly elec usage for fans
-    Vector Eelec_pump = div(div(v_Q_pump_tot, structure->floorArea()), kWh2MJ);  //% Total monthly elec usage for pumps
-    Vector Eelec_plug = v_Q_plug_elec;                                           //% Total monthly elec usage for elec plugloads
+    Vector Eelec_ht = div(v_Qelec_ht, structure->floorArea());
+    div(Eelec_ht, kWh2MJ, Eelec_ht);  //% Total monthly electric usage for heating
+    Vector Eelec_cl = div(v_Qcl_elec_tot, structure->floorArea());
+    div(Eelec_cl, kWh2MJ, Eelec_cl);                                       //% Total monthly electric usage for cooling
+    Vector Eelec_int_lt = div(v_Q_illum_tot, structure->floorArea());      //% Total monthly electric usage density for interior lighting
+    Vector Eelec_ext_lt = div(v_Q_illum_ext_tot, structure->floorArea());  //% Total monthly electric usage for exterior lights
+    const Vector& Eelec_fan = v_Qfan_tot;                                  //%Total monthly elec usage for fans
+    Vector Eelec_pump = div(v_Q_pump_tot, structure->floorArea());
+    div(Eelec_pump, kWh2MJ, Eelec_pump);       //% Total monthly elec usage for pumps
+    const Vector& Eelec_plug = v_Q_plug_elec;  //% Total monthly elec usage for elec plugloads
     Vector Eelec_dhw = div(v_Q_dhw_elec, structure->floorArea());
     /*
 %% Generating output table
@@ -2238,10 +2394,12 @@ Eelec_dhw  = v_Q_dhw_elec/In.cond_flr_area;
 
 */
 
-    Vector Egas_ht = div(div(v_Qgas_ht, structure->floorArea()), kWh2MJ);      //% total monthly gas usage for heating
-    Vector Egas_cl = div(div(v_Qcl_gas_tot, structure->floorArea()), kWh2MJ);  //% total monthly gas usage for cooling
-    Vector Egas_plug = v_Q_plug_gas;                                           //% total monthly gas plugloads
-    Vector Egas_dhw = div(v_Q_dhw_gas, structure->floorArea());                //% total monthly dhw gas plugloads
+    Vector Egas_ht = div(v_Qgas_ht, structure->floorArea());
+    div(Egas_ht, kWh2MJ, Egas_ht);  //% total monthly gas usage for heating
+    Vector Egas_cl = div(v_Qcl_gas_tot, structure->floorArea());
+    div(Egas_cl, kWh2MJ, Egas_cl);                               //% total monthly gas usage for cooling
+    const Vector& Egas_plug = v_Q_plug_gas;                      //% total monthly gas plugloads
+    Vector Egas_dhw = div(v_Q_dhw_gas, structure->floorArea());  //% total monthly dhw gas plugloads
 
     for (int i = 0; i < 12; i++) {
       results[i].addEndUse(Eelec_ht[i], EndUseFuelType::Electricity, EndUseCategoryType::Heating);
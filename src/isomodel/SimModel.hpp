@@ -74,6 +74,26 @@ namespace isomodel {
   ISOMODEL_API Vector abs(const Vector& v1);
   ISOMODEL_API Vector pow(const Vector& v1, const double xp);
 
+  /** Element-wise operations that write into result instead of allocating a new Vector. result is resized only if
+   *  its size differs, and may be one of the operands. */
+  ISOMODEL_API void mult(const double* v1, const double s1, int size, Vector& result);
+  ISOMODEL_API void mult(const Vector& v1, const double s1, Vector& result);
+  ISOMODEL_API void mult(const Vector& v1, const double* v2, Vector& result);
+  ISOMODEL_API void mult(const Vector& v1, const Vector& v2, Vector& result);
+  ISOMODEL_API void div(const Vector& v1, const double s1, Vector& result);
+  ISOMODEL_API void div(const double s1, const Vector& v1, Vector& result);
+  ISOMODEL_API void div(const Vector& v1, const Vector& v2, Vector& result);
+  ISOMODEL_API void sum(const Vector& v1, const Vector& v2, Vector& result);
+  ISOMODEL_API void sum(const Vector& v1, const double v2, Vector& result);
+  ISOMODEL_API void dif(const Vector& v1, const Vector& v2, Vector& result);
+  ISOMODEL_API void dif(const Vector& v1, const double v2, Vector& result);
+  ISOMODEL_API void dif(const double v1, const Vector& v2, Vector& result);
+  ISOMODEL_API void maximum(const Vector& v1, const Vector& v2, Vector& result);
+  ISOMODEL_API void maximum(const Vector& v1, double val, Vector& result);
+  ISOMODEL_API void minimum(const Vector& v1, double val, Vector& result);
+  ISOMODEL_API void abs(const Vector& v1, Vector& result);
+  ISOMODEL_API void pow(const Vector& v1, const double xp, Vector& result);
+
   struct ISOMODEL_API ISOResults
   {
     std::vector<EndUses> monthlyResults;
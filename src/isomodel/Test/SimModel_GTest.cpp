@@ -32,6 +32,8 @@
 #include "../SimModel.hpp"
 #include "../UserModel.hpp"
 #include <resources.hxx>
+#include <algorithm>
+#include <cmath>
 #include <sstream>
 
 using namespace openstudio::isomodel;
@@ -161,6 +163,38 @@ void testGenericFunctions() {
     EXPECT_DOUBLE_EQ(i, results[i]);
   }
 }
+TEST_F(ISOModelFixture, SimModel_HelpersWithOutput) {
+  Vector v1(12), v2(12);
+  for (unsigned int i = 0; i < 12; i++) {
+    v1[i] = i - 5.5;
+    v2[i] = 11 - i;
+  }
+
+  // an empty output is sized, a preallocated one is reused, and the output may be an operand
+  Vector result;
+  mult(v1, v2, result);
+  ASSERT_EQ(12u, result.size());
+  const double* data = &result[0];
+  mult(result, 2.0, result);
+  sum(result, v1, result);
+  dif(v2, result, result);
+  div(result, v2, result);
+  maximum(result, 0.5, result);
+  EXPECT_EQ(data, &result[0]);
+
+  Vector expected = maximum(div(dif(v2, sum(mult(mult(v1, v2), 2.0), v1)), v2), 0.5);
+  for (unsigned int i = 0; i < 12; i++) {
+    EXPECT_DOUBLE_EQ(expected[i], result[i]);
+  }
+
+  abs(v1, result);
+  pow(result, 2.0, result);
+  expected = pow(abs(v1), 2.0);
+  for (unsigned int i = 0; i < 12; i++) {
+    EXPECT_DOUBLE_EQ(expected[i], result[i]);
+  }
+}
+
 TEST_F(ISOModelFixture, SimModel) {
   //testGenericFunctions();
   UserModel userModel;
@@ -325,3 +359,48 @@ TEST_F(ISOModelFixture, SimModel) {
   EXPECT_DOUBLE_EQ(0, results.monthlyResults[10].getEndUse(EndUseFuelType::Gas, EndUseCategoryType::WaterSystems));
   EXPECT_DOUBLE_EQ(0, results.monthlyResults[11].getEndUse(EndUseFuelType::Gas, EndUseCategoryType::WaterSystems));
 }
+
+TEST_F(ISOModelFixture, SimModel_Batch) {
+  UserModel baseModel;
+  baseModel.load(resourcesPath() / openstudio::toPath("isomodel/exampleModel.ISO"));
+  ASSERT_TRUE(baseModel.valid());
+
+  // sweep the cooling setpoint and lighting power
+  std::vector<UserModel> variants;
+  for (int i = 0; i < 4; ++i) {
+    for (int j = 0; j < 4; ++j) {
+      UserModel variant = baseModel;
+      variant.setCoolingOccupiedSetpoint(baseModel.coolingOccupiedSetpoint() + i);
+      variant.setLightingPowerIntensityOccupied(baseModel.lightingPowerIntensityOccupied() * (1.0 + 0.25 * j));
+      variants.push_back(variant);
+    }
+  }
+
+  // a variant without weather is skipped
+  UserModel noWeather;
+  noWeather.setWeatherFilePath(openstudio::toPath("does_not_exist.epw"));
+  variants.push_back(noWeather);
+
+  std::vector<ISOResults> batchResults = UserModel::simulate(variants, 4);
+  ASSERT_EQ(variants.size(), batchResults.size());
+  EXPECT_TRUE(batchResults.back().monthlyResults.empty());
+  EXPECT_FALSE(variants.back().valid());
+
+  std::vector<EndUseFuelType> fuelTypes = EndUses::fuelTypes();
+  std::vector<EndUseCategoryType> categoryTypes = EndUses::categories();
+  for (size_t i = 0; i < variants.size() - 1; ++i) {
+    ISOResults results = variants[i].toSimModel().simulate();
+    ASSERT_EQ(results.monthlyResults.size(), batchResults[i].monthlyResults.size());
+    for (size_t month = 0; month < results.monthlyResults.size(); ++month) {
+      for (const auto& fuelType : fuelTypes) {
+        for (const auto& categoryType : categoryTypes) {
+          double expected = results.monthlyResults[month].getEndUse(fuelType, categoryType);
+          EXPECT_NEAR(expected, batchResults[i].monthlyResults[month].getEndUse(fuelType, categoryType), 1.0e-9 * std::max(1.0, std::abs(expected)));
+        }
+      }
+    }
+  }
+
+  // the variants give different results
+  EXPECT_NE(batchResults[0].totalEnergyUse(), batchResults[15].totalEnergyUse());
+}
@@ -29,6 +29,14 @@
 
 #include "UserModel.hpp"
 
+#include "../utilities/core/System.hpp"
+
+#include <boost/optional.hpp>
+
+#include <atomic>
+#include <map>
+#include <thread>
+
 using namespace std;
 namespace openstudio {
 namespace isomodel {
@@ -591,6 +599,55 @@ namespace isomodel {
       return -1;
   }
 
+  std::vector<ISOResults> UserModel::simulate(const std::vector<UserModel>& userModels, unsigned numThreads) {
+    // set up the SimModels on this thread, loading each weather file only once. Each variant is copied so that
+    // attaching the shared weather data does not change the caller's models
+    std::map<std::pair<openstudio::path, openstudio::path>, std::shared_ptr<WeatherData>> weatherByFile;
+    std::vector<boost::optional<SimModel>> simModels(userModels.size());
+    for (size_t i = 0; i < userModels.size(); ++i) {
+      UserModel userModel = userModels[i];
+      if (!userModel._weather) {
+        auto key = std::make_pair(userModel._weatherFilePath, userModel._dataFile.parent_path());
+        auto it = weatherByFile.find(key);
+        if (it == weatherByFile.end()) {
+          it = weatherByFile.emplace(key, userModel.loadWeather()).first;
+        }
+        userModel._weather = it->second;
+      }
+      if (!userModel._weather) {
+        // loadWeather logged the missing file
+        continue;
+      }
+      simModels[i] = userModel.toSimModel();
+    }
+
+    if (numThreads == 0) {
+      numThreads = System::numberOfProcessors();
+    }
+
+    // SimModel::simulate is const and the variants share nothing mutable
+    std::vector<ISOResults> results(userModels.size());
+    std::atomic<size_t> next(0);
+    auto worker = [&simModels, &results, &next]() {
+      for (size_t i = next++; i < simModels.size(); i = next++) {
+        if (simModels[i]) {
+          results[i] = simModels[i]->simulate();
+        }
+      }
+    };
+
+    std::vector<std::thread> threads;
+    for (unsigned t = 1; t < std::min<size_t>(numThreads, simModels.size()); ++t) {
+      threads.emplace_back(worker);
+    }
+    worker();
+    for (std::thread& thread : threads) {
+      thread.join();
+    }
+
+    return results;
+  }
+
   std::shared_ptr<WeatherData> UserModel::loadWeather() {
     openstudio::path weatherFilename;
     //see if weather file path is absolute path
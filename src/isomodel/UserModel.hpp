@@ -71,6 +71,15 @@ namespace isomodel {
      */
     SimModel toSimModel();
 
+    /**
+     * Simulates many variants of a model, e.g. for a parametric sweep, on up to
+     * numThreads threads (all processors if 0). Each weather file is loaded once
+     * and shared by the variants that use it. Results are in the order of
+     * userModels; a variant that is not valid gets an empty ISOResults. userModels
+     * are not modified.
+     */
+    static std::vector<ISOResults> simulate(const std::vector<UserModel>& userModels, unsigned numThreads = 0);
+
     /**
      * Indicates whether or not the user model loaded in correctly
      * If either the ISO file or the Weather File cannot be found
@@ -649,39 +649,67 @@ namespace model {
     }
 
     double Building_Impl::floorArea() const {
-      double result = 0;
-      for (const Space& space : spaces()) {
-        bool partofTotalFloorArea = space.partofTotalFloorArea();
-        if (partofTotalFloorArea) {
-          result += space.multiplier() * space.floorArea();
+      return model().getImpl<Model_Impl>()->cachedMetric(handle(), "Building.floorArea", [this]() {
+        double result = 0;
+        for (const Space& space : spaces()) {
+          bool partofTotalFloorArea = space.partofTotalFloorArea();
+          if (partofTotalFloorArea) {
+            result += space.multiplier() * space.floorArea();
+          }
         }
-      }
-      return result;
+        return result;
+      });
     }
 
     boost::optional<double> Building_Impl::conditionedFloorArea() const {
-      boost::optional<double> result;
+      return model().getImpl<Model_Impl>()->cachedOptionalMetric(handle(), "Building.conditionedFloorArea", [this]() {
+        boost::optional<double> result;
 
-      for (const ThermalZone& thermalZone : thermalZones()) {
-        boost::optional<std::string> isConditioned = thermalZone.isConditioned();
+        for (const ThermalZone& thermalZone : thermalZones()) {
+          boost::optional<std::string> isConditioned = thermalZone.isConditioned();
 
-        if (isConditioned) {
+          if (isConditioned) {
 
-          if (!result) {
-            result = 0;
-          }
+            if (!result) {
+              result = 0;
+            }
 
-          if (istringEqual("Yes", *isConditioned)) {
-            for (const Space& space : thermalZone.spaces()) {
-              bool partofTotalFloorArea = space.partofTotalFloorArea();
-              if (partofTotalFloorArea) {
-                result = *result + space.multiplier() * space.floorArea();
+            if (istringEqual("Yes", *isConditioned)) {
+              for (const Space& space : thermalZone.spaces()) {
+                bool partofTotalFloorArea = space.partofTotalFloorArea();
+                if (partofTotalFloorArea) {
+                  result = *result + space.multiplier() * space.floorArea();
+                }
               }
             }
           }
         }
+
+        return result;
+      });
+    }
+
+    std::vector<double> Building_Impl::spaceFloorAreas() const {
+      std::vector<double> result;
+      for (const Space& space : spaces()) {
+        result.push_back(space.floorArea());
       }
+      return result;
+    }
 
+    std::vector<double> Building_Impl::spaceNumberOfPeople() const {
+      std::vector<double> result;
+      for (const Space& space : spaces()) {
+        result.push_back(space.numberOfPeople());
+      }
+      return result;
+    }
+
+    std::vector<double> Building_Impl::spaceLightingPowers() const {
+      std::vector<double> result;
+      for (const Space& space : spaces()) {
+        result.push_back(space.lightingPower());
+      }
       return result;
     }
 
@@ -716,11 +744,13 @@ namespace model {
     }
 
     double Building_Impl::numberOfPeople() const {
-      double result(0.0);
-      for (const Space& space : spaces()) {
-        result += space.numberOfPeople() * space.multiplier();
-      }
-      return result;
+      return model().getImpl<Model_Impl>()->cachedMetric(handle(), "Building.numberOfPeople", [this]() {
+        double result(0.0);
+        for (const Space& space : spaces()) {
+          result += space.numberOfPeople() * space.multiplier();
+        }
+        return result;
+      });
     }
 
     double Building_Impl::peoplePerFloorArea() const {
@@ -748,11 +778,13 @@ namespace model {
     }
 
     double Building_Impl::lightingPower() const {
-      double result(0.0);
-      for (const Space& space : spaces()) {
-        result += space.multiplier() * space.lightingPower();
-      }
-      return result;
+      return model().getImpl<Model_Impl>()->cachedMetric(handle(), "Building.lightingPower", [this]() {
+        double result(0.0);
+        for (const Space& space : spaces()) {
+          result += space.multiplier() * space.lightingPower();
+        }
+        return result;
+      });
     }
 
     double Building_Impl::lightingPowerPerFloorArea() const {
@@ -1291,6 +1323,18 @@ namespace model {
     return getImpl<detail::Building_Impl>()->conditionedFloorArea();
   }
 
+  std::vector<double> Building::spaceFloorAreas() const {
+    return getImpl<detail::Building_Impl>()->spaceFloorAreas();
+  }
+
+  std::vector<double> Building::spaceNumberOfPeople() const {
+    return getImpl<detail::Building_Impl>()->spaceNumberOfPeople();
+  }
+
+  std::vector<double> Building::spaceLightingPowers() const {
+    return getImpl<detail::Building_Impl>()->spaceLightingPowers();
+  }
+
   double Building::exteriorSurfaceArea() const {
     return getImpl<detail::Building_Impl>()->exteriorSurfaceArea();
   }
@@ -234,6 +234,16 @@ namespace model {
     /// Attribute name: conditionedFloorArea
     boost::optional<double> conditionedFloorArea() const;
 
+    /** Returns the floor area (m^2) of each of spaces(), in the same order. Space multipliers are not applied.
+   *  Like the building totals, the values are memoized until the model changes. */
+    std::vector<double> spaceFloorAreas() const;
+
+    /** Returns the number of people in each of spaces(), in the same order. Space multipliers are not applied. */
+    std::vector<double> spaceNumberOfPeople() const;
+
+    /** Returns the lighting power (W) of each of spaces(), in the same order. Space multipliers are not applied. */
+    std::vector<double> spaceLightingPowers() const;
+
     // ETH@20140115 - Should take a bool as to whether to include spaces marked as
     // "not in floor area".
     /** Returns the total exterior surface area (m^2). Includes space multipliers in
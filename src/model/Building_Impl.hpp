@@ -188,6 +188,12 @@ namespace model {
 
       boost::optional<double> conditionedFloorArea() const;
 
+      std::vector<double> spaceFloorAreas() const;
+
+      std::vector<double> spaceNumberOfPeople() const;
+
+      std::vector<double> spaceLightingPowers() const;
+
       double exteriorSurfaceArea() const;
 
       double exteriorWallArea() const;
@@ -0,0 +1,444 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2021, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+
+#include "CompiledSchedule.hpp"
+#include "Model.hpp"
+#include "Schedule.hpp"
+#include "ScheduleCompact.hpp"
+#include "ScheduleCompact_Impl.hpp"
+#include "ScheduleConstant.hpp"
+#include "ScheduleConstant_Impl.hpp"
+#include "ScheduleDay.hpp"
+#include "ScheduleDay_Impl.hpp"
+#include "ScheduleRule.hpp"
+#include "ScheduleRule_Impl.hpp"
+#include "ScheduleRuleset.hpp"
+#include "ScheduleRuleset_Impl.hpp"
+#include "ScheduleWeek.hpp"
+#include "ScheduleWeek_Impl.hpp"
+#include "ScheduleYear.hpp"
+#include "ScheduleYear_Impl.hpp"
+
+#include "../utilities/core/Assert.hpp"
+#include "../utilities/core/Compare.hpp"
+#include "../utilities/idf/IdfExtensibleGroup.hpp"
+#include "../utilities/time/Time.hpp"
+
+#include <boost/algorithm/string.hpp>
+#include <boost/lexical_cast.hpp>
+
+#include <algorithm>
+#include <limits>
+
+namespace openstudio {
+namespace model {
+
+  namespace {
+
+    // unassigned entry in the day type table
+    const unsigned unassignedDay = std::numeric_limits<unsigned>::max();
+
+    // parses the part of a Schedule:Compact field after the colon, e.g. "Through: 12/31" -> "12/31"
+    std::string compactArgument(const std::string& field) {
+      std::string::size_type colon = field.find(':');
+      return boost::trim_copy(field.substr(colon + 1));
+    }
+
+    bool parseTwoNumbers(const std::string& text, char separator, int& first, int& second) {
+      std::string::size_type pos = text.find(separator);
+      if (pos == std::string::npos) {
+        return false;
+      }
+      try {
+        first = boost::lexical_cast<int>(boost::trim_copy(text.substr(0, pos)));
+        second = boost::lexical_cast<int>(boost::trim_copy(text.substr(pos + 1)));
+      } catch (const boost::bad_lexical_cast&) {
+        return false;
+      }
+      return true;
+    }
+
+  }  // namespace
+
+  CompiledSchedule::CompiledSchedule(const openstudio::Date& startDate, unsigned numberOfDays)
+    : m_startDate(startDate), m_dayTypes(numberOfDays, unassignedDay) {}
+
+  CompiledSchedule CompiledSchedule::forModelYear(Model model) {
+    openstudio::Date startDate = model.makeDate(MonthOfYear::Jan, 1);
+    openstudio::Date endDate = model.makeDate(MonthOfYear::Dec, 31);
+    return CompiledSchedule(startDate, static_cast<unsigned>((endDate - startDate).days()) + 1);
+  }
+
+  boost::optional<CompiledSchedule> CompiledSchedule::compile(const Schedule& schedule) {
+    CompiledSchedule result = forModelYear(schedule.model());
+
+    if (boost::optional<ScheduleConstant> scheduleConstant = schedule.optionalCast<ScheduleConstant>()) {
+      DayProfile dayProfile;
+      dayProfile.times = {-0.000001, 1.0, 1.000001};
+      dayProfile.values = {0.0, scheduleConstant->value(), 0.0};
+      std::fill(result.m_dayTypes.begin(), result.m_dayTypes.end(), result.addDayProfile(dayProfile));
+    } else if (boost::optional<ScheduleRuleset> scheduleRuleset = schedule.optionalCast<ScheduleRuleset>()) {
+      result.compileRuleset(*scheduleRuleset);
+    } else if (boost::optional<ScheduleYear> scheduleYear = schedule.optionalCast<ScheduleYear>()) {
+      result.compileYear(*scheduleYear);
+    } else if (boost::optional<ScheduleCompact> scheduleCompact = schedule.optionalCast<ScheduleCompact>()) {
+      if (!result.compileCompact(*scheduleCompact)) {
+        LOG(Warn, "Cannot compile " << schedule.briefDescription() << ", its data could not be parsed.");
+        return boost::none;
+      }
+    } else {
+      LOG(Warn, "Cannot compile " << schedule.briefDescription() << ", schedules of type " << schedule.iddObjectType().valueName()
+                                  << " are not supported.");
+      return boost::none;
+    }
+
+    // days not covered by the schedule evaluate to 0, as ScheduleDay::getValue does without values
+    if (std::find(result.m_dayTypes.begin(), result.m_dayTypes.end(), unassignedDay) != result.m_dayTypes.end()) {
+      unsigned empty = result.addDayProfile(DayProfile());
+      std::replace(result.m_dayTypes.begin(), result.m_dayTypes.end(), unassignedDay, empty);
+    }
+
+    return result;
+  }
+
+  CompiledSchedule CompiledSchedule::compile(const ScheduleDay& scheduleDay) {
+    CompiledSchedule result = forModelYear(scheduleDay.model());
+    std::fill(result.m_dayTypes.begin(), result.m_dayTypes.end(), result.addDayProfile(scheduleDay));
+    return result;
+  }
+
+  openstudio::Date CompiledSchedule::startDate() const {
+    return m_startDate;
+  }
+
+  unsigned CompiledSchedule::numberOfDays() const {
+    return m_dayTypes.size();
+  }
+
+  unsigned CompiledSchedule::numberOfDayProfiles() const {
+    return m_dayProfiles.size();
+  }
+
+  unsigned CompiledSchedule::dayProfileIndex(unsigned dayOfYear) const {
+    OS_ASSERT(dayOfYear >= 1 && dayOfYear <= m_dayTypes.size());
+    return m_dayTypes[dayOfYear - 1];
+  }
+
+  double CompiledSchedule::value(unsigned dayOfYear, const openstudio::Time& time) const {
+    if (dayOfYear < 1 || dayOfYear > m_dayTypes.size()) {
+      return 0.0;
+    }
+    if (time.totalMinutes() < 0.0) {
+      return 0.0;
+    }
+    return profileValue(m_dayProfiles[m_dayTypes[dayOfYear - 1]], time.totalDays());
+  }
+
+  double CompiledSchedule::value(const openstudio::Date& date, const openstudio::Time& time) const {
+    return value(date.dayOfYear(), time);
+  }
+
+  std::vector<double> CompiledSchedule::evaluate(unsigned timestepsPerHour) const {
+    std::vector<double> result;
+    if (timestepsPerHour == 0 || (3600 % timestepsPerHour) != 0) {
+      LOG(Error, "Cannot evaluate schedule with " << timestepsPerHour << " timesteps per hour.");
+      return result;
+    }
+
+    // evaluate each day profile once at the end of each timestep, then lay out the days
+    unsigned timestepsPerDay = 24 * timestepsPerHour;
+    std::vector<double> days(timestepsPerDay);
+    for (unsigned i = 0; i < timestepsPerDay; ++i) {
+      days[i] = openstudio::Time(0, 0, 0, static_cast<int>((i + 1) * (3600 / timestepsPerHour))).totalDays();
+    }
+    std::vector<std::vector<double>> profileValues;
+    profileValues.reserve(m_dayProfiles.size());
+    for (const DayProfile& dayProfile : m_dayProfiles) {
+      std::vector<double> values(timestepsPerDay);
+      for (unsigned i = 0; i < timestepsPerDay; ++i) {
+        values[i] = profileValue(dayProfile, days[i]);
+      }
+      profileValues.push_back(std::move(values));
+    }
+
+    result.reserve(m_dayTypes.size() * timestepsPerDay);
+    for (unsigned dayType : m_dayTypes) {
+      const std::vector<double>& values = profileValues[dayType];
+      result.insert(result.end(), values.begin(), values.end());
+    }
+    return result;
+  }
+
+  unsigned CompiledSchedule::addDayProfile(DayProfile dayProfile) {
+    for (unsigned i = 0; i < m_dayProfiles.size(); ++i) {
+      const DayProfile& existing = m_dayProfiles[i];
+      if ((existing.interpolate == dayProfile.interpolate) && (existing.times == dayProfile.times) && (existing.values == dayProfile.values)) {
+        return i;
+      }
+    }
+    m_dayProfiles.push_back(std::move(dayProfile));
+    return m_dayProfiles.size() - 1;
+  }
+
+  unsigned CompiledSchedule::addDayProfile(const boost::optional<ScheduleDay>& scheduleDay) {
+    if (!scheduleDay) {
+      return addDayProfile(DayProfile());
+    }
+
+    auto it = m_scheduleDayProfiles.find(scheduleDay->handle());
+    if (it != m_scheduleDayProfiles.end()) {
+      return it->second;
+    }
+
+    // same knots as ScheduleDay_Impl::getValue
+    DayProfile dayProfile;
+    std::vector<double> values = scheduleDay->values();
+    std::vector<openstudio::Time> times = scheduleDay->times();
+    unsigned N = times.size();
+    OS_ASSERT(values.size() == N);
+    if (N > 0) {
+      dayProfile.times.reserve(N + 2);
+      dayProfile.values.reserve(N + 2);
+      dayProfile.times.push_back(-0.000001);
+      dayProfile.values.push_back(0.0);
+      for (unsigned i = 0; i < N; ++i) {
+        dayProfile.times.push_back(times[i].totalDays());
+        dayProfile.values.push_back(values[i]);
+      }
+      dayProfile.times.push_back(1.000001);
+      dayProfile.values.push_back(0.0);
+      dayProfile.interpolate = scheduleDay->interpolatetoTimestep();
+    }
+
+    unsigned result = addDayProfile(std::move(dayProfile));
+    m_scheduleDayProfiles[scheduleDay->handle()] = result;
+    return result;
+  }
+
+  void CompiledSchedule::compileRuleset(const ScheduleRuleset& scheduleRuleset) {
+    openstudio::Date endDate = m_startDate + openstudio::Time(static_cast<int>(m_dayTypes.size()) - 1);
+    std::vector<int> activeRuleIndices = scheduleRuleset.getActiveRuleIndices(m_startDate, endDate);
+    OS_ASSERT(activeRuleIndices.size() == m_dayTypes.size());
+
+    std::vector<ScheduleRule> scheduleRules = scheduleRuleset.scheduleRules();
+    unsigned defaultDayType = addDayProfile(scheduleRuleset.defaultDaySchedule());
+    std::vector<unsigned> ruleDayTypes;
+    ruleDayTypes.reserve(scheduleRules.size());
+    for (const ScheduleRule& scheduleRule : scheduleRules) {
+      ruleDayTypes.push_back(addDayProfile(scheduleRule.daySchedule()));
+    }
+
+    for (unsigned i = 0; i < m_dayTypes.size(); ++i) {
+      int ruleIndex = activeRuleIndices[i];
+      m_dayTypes[i] = (ruleIndex == -1) ? defaultDayType : ruleDayTypes[ruleIndex];
+    }
+  }
+
+  void CompiledSchedule::compileYear(const ScheduleYear& scheduleYear) {
+    // as in ScheduleYear::getScheduleWeek, each week schedule applies through its date
+    std::vector<openstudio::Date> dates = scheduleYear.dates();
+    std::vector<ScheduleWeek> scheduleWeeks = scheduleYear.scheduleWeeks();
+    unsigned N = std::min(dates.size(), scheduleWeeks.size());
+
+    std::map<UUID, std::vector<unsigned>> weekDayTypes;
+    unsigned week = 0;
+    openstudio::Date date = m_startDate;
+    for (unsigned i = 0; i < m_dayTypes.size(); ++i, date += openstudio::Time(1)) {
+      while (week < N && dates[week] < date) {
+        ++week;
+      }
+      if (week == N) {
+        break;
+      }
+
+      const ScheduleWeek& scheduleWeek = scheduleWeeks[week];
+      std::vector<unsigned>& dayTypes = weekDayTypes[scheduleWeek.handle()];
+      if (dayTypes.empty()) {
+        dayTypes = {addDayProfile(scheduleWeek.sundaySchedule()),   addDayProfile(scheduleWeek.mondaySchedule()),
+                    addDayProfile(scheduleWeek.tuesdaySchedule()),  addDayProfile(scheduleWeek.wednesdaySchedule()),
+                    addDayProfile(scheduleWeek.thursdaySchedule()), addDayProfile(scheduleWeek.fridaySchedule()),
+                    addDayProfile(scheduleWeek.saturdaySchedule())};
+      }
+      m_dayTypes[i] = dayTypes[date.dayOfWeek().value()];
+    }
+  }
+
+  bool CompiledSchedule::compileCompact(const ScheduleCompact& scheduleCompact) {
+    Model model = scheduleCompact.model();
+
+    unsigned firstDay = 0;  // first day of the current Through: period
+    unsigned endDay = 0;    // one past the last day of the current Through: period
+    std::vector<bool> periodDays(7, false);  // days of the week already assigned in the current period
+    std::vector<bool> forDays(7, false);     // days of the week of the current For: line
+    DayProfile dayProfile;
+    boost::optional<double> untilTime;
+
+    auto finishFor = [&]() {
+      if (std::find(forDays.begin(), forDays.end(), true) != forDays.end()) {
+        // close the day profile with the trailing knot used by ScheduleDay::getValue
+        if (!dayProfile.times.empty()) {
+          dayProfile.times.push_back(1.000001);
+          dayProfile.values.push_back(0.0);
+        }
+        unsigned dayType = addDayProfile(dayProfile);
+        openstudio::Date date = m_startDate + openstudio::Time(static_cast<int>(firstDay));
+        for (unsigned i = firstDay; i < endDay; ++i, date += openstudio::Time(1)) {
+          unsigned dayOfWeek = date.dayOfWeek().value();
+          if (forDays[dayOfWeek]) {
+            m_dayTypes[i] = dayType;
+          }
+        }
+        for (unsigned i = 0; i < 7; ++i) {
+          periodDays[i] = periodDays[i] || forDays[i];
+        }
+      }
+      forDays.assign(7, false);
+      dayProfile = DayProfile();
+      untilTime.reset();
+    };
+
+    for (const IdfExtensibleGroup& group : scheduleCompact.extensibleGroups()) {
+      std::string field = boost::trim_copy(group.getString(0, true).get());
+      if (field.empty()) {
+        continue;
+      }
+
+      if (boost::istarts_with(field, "Through:")) {
+        finishFor();
+        int month = 0;
+        int day = 0;
+        if (!parseTwoNumbers(compactArgument(field), '/', month, day)) {
+          return false;
+        }
+        openstudio::Date throughDate;
+        try {
+          throughDate = model.makeDate(static_cast<unsigned>(month), static_cast<unsigned>(day));
+        } catch (const std::exception&) {
+          return false;
+        }
+        firstDay = endDay;
+        endDay = std::min(static_cast<unsigned>((throughDate - m_startDate).days()) + 1, static_cast<unsigned>(m_dayTypes.size()));
+        periodDays.assign(7, false);
+      } else if (boost::istarts_with(field, "For:")) {
+        finishFor();
+        std::vector<std::string> dayTypes;
+        std::string argument = compactArgument(field);
+        boost::split(dayTypes, argument, boost::is_any_of(" \t"), boost::token_compress_on);
+        for (const std::string& dayType : dayTypes) {
+          if (istringEqual(dayType, "AllDays")) {
+            forDays.assign(7, true);
+          } else if (istringEqual(dayType, "Weekdays")) {
+            std::fill(forDays.begin() + DayOfWeek::Monday, forDays.begin() + DayOfWeek::Saturday, true);
+          } else if (istringEqual(dayType, "Weekends")) {
+            forDays[DayOfWeek::Sunday] = true;
+            forDays[DayOfWeek::Saturday] = true;
+          } else if (istringEqual(dayType, "AllOtherDays")) {
+            for (unsigned i = 0; i < 7; ++i) {
+              forDays[i] = forDays[i] || !periodDays[i];
+            }
+          } else {
+            try {
+              forDays[DayOfWeek(dayType).value()] = true;
+            } catch (const std::exception&) {
+              // holidays, design days and custom days are not represented
+            }
+          }
+        }
+        // a day already assigned in this period keeps its first assignment
+        for (unsigned i = 0; i < 7; ++i) {
+          forDays[i] = forDays[i] && !periodDays[i];
+        }
+      } else if (boost::istarts_with(field, "Interpolate:")) {
+        dayProfile.interpolate = !istringEqual(compactArgument(field), "No");
+      } else if (boost::istarts_with(field, "Until:")) {
+        int hour = 0;
+        int minute = 0;
+        if (!parseTwoNumbers(compactArgument(field), ':', hour, minute)) {
+          return false;
+        }
+        untilTime = openstudio::Time(0, hour, minute).totalDays();
+      } else {
+        double value = 0.0;
+        try {
+          value = boost::lexical_cast<double>(field);
+        } catch (const boost::bad_lexical_cast&) {
+          return false;
+        }
+        if (!untilTime) {
+          return false;
+        }
+        if (dayProfile.times.empty()) {
+          dayProfile.times.push_back(-0.000001);
+          dayProfile.values.push_back(0.0);
+        }
+        dayProfile.times.push_back(*untilTime);
+        dayProfile.values.push_back(value);
+        untilTime.reset();
+      }
+    }
+    finishFor();
+
+    return true;
+  }
+
+  double CompiledSchedule::profileValue(const DayProfile& dayProfile, double days) {
+    // mirrors ScheduleDay_Impl::getValue, i.e. openstudio::interp with NoneExtrap
+    if (days > 1.0) {
+      return 0.0;
+    }
+
+    const std::vector<double>& x = dayProfile.times;
+    const std::vector<double>& y = dayProfile.values;
+    if (x.empty()) {
+      return 0.0;
+    }
+
+    if (x.front() == days) {
+      return y.front();
+    } else if (days < x.front()) {
+      return 0.0;
+    } else if (x.back() == days) {
+      return y.back();
+    } else if (days > x.back()) {
+      return 0.0;
+    }
+
+    auto ib = static_cast<unsigned>(std::lower_bound(x.begin(), x.end(), days) - x.begin());
+    unsigned ia = ib - 1;
+    if (!dayProfile.interpolate) {
+      return y[ib];
+    }
+    double wa = (x[ib] - days) / (x[ib] - x[ia]);
+    double wb = (days - x[ia]) / (x[ib] - x[ia]);
+    return wa * y[ia] + wb * y[ib];
+  }
+
+}  // namespace model
+}  // namespace openstudio
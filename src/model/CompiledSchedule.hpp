@@ -0,0 +1,133 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2021, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+
+#ifndef MODEL_COMPILEDSCHEDULE_HPP
+#define MODEL_COMPILEDSCHEDULE_HPP
+
+#include "ModelAPI.hpp"
+
+#include "../utilities/core/Logger.hpp"
+#include "../utilities/core/UUID.hpp"
+#include "../utilities/time/Date.hpp"
+
+#include <boost/optional.hpp>
+
+#include <map>
+#include <vector>
+
+namespace openstudio {
+
+class Time;
+
+namespace model {
+
+  class Model;
+  class Schedule;
+  class ScheduleDay;
+  class ScheduleRuleset;
+  class ScheduleYear;
+  class ScheduleCompact;
+
+  /** CompiledSchedule is a read-only annual snapshot of a Schedule for fast evaluation. Each day of the year refers to one
+   *  of a small table of day profiles, and each day profile holds the piecewise segments of a day schedule, evaluated
+   *  exactly as ScheduleDay::getValue does. Days are selected by date and day of week only, as in
+   *  ScheduleRuleset::getDaySchedules and ScheduleYear::getScheduleWeek, so holidays and design days are not represented.
+   *  The compiled schedule does not follow later changes to the model. */
+  class MODEL_API CompiledSchedule
+  {
+   public:
+    /** Compiles schedule for the year described by the model's YearDescription. ScheduleConstant, ScheduleRuleset,
+     *  ScheduleYear and ScheduleCompact are supported, returns boost::none for other types of schedule. */
+    static boost::optional<CompiledSchedule> compile(const Schedule& schedule);
+
+    /** Compiles scheduleDay applied to every day of the year described by the model's YearDescription. */
+    static CompiledSchedule compile(const ScheduleDay& scheduleDay);
+
+    /// Returns the first day of the compiled year.
+    openstudio::Date startDate() const;
+
+    /// Returns the number of days in the compiled year.
+    unsigned numberOfDays() const;
+
+    /// Returns the number of distinct day profiles.
+    unsigned numberOfDayProfiles() const;
+
+    /// Returns the index of the day profile in effect on dayOfYear, which starts at 1.
+    unsigned dayProfileIndex(unsigned dayOfYear) const;
+
+    /// Returns the value at time on dayOfYear, which starts at 1. Returns 0 if either is out of range.
+    double value(unsigned dayOfYear, const openstudio::Time& time) const;
+
+    /// Returns the value at time on date. Returns 0 if either is out of range.
+    double value(const openstudio::Date& date, const openstudio::Time& time) const;
+
+    /// Returns the values at the end of each timestep of the year, numberOfDays() * 24 * timestepsPerHour values in order.
+    std::vector<double> evaluate(unsigned timestepsPerHour = 1) const;
+
+   private:
+    CompiledSchedule(const openstudio::Date& startDate, unsigned numberOfDays);
+
+    static CompiledSchedule forModelYear(Model model);
+
+    REGISTER_LOGGER("openstudio.model.CompiledSchedule");
+
+    struct DayProfile
+    {
+      // knots in days, including the leading and trailing knots used by ScheduleDay::getValue, empty if always 0
+      std::vector<double> times;
+      std::vector<double> values;
+      bool interpolate = false;
+    };
+
+    unsigned addDayProfile(DayProfile dayProfile);
+
+    unsigned addDayProfile(const boost::optional<ScheduleDay>& scheduleDay);
+
+    void compileRuleset(const ScheduleRuleset& scheduleRuleset);
+
+    void compileYear(const ScheduleYear& scheduleYear);
+
+    bool compileCompact(const ScheduleCompact& scheduleCompact);
+
+    static double profileValue(const DayProfile& dayProfile, double days);
+
+    openstudio::Date m_startDate;
+    std::vector<DayProfile> m_dayProfiles;
+    std::vector<unsigned> m_dayTypes;  // day profile index for each day of the year
+    std::map<UUID, unsigned> m_scheduleDayProfiles;
+  };
+
+  /** \relates CompiledSchedule */
+  typedef boost::optional<CompiledSchedule> OptionalCompiledSchedule;
+
+}  // namespace model
+}  // namespace openstudio
+
+#endif  // MODEL_COMPILEDSCHEDULE_HPP
@@ -50,6 +50,7 @@
 #include "ConnectorSplitter.hpp"
 #include "ConnectorSplitter_Impl.hpp"
 #include "Model.hpp"
+#include "Model_Impl.hpp"
 
 #include <utilities/idd/IddEnums.hxx>
 
@@ -134,22 +135,22 @@ namespace model {
     }
 
     boost::optional<ModelObject> Loop_Impl::demandComponent(openstudio::Handle handle) const {
-      auto comps = demandComponents();
+      const ComponentIndex& index = demandComponentIndex();
 
-      auto it = std::find_if(comps.begin(), comps.end(), [&](const ModelObject& comp) { return (comp.handle() == handle); });
-      if (it != comps.end()) {
-        return *it;
+      auto it = index.positions.find(handle);
+      if (it != index.positions.end()) {
+        return index.components[it->second];
       }
 
       return boost::none;
     }
 
     boost::optional<ModelObject> Loop_Impl::supplyComponent(openstudio::Handle handle) const {
-      auto comps = supplyComponents();
+      const ComponentIndex& index = supplyComponentIndex();
 
-      auto it = std::find_if(comps.begin(), comps.end(), [&](const ModelObject& comp) { return (comp.handle() == handle); });
-      if (it != comps.end()) {
-        return *it;
+      auto it = index.positions.find(handle);
+      if (it != index.positions.end()) {
+        return index.components[it->second];
       }
 
       return boost::none;
@@ -274,14 +275,38 @@ namespace model {
       std::set<T> s_;
     };
 
-    std::vector<ModelObject> Loop_Impl::supplyComponents(openstudio::IddObjectType type) const {
+    Loop_Impl::ComponentIndex Loop_Impl::makeComponentIndex(std::vector<ModelObject> components) {
+      ComponentIndex result;
+      for (unsigned i = 0; i < components.size(); ++i) {
+        result.positions.emplace(components[i].handle(), i);
+        result.componentsByType[components[i].iddObject().type()].push_back(components[i]);
+      }
+      result.components = std::move(components);
+      return result;
+    }
+
+    void Loop_Impl::clearStaleComponentIndex() const {
+      unsigned revision = model().getImpl<Model_Impl>()->connectionRevision();
+      if (revision != m_componentIndexRevision) {
+        m_supplyComponentIndex.reset();
+        m_demandComponentIndex.reset();
+        m_componentIndexRevision = revision;
+      }
+    }
+
+    const Loop_Impl::ComponentIndex& Loop_Impl::supplyComponentIndex() const {
+      clearStaleComponentIndex();
+      if (m_supplyComponentIndex) {
+        return m_supplyComponentIndex.get();
+      }
+
       std::vector<ModelObject> result;
 
       auto t_supplyInletNode = supplyInletNode();
       auto t_supplyOutletNodes = supplyOutletNodes();
 
       for (auto const& t_supplyOutletNode : t_supplyOutletNodes) {
-        auto components = supplyComponents(t_supplyInletNode, t_supplyOutletNode, type);
+        auto components = supplyComponents(t_supplyInletNode, t_supplyOutletNode);
         result.insert(result.end(), components.begin(), components.end());
       }
 
@@ -289,20 +314,26 @@ namespace model {
       if (t_supplyOutletNodes.size() > 1u) {
         Duplicate<ModelObject> pred;
         auto it = std::remove_if(result.begin(), result.end(), std::ref(pred));
-        return std::vector<ModelObject>(result.begin(), it);
-      } else {
-        return result;
+        result.erase(it, result.end());
       }
+
+      m_supplyComponentIndex = makeComponentIndex(std::move(result));
+      return m_supplyComponentIndex.get();
     }
 
-    std::vector<ModelObject> Loop_Impl::demandComponents(openstudio::IddObjectType type) const {
+    const Loop_Impl::ComponentIndex& Loop_Impl::demandComponentIndex() const {
+      clearStaleComponentIndex();
+      if (m_demandComponentIndex) {
+        return m_demandComponentIndex.get();
+      }
+
       std::vector<ModelObject> result;
 
       auto t_demandOutletNode = demandOutletNode();
       auto t_demandInletNodes = demandInletNodes();
 
       for (auto const& t_demandInletNode : t_demandInletNodes) {
-        auto components = demandComponents(t_demandInletNode, t_demandOutletNode, type);
+        auto components = demandComponents(t_demandInletNode, t_demandOutletNode);
         result.insert(result.end(), components.begin(), components.end());
       }
 
@@ -310,10 +341,37 @@ namespace model {
       if (t_demandInletNodes.size() > 1u) {
         Duplicate<ModelObject> pred;
         auto it = std::remove_if(result.begin(), result.end(), std::ref(pred));
-        return std::vector<ModelObject>(result.begin(), it);
-      } else {
-        return result;
+        result.erase(it, result.end());
       }
+
+      m_demandComponentIndex = makeComponentIndex(std::move(result));
+      return m_demandComponentIndex.get();
+    }
+
+    std::vector<ModelObject> Loop_Impl::supplyComponents(openstudio::IddObjectType type) const {
+      const ComponentIndex& index = supplyComponentIndex();
+      if (type == IddObjectType::Catchall) {
+        return index.components;
+      }
+
+      auto it = index.componentsByType.find(type);
+      if (it != index.componentsByType.end()) {
+        return it->second;
+      }
+      return std::vector<ModelObject>();
+    }
+
+    std::vector<ModelObject> Loop_Impl::demandComponents(openstudio::IddObjectType type) const {
+      const ComponentIndex& index = demandComponentIndex();
+      if (type == IddObjectType::Catchall) {
+        return index.components;
+      }
+
+      auto it = index.componentsByType.find(type);
+      if (it != index.componentsByType.end()) {
+        return it->second;
+      }
+      return std::vector<ModelObject>();
     }
 
     std::vector<ModelObject> Loop_Impl::components(openstudio::IddObjectType type) {
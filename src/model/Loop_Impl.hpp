@@ -31,6 +31,7 @@
 #define MODEL_LOOP_IMPL_HPP
 
 #include "ParentObject_Impl.hpp"
+#include "ModelObject.hpp"
 
 namespace openstudio {
 
@@ -129,6 +130,28 @@ namespace model {
       boost::optional<ModelObject> supplyOutletNodeAsModelObject();
       boost::optional<ModelObject> demandInletNodeAsModelObject();
       boost::optional<ModelObject> demandOutletNodeAsModelObject();
+
+      // Components of one side of the loop, in the order returned by supplyComponents() and
+      // demandComponents(), indexed by handle and by type.
+      struct ComponentIndex
+      {
+        std::vector<ModelObject> components;
+        std::map<Handle, unsigned> positions;
+        std::map<IddObjectType, std::vector<ModelObject>> componentsByType;
+      };
+
+      static ComponentIndex makeComponentIndex(std::vector<ModelObject> components);
+
+      // Return the cached index of each side, rebuilt after the model's connection revision changes.
+      const ComponentIndex& supplyComponentIndex() const;
+      const ComponentIndex& demandComponentIndex() const;
+
+      // Drops both indexes if connections in the model changed since they were built.
+      void clearStaleComponentIndex() const;
+
+      mutable boost::optional<ComponentIndex> m_supplyComponentIndex;
+      mutable boost::optional<ComponentIndex> m_demandComponentIndex;
+      mutable unsigned m_componentIndexRevision = 0;
     };
 
   }  // namespace detail
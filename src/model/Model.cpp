@@ -64,6 +64,8 @@
 
 #include <boost/regex.hpp>
 
+#include <mutex>
+
 using openstudio::IddObjectType;
 using openstudio::detail::WorkspaceObject_Impl;
 
@@ -77,6 +79,7 @@ namespace model {
     // default constructor
     Model_Impl::Model_Impl() : Workspace_Impl(StrictnessLevel::Draft, IddFileType::OpenStudio) {
       // careful not to call anything that calls shared_from_this here, this is not yet constructed
+      watchConnections();
     }
 
     Model_Impl::Model_Impl(const IdfFile& idfFile) : Workspace_Impl(idfFile, StrictnessLevel(StrictnessLevel::Draft)) {
@@ -85,6 +88,7 @@ namespace model {
         LOG_AND_THROW("Models must be constructed with the OpenStudio Idd as the underlying "
                       << "data schema. (Attempted construction from IdfFile with IddFileType " << idfFile.iddFileType().valueDescription() << ".)");
       }
+      watchConnections();
     }
 
     Model_Impl::Model_Impl(const openstudio::detail::Workspace_Impl& workspace, bool keepHandles)
@@ -95,6 +99,7 @@ namespace model {
                       << "data schema. (Attempted construction from Workspace with IddFileType " << workspace.iddFileType().valueDescription()
                       << ".)");
       }
+      watchConnections();
     }
 
     // copy constructor, used for clone
@@ -104,6 +109,7 @@ namespace model {
         m_workflowJSON(WorkflowJSON(other.m_workflowJSON)) {
       // notice we are cloning the workflow and sqlfile too, if necessary
       // careful not to call anything that calls shared_from_this here, this is not yet constructed
+      watchConnections();
     }
 
     // copy constructor used for cloneSubset
@@ -112,6 +118,7 @@ namespace model {
         m_sqlFile((other.m_sqlFile) ? (std::shared_ptr<SqlFile>(new SqlFile(*other.m_sqlFile))) : (other.m_sqlFile)),
         m_workflowJSON(WorkflowJSON(other.m_workflowJSON)) {
       // notice we are cloning the workflow and sqlfile too, if necessary
+      watchConnections();
     }
     Workspace Model_Impl::clone(bool keepHandles) const {
       // copy everything but objects
@@ -155,6 +162,22 @@ namespace model {
       m_componentWatchers = otherImpl->m_componentWatchers;
       otherImpl->m_componentWatchers = tcw;
 
+      // objects now report connection changes to the model that holds them
+      for (const WorkspaceObject& object : objects()) {
+        auto impl = object.getImpl<openstudio::detail::WorkspaceObject_Impl>();
+        impl->onRelationshipChange.disconnect<Model_Impl, &Model_Impl::connectionChange>(otherImpl.get());
+        impl->onRelationshipChange.connect<Model_Impl, &Model_Impl::connectionChange>(this);
+      }
+      for (const WorkspaceObject& object : otherImpl->objects()) {
+        auto impl = object.getImpl<openstudio::detail::WorkspaceObject_Impl>();
+        impl->onRelationshipChange.disconnect<Model_Impl, &Model_Impl::connectionChange>(this);
+        impl->onRelationshipChange.connect<Model_Impl, &Model_Impl::connectionChange>(otherImpl.get());
+      }
+      ++m_connectionRevision;
+      ++otherImpl->m_connectionRevision;
+      ++m_dataRevision;
+      ++otherImpl->m_dataRevision;
+
       clearCachedData();
       otherImpl->clearCachedData();
     }
@@ -718,6 +741,8 @@ namespace model {
     bool Model_Impl::setSqlFile(const openstudio::SqlFile& sqlFile) {
       bool result = true;
       m_sqlFile = std::shared_ptr<openstudio::SqlFile>(new openstudio::SqlFile(sqlFile));
+      // some metrics, like the conditioned floor area, come from the results
+      ++m_dataRevision;
       return result;
     }
 
@@ -725,6 +750,7 @@ namespace model {
     bool Model_Impl::resetSqlFile() {
       bool result = true;
       m_sqlFile.reset();
+      ++m_dataRevision;
       return result;
     }
 
@@ -891,6 +917,70 @@ namespace model {
       }
     }
 
+    unsigned Model_Impl::connectionRevision() const {
+      return m_connectionRevision;
+    }
+
+    unsigned Model_Impl::dataRevision() const {
+      return m_dataRevision;
+    }
+
+    double Model_Impl::cachedMetric(const Handle& handle, const std::string& metric, const std::function<double()>& compute) const {
+      return cachedOptionalMetric(handle, metric, [&compute]() { return boost::optional<double>(compute()); }).get();
+    }
+
+    boost::optional<double> Model_Impl::cachedOptionalMetric(const Handle& handle, const std::string& metric,
+                                                             const std::function<boost::optional<double>()>& compute) const {
+      auto key = std::make_pair(handle, metric);
+      unsigned revision = 0;
+      {
+        std::lock_guard<std::mutex> lock(m_metricCacheMutex);
+        if (m_metricCacheRevision != m_dataRevision) {
+          m_metricCache.clear();
+          m_metricCacheRevision = m_dataRevision;
+        }
+        auto it = m_metricCache.find(key);
+        if (it != m_metricCache.end()) {
+          return it->second;
+        }
+        revision = m_dataRevision;
+      }
+
+      // computed without the lock, metrics are built from other memoized metrics
+      boost::optional<double> result = compute();
+
+      std::lock_guard<std::mutex> lock(m_metricCacheMutex);
+      if ((revision == m_dataRevision) && (m_metricCacheRevision == m_dataRevision)) {
+        m_metricCache.emplace(std::move(key), result);
+      }
+      return result;
+    }
+
+    void Model_Impl::watchConnections() {
+      this->addWorkspaceObjectPtr.connect<Model_Impl, &Model_Impl::watchObjectConnections>(this);
+      this->removeWorkspaceObjectPtr.connect<Model_Impl, &Model_Impl::objectConnectionsRemoved>(this);
+      this->onChange.connect<Model_Impl, &Model_Impl::dataChange>(this);
+    }
+
+    void Model_Impl::watchObjectConnections(std::shared_ptr<openstudio::detail::WorkspaceObject_Impl> object, const IddObjectType&,
+                                            const openstudio::UUID&) {
+      object->onRelationshipChange.connect<Model_Impl, &Model_Impl::connectionChange>(this);
+      ++m_connectionRevision;
+    }
+
+    void Model_Impl::objectConnectionsRemoved(std::shared_ptr<openstudio::detail::WorkspaceObject_Impl>, const IddObjectType&, const openstudio::UUID&) {
+      // the object keeps its connection in case the removal is rolled back
+      ++m_connectionRevision;
+    }
+
+    void Model_Impl::connectionChange(int, Handle, Handle) {
+      ++m_connectionRevision;
+    }
+
+    void Model_Impl::dataChange() {
+      ++m_dataRevision;
+    }
+
     void Model_Impl::obsoleteComponentWatcher(const ComponentWatcher& watcher) {
       auto it = std::find(m_componentWatchers.begin(), m_componentWatchers.end(), watcher);
       OS_ASSERT(it != m_componentWatchers.end());
@@ -1279,6 +1369,25 @@ namespace model {
     return result;
   }
 
+  std::vector<std::shared_ptr<WorkspaceObject_Impl>> Model::getObjectImplsByImplType(const std::type_index& implType,
+                                                                                       ImplTypeTest test) const {
+    // Each IddObjectType is always instantiated as the same _Impl class (the one registered with
+    // ModelObjectCreator, or GenericModelObject_Impl), so whether its objects derive from implType only
+    // has to be checked once per process, on any one of its objects.
+    static std::mutex registryMutex;
+    static std::map<std::pair<std::type_index, IddObjectType>, bool> registry;
+
+    return getImpl<detail::Model_Impl>()->getObjectImplsByType(
+      [&implType, test](IddObjectType iddObjectType, const std::shared_ptr<WorkspaceObject_Impl>& example) {
+        std::lock_guard<std::mutex> lock(registryMutex);
+        auto it = registry.find(std::make_pair(implType, iddObjectType));
+        if (it == registry.end()) {
+          it = registry.insert(std::make_pair(std::make_pair(implType, iddObjectType), test(example))).first;
+        }
+        return it->second;
+      });
+  }
+
   boost::optional<ComponentData> Model::insertComponent(const Component& component) {
     return getImpl<detail::Model_Impl>()->insertComponent(component);
   }
@@ -37,6 +37,8 @@
 #include "../utilities/filetypes/WorkflowJSON.hpp"
 #include "../utilities/core/Assert.hpp"
 
+#include <typeindex>
+#include <typeinfo>
 #include <vector>
 
 namespace openstudio {
@@ -295,13 +297,23 @@ namespace model {
     template <typename T>
     std::vector<T> getModelObjects(bool sorted = false) const {
       std::vector<T> result;
-      std::vector<WorkspaceObject> objects = this->objects(sorted);
-      result.reserve(objects.size());
-      for (std::vector<WorkspaceObject>::const_iterator it = objects.begin(), itend = objects.end(); it < itend; ++it) {
-        std::shared_ptr<typename T::ImplType> p = it->getImpl<typename T::ImplType>();
-        if (p) {
-          result.push_back(T(p));
+      if (sorted) {
+        std::vector<WorkspaceObject> objects = this->objects(sorted);
+        result.reserve(objects.size());
+        for (std::vector<WorkspaceObject>::const_iterator it = objects.begin(), itend = objects.end(); it < itend; ++it) {
+          std::shared_ptr<typename T::ImplType> p = it->getImpl<typename T::ImplType>();
+          if (p) {
+            result.push_back(T(p));
+          }
         }
+        return result;
+      }
+      // only the objects of types known to be T are visited, so no per object cast is needed
+      std::vector<std::shared_ptr<openstudio::detail::WorkspaceObject_Impl>> impls =
+        this->getObjectImplsByImplType(typeid(typename T::ImplType), &Model::hasImplType<typename T::ImplType>);
+      result.reserve(impls.size());
+      for (const std::shared_ptr<openstudio::detail::WorkspaceObject_Impl>& impl : impls) {
+        result.push_back(T(std::static_pointer_cast<typename T::ImplType>(impl)));
       }
       return result;
     }
@@ -493,6 +505,17 @@ namespace model {
     /// @endcond
    private:
     REGISTER_LOGGER("openstudio.model.Model");
+
+    typedef bool (*ImplTypeTest)(const std::shared_ptr<openstudio::detail::WorkspaceObject_Impl>&);
+
+    template <typename ImplType>
+    static bool hasImplType(const std::shared_ptr<openstudio::detail::WorkspaceObject_Impl>& impl) {
+      return static_cast<bool>(std::dynamic_pointer_cast<ImplType>(impl));
+    }
+
+    // implementations of all objects whose implementation class is or derives from implType
+    std::vector<std::shared_ptr<openstudio::detail::WorkspaceObject_Impl>> getObjectImplsByImplType(const std::type_index& implType,
+                                                                                                    ImplTypeTest test) const;
   };
 
   /** \relates Model */
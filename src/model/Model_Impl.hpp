@@ -51,6 +51,10 @@
 
 #include <boost/optional.hpp>
 
+#include <functional>
+#include <map>
+#include <mutex>
+
 #include <vector>
 
 namespace openstudio {
@@ -258,6 +262,23 @@ namespace model {
 
       void disconnect(ModelObject object, unsigned port);
 
+      /** Returns a counter that changes whenever a pointer between objects in the model may have
+     *  changed, for instance when HVAC components are connected or disconnected. Loops compare it
+     *  to know when their cached component lists are stale. */
+      unsigned connectionRevision() const;
+
+      /** Returns a counter that changes whenever an object in the model is added, removed or modified.
+     *  Aggregate metrics such as floor areas compare it to know when their memoized values are stale. */
+      unsigned dataRevision() const;
+
+      /** Returns the value of metric for the object with handle, as memoized since the last change to the
+     *  model. If there is none, it is computed with compute and stored until dataRevision() changes. */
+      double cachedMetric(const Handle& handle, const std::string& metric, const std::function<double()>& compute) const;
+
+      /** As cachedMetric, for metrics that may not be defined. */
+      boost::optional<double> cachedOptionalMetric(const Handle& handle, const std::string& metric,
+                                                   const std::function<boost::optional<double>()>& compute) const;
+
       //@}
       /** @name Nano Signals */
       //@{
@@ -298,6 +319,19 @@ namespace model {
 
       WorkflowJSON m_workflowJSON;
 
+      unsigned m_connectionRevision = 0;
+
+      // Connects the add and remove object signals used to maintain m_connectionRevision, and the change
+      // signal used to maintain m_dataRevision.
+      void watchConnections();
+
+      unsigned m_dataRevision = 0;
+
+      // memoized aggregate metrics by (handle, metric), valid for m_metricCacheRevision only
+      mutable std::map<std::pair<Handle, std::string>, boost::optional<double>> m_metricCache;
+      mutable unsigned m_metricCacheRevision = 0;
+      mutable std::mutex m_metricCacheMutex;
+
      private:
       mutable boost::optional<Building> m_cachedBuilding;
       mutable boost::optional<FoundationKivaSettings> m_cachedFoundationKivaSettings;
@@ -320,6 +354,12 @@ namespace model {
       void clearCachedRunPeriod(const Handle& handle);
       void clearCachedYearDescription(const Handle& handle);
       void clearCachedWeatherFile(const Handle& handle);
+      void watchObjectConnections(std::shared_ptr<openstudio::detail::WorkspaceObject_Impl> object, const IddObjectType& type,
+                                  const openstudio::UUID& handle);
+      void objectConnectionsRemoved(std::shared_ptr<openstudio::detail::WorkspaceObject_Impl> object, const IddObjectType& type,
+                                    const openstudio::UUID& handle);
+      void connectionChange(int index, Handle newHandle, Handle oldHandle);
+      void dataChange();
 
       typedef std::function<std::shared_ptr<openstudio::detail::WorkspaceObject_Impl>(
         Model_Impl*, const std::shared_ptr<openstudio::detail::WorkspaceObject_Impl>&, bool)>
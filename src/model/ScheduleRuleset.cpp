@@ -497,21 +497,17 @@ namespace model {
 
       unsigned numDates = dates.size();
 
-      // check if each rule contains each date
+      // the first rule that contains a date is active on that date, so test rules in order until every date is covered
       std::vector<ScheduleRule> scheduleRules = this->scheduleRules();
       unsigned numRules = scheduleRules.size();
-      std::vector<std::vector<bool>> test;
-      for (unsigned i = 0; i < numRules; ++i) {
-        test.push_back(scheduleRules[i].containsDates(dates));
-      }
-
-      // now create result
       std::vector<int> result(numDates, -1);
-      for (unsigned j = 0; j < numDates; ++j) {
-        for (unsigned i = 0; i < numRules; ++i) {
-          if (test[i][j]) {
+      unsigned numRemaining = numDates;
+      for (unsigned i = 0; i < numRules && numRemaining > 0; ++i) {
+        std::vector<bool> test = scheduleRules[i].containsDates(dates);
+        for (unsigned j = 0; j < numDates; ++j) {
+          if (test[j] && result[j] == -1) {
             result[j] = i;
-            break;
+            --numRemaining;
           }
         }
       }
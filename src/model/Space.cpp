@@ -126,9 +126,14 @@
 #include "../utilities/geometry/Vector3d.hpp"
 #include "../utilities/geometry/EulerAngles.hpp"
 #include "../utilities/geometry/BoundingBox.hpp"
+#include "../utilities/geometry/BoundingBoxTree.hpp"
 #include "../utilities/geometry/Polygon3d.hpp"
 
 #include "../utilities/core/Assert.hpp"
+#include "../utilities/core/String.hpp"
+#include "../utilities/core/System.hpp"
+
+#include <boost/lexical_cast.hpp>
 
 #undef BOOST_UBLAS_TYPE_CHECK
 #if defined(_MSC_VER)
@@ -145,11 +150,249 @@
 #  pragma warning(pop)
 #endif
 
+#include <atomic>
 #include <cmath>
+#include <exception>
+#include <numeric>
+#include <thread>
 
 namespace openstudio {
 namespace model {
 
+  namespace {
+
+    /** A surface taking part in the intersection of two spaces, either existing or created by the intersection. */
+    struct IntersectionSurface
+    {
+      std::vector<Point3d> vertices;
+      bool eligible;  // surfaces with sub surfaces or adjacent surfaces are not intersected
+    };
+
+    /** One intersection of a surface in each space which needs to be applied to the model. */
+    struct IntersectionStep
+    {
+      unsigned surface;
+      unsigned otherSurface;
+      detail::SurfaceIntersectionGeometry geometry;
+    };
+
+    /** Intersection of two spaces, planned on plain geometry so that planning does not access the model and may run on any thread.
+     *  Surfaces are indexed in creation order, existing surfaces first in the order they are intersected. */
+    struct SpaceIntersectionPlan
+    {
+      std::vector<Surface> modelSurfaces;
+      std::vector<Surface> otherModelSurfaces;
+      Transformation transformation;
+      Transformation otherTransformation;
+      std::vector<IntersectionSurface> surfaces;
+      std::vector<IntersectionSurface> otherSurfaces;
+      std::vector<IntersectionStep> steps;
+      std::exception_ptr error;
+    };
+
+    // vertices are stored as text, this returns the vertices the model will report after setVertices
+    std::vector<Point3d> storedVertices(const std::vector<Point3d>& vertices) {
+      std::vector<Point3d> result;
+      for (const Point3d& vertex : vertices) {
+        try {
+          result.push_back(Point3d(boost::lexical_cast<double>(toString(vertex.x())), boost::lexical_cast<double>(toString(vertex.y())),
+                                   boost::lexical_cast<double>(toString(vertex.z()))));
+        } catch (const std::exception&) {
+        }
+      }
+      return result;
+    }
+
+    // same checks as PlanarSurface_Impl::setVertices
+    bool settableVertices(const std::vector<Point3d>& vertices) {
+      if (vertices.size() < 3) {
+        return false;
+      }
+      try {
+        Plane plane(vertices);
+      } catch (const std::exception&) {
+        return false;
+      }
+      return true;
+    }
+
+    SpaceIntersectionPlan snapshotSpaceIntersection(const Space& space, const Space& other) {
+      SpaceIntersectionPlan result;
+      result.modelSurfaces = space.surfaces();
+      result.otherModelSurfaces = other.surfaces();
+
+      std::sort(result.modelSurfaces.begin(), result.modelSurfaces.end(),
+                [](const Surface& a, const Surface& b) -> bool { return a.grossArea() > b.grossArea(); });
+      std::sort(result.otherModelSurfaces.begin(), result.otherModelSurfaces.end(),
+                [](const Surface& a, const Surface& b) -> bool { return a.grossArea() > b.grossArea(); });
+
+      result.transformation = space.transformation();
+      result.otherTransformation = other.transformation();
+
+      for (const Surface& surface : result.modelSurfaces) {
+        result.surfaces.push_back(IntersectionSurface{surface.vertices(), surface.subSurfaces().empty() && !surface.adjacentSurface()});
+      }
+      for (const Surface& surface : result.otherModelSurfaces) {
+        result.otherSurfaces.push_back(IntersectionSurface{surface.vertices(), surface.subSurfaces().empty() && !surface.adjacentSurface()});
+      }
+
+      return result;
+    }
+
+    // records the effect of a step on the planned surfaces, returns false if applying it to the model will throw
+    bool planIntersectionStep(SpaceIntersectionPlan& plan, const IntersectionStep& step, std::vector<unsigned>& newSurfaces,
+                              std::vector<unsigned>& newOtherSurfaces) {
+      const detail::SurfaceIntersectionGeometry& geometry = step.geometry;
+      if (geometry.newVertices1.empty() && geometry.newVertices2.empty()) {
+        return true;
+      }
+
+      if (settableVertices(geometry.vertices1)) {
+        plan.surfaces[step.surface].vertices = storedVertices(geometry.vertices1);
+      }
+      if (settableVertices(geometry.vertices2)) {
+        plan.otherSurfaces[step.otherSurface].vertices = storedVertices(geometry.vertices2);
+      }
+
+      for (const std::vector<Point3d>& newVertices : geometry.newVertices1) {
+        if (!settableVertices(newVertices)) {
+          return false;
+        }
+        newSurfaces.push_back(plan.surfaces.size());
+        plan.surfaces.push_back(IntersectionSurface{storedVertices(newVertices), true});
+      }
+      for (const std::vector<Point3d>& newVertices : geometry.newVertices2) {
+        if (!settableVertices(newVertices)) {
+          return false;
+        }
+        newOtherSurfaces.push_back(plan.otherSurfaces.size());
+        plan.otherSurfaces.push_back(IntersectionSurface{storedVertices(newVertices), true});
+      }
+
+      return true;
+    }
+
+    // mirrors the loop in Space_Impl::intersectSurfaces prior to planning, does not access the model
+    void planSpaceIntersection(SpaceIntersectionPlan& plan) {
+      std::vector<unsigned> surfaces(plan.surfaces.size());
+      std::iota(surfaces.begin(), surfaces.end(), 0u);
+      std::vector<unsigned> otherSurfaces(plan.otherSurfaces.size());
+      std::iota(otherSurfaces.begin(), otherSurfaces.end(), 0u);
+
+      std::set<std::pair<unsigned, unsigned>> completedIntersections;
+
+      try {
+        bool anyNewSurfaces = true;
+        while (anyNewSurfaces) {
+
+          anyNewSurfaces = false;
+          std::vector<unsigned> newSurfaces;
+          std::vector<unsigned> newOtherSurfaces;
+
+          for (unsigned surface : surfaces) {
+            if (!plan.surfaces[surface].eligible) {
+              continue;
+            }
+
+            for (unsigned otherSurface : otherSurfaces) {
+              if (!plan.otherSurfaces[otherSurface].eligible) {
+                continue;
+              }
+
+              // see if we have already tested these for intersection,
+              // surfaces that previously did not intersect will not intersect if vertices change
+              // surfaces that previously did intersect will intersect exactly
+              if (!completedIntersections.insert(std::make_pair(surface, otherSurface)).second) {
+                continue;
+              }
+
+              IntersectionStep step{surface, otherSurface,
+                                    detail::Surface_Impl::computeIntersectionGeometry(plan.surfaces[surface].vertices, plan.transformation,
+                                                                                      plan.otherSurfaces[otherSurface].vertices, plan.otherTransformation)};
+
+              if ((step.geometry.status == detail::SurfaceIntersectionGeometry::NotReverseEqual)
+                  || (step.geometry.status == detail::SurfaceIntersectionGeometry::NoIntersection)) {
+                continue;
+              }
+
+              plan.steps.push_back(step);
+
+              if (step.geometry.status != detail::SurfaceIntersectionGeometry::Intersected) {
+                continue;
+              }
+
+              // number of surfaces in each space will only increase in intersect
+              unsigned numNewSurfaces = newSurfaces.size();
+              unsigned numNewOtherSurfaces = newOtherSurfaces.size();
+              if (!planIntersectionStep(plan, step, newSurfaces, newOtherSurfaces)) {
+                // creating the surface will throw when the plan is applied, nothing after it happens
+                return;
+              }
+
+              // surfaces involved in this intersection are ineligible to be re-intersected with other surfaces in this intersection
+              std::vector<unsigned> ineligibleSurfaces(1, surface);
+              ineligibleSurfaces.insert(ineligibleSurfaces.end(), newSurfaces.begin() + numNewSurfaces, newSurfaces.end());
+
+              std::vector<unsigned> ineligibleOtherSurfaces(1, otherSurface);
+              ineligibleOtherSurfaces.insert(ineligibleOtherSurfaces.end(), newOtherSurfaces.begin() + numNewOtherSurfaces, newOtherSurfaces.end());
+              for (unsigned ineligibleSurface : ineligibleSurfaces) {
+                for (unsigned ineligibleOtherSurface : ineligibleOtherSurfaces) {
+                  completedIntersections.insert(std::make_pair(ineligibleSurface, ineligibleOtherSurface));
+                }
+              }
+            }
+          }
+
+          if (!newSurfaces.empty()) {
+            surfaces.insert(surfaces.end(), newSurfaces.begin(), newSurfaces.end());
+            anyNewSurfaces = true;
+          }
+          if (!newOtherSurfaces.empty()) {
+            otherSurfaces.insert(otherSurfaces.end(), newOtherSurfaces.begin(), newOtherSurfaces.end());
+            anyNewSurfaces = true;
+          }
+        }
+      } catch (...) {
+        // rethrown once the steps before it have been applied
+        plan.error = std::current_exception();
+      }
+    }
+
+    void applySpaceIntersection(SpaceIntersectionPlan& plan) {
+      for (const IntersectionStep& step : plan.steps) {
+        Surface& surface = plan.modelSurfaces[step.surface];
+        Surface& otherSurface = plan.otherModelSurfaces[step.otherSurface];
+        boost::optional<SurfaceIntersection> intersection = surface.getImpl<detail::Surface_Impl>()->applyIntersectionGeometry(otherSurface, step.geometry);
+        if (intersection) {
+          std::vector<Surface> newSurfaces1 = intersection->newSurfaces1();
+          plan.modelSurfaces.insert(plan.modelSurfaces.end(), newSurfaces1.begin(), newSurfaces1.end());
+
+          std::vector<Surface> newSurfaces2 = intersection->newSurfaces2();
+          plan.otherModelSurfaces.insert(plan.otherModelSurfaces.end(), newSurfaces2.begin(), newSurfaces2.end());
+        }
+      }
+
+      if (plan.error) {
+        std::rethrow_exception(plan.error);
+      }
+    }
+
+    // spaces sorted by floor area and the pairs of them to intersect, in the order they are intersected
+    std::vector<std::pair<unsigned, unsigned>> spaceIntersectionPairs(std::vector<Space>& spaces) {
+      std::sort(spaces.begin(), spaces.end(), [](const Space& a, const Space& b) -> bool { return a.floorArea() < b.floorArea(); });
+
+      std::vector<BoundingBox> bounds;
+      for (const Space& space : spaces) {
+        bounds.push_back(space.transformation() * space.boundingBox());
+      }
+
+      // pairs come back ordered by (i, j), the same order as testing every pair
+      BoundingBoxTree tree(bounds);
+      return tree.intersectingPairs();
+    }
+
+  }  // namespace
+
   namespace detail {
 
     Space_Impl::Space_Impl(const IdfObject& idfObject, Model_Impl* model, bool keepHandle) : PlanarSurfaceGroup_Impl(idfObject, model, keepHandle) {
@@ -851,16 +1094,18 @@ namespace model {
     }
 
     double Space_Impl::floorArea() const {
-      double result = 0;
-      for (const Surface& surface : this->surfaces()) {
-        if (istringEqual(surface.surfaceType(), "Floor")) {
-          if (surface.isAirWall()) {
-            continue;
+      return model().getImpl<Model_Impl>()->cachedMetric(handle(), "Space.floorArea", [this]() {
+        double result = 0;
+        for (const Surface& surface : this->surfaces()) {
+          if (istringEqual(surface.surfaceType(), "Floor")) {
+            if (surface.isAirWall()) {
+              continue;
+            }
+            result += surface.grossArea();
           }
-          result += surface.grossArea();
         }
-      }
-      return result;
+        return result;
+      });
     }
 
     double Space_Impl::exteriorArea() const {
@@ -917,20 +1162,22 @@ namespace model {
     }
 
     double Space_Impl::numberOfPeople() const {
-      double result = 0.0;
-      double area = floorArea();
+      return model().getImpl<Model_Impl>()->cachedMetric(handle(), "Space.numberOfPeople", [this]() {
+        double result = 0.0;
+        double area = floorArea();
 
-      for (const People& person : this->people()) {
-        result += person.getNumberOfPeople(area);
-      }
-
-      if (OptionalSpaceType st = spaceType()) {
-        for (const People& person : st->people()) {
+        for (const People& person : this->people()) {
           result += person.getNumberOfPeople(area);
         }
-      }
 
-      return result;
+        if (OptionalSpaceType st = spaceType()) {
+          for (const People& person : st->people()) {
+            result += person.getNumberOfPeople(area);
+          }
+        }
+
+        return result;
+      });
     }
 
     bool Space_Impl::setNumberOfPeople(double numberOfPeople) {
@@ -994,20 +1241,22 @@ namespace model {
     }
 
     double Space_Impl::peoplePerFloorArea() const {
-      double result = 0.0;
-      double area = floorArea();
-
-      for (const People& person : this->people()) {
-        result += person.getPeoplePerFloorArea(area);
-      }
+      return model().getImpl<Model_Impl>()->cachedMetric(handle(), "Space.peoplePerFloorArea", [this]() {
+        double result = 0.0;
+        double area = floorArea();
 
-      if (OptionalSpaceType st = spaceType()) {
-        for (const People& person : st->people()) {
+        for (const People& person : this->people()) {
           result += person.getPeoplePerFloorArea(area);
         }
-      }
 
-      return result;
+        if (OptionalSpaceType st = spaceType()) {
+          for (const People& person : st->people()) {
+            result += person.getPeoplePerFloorArea(area);
+          }
+        }
+
+        return result;
+      });
     }
 
     bool Space_Impl::setPeoplePerFloorArea(double peoplePerFloorArea) {
@@ -1135,27 +1384,29 @@ namespace model {
     }
 
     double Space_Impl::lightingPower() const {
-      double result(0.0);
-      double area = floorArea();
-      double numPeople = numberOfPeople();
+      return model().getImpl<Model_Impl>()->cachedMetric(handle(), "Space.lightingPower", [this]() {
+        double result(0.0);
+        double area = floorArea();
+        double numPeople = numberOfPeople();
 
-      for (const Lights& light : lights()) {
-        result += light.getLightingPower(area, numPeople);
-      }
-      for (const Luminaire& luminaire : luminaires()) {
-        result += luminaire.lightingPower();
-      }
-
-      if (OptionalSpaceType spaceType = this->spaceType()) {
-        for (const Lights& light : spaceType->lights()) {
+        for (const Lights& light : lights()) {
           result += light.getLightingPower(area, numPeople);
         }
-        for (const Luminaire& luminaire : spaceType->luminaires()) {
+        for (const Luminaire& luminaire : luminaires()) {
           result += luminaire.lightingPower();
         }
-      }
 
-      return result;
+        if (OptionalSpaceType spaceType = this->spaceType()) {
+          for (const Lights& light : spaceType->lights()) {
+            result += light.getLightingPower(area, numPeople);
+          }
+          for (const Luminaire& luminaire : spaceType->luminaires()) {
+            result += luminaire.lightingPower();
+          }
+        }
+
+        return result;
+      });
     }
 
     bool Space_Impl::setLightingPower(double lightingPower) {
@@ -2165,6 +2416,18 @@ namespace model {
       // transform from other to this coordinates
       Transformation transformation = this->transformation().inverse() * other.transformation();
 
+      // transform other's surfaces once, and index them so each surface is only compared against nearby candidates
+      std::vector<Surface> otherSurfaces = other.surfaces();
+      std::vector<std::vector<Point3d>> transformedOtherVertices;
+      std::vector<BoundingBox> otherBounds;
+      for (const Surface& otherSurface : otherSurfaces) {
+        transformedOtherVertices.push_back(removeCollinear(transformation * otherSurface.vertices()));
+        BoundingBox otherBound;
+        otherBound.addPoints(transformedOtherVertices.back());
+        otherBounds.push_back(otherBound);
+      }
+      BoundingBoxTree otherTree(otherBounds);
+
       for (Surface surface : this->surfaces()) {
 
         std::vector<Point3d> vertices = removeCollinear(surface.vertices());
@@ -2174,9 +2437,13 @@ namespace model {
           continue;
         }
 
-        for (Surface otherSurface : other.surfaces()) {
+        BoundingBox bound;
+        bound.addPoints(vertices);
 
-          std::vector<Point3d> otherVertices = removeCollinear(transformation * otherSurface.vertices());
+        for (unsigned i : otherTree.intersecting(bound, tol)) {
+
+          Surface otherSurface = otherSurfaces[i];
+          std::vector<Point3d> otherVertices = transformedOtherVertices[i];
 
           boost::optional<Vector3d> otherOutwardNormal = getOutwardNormal(otherVertices);
           if (!otherOutwardNormal) {
@@ -2225,91 +2492,9 @@ namespace model {
         return;
       }
 
-      std::vector<Surface> surfaces = this->surfaces();
-      std::vector<Surface> otherSurfaces = other.surfaces();
-
-      std::sort(surfaces.begin(), surfaces.end(), [](const Surface& a, const Surface& b) -> bool { return a.grossArea() > b.grossArea(); });
-      std::sort(otherSurfaces.begin(), otherSurfaces.end(), [](const Surface& a, const Surface& b) -> bool { return a.grossArea() > b.grossArea(); });
-
-      std::map<std::string, bool> hasSubSurfaceMap;
-      std::map<std::string, bool> hasAdjacentSurfaceMap;
-      std::set<std::string> completedIntersections;
-
-      bool anyNewSurfaces = true;
-      while (anyNewSurfaces) {
-
-        anyNewSurfaces = false;
-        std::vector<Surface> newSurfaces;
-        std::vector<Surface> newOtherSurfaces;
-
-        for (Surface surface : surfaces) {
-          std::string surfaceHandle = toString(surface.handle());
-
-          if (hasSubSurfaceMap.find(surfaceHandle) == hasSubSurfaceMap.end()) {
-            hasSubSurfaceMap[surfaceHandle] = !surface.subSurfaces().empty();
-            hasAdjacentSurfaceMap[surfaceHandle] = surface.adjacentSurface().has_value();
-          }
-
-          if (hasSubSurfaceMap[surfaceHandle] || hasAdjacentSurfaceMap[surfaceHandle]) {
-            continue;
-          }
-
-          for (Surface otherSurface : otherSurfaces) {
-            std::string otherSurfaceHandle = toString(otherSurface.handle());
-            if (hasSubSurfaceMap.find(otherSurfaceHandle) == hasSubSurfaceMap.end()) {
-              hasSubSurfaceMap[otherSurfaceHandle] = !otherSurface.subSurfaces().empty();
-              hasAdjacentSurfaceMap[otherSurfaceHandle] = otherSurface.adjacentSurface().has_value();
-            }
-
-            if (hasSubSurfaceMap[otherSurfaceHandle] || hasAdjacentSurfaceMap[otherSurfaceHandle]) {
-              continue;
-            }
-
-            // see if we have already tested these for intersection,
-            // surfaces that previously did not intersect will not intersect if vertices change
-            // surfaces that previously did intersect will intersect exactly
-            std::string intersectionKey = surfaceHandle + otherSurfaceHandle;
-            if (completedIntersections.find(intersectionKey) != completedIntersections.end()) {
-              continue;
-            }
-            completedIntersections.insert(intersectionKey);
-
-            // number of surfaces in each space will only increase in intersect
-            boost::optional<SurfaceIntersection> intersection = surface.computeIntersection(otherSurface);
-            if (intersection) {
-              std::vector<Surface> newSurfaces1 = intersection->newSurfaces1();
-              newSurfaces.insert(newSurfaces.end(), newSurfaces1.begin(), newSurfaces1.end());
-
-              std::vector<Surface> newSurfaces2 = intersection->newSurfaces2();
-              newOtherSurfaces.insert(newOtherSurfaces.end(), newSurfaces2.begin(), newSurfaces2.end());
-
-              // surfaces involved in this intersection are ineligible to be re-intersected with other surfaces in this intersection
-              std::vector<Surface> ineligibleSurfaces;
-              ineligibleSurfaces.push_back(surface);
-              ineligibleSurfaces.insert(ineligibleSurfaces.end(), newSurfaces1.begin(), newSurfaces1.end());
-
-              std::vector<Surface> ineligibleOtherSurfaces;
-              ineligibleOtherSurfaces.push_back(otherSurface);
-              ineligibleOtherSurfaces.insert(ineligibleOtherSurfaces.end(), newSurfaces2.begin(), newSurfaces2.end());
-              for (Surface ineligibleSurface : ineligibleSurfaces) {
-                for (Surface ineligibleOtherSurface : ineligibleOtherSurfaces) {
-                  std::string ineligibleIntersectionKey = toString(ineligibleSurface.handle()) + toString(ineligibleOtherSurface.handle());
-                  completedIntersections.insert(ineligibleIntersectionKey);
-                }
-              }
-            }
-          }
-        }
-
-        if (!newSurfaces.empty()) {
-          surfaces.insert(surfaces.end(), newSurfaces.begin(), newSurfaces.end());
-          anyNewSurfaces = true;
-        }
-        if (!newOtherSurfaces.empty()) {
-          otherSurfaces.insert(otherSurfaces.end(), newOtherSurfaces.begin(), newOtherSurfaces.end());
-          anyNewSurfaces = true;
-        }
-      }
+      SpaceIntersectionPlan plan = snapshotSpaceIntersection(getObject<Space>(), other);
+      planSpaceIntersection(plan);
+      applySpaceIntersection(plan);
     }
 
     std::vector<Surface> Space_Impl::findSurfaces(boost::optional<double> minDegreesFromNorth, boost::optional<double> maxDegreesFromNorth,
@@ -3286,19 +3471,64 @@ namespace model {
 
   void intersectSurfaces(std::vector<Space>& t_spaces) {
     std::vector<Space> spaces(t_spaces);
-    std::sort(spaces.begin(), spaces.end(), [](const Space& a, const Space& b) -> bool { return a.floorArea() < b.floorArea(); });
+    for (const std::pair<unsigned, unsigned>& pair : spaceIntersectionPairs(spaces)) {
+      spaces[pair.first].intersectSurfaces(spaces[pair.second]);
+    }
+  }
 
-    std::vector<BoundingBox> bounds;
-    for (const Space& space : spaces) {
-      bounds.push_back(space.transformation() * space.boundingBox());
+  void intersectSurfaces(std::vector<Space>& t_spaces, unsigned numThreads) {
+    std::vector<Space> spaces(t_spaces);
+    std::vector<std::pair<unsigned, unsigned>> pairs = spaceIntersectionPairs(spaces);
+
+    if (numThreads == 0) {
+      numThreads = System::numberOfProcessors();
     }
 
-    for (unsigned i = 0; i < spaces.size(); ++i) {
-      for (unsigned j = i + 1; j < spaces.size(); ++j) {
-        if (!bounds[i].intersects(bounds[j])) {
-          continue;
+    // greedily color the conflict graph in intersection order, a pair goes one level after the last pair sharing one of its spaces
+    // so pairs in a level share no space and each space sees the same sequence of intersections as in serial order
+    std::map<Handle, unsigned> lastLevel;
+    std::vector<std::vector<unsigned>> levels;
+    for (unsigned i = 0; i < pairs.size(); ++i) {
+      const Handle& handle1 = spaces[pairs[i].first].handle();
+      const Handle& handle2 = spaces[pairs[i].second].handle();
+      if (handle1 == handle2) {
+        continue;
+      }
+      unsigned level = std::max(lastLevel[handle1], lastLevel[handle2]);
+      if (level == levels.size()) {
+        levels.push_back(std::vector<unsigned>());
+      }
+      levels[level].push_back(i);
+      lastLevel[handle1] = level + 1;
+      lastLevel[handle2] = level + 1;
+    }
+
+    for (const std::vector<unsigned>& level : levels) {
+      std::vector<SpaceIntersectionPlan> plans;
+      plans.reserve(level.size());
+      for (unsigned i : level) {
+        plans.push_back(snapshotSpaceIntersection(spaces[pairs[i].first], spaces[pairs[i].second]));
+      }
+
+      std::atomic<unsigned> next(0);
+      auto worker = [&plans, &next]() {
+        for (unsigned i = next++; i < plans.size(); i = next++) {
+          planSpaceIntersection(plans[i]);
         }
-        spaces[i].intersectSurfaces(spaces[j]);
+      };
+
+      std::vector<std::thread> threads;
+      for (unsigned t = 1; t < std::min<unsigned>(numThreads, plans.size()); ++t) {
+        threads.emplace_back(worker);
+      }
+      worker();
+      for (std::thread& thread : threads) {
+        thread.join();
+      }
+
+      // the model is only modified here, on this thread, in intersection order
+      for (SpaceIntersectionPlan& plan : plans) {
+        applySpaceIntersection(plan);
       }
     }
   }
@@ -3309,13 +3539,9 @@ namespace model {
       bounds.push_back(space.transformation() * space.boundingBox());
     }
 
-    for (unsigned i = 0; i < spaces.size(); ++i) {
-      for (unsigned j = i + 1; j < spaces.size(); ++j) {
-        if (!bounds[i].intersects(bounds[j])) {
-          continue;
-        }
-        spaces[i].matchSurfaces(spaces[j]);
-      }
+    BoundingBoxTree tree(bounds);
+    for (const std::pair<unsigned, unsigned>& pair : tree.intersectingPairs()) {
+      spaces[pair.first].matchSurfaces(spaces[pair.second]);
     }
   }
 
@@ -605,6 +605,11 @@ namespace model {
   /** Intersect surfaces within spaces. */
   MODEL_API void intersectSurfaces(std::vector<Space>& spaces);
 
+  /** Intersect surfaces within spaces using up to numThreads threads, a numThreads of 0 uses all processors.
+   *  Pairs of spaces that do not share a space are intersected concurrently, the model is only modified on the
+   *  calling thread and in the same order as intersectSurfaces(spaces), so the resulting geometry is identical. */
+  MODEL_API void intersectSurfaces(std::vector<Space>& spaces, unsigned numThreads);
+
   /** Match surfaces and sub surfaces within spaces. */
   MODEL_API void matchSurfaces(std::vector<Space>& spaces);
 
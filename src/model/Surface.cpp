@@ -1034,9 +1034,6 @@ namespace model {
     }
 
     boost::optional<SurfaceIntersection> Surface_Impl::computeIntersection(Surface& otherSurface) {
-      double tol = 0.01;       //  1 cm tolerance
-      double areaTol = 0.001;  // 10 cm2 tolerance
-
       boost::optional<Space> space = this->space();
       boost::optional<Space> otherSpace = otherSurface.space();
 
@@ -1055,27 +1052,35 @@ namespace model {
         return boost::none;
       }
 
-      // goes from local system to building coordinates
-      Transformation spaceTransformation = space->transformation();
-      Transformation otherSpaceTransformation = otherSpace->transformation();
+      return applyIntersectionGeometry(
+        otherSurface, computeIntersectionGeometry(this->vertices(), space->transformation(), otherSurface.vertices(), otherSpace->transformation()));
+    }
+
+    SurfaceIntersectionGeometry Surface_Impl::computeIntersectionGeometry(const std::vector<Point3d>& vertices,
+                                                                          const Transformation& spaceTransformation,
+                                                                          const std::vector<Point3d>& otherVertices,
+                                                                          const Transformation& otherSpaceTransformation) {
+      double tol = 0.01;  //  1 cm tolerance
+
+      SurfaceIntersectionGeometry result;
 
       // do the intersection in building coordinates
 
-      Plane plane = spaceTransformation * this->plane();
-      Plane otherPlane = otherSpaceTransformation * otherSurface.plane();
+      Plane plane = spaceTransformation * Plane(vertices);
+      Plane otherPlane = otherSpaceTransformation * Plane(otherVertices);
 
       if (!plane.reverseEqual(otherPlane)) {
-        //LOG(Info, "Planes are not reverse equal, intersection of '" << this->name().get() << "' with '" << otherSurface.name().get() << "' fails");
-        return boost::none;
+        result.status = SurfaceIntersectionGeometry::NotReverseEqual;
+        return result;
       }
 
       // get vertices in building coordinates
-      std::vector<Point3d> buildingVertices = spaceTransformation * this->vertices();
-      std::vector<Point3d> otherBuildingVertices = otherSpaceTransformation * otherSurface.vertices();
+      std::vector<Point3d> buildingVertices = spaceTransformation * vertices;
+      std::vector<Point3d> otherBuildingVertices = otherSpaceTransformation * otherVertices;
 
       if ((buildingVertices.size() < 3) || (otherBuildingVertices.size() < 3)) {
-        LOG(Error, "Fewer than 3 vertices, intersection of '" << this->name().get() << "' with '" << otherSurface.name().get() << "' fails");
-        return boost::none;
+        result.status = SurfaceIntersectionGeometry::TooFewVertices;
+        return result;
       }
 
       // goes from face coordinates of building vertices to building coordinates
@@ -1085,8 +1090,8 @@ namespace model {
         faceTransformation = Transformation::alignFace(buildingVertices);
         faceTransformationInverse = faceTransformation.inverse();
       } catch (const std::exception&) {
-        LOG(Error, "Cannot compute face transform, intersection of '" << this->name().get() << "' with '" << otherSurface.name().get() << "' fails");
-        return boost::none;
+        result.status = SurfaceIntersectionGeometry::NoFaceTransformation;
+        return result;
       }
 
       // put building vertices into face coordinates
@@ -1097,87 +1102,122 @@ namespace model {
       std::reverse(faceVertices.begin(), faceVertices.end());
       //std::reverse(otherFaceVertices.begin(), otherFaceVertices.end());
 
-      //LOG(Info, "Trying intersection of '" << this->name().get() << "' with '" << otherSurface.name().get());
-
       boost::optional<IntersectionResult> intersection = openstudio::intersect(faceVertices, otherFaceVertices, tol);
       if (!intersection) {
-        //LOG(Info, "No intersection");
-        return boost::none;
+        result.status = SurfaceIntersectionGeometry::NoIntersection;
+        return result;
+      }
+
+      result.status = SurfaceIntersectionGeometry::Intersected;
+      result.area1 = getArea(faceVertices);
+      result.area2 = getArea(otherFaceVertices);
+      result.intersectionArea1 = intersection->area1();
+      result.intersectionArea2 = intersection->area2();
+
+      // goes from building coordinates to local system
+      Transformation spaceTransformationInverse = spaceTransformation.inverse();
+      Transformation otherSpaceTransformationInverse = otherSpaceTransformation.inverse();
+
+      std::vector<std::vector<Point3d>> newPolygons1 = intersection->newPolygons1();
+      std::vector<std::vector<Point3d>> newPolygons2 = intersection->newPolygons2();
+      if (newPolygons1.empty() && newPolygons2.empty()) {
+        // both surfaces intersect perfectly, no-op
+        return result;
+      }
+
+      // modify vertices for surface in this space
+      std::vector<Point3d> newBuildingVertices = faceTransformation * intersection->polygon1();
+      std::vector<Point3d> newVertices = spaceTransformationInverse * newBuildingVertices;
+      std::reverse(newVertices.begin(), newVertices.end());
+      result.vertices1 = reorderULC(newVertices);
+
+      // modify vertices for surface in other space
+      std::vector<Point3d> newOtherBuildingVertices = faceTransformation * intersection->polygon2();
+      std::vector<Point3d> newOtherVertices = otherSpaceTransformationInverse * newOtherBuildingVertices;
+      result.vertices2 = reorderULC(newOtherVertices);
+
+      // new surfaces in this space
+      for (const std::vector<Point3d>& newPolygon : newPolygons1) {
+        newBuildingVertices = faceTransformation * newPolygon;
+        newVertices = spaceTransformationInverse * newBuildingVertices;
+        std::reverse(newVertices.begin(), newVertices.end());
+        result.newVertices1.push_back(reorderULC(newVertices));
+      }
+
+      // new surfaces in other space
+      for (const std::vector<Point3d>& newPolygon : newPolygons2) {
+        newOtherBuildingVertices = faceTransformation * newPolygon;
+        newOtherVertices = otherSpaceTransformationInverse * newOtherBuildingVertices;
+        result.newVertices2.push_back(reorderULC(newOtherVertices));
+      }
+
+      return result;
+    }
+
+    boost::optional<SurfaceIntersection> Surface_Impl::applyIntersectionGeometry(Surface& otherSurface, const SurfaceIntersectionGeometry& geometry) {
+      double areaTol = 0.001;  // 10 cm2 tolerance
+
+      switch (geometry.status) {
+        case SurfaceIntersectionGeometry::NotReverseEqual:
+          //LOG(Info, "Planes are not reverse equal, intersection of '" << this->name().get() << "' with '" << otherSurface.name().get() << "' fails");
+          return boost::none;
+        case SurfaceIntersectionGeometry::TooFewVertices:
+          LOG(Error, "Fewer than 3 vertices, intersection of '" << this->name().get() << "' with '" << otherSurface.name().get() << "' fails");
+          return boost::none;
+        case SurfaceIntersectionGeometry::NoFaceTransformation:
+          LOG(Error, "Cannot compute face transform, intersection of '" << this->name().get() << "' with '" << otherSurface.name().get() << "' fails");
+          return boost::none;
+        case SurfaceIntersectionGeometry::NoIntersection:
+          //LOG(Info, "No intersection");
+          return boost::none;
+        case SurfaceIntersectionGeometry::Intersected:
+          break;
       }
 
       // DA - Change tolerance. Current tolerance is 0.0001 which is 1cm2 which is unrealistic
       // tolerance could be fixed, say 10cm2 or as a proportion of the area of the polygon. 4cm2
       // on a polygon of area 570m2 is a tiny fraction
-      boost::optional<double> area1 = getArea(faceVertices);
-      boost::optional<double> area2 = getArea(otherFaceVertices);
-      if (area1) {
-        if (std::abs(area1.get() - intersection->area1()) > areaTol) {
-          LOG(Error, "Initial area of surface '" << this->nameString() << "' " << area1.get() << " does not equal post intersection area "
-                                                 << intersection->area1());
+      if (geometry.area1) {
+        if (std::abs(geometry.area1.get() - geometry.intersectionArea1) > areaTol) {
+          LOG(Error, "Initial area of surface '" << this->nameString() << "' " << geometry.area1.get() << " does not equal post intersection area "
+                                                 << geometry.intersectionArea1);
         }
       }
-      if (area2) {
-        if (std::abs(area2.get() - intersection->area2()) > areaTol) {
-          LOG(Error, "Initial area of other surface '" << otherSurface.nameString() << "' " << area2.get()
-                                                       << " does not equal post intersection area " << intersection->area2());
+      if (geometry.area2) {
+        if (std::abs(geometry.area2.get() - geometry.intersectionArea2) > areaTol) {
+          LOG(Error, "Initial area of other surface '" << otherSurface.nameString() << "' " << geometry.area2.get()
+                                                       << " does not equal post intersection area " << geometry.intersectionArea2);
         }
       }
 
+      boost::optional<Space> space = this->space();
+      boost::optional<Space> otherSpace = otherSurface.space();
+      OS_ASSERT(space);
+      OS_ASSERT(otherSpace);
+
       // non-zero intersection
       // could match here but will save that for other discrete operation
       Surface surface(std::dynamic_pointer_cast<Surface_Impl>(this->shared_from_this()));
       std::vector<Surface> newSurfaces;
       std::vector<Surface> newOtherSurfaces;
 
-      //LOG(Debug, "Before intersection");
-      //LOG(Debug, surface);
-      //LOG(Debug, otherSurface);
-
-      // goes from building coordinates to local system
-      Transformation spaceTransformationInverse = spaceTransformation.inverse();
-      Transformation otherSpaceTransformationInverse = otherSpaceTransformation.inverse();
-
-      std::vector<std::vector<Point3d>> newPolygons1 = intersection->newPolygons1();
-      std::vector<std::vector<Point3d>> newPolygons2 = intersection->newPolygons2();
-      if (newPolygons1.empty() && newPolygons2.empty()) {
+      if (geometry.newVertices1.empty() && geometry.newVertices2.empty()) {
         // both surfaces intersect perfectly, no-op
 
       } else {
         // new surfaces are created
-
-        // modify vertices for surface in this space
-        std::vector<Point3d> newBuildingVertices = faceTransformation * intersection->polygon1();
-        std::vector<Point3d> newVertices = spaceTransformationInverse * newBuildingVertices;
-        std::reverse(newVertices.begin(), newVertices.end());
-        newVertices = reorderULC(newVertices);
-        this->setVertices(newVertices);
-
-        // modify vertices for surface in other space
-        std::vector<Point3d> newOtherBuildingVertices = faceTransformation * intersection->polygon2();
-        std::vector<Point3d> newOtherVertices = otherSpaceTransformationInverse * newOtherBuildingVertices;
-        newOtherVertices = reorderULC(newOtherVertices);
-        otherSurface.setVertices(newOtherVertices);
+        this->setVertices(geometry.vertices1);
+        otherSurface.setVertices(geometry.vertices2);
 
         // create new surfaces in this space
-        for (unsigned i = 0; i < newPolygons1.size(); ++i) {
-
-          // new surface in this space
-          newBuildingVertices = faceTransformation * newPolygons1[i];
-          newVertices = spaceTransformationInverse * newBuildingVertices;
-          std::reverse(newVertices.begin(), newVertices.end());
-          newVertices = reorderULC(newVertices);
+        for (const std::vector<Point3d>& newVertices : geometry.newVertices1) {
           Surface newSurface(newVertices, this->model());
           newSurface.setSpace(*space);
           newSurfaces.push_back(newSurface);
         }
 
         // create new surfaces in other space
-        for (unsigned i = 0; i < newPolygons2.size(); ++i) {
-
-          // new surface in other space
-          newOtherBuildingVertices = faceTransformation * newPolygons2[i];
-          newOtherVertices = otherSpaceTransformationInverse * newOtherBuildingVertices;
-          newOtherVertices = reorderULC(newOtherVertices);
+        for (const std::vector<Point3d>& newOtherVertices : geometry.newVertices2) {
           Surface newOtherSurface(newOtherVertices, this->model());
           newOtherSurface.setSpace(*otherSpace);
           newOtherSurfaces.push_back(newOtherSurface);
@@ -1188,16 +1228,6 @@ namespace model {
 
       LOG(Info, "Intersection of '" << this->name().get() << "' with '" << otherSurface.name().get() << "' results in " << result);
 
-      //LOG(Debug, "After intersection");
-      //LOG(Debug, surface);
-      //LOG(Debug, otherSurface);
-      //for (const Surface& s : newSurfaces){
-      //  LOG(Debug, s);
-      //}
-      //for (const Surface& s : newOtherSurfaces){
-      //  LOG(Debug, s);
-      //}
-
       return result;
     }
 
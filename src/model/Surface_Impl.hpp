@@ -35,6 +35,7 @@
 
 namespace openstudio {
 class Polygon3d;
+class Transformation;
 namespace model {
 
   class AirflowNetworkSurface;
@@ -53,6 +54,37 @@ namespace model {
 
   namespace detail {
 
+    /** SurfaceIntersectionGeometry is the result of intersecting the vertices of two surfaces in different spaces.
+     *  It is computed without touching the model and applied with Surface_Impl::applyIntersectionGeometry.
+     *  All vertices are in the coordinates of the space containing the corresponding surface. */
+    struct SurfaceIntersectionGeometry
+    {
+      enum Status
+      {
+        NotReverseEqual,
+        TooFewVertices,
+        NoFaceTransformation,
+        NoIntersection,
+        Intersected
+      };
+
+      Status status = NoIntersection;
+
+      // areas before and after intersection, used to report area mismatches
+      boost::optional<double> area1;
+      boost::optional<double> area2;
+      double intersectionArea1 = 0.0;
+      double intersectionArea2 = 0.0;
+
+      // new vertices for the two surfaces, empty if the surfaces intersect exactly
+      std::vector<Point3d> vertices1;
+      std::vector<Point3d> vertices2;
+
+      // vertices of the surfaces to create in each space
+      std::vector<std::vector<Point3d>> newVertices1;
+      std::vector<std::vector<Point3d>> newVertices2;
+    };
+
     /** Surface_Impl is a PlanarSurface_Impl that is the implementation class for Surface.*/
     class MODEL_API Surface_Impl : public PlanarSurface_Impl
     {
@@ -221,6 +253,16 @@ namespace model {
       bool intersect(Surface& otherSurface);
       boost::optional<SurfaceIntersection> computeIntersection(Surface& otherSurface);
 
+      /** Computes the intersection of vertices in a space with otherVertices in another space, does not access the model
+       *  so it may be called from any thread. Transformations go from each space's coordinates to building coordinates. */
+      static SurfaceIntersectionGeometry computeIntersectionGeometry(const std::vector<Point3d>& vertices, const Transformation& spaceTransformation,
+                                                                     const std::vector<Point3d>& otherVertices,
+                                                                     const Transformation& otherSpaceTransformation);
+
+      /** Applies geometry from computeIntersectionGeometry to this surface and otherSurface, creating new surfaces in each space.
+       *  Returns none and logs the reason if the surfaces did not intersect. */
+      boost::optional<SurfaceIntersection> applyIntersectionGeometry(Surface& otherSurface, const SurfaceIntersectionGeometry& geometry);
+
       boost::optional<Surface> createAdjacentSurface(const Space& otherSpace);
 
       bool isPartOfEnvelope() const;
@@ -70,9 +70,17 @@
 #include "../utilities/geometry/Geometry.hpp"
 #include "../utilities/geometry/ThreeJS.hpp"
 
+#include "../utilities/core/Filesystem.hpp"
+
 #include <thread>
 
+#include <array>
 #include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <iomanip>
+#include <limits>
+#include <sstream>
 
 namespace openstudio {
 namespace model {
@@ -306,9 +314,9 @@ namespace model {
     }
   }
 
-  void makeGeometries(const PlanarSurface& planarSurface, std::vector<ThreeGeometry>& geometries, std::vector<ThreeUserData>& userDatas,
-                      bool triangulateSurfaces) {
-    std::string name = planarSurface.nameString();
+  // get the faces of a planar surface in site coordinates, triangulated around its sub surfaces if requested
+  // returns an empty vector if triangulation fails
+  Point3dVectorVector getSiteFaceVertices(const PlanarSurface& planarSurface, bool triangulateSurfaces) {
     boost::optional<Surface> surface = planarSurface.optionalCast<Surface>();
     boost::optional<PlanarSurfaceGroup> planarSurfaceGroup = planarSurface.planarSurfaceGroup();
 
@@ -337,18 +345,61 @@ namespace model {
     if (triangulateSurfaces) {
       finalFaceVertices = computeTriangulation(faceVertices, faceSubVertices);
       if (finalFaceVertices.empty()) {
-        LOG_FREE(Error, "modelToThreeJS", "Failed to triangulate surface " << name << " with " << faceSubVertices.size() << " sub surfaces");
-        return;
+        LOG_FREE(Error, "modelToThreeJS",
+                 "Failed to triangulate surface " << planarSurface.nameString() << " with " << faceSubVertices.size() << " sub surfaces");
+        return finalFaceVertices;
       }
     } else {
       finalFaceVertices.push_back(faceVertices);
     }
 
-    Point3dVector allVertices;
-    std::vector<size_t> faceIndices;
+    Point3dVectorVector result;
     for (const auto& finalFaceVerts : finalFaceVertices) {
-      Point3dVector finalVerts = buildingTransformation * t * finalFaceVerts;
+      result.push_back(buildingTransformation * t * finalFaceVerts);
       //normal = buildingTransformation.rotationMatrix*r*z
+    }
+    return result;
+  }
+
+  // check if the adjacent surface is truly adjacent
+  // this controls display only, not energy model
+  void updateCoincidentWithOutsideObject(ThreeUserData& userData, const PlanarSurface& planarSurface) {
+    if (userData.outsideBoundaryConditionObjectHandle().empty()) {
+      return;
+    }
+
+    Transformation buildingTransformation;
+    if (planarSurface.planarSurfaceGroup()) {
+      buildingTransformation = planarSurface.planarSurfaceGroup()->buildingTransformation();
+    }
+
+    UUID adjacentHandle = toUUID(fromThreeUUID(userData.outsideBoundaryConditionObjectHandle()));
+    boost::optional<PlanarSurface> adjacentPlanarSurface = planarSurface.model().getModelObject<PlanarSurface>(adjacentHandle);
+    OS_ASSERT(adjacentPlanarSurface);
+
+    Transformation otherBuildingTransformation;
+    if (adjacentPlanarSurface->planarSurfaceGroup()) {
+      otherBuildingTransformation = adjacentPlanarSurface->planarSurfaceGroup()->buildingTransformation();
+    }
+
+    Point3dVector otherVertices = otherBuildingTransformation * adjacentPlanarSurface->vertices();
+    if (circularEqual(buildingTransformation * planarSurface.vertices(), reverse(otherVertices))) {
+      userData.setCoincidentWithOutsideObject(true);
+    } else {
+      userData.setCoincidentWithOutsideObject(false);
+    }
+  }
+
+  void makeGeometries(const PlanarSurface& planarSurface, std::vector<ThreeGeometry>& geometries, std::vector<ThreeUserData>& userDatas,
+                      bool triangulateSurfaces) {
+    Point3dVectorVector finalFaceVertices = getSiteFaceVertices(planarSurface, triangulateSurfaces);
+    if (finalFaceVertices.empty()) {
+      return;
+    }
+
+    Point3dVector allVertices;
+    std::vector<size_t> faceIndices;
+    for (const auto& finalVerts : finalFaceVertices) {
 
       // https://github.com/mrdoob/three.js/wiki/JSON-Model-format-3
       // 0 indicates triangle
@@ -365,8 +416,8 @@ namespace model {
         faceIndices.push_back(openstudioFaceFormatId());
       }
 
-      Point3dVector::reverse_iterator it = finalVerts.rbegin();
-      Point3dVector::reverse_iterator itend = finalVerts.rend();
+      Point3dVector::const_reverse_iterator it = finalVerts.rbegin();
+      Point3dVector::const_reverse_iterator itend = finalVerts.rend();
       for (; it != itend; ++it) {
         faceIndices.push_back(getVertexIndex(*it, allVertices));
       }
@@ -382,29 +433,98 @@ namespace model {
 
     ThreeUserData userData;
     updateUserData(userData, planarSurface);
+    updateCoincidentWithOutsideObject(userData, planarSurface);
 
-    // check if the adjacent surface is truly adjacent
-    // this controls display only, not energy model
-    if (!userData.outsideBoundaryConditionObjectHandle().empty()) {
-
-      UUID adjacentHandle = toUUID(fromThreeUUID(userData.outsideBoundaryConditionObjectHandle()));
-      boost::optional<PlanarSurface> adjacentPlanarSurface = planarSurface.model().getModelObject<PlanarSurface>(adjacentHandle);
-      OS_ASSERT(adjacentPlanarSurface);
+    userDatas.push_back(userData);
+  }
 
-      Transformation otherBuildingTransformation;
-      if (adjacentPlanarSurface->planarSurfaceGroup()) {
-        otherBuildingTransformation = adjacentPlanarSurface->planarSurfaceGroup()->buildingTransformation();
+  // quote and escape a string for the glTF JSON chunk
+  std::string toGLBJsonString(const std::string& s) {
+    std::string result("\"");
+    for (char c : s) {
+      switch (c) {
+        case '"':
+          result += "\\\"";
+          break;
+        case '\\':
+          result += "\\\\";
+          break;
+        case '\n':
+          result += "\\n";
+          break;
+        case '\r':
+          result += "\\r";
+          break;
+        case '\t':
+          result += "\\t";
+          break;
+        default:
+          if (static_cast<unsigned char>(c) < 0x20) {
+            char buffer[8];
+            std::snprintf(buffer, sizeof(buffer), "\\u%04x", static_cast<unsigned>(c));
+            result += buffer;
+          } else {
+            result += c;
+          }
       }
+    }
+    result += '"';
+    return result;
+  }
 
-      Point3dVector otherVertices = otherBuildingTransformation * adjacentPlanarSurface->vertices();
-      if (circularEqual(buildingTransformation * vertices, reverse(otherVertices))) {
-        userData.setCoincidentWithOutsideObject(true);
-      } else {
-        userData.setCoincidentWithOutsideObject(false);
-      }
+  // GLB is little endian regardless of platform
+  void appendGLBUInt32(std::string& bytes, uint32_t value) {
+    bytes += static_cast<char>(value & 0xFF);
+    bytes += static_cast<char>((value >> 8) & 0xFF);
+    bytes += static_cast<char>((value >> 16) & 0xFF);
+    bytes += static_cast<char>((value >> 24) & 0xFF);
+  }
+
+  void appendGLBFloat(std::string& bytes, float value) {
+    uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    appendGLBUInt32(bytes, bits);
+  }
+
+  // index of a vertex in the shared position buffer, vertices within 1 mm are merged
+  uint32_t getGLBVertexIndex(const Point3d& point3d, std::map<std::array<long long, 3>, uint32_t>& vertexMap, std::vector<Point3d>& vertices) {
+    std::array<long long, 3> key{std::llround(point3d.x() * 1000.0), std::llround(point3d.y() * 1000.0), std::llround(point3d.z() * 1000.0)};
+    auto it = vertexMap.find(key);
+    if (it != vertexMap.end()) {
+      return it->second;
     }
+    auto result = static_cast<uint32_t>(vertices.size());
+    vertexMap.emplace(key, result);
+    vertices.push_back(point3d);
+    return result;
+  }
 
-    userDatas.push_back(userData);
+  void writeGLBExtras(std::ostream& json, const ThreeUserData& userData) {
+    json << "{\"handle\":" << toGLBJsonString(userData.handle());
+    json << ",\"name\":" << toGLBJsonString(userData.name());
+    json << ",\"surfaceType\":" << toGLBJsonString(userData.surfaceType());
+    json << ",\"surfaceTypeMaterialName\":" << toGLBJsonString(userData.surfaceTypeMaterialName());
+    json << ",\"constructionName\":" << toGLBJsonString(userData.constructionName());
+    json << ",\"constructionMaterialName\":" << toGLBJsonString(userData.constructionMaterialName());
+    json << ",\"surfaceName\":" << toGLBJsonString(userData.surfaceName());
+    json << ",\"surfaceHandle\":" << toGLBJsonString(userData.surfaceHandle());
+    json << ",\"spaceName\":" << toGLBJsonString(userData.spaceName());
+    json << ",\"thermalZoneName\":" << toGLBJsonString(userData.thermalZoneName());
+    json << ",\"thermalZoneMaterialName\":" << toGLBJsonString(userData.thermalZoneMaterialName());
+    json << ",\"spaceTypeName\":" << toGLBJsonString(userData.spaceTypeName());
+    json << ",\"spaceTypeMaterialName\":" << toGLBJsonString(userData.spaceTypeMaterialName());
+    json << ",\"buildingStoryName\":" << toGLBJsonString(userData.buildingStoryName());
+    json << ",\"buildingStoryMaterialName\":" << toGLBJsonString(userData.buildingStoryMaterialName());
+    json << ",\"buildingUnitName\":" << toGLBJsonString(userData.buildingUnitName());
+    json << ",\"buildingUnitMaterialName\":" << toGLBJsonString(userData.buildingUnitMaterialName());
+    json << ",\"boundaryMaterialName\":" << toGLBJsonString(userData.boundaryMaterialName());
+    json << ",\"outsideBoundaryCondition\":" << toGLBJsonString(userData.outsideBoundaryCondition());
+    json << ",\"outsideBoundaryConditionObjectName\":" << toGLBJsonString(userData.outsideBoundaryConditionObjectName());
+    json << ",\"outsideBoundaryConditionObjectHandle\":" << toGLBJsonString(userData.outsideBoundaryConditionObjectHandle());
+    json << ",\"coincidentWithOutsideObject\":" << (userData.coincidentWithOutsideObject() ? "true" : "false");
+    json << ",\"sunExposure\":" << toGLBJsonString(userData.sunExposure());
+    json << ",\"windExposure\":" << toGLBJsonString(userData.windExposure());
+    json << "}";
   }
 
   ThreeJSForwardTranslator::ThreeJSForwardTranslator() {
@@ -627,5 +747,188 @@ namespace model {
     return scene;
   }
 
+  bool ThreeJSForwardTranslator::modelToGLB(const Model& model, const openstudio::path& path) {
+    openstudio::filesystem::ofstream file(path, std::ios_base::binary);
+    if (!file.is_open()) {
+      LOG(Error, "Cannot open file '" << toString(path) << "' for writing");
+      return false;
+    }
+    return modelToGLB(model, file);
+  }
+
+  bool ThreeJSForwardTranslator::modelToGLB(const Model& model, std::ostream& os) {
+    return modelToGLB(model, os, [](double percentage) {});
+  }
+
+  bool ThreeJSForwardTranslator::modelToGLB(const Model& model, std::ostream& os, std::function<void(double)> updatePercentage) {
+    m_logSink.setThreadId(std::this_thread::get_id());
+    m_logSink.resetStringStream();
+
+    updatePercentage(0.0);
+
+    std::vector<ThreeMaterial> materials;
+    std::map<std::string, std::string> materialMap;
+    for (const auto& material : makeStandardThreeMaterials()) {
+      addThreeMaterial(materials, materialMap, material);
+    }
+    buildMaterials(model, materials, materialMap);
+
+    std::map<std::string, unsigned> materialIndices;
+    for (unsigned i = 0; i < materials.size(); ++i) {
+      materialIndices.emplace(materials[i].name(), i);
+    }
+
+    std::vector<PlanarSurface> planarSurfaces = model.getModelObjects<PlanarSurface>();
+    double n = 0;
+    std::vector<PlanarSurface>::size_type N = planarSurfaces.size() + 1;
+
+    // one node and mesh per surface, all meshes index into a single shared position buffer
+    std::map<std::array<long long, 3>, uint32_t> vertexMap;
+    std::vector<Point3d> vertices;
+    std::string indexBytes;
+    std::ostringstream meshes;
+    std::ostringstream nodes;
+    std::ostringstream indexAccessors;
+    meshes.imbue(std::locale::classic());
+    nodes.imbue(std::locale::classic());
+    unsigned nMeshes = 0;
+
+    for (const auto& planarSurface : planarSurfaces) {
+      Point3dVectorVector faces = getSiteFaceVertices(planarSurface, true);
+      if (!faces.empty()) {
+        size_t byteOffset = indexBytes.size();
+        uint32_t count = 0;
+        for (const auto& face : faces) {
+          // same winding as the ThreeJS faces
+          for (auto it = face.rbegin(); it != face.rend(); ++it) {
+            appendGLBUInt32(indexBytes, getGLBVertexIndex(*it, vertexMap, vertices));
+            ++count;
+          }
+        }
+
+        ThreeUserData userData;
+        updateUserData(userData, planarSurface);
+        updateCoincidentWithOutsideObject(userData, planarSurface);
+
+        // accessor 0 is the position buffer
+        std::string separator = (nMeshes == 0) ? "" : ",";
+        indexAccessors << separator << "{\"bufferView\":1,\"byteOffset\":" << byteOffset << ",\"componentType\":5125,\"count\":" << count
+                       << ",\"type\":\"SCALAR\"}";
+        meshes << separator << "{\"name\":" << toGLBJsonString(userData.name()) << ",\"primitives\":[{\"attributes\":{\"POSITION\":0},\"indices\":"
+               << nMeshes + 1;
+        auto materialIt = materialIndices.find(userData.surfaceTypeMaterialName());
+        if (materialIt != materialIndices.end()) {
+          meshes << ",\"material\":" << materialIt->second;
+        }
+        meshes << ",\"mode\":4}]}";
+        nodes << separator << "{\"name\":" << toGLBJsonString(userData.name()) << ",\"mesh\":" << nMeshes << ",\"extras\":";
+        writeGLBExtras(nodes, userData);
+        nodes << "}";
+        ++nMeshes;
+      }
+
+      n += 1;
+      updatePercentage(100.0 * n / N);
+    }
+
+    // glTF is Y up, OpenStudio is Z up
+    std::string binBytes;
+    binBytes.reserve(vertices.size() * 12 + indexBytes.size());
+    std::array<float, 3> minPosition{0, 0, 0};
+    std::array<float, 3> maxPosition{0, 0, 0};
+    for (size_t i = 0; i < vertices.size(); ++i) {
+      std::array<float, 3> position{static_cast<float>(vertices[i].x()), static_cast<float>(vertices[i].z()), static_cast<float>(-vertices[i].y())};
+      for (unsigned j = 0; j < 3; ++j) {
+        appendGLBFloat(binBytes, position[j]);
+        if (i == 0 || position[j] < minPosition[j]) {
+          minPosition[j] = position[j];
+        }
+        if (i == 0 || position[j] > maxPosition[j]) {
+          maxPosition[j] = position[j];
+        }
+      }
+    }
+    size_t positionsLength = binBytes.size();
+    binBytes += indexBytes;
+
+    std::vector<std::string> buildingStoryNames;
+    for (const auto& buildingStory : model.getConcreteModelObjects<BuildingStory>()) {
+      buildingStoryNames.push_back(buildingStory.nameString());
+    }
+    std::sort(buildingStoryNames.begin(), buildingStoryNames.end(), IstringCompare());
+
+    double northAxis = 0.0;
+    boost::optional<Building> building = model.getOptionalUniqueModelObject<Building>();
+    if (building) {
+      northAxis = -building->northAxis();
+    }
+
+    std::ostringstream json;
+    json.imbue(std::locale::classic());
+    json << std::setprecision(std::numeric_limits<float>::max_digits10);
+    json << "{\"asset\":{\"version\":\"2.0\",\"generator\":\"OpenStudio\"},\"scene\":0,\"scenes\":[{\"nodes\":[";
+    for (unsigned i = 0; i < nMeshes; ++i) {
+      json << (i == 0 ? "" : ",") << i;
+    }
+    json << "],\"extras\":{\"northAxis\":" << northAxis << ",\"buildingStoryNames\":[";
+    for (size_t i = 0; i < buildingStoryNames.size(); ++i) {
+      json << (i == 0 ? "" : ",") << toGLBJsonString(buildingStoryNames[i]);
+    }
+    json << "]}}]";
+
+    json << ",\"materials\":[";
+    for (size_t i = 0; i < materials.size(); ++i) {
+      unsigned color = materials[i].color();
+      json << (i == 0 ? "" : ",") << "{\"name\":" << toGLBJsonString(materials[i].name()) << ",\"pbrMetallicRoughness\":{\"baseColorFactor\":["
+           << ((color >> 16) & 0xFF) / 255.0 << "," << ((color >> 8) & 0xFF) / 255.0 << "," << (color & 0xFF) / 255.0 << ","
+           << materials[i].opacity() << "],\"metallicFactor\":0,\"roughnessFactor\":1}";
+      if (materials[i].transparent()) {
+        json << ",\"alphaMode\":\"BLEND\"";
+      }
+      if (materials[i].side() == DoubleSide) {
+        json << ",\"doubleSided\":true";
+      }
+      json << "}";
+    }
+    json << "]";
+
+    if (nMeshes > 0) {
+      json << ",\"nodes\":[" << nodes.str() << "],\"meshes\":[" << meshes.str() << "]";
+      json << ",\"accessors\":[{\"bufferView\":0,\"componentType\":5126,\"count\":" << vertices.size() << ",\"type\":\"VEC3\",\"min\":["
+           << minPosition[0] << "," << minPosition[1] << "," << minPosition[2] << "],\"max\":[" << maxPosition[0] << "," << maxPosition[1] << ","
+           << maxPosition[2] << "]}," << indexAccessors.str() << "]";
+      json << ",\"bufferViews\":[{\"buffer\":0,\"byteOffset\":0,\"byteLength\":" << positionsLength << ",\"target\":34962}"
+           << ",{\"buffer\":0,\"byteOffset\":" << positionsLength << ",\"byteLength\":" << indexBytes.size() << ",\"target\":34963}]";
+      json << ",\"buffers\":[{\"byteLength\":" << binBytes.size() << "}]";
+    }
+    json << "}";
+
+    // chunks are padded to 4 bytes, JSON with spaces and BIN with zeros
+    std::string jsonBytes = json.str();
+    jsonBytes.append((4 - jsonBytes.size() % 4) % 4, ' ');
+    binBytes.append((4 - binBytes.size() % 4) % 4, '\0');
+
+    std::string header;
+    appendGLBUInt32(header, 0x46546C67);  // "glTF"
+    appendGLBUInt32(header, 2);
+    auto totalLength = static_cast<uint32_t>(12 + 8 + jsonBytes.size() + ((nMeshes > 0) ? 8 + binBytes.size() : 0));
+    appendGLBUInt32(header, totalLength);
+    appendGLBUInt32(header, static_cast<uint32_t>(jsonBytes.size()));
+    appendGLBUInt32(header, 0x4E4F534A);  // "JSON"
+    os.write(header.data(), header.size());
+    os.write(jsonBytes.data(), jsonBytes.size());
+    if (nMeshes > 0) {
+      std::string binHeader;
+      appendGLBUInt32(binHeader, static_cast<uint32_t>(binBytes.size()));
+      appendGLBUInt32(binHeader, 0x004E4942);  // "BIN"
+      os.write(binHeader.data(), binHeader.size());
+      os.write(binBytes.data(), binBytes.size());
+    }
+
+    updatePercentage(100.0);
+
+    return os.good();
+  }
+
 }  // namespace model
 }  // namespace openstudio
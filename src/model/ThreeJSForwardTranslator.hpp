@@ -37,6 +37,9 @@
 #include "../utilities/geometry/ThreeJS.hpp"
 #include "../utilities/core/Logger.hpp"
 #include "../utilities/core/StringStreamLogSink.hpp"
+#include "../utilities/core/Path.hpp"
+
+#include <ostream>
 
 namespace openstudio {
 namespace model {
@@ -58,6 +61,13 @@ namespace model {
     ThreeScene modelToThreeJS(const Model& model, bool triangulateSurfaces);
     ThreeScene modelToThreeJS(const Model& model, bool triangulateSurfaces, std::function<void(double)> updatePercentage);
 
+    /// Convert an OpenStudio Model to binary glTF (GLB) for display. Surfaces are triangulated and share one indexed
+    /// vertex buffer, each surface is a node whose extras hold the same user data as the ThreeJS scene children.
+    /// Geometry is written Y up as glTF requires. The GLB is built directly from model geometry, no ThreeScene is created.
+    bool modelToGLB(const Model& model, const openstudio::path& path);
+    bool modelToGLB(const Model& model, std::ostream& os);
+    bool modelToGLB(const Model& model, std::ostream& os, std::function<void(double)> updatePercentage);
+
     /// Get warning messages generated by the last translation.
     std::vector<LogMessage> warnings() const;
 
@@ -33,6 +33,7 @@
 
 #include "../Building.hpp"
 #include "../Building_Impl.hpp"
+#include "../Model_Impl.hpp"
 
 #include "../ThermalZone.hpp"
 #include "../ThermalZone_Impl.hpp"
@@ -166,6 +167,71 @@ TEST_F(ModelFixture, Building_SpaceAttributes) {
   EXPECT_NEAR(2.0 / 100.0, building.peoplePerFloorArea(), 0.0001);
 }
 
+TEST_F(ModelFixture, Building_AggregateCache) {
+  Model model;
+
+  Building building = model.getUniqueModelObject<Building>();
+
+  Point3dVector points{{0, 10, 0}, {10, 10, 0}, {10, 0, 0}, {0, 0, 0}};
+  boost::optional<Space> space1 = Space::fromFloorPrint(points, 3.0, model);
+  ASSERT_TRUE(space1);
+  points = {{10, 10, 0}, {20, 10, 0}, {20, 0, 0}, {10, 0, 0}};
+  boost::optional<Space> space2 = Space::fromFloorPrint(points, 3.0, model);
+  ASSERT_TRUE(space2);
+
+  LightsDefinition lightsDefinition(model);
+  EXPECT_TRUE(lightsDefinition.setLightingLevel(100));
+  Lights light(lightsDefinition);
+  EXPECT_TRUE(light.setSpace(*space1));
+
+  std::vector<Space> spaces = building.spaces();
+  ASSERT_EQ(2u, spaces.size());
+  std::vector<double> floorAreas = building.spaceFloorAreas();
+  std::vector<double> lightingPowers = building.spaceLightingPowers();
+  std::vector<double> numberOfPeople = building.spaceNumberOfPeople();
+  ASSERT_EQ(2u, floorAreas.size());
+  ASSERT_EQ(2u, lightingPowers.size());
+  ASSERT_EQ(2u, numberOfPeople.size());
+  for (unsigned i = 0; i < spaces.size(); ++i) {
+    EXPECT_DOUBLE_EQ(spaces[i].floorArea(), floorAreas[i]);
+    EXPECT_DOUBLE_EQ(spaces[i].lightingPower(), lightingPowers[i]);
+    EXPECT_DOUBLE_EQ(0.0, numberOfPeople[i]);
+  }
+
+  // reading metrics does not change the model, so they are served from the cache
+  unsigned revision = model.getImpl<detail::Model_Impl>()->dataRevision();
+  EXPECT_NEAR(200, building.floorArea(), 0.0001);
+  EXPECT_NEAR(100, building.lightingPower(), 0.0001);
+  EXPECT_NEAR(0.5, building.lightingPowerPerFloorArea(), 0.0001);
+  EXPECT_EQ(revision, model.getImpl<detail::Model_Impl>()->dataRevision());
+
+  // any change to the model invalidates the memoized values
+  std::vector<Surface> floors;
+  for (const Surface& surface : space2->surfaces()) {
+    if (surface.surfaceType() == "Floor") {
+      floors.push_back(surface);
+    }
+  }
+  ASSERT_EQ(1u, floors.size());
+  floors[0].remove();
+  EXPECT_NE(revision, model.getImpl<detail::Model_Impl>()->dataRevision());
+  EXPECT_NEAR(0, space2->floorArea(), 0.0001);
+  EXPECT_NEAR(100, building.floorArea(), 0.0001);
+  EXPECT_NEAR(1, building.lightingPowerPerFloorArea(), 0.0001);
+
+  EXPECT_TRUE(lightsDefinition.setLightingLevel(50));
+  EXPECT_NEAR(50, space1->lightingPower(), 0.0001);
+  EXPECT_NEAR(50, building.lightingPower(), 0.0001);
+
+  PeopleDefinition peopleDefinition(model);
+  EXPECT_TRUE(peopleDefinition.setNumberofPeople(4));
+  People person(peopleDefinition);
+  EXPECT_TRUE(person.setSpace(*space1));
+  EXPECT_NEAR(4, space1->numberOfPeople(), 0.0001);
+  EXPECT_NEAR(0.04, space1->peoplePerFloorArea(), 0.0001);
+  EXPECT_NEAR(0.04, building.peoplePerFloorArea(), 0.0001);
+}
+
 TEST_F(ModelFixture, Building_SpaceTypeAttributes) {
   Model model;
 
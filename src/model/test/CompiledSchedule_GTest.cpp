@@ -0,0 +1,212 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2021, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+
+#include <gtest/gtest.h>
+
+#include "ModelFixture.hpp"
+#include "../CompiledSchedule.hpp"
+#include "../ScheduleCompact.hpp"
+#include "../ScheduleConstant.hpp"
+#include "../ScheduleDay.hpp"
+#include "../ScheduleFixedInterval.hpp"
+#include "../ScheduleRule.hpp"
+#include "../ScheduleRuleset.hpp"
+#include "../ScheduleWeek.hpp"
+#include "../ScheduleYear.hpp"
+
+#include "../../utilities/idf/IdfExtensibleGroup.hpp"
+#include "../../utilities/time/Date.hpp"
+#include "../../utilities/time/Time.hpp"
+
+using namespace openstudio::model;
+using namespace openstudio;
+
+TEST_F(ModelFixture, CompiledSchedule_Ruleset) {
+  Model model;
+  model.setCalendarYear(2012);
+
+  ScheduleRuleset schedule(model);
+  ScheduleDay defaultDay = schedule.defaultDaySchedule();
+  defaultDay.addValue(Time(0, 8, 0), 0.2);
+  defaultDay.addValue(Time(0, 18, 0), 1.0);
+  defaultDay.addValue(Time(0, 24, 0), 0.3);
+
+  ScheduleRule weekendRule(schedule);
+  weekendRule.setApplySaturday(true);
+  weekendRule.setApplySunday(true);
+  weekendRule.daySchedule().addValue(Time(0, 24, 0), 0.1);
+
+  ScheduleRule summerRule(schedule);
+  summerRule.setApplyAllDays(true);
+  summerRule.setStartDate(model.makeDate(MonthOfYear::Jun, 1));
+  summerRule.setEndDate(model.makeDate(MonthOfYear::Aug, 31));
+  ScheduleDay summerDay = summerRule.daySchedule();
+  summerDay.setInterpolatetoTimestep(true);
+  summerDay.addValue(Time(0, 6, 0), 0.0);
+  summerDay.addValue(Time(0, 12, 0), 1.0);
+  summerDay.addValue(Time(0, 24, 0), 0.5);
+
+  boost::optional<CompiledSchedule> compiled = CompiledSchedule::compile(schedule);
+  ASSERT_TRUE(compiled);
+  EXPECT_EQ(366u, compiled->numberOfDays());
+  EXPECT_EQ(3u, compiled->numberOfDayProfiles());
+  EXPECT_EQ(Date(MonthOfYear::Jan, 1, 2012), compiled->startDate());
+
+  Date startDate = compiled->startDate();
+  std::vector<ScheduleDay> daySchedules = schedule.getDaySchedules(startDate, model.makeDate(MonthOfYear::Dec, 31));
+  ASSERT_EQ(366u, daySchedules.size());
+
+  unsigned timestepsPerHour = 4;
+  std::vector<double> values = compiled->evaluate(timestepsPerHour);
+  ASSERT_EQ(366u * 24u * timestepsPerHour, values.size());
+
+  unsigned index = 0;
+  for (unsigned day = 1; day <= 366; ++day) {
+    const ScheduleDay& daySchedule = daySchedules[day - 1];
+    for (unsigned i = 1; i <= 24 * timestepsPerHour; ++i, ++index) {
+      Time time(0, 0, 15 * i);
+      double expected = daySchedule.getValue(time);
+      EXPECT_DOUBLE_EQ(expected, values[index]) << day << " " << time;
+      EXPECT_DOUBLE_EQ(expected, compiled->value(day, time)) << day << " " << time;
+    }
+  }
+
+  // spot checks
+  EXPECT_DOUBLE_EQ(0.2, compiled->value(Date(MonthOfYear::Jan, 2, 2012), Time(0, 8, 0)));   // Monday
+  EXPECT_DOUBLE_EQ(1.0, compiled->value(Date(MonthOfYear::Jan, 2, 2012), Time(0, 8, 1)));   // Monday
+  EXPECT_DOUBLE_EQ(0.1, compiled->value(Date(MonthOfYear::Jan, 1, 2012), Time(0, 12, 0)));  // Sunday
+  EXPECT_DOUBLE_EQ(0.5, compiled->value(Date(MonthOfYear::Jun, 4, 2012), Time(0, 9, 0)));   // interpolated
+  EXPECT_DOUBLE_EQ(0.0, compiled->value(367, Time(0, 12, 0)));
+  EXPECT_DOUBLE_EQ(0.0, compiled->value(1, Time(1, 0, 1)));
+  EXPECT_EQ(compiled->dayProfileIndex(1), compiled->dayProfileIndex(7));
+  EXPECT_NE(compiled->dayProfileIndex(1), compiled->dayProfileIndex(2));
+
+  EXPECT_TRUE(compiled->evaluate(0).empty());
+}
+
+TEST_F(ModelFixture, CompiledSchedule_Year) {
+  Model model;
+
+  ScheduleDay weekday(model, 1.0);
+  ScheduleDay weekend(model, 0.25);
+  ScheduleDay winter(model, 0.5);
+
+  ScheduleWeek winterWeek(model);
+  winterWeek.setAllSchedules(winter);
+  ScheduleWeek summerWeek(model);
+  summerWeek.setWeekdaySchedule(weekday);
+  summerWeek.setWeekendSchedule(weekend);
+
+  ScheduleYear schedule(model);
+  EXPECT_TRUE(schedule.addScheduleWeek(model.makeDate(MonthOfYear::Apr, 30), winterWeek));
+  EXPECT_TRUE(schedule.addScheduleWeek(model.makeDate(MonthOfYear::Sep, 30), summerWeek));
+
+  boost::optional<CompiledSchedule> compiled = CompiledSchedule::compile(schedule);
+  ASSERT_TRUE(compiled);
+  EXPECT_EQ(365u, compiled->numberOfDays());
+
+  Date date = compiled->startDate();
+  for (unsigned day = 1; day <= compiled->numberOfDays(); ++day, date += Time(1)) {
+    double expected = 0.0;
+    if (boost::optional<ScheduleWeek> week = schedule.getScheduleWeek(date)) {
+      DayOfWeek dayOfWeek = date.dayOfWeek();
+      if ((dayOfWeek == DayOfWeek::Saturday) || (dayOfWeek == DayOfWeek::Sunday)) {
+        expected = week->saturdaySchedule()->getValue(Time(0, 12, 0));
+      } else {
+        expected = week->mondaySchedule()->getValue(Time(0, 12, 0));
+      }
+    }
+    EXPECT_DOUBLE_EQ(expected, compiled->value(day, Time(0, 12, 0))) << date;
+  }
+
+  // nothing is scheduled after September
+  EXPECT_DOUBLE_EQ(0.0, compiled->value(model.makeDate(MonthOfYear::Oct, 1), Time(0, 12, 0)));
+}
+
+TEST_F(ModelFixture, CompiledSchedule_Compact) {
+  Model model;
+
+  ScheduleCompact constant(model, 0.75);
+  boost::optional<CompiledSchedule> compiled = CompiledSchedule::compile(constant);
+  ASSERT_TRUE(compiled);
+  EXPECT_EQ(1u, compiled->numberOfDayProfiles());
+  for (double value : compiled->evaluate()) {
+    EXPECT_DOUBLE_EQ(0.75, value);
+  }
+
+  ScheduleCompact schedule(model);
+  for (const std::string& field : {"Through: 6/30", "For: Weekdays", "Until: 08:00", "0.1", "Until: 24:00", "0.9", "For: AllOtherDays",
+                                   "Until: 24:00", "0.2", "Through: 12/31", "For: AllDays", "Interpolate: Linear", "Until: 12:00", "0.0",
+                                   "Until: 24:00", "1.0"}) {
+    EXPECT_FALSE(schedule.pushExtensibleGroup(std::vector<std::string>{field}).empty());
+  }
+  compiled = CompiledSchedule::compile(schedule);
+  ASSERT_TRUE(compiled);
+  EXPECT_EQ(3u, compiled->numberOfDayProfiles());
+
+  Date monday = model.makeDate(MonthOfYear::Jan, 5);
+  ASSERT_EQ(DayOfWeek::Monday, monday.dayOfWeek().value());
+  EXPECT_DOUBLE_EQ(0.1, compiled->value(monday, Time(0, 8, 0)));
+  EXPECT_DOUBLE_EQ(0.9, compiled->value(monday, Time(0, 9, 0)));
+  EXPECT_DOUBLE_EQ(0.2, compiled->value(monday - Time(1), Time(0, 9, 0)));
+  EXPECT_DOUBLE_EQ(0.0, compiled->value(model.makeDate(MonthOfYear::Jul, 1), Time(0, 12, 0)));
+  EXPECT_DOUBLE_EQ(0.5, compiled->value(model.makeDate(MonthOfYear::Jul, 1), Time(0, 18, 0)));
+
+  ScheduleCompact bad(model);
+  bad.pushExtensibleGroup(std::vector<std::string>{"Through: 12/31"});
+  bad.pushExtensibleGroup(std::vector<std::string>{"For: AllDays"});
+  bad.pushExtensibleGroup(std::vector<std::string>{"Until: noon"});
+  EXPECT_FALSE(CompiledSchedule::compile(bad));
+}
+
+TEST_F(ModelFixture, CompiledSchedule_Other) {
+  Model model;
+
+  ScheduleConstant constant(model);
+  constant.setValue(3.0);
+  boost::optional<CompiledSchedule> compiled = CompiledSchedule::compile(constant);
+  ASSERT_TRUE(compiled);
+  std::vector<double> values = compiled->evaluate(6);
+  ASSERT_EQ(365u * 24u * 6u, values.size());
+  for (double value : values) {
+    EXPECT_DOUBLE_EQ(3.0, value);
+  }
+
+  ScheduleDay scheduleDay(model);
+  scheduleDay.addValue(Time(0, 12, 0), 2.0);
+  scheduleDay.addValue(Time(0, 24, 0), 4.0);
+  CompiledSchedule compiledDay = CompiledSchedule::compile(scheduleDay);
+  EXPECT_EQ(1u, compiledDay.numberOfDayProfiles());
+  EXPECT_DOUBLE_EQ(2.0, compiledDay.value(100, Time(0, 12, 0)));
+  EXPECT_DOUBLE_EQ(4.0, compiledDay.value(100, Time(0, 12, 1)));
+
+  ScheduleFixedInterval interval(model);
+  EXPECT_FALSE(CompiledSchedule::compile(interval));
+}
@@ -39,6 +39,9 @@
 #include "../HVACTemplates.hpp"
 #include "../Node.hpp"
 #include "../Node_Impl.hpp"
+#include "../PlantLoop.hpp"
+#include "../PumpVariableSpeed.hpp"
+#include "../CoilHeatingWater.hpp"
 
 #include "../AirLoopHVACUnitarySystem.hpp"
 
@@ -116,3 +119,52 @@ TEST_F(ModelFixture, Loop_DeleteUnitaryVAVChangeoverBypassAirLoopHVAC) {
   inletComponents = airLoopHVAC.supplyComponents(supplyInletNode, supplyOutletNode);
   EXPECT_EQ(3, inletComponents.size());
 }
+
+TEST_F(ModelFixture, Loop_CachedComponentsFollowConnections) {
+  Model m;
+  PlantLoop plantLoop(m);
+  Schedule s = m.alwaysOnDiscreteSchedule();
+
+  // repeated queries give the same answer
+  std::vector<ModelObject> supplyComponents = plantLoop.supplyComponents();
+  EXPECT_EQ(5u, supplyComponents.size());
+  EXPECT_EQ(supplyComponents, plantLoop.supplyComponents());
+  EXPECT_TRUE(plantLoop.supplyComponent(plantLoop.supplyInletNode().handle()));
+  EXPECT_FALSE(plantLoop.demandComponent(plantLoop.supplyInletNode().handle()));
+
+  // adding a component is seen by the handle and type lookups
+  PumpVariableSpeed pump(m);
+  EXPECT_FALSE(plantLoop.supplyComponent(pump.handle()));
+  Node supplyInletNode = plantLoop.supplyInletNode();
+  EXPECT_TRUE(pump.addToNode(supplyInletNode));
+  EXPECT_EQ(7u, plantLoop.supplyComponents().size());
+  ASSERT_TRUE(plantLoop.supplyComponent(pump.handle()));
+  EXPECT_EQ(pump, plantLoop.supplyComponent(pump.handle()).get());
+  ASSERT_EQ(1u, plantLoop.supplyComponents(PumpVariableSpeed::iddObjectType()).size());
+  EXPECT_EQ(pump, plantLoop.supplyComponents(PumpVariableSpeed::iddObjectType())[0]);
+
+  CoilHeatingWater coil(m, s);
+  std::vector<ModelObject> demandComponents = plantLoop.demandComponents();
+  EXPECT_TRUE(plantLoop.addDemandBranchForComponent(coil));
+  EXPECT_EQ(demandComponents.size() + 2, plantLoop.demandComponents().size());
+  EXPECT_TRUE(plantLoop.demandComponent(coil.handle()));
+  EXPECT_EQ(1u, plantLoop.demandComponents(CoilHeatingWater::iddObjectType()).size());
+
+  // so is removing them
+  pump.remove();
+  EXPECT_FALSE(plantLoop.supplyComponent(pump.handle()));
+  EXPECT_TRUE(plantLoop.supplyComponents(PumpVariableSpeed::iddObjectType()).empty());
+  EXPECT_EQ(supplyComponents.size(), plantLoop.supplyComponents().size());
+
+  EXPECT_TRUE(plantLoop.removeDemandBranchWithComponent(coil));
+  EXPECT_FALSE(plantLoop.demandComponent(coil.handle()));
+  EXPECT_EQ(demandComponents.size(), plantLoop.demandComponents().size());
+
+  // clones have their own components
+  Model m2 = m.clone().cast<Model>();
+  std::vector<PlantLoop> plantLoops = m2.getConcreteModelObjects<PlantLoop>();
+  ASSERT_EQ(1u, plantLoops.size());
+  EXPECT_EQ(supplyComponents.size(), plantLoops[0].supplyComponents().size());
+  EXPECT_FALSE(plantLoops[0].supplyComponent(plantLoop.supplyInletNode().handle()));
+  EXPECT_TRUE(plantLoops[0].supplyComponent(plantLoops[0].supplyInletNode().handle()));
+}
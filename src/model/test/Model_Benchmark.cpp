@@ -90,6 +90,29 @@ static void BM_SetUpPlantLoop(benchmark::State& state) {
   state.SetComplexityN(state.range(0));
 }
 
+// Query the demand side of a plant loop with N coils, as translation and measures do repeatedly
+static void BM_PlantLoopDemandComponents(benchmark::State& state) {
+
+  Model m;
+  Schedule alwaysOn = m.alwaysOnDiscreteSchedule();
+  PlantLoop p(m);
+  std::vector<CoilHeatingWater> coils;
+  for (auto i = 0; i < state.range(0); ++i) {
+    coils.emplace_back(m, alwaysOn);
+    p.addDemandBranchForComponent(coils.back());
+  }
+
+  // Code inside this loop is measured repeatedly
+  for (auto _ : state) {
+    for (const auto& coil : coils) {
+      benchmark::DoNotOptimize(p.demandComponent(coil.handle()));
+    }
+    benchmark::DoNotOptimize(p.demandComponents(CoilHeatingWater::iddObjectType()));
+  }
+
+  state.SetComplexityN(state.range(0));
+}
+
 // Regular run, with n=512
 /*
 BENCHMARK(BM_WorkspaceSetNameWithChecks)->Unit(benchmark::kMillisecond)->Arg(512);
@@ -105,3 +128,5 @@ BENCHMARK(BM_AddObjects)->Unit(benchmark::kMillisecond)->RangeMultiplier(2)->Ran
 // 128 takes 14secs,  512 takes about 300 seconds, 1024 takes 20 minutes. By interpolation, 4096 would take 636 minutes, 8192 = 2567 minutes = 42 h
 // 'y[ms] = 1.156580334046908*x**2 + -72.31709114930806*x + 1397.3555792110117'
 BENCHMARK(BM_SetUpPlantLoop)->Unit(benchmark::kMillisecond)->RangeMultiplier(2)->Range(1, 512)->Complexity();
+
+BENCHMARK(BM_PlantLoopDemandComponents)->Unit(benchmark::kMillisecond)->RangeMultiplier(2)->Range(8, 512)->Complexity();
@@ -74,6 +74,14 @@
 #include "../FanConstantVolume_Impl.hpp"
 #include "../AirLoopHVAC.hpp"
 #include "../AirLoopHVAC_Impl.hpp"
+#include "../LayeredConstruction.hpp"
+#include "../LayeredConstruction_Impl.hpp"
+#include "../PlanarSurface.hpp"
+#include "../PlanarSurface_Impl.hpp"
+#include "../ResourceObject.hpp"
+#include "../ResourceObject_Impl.hpp"
+#include "../SpaceLoad.hpp"
+#include "../SpaceLoad_Impl.hpp"
 
 #include "../../utilities/sql/SqlFile.hpp"
 #include "../../utilities/data/TimeSeries.hpp"
@@ -85,6 +93,7 @@
 #include <utilities/idd/IddEnums.hxx>
 
 #include <boost/algorithm/string/case_conv.hpp>
+#include <algorithm>
 
 using namespace openstudio::model;
 using namespace openstudio;
@@ -454,6 +463,49 @@ TEST_F(ExampleModelFixture, ExampleModel) {
   }
 }
 
+// getModelObjects<T> only visits the types known to be T, check it against a cast of every object
+template <typename T>
+void checkGetModelObjects(const Model& model) {
+  std::vector<Handle> expected;
+  for (const WorkspaceObject& object : model.objects()) {
+    if (object.optionalCast<T>()) {
+      expected.push_back(object.handle());
+    }
+  }
+  std::vector<Handle> actual;
+  for (const T& object : model.getModelObjects<T>()) {
+    actual.push_back(object.handle());
+  }
+  std::sort(expected.begin(), expected.end());
+  std::sort(actual.begin(), actual.end());
+  EXPECT_EQ(expected, actual);
+}
+
+TEST_F(ExampleModelFixture, ExampleModel_GetModelObjectsAbstract) {
+  Model model = exampleModel();
+
+  // run twice so the second pass uses the cached type answers
+  for (int i = 0; i < 2; ++i) {
+    checkGetModelObjects<ModelObject>(model);
+    checkGetModelObjects<ParentObject>(model);
+    checkGetModelObjects<ResourceObject>(model);
+    checkGetModelObjects<PlanarSurface>(model);
+    checkGetModelObjects<LayeredConstruction>(model);
+    checkGetModelObjects<SpaceLoad>(model);
+    checkGetModelObjects<Surface>(model);
+    checkGetModelObjects<Space>(model);
+  }
+
+  // objects added after the first call are found
+  Space space(model);
+  checkGetModelObjects<ParentObject>(model);
+  checkGetModelObjects<Space>(model);
+
+  // the version object is never returned
+  EXPECT_EQ(model.objects().size(), model.getModelObjects<ModelObject>().size());
+  EXPECT_EQ(model.modelObjects().size(), model.getModelObjects<ModelObject>(true).size());
+}
+
 TEST_F(ExampleModelFixture, ExampleModel_Save) {
   Model model = exampleModel();
 
@@ -0,0 +1,90 @@
+#include <benchmark/benchmark.h>
+
+#include "../Model.hpp"
+#include "../Space.hpp"
+#include "../Surface.hpp"
+
+#include "../../utilities/geometry/Point3d.hpp"
+
+using namespace openstudio;
+using namespace openstudio::model;
+
+// Synthetic multi-story building: a nx-by-nx grid of 10m x 10m spaces on each of nStories 3m stories
+static std::vector<Space> makeGridBuilding(Model& m, int nx, int nStories) {
+  std::vector<Point3d> floorPrint;
+  floorPrint.push_back(Point3d(0, 10, 0));
+  floorPrint.push_back(Point3d(10, 10, 0));
+  floorPrint.push_back(Point3d(10, 0, 0));
+  floorPrint.push_back(Point3d(0, 0, 0));
+
+  std::vector<Space> spaces;
+  for (int k = 0; k < nStories; ++k) {
+    for (int i = 0; i < nx; ++i) {
+      for (int j = 0; j < nx; ++j) {
+        Space space = Space::fromFloorPrint(floorPrint, 3, m).get();
+        space.setXOrigin(10.0 * i);
+        space.setYOrigin(10.0 * j);
+        space.setZOrigin(3.0 * k);
+        spaces.push_back(space);
+      }
+    }
+  }
+  return spaces;
+}
+
+static void BM_MatchSurfaces(benchmark::State& state) {
+  const int nStories = 3;
+  Model m;
+  std::vector<Space> spaces = makeGridBuilding(m, state.range(0), nStories);
+
+  // Code inside this loop is measured repeatedly
+  for (auto _ : state) {
+    matchSurfaces(spaces);
+    state.PauseTiming();
+    unmatchSurfaces(spaces);
+    state.ResumeTiming();
+  }
+
+  state.counters["spaces"] = spaces.size();
+  state.SetComplexityN(spaces.size());
+}
+
+static void BM_IntersectSurfaces(benchmark::State& state) {
+  const int nStories = 3;
+
+  // Code inside this loop is measured repeatedly
+  for (auto _ : state) {
+    state.PauseTiming();
+    Model m;
+    std::vector<Space> spaces = makeGridBuilding(m, state.range(0), nStories);
+    state.ResumeTiming();
+
+    intersectSurfaces(spaces);
+  }
+
+  state.SetComplexityN(nStories * state.range(0) * state.range(0));
+}
+
+static void BM_IntersectSurfacesParallel(benchmark::State& state) {
+  const int nStories = 3;
+
+  // Code inside this loop is measured repeatedly
+  for (auto _ : state) {
+    state.PauseTiming();
+    Model m;
+    std::vector<Space> spaces = makeGridBuilding(m, state.range(0), nStories);
+    state.ResumeTiming();
+
+    intersectSurfaces(spaces, state.range(1));
+  }
+
+  state.SetComplexityN(nStories * state.range(0) * state.range(0));
+}
+
+// 3 stories of 2x2 up to 32x32 spaces, ie 12 to 3072 spaces
+BENCHMARK(BM_MatchSurfaces)->Unit(benchmark::kMillisecond)->RangeMultiplier(2)->Range(2, 32)->Complexity();
+
+BENCHMARK(BM_IntersectSurfaces)->Unit(benchmark::kMillisecond)->RangeMultiplier(2)->Range(2, 16)->Complexity();
+
+// 3 stories of 8x8 and 16x16 spaces, on 1 to 8 threads
+BENCHMARK(BM_IntersectSurfacesParallel)->Unit(benchmark::kMillisecond)->RangeMultiplier(2)->Ranges({{8, 16}, {1, 8}});
@@ -75,6 +75,7 @@
 #include "../../utilities/geometry/Intersection.hpp"
 
 #include <iostream>
+#include <tuple>
 
 using namespace openstudio;
 using namespace openstudio::model;
@@ -2990,3 +2991,70 @@ TEST_F(ModelFixture, DISABLED_ShatteredModel_Existing_3424) {
   EXPECT_EQ(7, ceilingSpace4.size());
 }
 //#  endif // SURFACESHATTERING
+
+TEST_F(ModelFixture, Space_IntersectSurfaces_Parallel) {
+  // Staggered stories so that floors and ceilings are split, spaces are created in the same order in both models
+  auto makeSpaces = [](Model& model) {
+    std::vector<Point3d> floorPrint;
+    floorPrint.push_back(Point3d(0, 10, 0));
+    floorPrint.push_back(Point3d(10, 10, 0));
+    floorPrint.push_back(Point3d(10, 0, 0));
+    floorPrint.push_back(Point3d(0, 0, 0));
+
+    std::vector<Space> spaces;
+    for (int k = 0; k < 3; ++k) {
+      for (int i = 0; i < 3; ++i) {
+        for (int j = 0; j < 3; ++j) {
+          boost::optional<Space> space = Space::fromFloorPrint(floorPrint, 3, model);
+          EXPECT_TRUE(space);
+          space->setXOrigin(10.0 * i + 2.5 * (k % 2));
+          space->setYOrigin(10.0 * j + 5.0 * (k % 2));
+          space->setZOrigin(3.0 * k);
+          spaces.push_back(*space);
+        }
+      }
+    }
+    return spaces;
+  };
+
+  auto sortedVertices = [](const Space& space) {
+    std::vector<std::vector<Point3d>> result;
+    for (const Surface& surface : space.surfaces()) {
+      result.push_back(surface.vertices());
+    }
+    auto pointLess = [](const Point3d& a, const Point3d& b) {
+      return std::make_tuple(a.x(), a.y(), a.z()) < std::make_tuple(b.x(), b.y(), b.z());
+    };
+    std::sort(result.begin(), result.end(), [&pointLess](const std::vector<Point3d>& a, const std::vector<Point3d>& b) {
+      return std::lexicographical_compare(a.begin(), a.end(), b.begin(), b.end(), pointLess);
+    });
+    return result;
+  };
+
+  Model serialModel;
+  std::vector<Space> serialSpaces = makeSpaces(serialModel);
+  intersectSurfaces(serialSpaces);
+
+  Model parallelModel;
+  std::vector<Space> parallelSpaces = makeSpaces(parallelModel);
+  intersectSurfaces(parallelSpaces, 4);
+
+  EXPECT_GT(serialModel.getConcreteModelObjects<Surface>().size(), 6u * serialSpaces.size());
+  EXPECT_EQ(serialModel.getConcreteModelObjects<Surface>().size(), parallelModel.getConcreteModelObjects<Surface>().size());
+
+  ASSERT_EQ(serialSpaces.size(), parallelSpaces.size());
+  for (unsigned i = 0; i < serialSpaces.size(); ++i) {
+    std::vector<std::vector<Point3d>> serialVertices = sortedVertices(serialSpaces[i]);
+    std::vector<std::vector<Point3d>> parallelVertices = sortedVertices(parallelSpaces[i]);
+    ASSERT_EQ(serialVertices.size(), parallelVertices.size());
+    for (unsigned j = 0; j < serialVertices.size(); ++j) {
+      ASSERT_EQ(serialVertices[j].size(), parallelVertices[j].size());
+      for (unsigned k = 0; k < serialVertices[j].size(); ++k) {
+        // bit-identical, not just within tolerance
+        EXPECT_EQ(serialVertices[j][k].x(), parallelVertices[j][k].x());
+        EXPECT_EQ(serialVertices[j][k].y(), parallelVertices[j][k].y());
+        EXPECT_EQ(serialVertices[j][k].z(), parallelVertices[j][k].z());
+      }
+    }
+  }
+}
@@ -0,0 +1,71 @@
+#include <benchmark/benchmark.h>
+
+#include "../Model.hpp"
+#include "../Space.hpp"
+#include "../ThreeJSForwardTranslator.hpp"
+
+#include "../../utilities/geometry/Point3d.hpp"
+#include "../../utilities/geometry/ThreeJS.hpp"
+
+#include <sstream>
+
+using namespace openstudio;
+using namespace openstudio::model;
+
+// Synthetic multi-story building: a nx-by-nx grid of 10m x 10m spaces on each of nStories 3m stories
+static Model makeGridModel(int nx, int nStories) {
+  Model m;
+  std::vector<Point3d> floorPrint;
+  floorPrint.push_back(Point3d(0, 10, 0));
+  floorPrint.push_back(Point3d(10, 10, 0));
+  floorPrint.push_back(Point3d(10, 0, 0));
+  floorPrint.push_back(Point3d(0, 0, 0));
+
+  for (int k = 0; k < nStories; ++k) {
+    for (int i = 0; i < nx; ++i) {
+      for (int j = 0; j < nx; ++j) {
+        Space space = Space::fromFloorPrint(floorPrint, 3, m).get();
+        space.setXOrigin(10.0 * i);
+        space.setYOrigin(10.0 * j);
+        space.setZOrigin(3.0 * k);
+      }
+    }
+  }
+  return m;
+}
+
+static void BM_ThreeJSJson(benchmark::State& state) {
+  Model m = makeGridModel(state.range(0), 3);
+  ThreeJSForwardTranslator ft;
+
+  size_t bytes = 0;
+  for (auto _ : state) {
+    std::string json = ft.modelToThreeJS(m, true).toJSON(false);
+    bytes = json.size();
+    benchmark::DoNotOptimize(json);
+  }
+
+  state.counters["bytes"] = bytes;
+  state.SetComplexityN(3 * state.range(0) * state.range(0));
+}
+
+static void BM_ThreeJSGLB(benchmark::State& state) {
+  Model m = makeGridModel(state.range(0), 3);
+  ThreeJSForwardTranslator ft;
+
+  size_t bytes = 0;
+  for (auto _ : state) {
+    std::stringstream ss;
+    ft.modelToGLB(m, ss);
+    bytes = ss.tellp();
+    benchmark::DoNotOptimize(ss);
+  }
+
+  state.counters["bytes"] = bytes;
+  state.SetComplexityN(3 * state.range(0) * state.range(0));
+}
+
+// 3 stories of 2x2 up to 16x16 spaces, ie 12 to 768 spaces
+BENCHMARK(BM_ThreeJSJson)->Unit(benchmark::kMillisecond)->RangeMultiplier(2)->Range(2, 16)->Complexity();
+
+BENCHMARK(BM_ThreeJSGLB)->Unit(benchmark::kMillisecond)->RangeMultiplier(2)->Range(2, 16)->Complexity();
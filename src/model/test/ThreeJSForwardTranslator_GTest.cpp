@@ -46,6 +46,7 @@
 #include "../../utilities/geometry/ThreeJS.hpp"
 
 #include <algorithm>
+#include <sstream>
 
 using namespace openstudio;
 using namespace openstudio::model;
@@ -116,6 +117,59 @@ TEST_F(ModelFixture, ThreeJSForwardTranslator_ExampleModel) {
   EXPECT_EQ(model.getConcreteModelObjects<SubSurface>().size(), model2->getConcreteModelObjects<SubSurface>().size());
 }
 
+TEST_F(ModelFixture, ThreeJSForwardTranslator_GLB) {
+
+  ThreeJSForwardTranslator ft;
+
+  Model model = exampleModel();
+
+  std::stringstream ss;
+  EXPECT_TRUE(ft.modelToGLB(model, ss));
+  EXPECT_EQ(0, ft.errors().size());
+  EXPECT_EQ(0, ft.warnings().size());
+
+  std::string glb = ss.str();
+  ASSERT_GE(glb.size(), 28u);
+  EXPECT_EQ(0u, glb.size() % 4);
+
+  auto readUInt32 = [&glb](size_t offset) {
+    uint32_t result = 0;
+    for (unsigned i = 0; i < 4; ++i) {
+      result |= static_cast<uint32_t>(static_cast<unsigned char>(glb[offset + i])) << (8 * i);
+    }
+    return result;
+  };
+
+  // header
+  EXPECT_EQ(0x46546C67u, readUInt32(0));
+  EXPECT_EQ(2u, readUInt32(4));
+  EXPECT_EQ(glb.size(), readUInt32(8));
+
+  // JSON chunk then BIN chunk
+  uint32_t jsonLength = readUInt32(12);
+  EXPECT_EQ(0x4E4F534Au, readUInt32(16));
+  ASSERT_GE(glb.size(), 20u + jsonLength + 8u);
+  std::string json = glb.substr(20, jsonLength);
+  EXPECT_NE(std::string::npos, json.find("\"asset\":{\"version\":\"2.0\""));
+  EXPECT_NE(std::string::npos, json.find("\"surfaceType\":\"Wall\""));
+
+  uint32_t binLength = readUInt32(20 + jsonLength);
+  EXPECT_EQ(0x004E4942u, readUInt32(24 + jsonLength));
+  EXPECT_EQ(glb.size(), 28u + jsonLength + binLength);
+
+  // vertices are shared between surfaces, so the GLB is much smaller than the triangulated ThreeJS json
+  std::string threeJson = ft.modelToThreeJS(model, true).toJSON(false);
+  EXPECT_LT(glb.size(), threeJson.size());
+
+  // empty model still produces a valid scene
+  std::stringstream ss2;
+  EXPECT_TRUE(ft.modelToGLB(Model(), ss2));
+  std::string emptyGlb = ss2.str();
+  ASSERT_GE(emptyGlb.size(), 20u);
+  EXPECT_EQ("glTF", emptyGlb.substr(0, 4));
+  EXPECT_EQ(0u, emptyGlb.size() % 4);
+}
+
 TEST_F(ModelFixture, ThreeJSForwardTranslator_ConstructionAirBoundary) {
 
   ThreeJSForwardTranslator ft;
@@ -61,6 +61,7 @@
 #include "../utilities/math/FloatCompare.hpp"
 
 #include <OpenStudio.hxx>
+#include <osversion/embedded_files.hxx>
 
 #include <thread>
 #include <map>
@@ -581,7 +582,16 @@ namespace osversion {
   IddFileAndFactoryWrapper VersionTranslator::getIddFile(const VersionString& version) {
     IddFileAndFactoryWrapper result(IddFileType::OpenStudio);
     if (version < VersionString(openStudioVersion())) {
-      OptionalIddFile iddFile = IddFactory::instance().getIddFile(IddFileType::OpenStudio, version);
+      // prefer the binary snapshot generated at build time, which loads without parsing IDD text
+      OptionalIddFile iddFile;
+      std::stringstream snapshotPath;
+      snapshotPath << ":/idd/versions/" << version.major() << "_" << version.minor() << "_" << version.patch().get() << "/OpenStudio.iddsnap";
+      if (::openstudioosversion::embedded_files::hasFile(snapshotPath.str())) {
+        iddFile = IddFile::loadSnapshot(::openstudioosversion::embedded_files::getFileAsString(snapshotPath.str()));
+      }
+      if (!iddFile) {
+        iddFile = IddFactory::instance().getIddFile(IddFileType::OpenStudio, version);
+      }
       if (!iddFile) {
         LOG_AND_THROW("Unable to retrieve OpenStudio Version " << version.str() << " IDD from the IddFactory.");
       }
@@ -594,7 +604,7 @@ namespace osversion {
     std::map<VersionString, IdfFile>::const_iterator start = m_map.find(startVersion);
     if (start != m_map.end()) {
 
-      std::string translatedIdf;
+      boost::optional<IdfFile> translatedIdf;
       VersionString lastVersion("0.0.0");
       boost::optional<IddFileAndFactoryWrapper> oIddFile;
       for (std::map<VersionString, OSVersionUpdater>::const_iterator it = m_updateMethods.begin(), itEnd = m_updateMethods.end(); it != itEnd; ++it) {
@@ -603,63 +613,103 @@ namespace osversion {
         lastVersion = it->first;
         if (startVersion < it->first) {
           oIddFile = getIddFile(it->first);
-          translatedIdf = it->second(this, start->second, *oIddFile);
+          if (it->second == &VersionTranslator::defaultUpdate) {
+            // nothing changed but the version, re-binding the objects below is all there is to do
+            translatedIdf = start->second;
+          } else {
+            translatedIdf = it->second(this, start->second, *oIddFile);
+          }
           break;
         }
       }
 
-      if (translatedIdf.empty()) {
+      if (!translatedIdf) {
         LOG(Error, "Unable to complete translation from " << startVersion.str() << " to " << lastVersion.str()
                                                           << ". Unable to find and execute the appropriate update method.");
         return;
       }
-      std::stringstream ss(translatedIdf);
-      OptionalIdfFile oIdfFile;
-      if (oIddFile->iddFileType() == IddFileType::UserCustom) {
-        oIdfFile = IdfFile::load(ss, oIddFile->iddFile());
-      } else {
-        oIdfFile = IdfFile::load(ss, oIddFile->iddFileType());
+      IdfFile idfFile = rebind(*translatedIdf, *oIddFile);
+      m_map[idfFile.version()] = idfFile;
+      LOG(Debug, "Translation to " << lastVersion.str() << " model has " << idfFile.numObjects() << " objects.");
+    }
+  }
+
+  IdfFile VersionTranslator::rebind(const IdfFile& idf, const IddFileAndFactoryWrapper& targetIdd) {
+    IdfFile result = (targetIdd.iddFileType() == IddFileType::UserCustom) ? IdfFile(targetIdd.iddFile()) : IdfFile(targetIdd.iddFileType());
+    result.setHeader(idf.header());
+
+    // update methods mix objects of the previous and the target IddFile, look each type up once
+    std::map<std::string, IddObject, IstringCompare> iddObjects;
+    boost::optional<IddObject> commentOnlyIddObject;
+
+    for (const IdfObject& object : idf.objects()) {
+      IddObject iddObject = object.iddObject();
+      if (iddObject.type() == IddObjectType::CommentOnly) {
+        if (!commentOnlyIddObject) {
+          commentOnlyIddObject = targetIdd.getObject(IddObjectType::CommentOnly);
+          if (!commentOnlyIddObject) {
+            LOG(Error, "IddFile does not contain a CommentOnly object. Will not be able to save comment objects.");
+            commentOnlyIddObject = IddObject();
+          }
+        }
+        if (commentOnlyIddObject->type() == IddObjectType::CommentOnly) {
+          result.addObject(object.rebind(*commentOnlyIddObject));
+        }
+        continue;
       }
-      if (!oIdfFile) {
-        LOG(Error, "Unable to complete translation from " << startVersion.str() << " to " << lastVersion.str()
-                                                          << ". Could not load translated IDF using the "
-                                                          << "latter version's IddFile. Translated text: " << '\n'
-                                                          << translatedIdf);
-        return;
+
+      // Catchall objects carry their object type in the first field
+      std::string objectType = iddObject.name();
+      if (iddObject.type() == IddObjectType::Catchall) {
+        objectType = object.getString(0).get_value_or(objectType);
+      }
+
+      auto it = iddObjects.find(objectType);
+      if (it == iddObjects.end()) {
+        OptionalIddObject candidate = targetIdd.getObject(objectType);
+        if (!candidate) {
+          LOG(Warn, "Cannot find object type '" << objectType << "' in Idd. Placing data in Catchall object.");
+          candidate = IddObject();
+        }
+        it = iddObjects.insert(std::make_pair(objectType, *candidate)).first;
       }
-      IdfFile idfFile = *oIdfFile;
-      m_map[oIdfFile->version()] = idfFile;
-      LOG(Debug, "Translation to " << lastVersion.str() << " model has " << oIdfFile->numObjects() << " objects.");
+
+      result.addObject(object.rebind(it->second));
     }
+
+    return result;
   }
 
-  std::string VersionTranslator::defaultUpdate(const IdfFile& idf, const IddFileAndFactoryWrapper& targetIdd) {
-    // use for version increments with no IDD changes
-    std::stringstream ss;
+  void VersionTranslator::addObjectText(IdfFile& targetIdf, const std::string& text) {
+    // kept as a Catchall object until rebind finds its type in the target IddFile
+    if (OptionalIdfObject object = IdfObject::load(text, IddObject())) {
+      targetIdf.addObject(*object);
+    } else {
+      LOG(Error, "Unable to construct IdfObject from text: " << '\n' << text << '\n' << "Throwing this object out.");
+    }
+  }
 
-    ss << idf.header() << '\n' << '\n';
+  IdfFile VersionTranslator::defaultUpdate(const IdfFile& idf, const IddFileAndFactoryWrapper& targetIdd) {
+    // use for version increments with no IDD changes
 
     // new version object
     IdfFile targetIdf(targetIdd.iddFile());
-    ss << targetIdf.versionObject().get();
+    targetIdf.setHeader(idf.header());
 
     // all other objects
     for (const IdfObject& object : idf.objects()) {
-      ss << object;
+      targetIdf.addObject(object);
     }
 
-    return ss.str();
+    return targetIdf;
   }
 
-  std::string VersionTranslator::update_0_7_1_to_0_7_2(const IdfFile& idf_0_7_1, const IddFileAndFactoryWrapper& idd_0_7_2) {
+  IdfFile VersionTranslator::update_0_7_1_to_0_7_2(const IdfFile& idf_0_7_1, const IddFileAndFactoryWrapper& idd_0_7_2) {
     // Url field refinements
-    std::stringstream ss;
-
-    ss << idf_0_7_1.header() << '\n' << '\n';
 
     // new version object
     IdfFile targetIdf(idd_0_7_2.iddFile());
-    ss << targetIdf.versionObject().get();
+    targetIdf.setHeader(idf_0_7_1.header());
 
     // all other objects
     for (const IdfObject& object : idf_0_7_1.objects()) {
@@ -672,10 +722,10 @@ namespace osversion {
         toPrint = updateUrlField_0_7_1_to_0_7_2(object, 1);
       }
 
-      ss << toPrint;
+      targetIdf.addObject(toPrint);
     }
 
-    return ss.str();
+    return targetIdf;
   }
 
   IdfObject VersionTranslator::updateUrlField_0_7_1_to_0_7_2(const IdfObject& object, unsigned index) {
@@ -698,15 +748,12 @@ namespace osversion {
     return result;
   }
 
-  std::string VersionTranslator::update_0_7_2_to_0_7_3(const IdfFile& idf_0_7_2, const IddFileAndFactoryWrapper& idd_0_7_3) {
+  IdfFile VersionTranslator::update_0_7_2_to_0_7_3(const IdfFile& idf_0_7_2, const IddFileAndFactoryWrapper& idd_0_7_3) {
     // use for version increments with no IDD changes
-    std::stringstream ss;
-
-    ss << idf_0_7_2.header() << '\n' << '\n';
 
     // new version object
     IdfFile targetIdf(idd_0_7_3.iddFile());
-    ss << targetIdf.versionObject().get();
+    targetIdf.setHeader(idf_0_7_2.header());
 
     // all other objects
     for (const IdfObject& object : idf_0_7_2.objects()) {
@@ -715,23 +762,20 @@ namespace osversion {
         LOG(Warn, "This model contains an out-of-date " << object.iddObject().name() << " object. "
                                                         << "In particular, it needs a bypass branch added in order to run properly in EnergyPlus.");
       }
-      ss << object;
+      targetIdf.addObject(object);
     }
 
-    return ss.str();
+    return targetIdf;
   }
 
-  std::string VersionTranslator::update_0_7_3_to_0_7_4(const IdfFile& idf_0_7_3, const IddFileAndFactoryWrapper& idd_0_7_4) {
-    std::stringstream ss;
+  IdfFile VersionTranslator::update_0_7_3_to_0_7_4(const IdfFile& idf_0_7_3, const IddFileAndFactoryWrapper& idd_0_7_4) {
     IddObject componentDataIdd = idd_0_7_4.getObject("OS:ComponentData").get();
     IdfObject componentDataIdf(componentDataIdd);
     int fs = IdfObject::printedFieldSpace();
 
-    ss << idf_0_7_3.header() << '\n' << '\n';
-
     // new version object
     IdfFile targetIdf(idd_0_7_4.iddFile());
-    ss << targetIdf.versionObject().get();
+    targetIdf.setHeader(idf_0_7_3.header());
 
     // all other objects
     for (IdfObject object : idf_0_7_3.objects()) {
@@ -926,10 +970,10 @@ namespace osversion {
         }
       }
 
-      ss << objectSS.str();
+      addObjectText(targetIdf, objectSS.str());
     }
 
-    return ss.str();
+    return targetIdf;
   }
 
   std::vector<std::shared_ptr<VersionTranslator::InterobjectIssueInformation>>
@@ -1302,15 +1346,12 @@ namespace osversion {
     }
   }
 
-  std::string VersionTranslator::update_0_9_1_to_0_9_2(const IdfFile& idf_0_9_1, const IddFileAndFactoryWrapper& idd_0_9_2) {
+  IdfFile VersionTranslator::update_0_9_1_to_0_9_2(const IdfFile& idf_0_9_1, const IddFileAndFactoryWrapper& idd_0_9_2) {
     // use for version increments with no IDD changes
-    std::stringstream ss;
-
-    ss << idf_0_9_1.header() << '\n' << '\n';
 
     // new version object
     IdfFile targetIdf(idd_0_9_2.iddFile());
-    ss << targetIdf.versionObject().get();
+    targetIdf.setHeader(idf_0_9_1.header());
 
     // Fixup all thermal zone objects
     for (const IdfObject& object : idf_0_9_1.objects()) {
@@ -1466,31 +1507,31 @@ namespace osversion {
           }
         }
 
-        ss << newThermalZone;
-        ss << newInletPortList;
-        ss << newExhaustPortList;
-        ss << newZoneHVACEquipmentList;
+        targetIdf.addObject(newThermalZone);
+        targetIdf.addObject(newInletPortList);
+        targetIdf.addObject(newExhaustPortList);
+        targetIdf.addObject(newZoneHVACEquipmentList);
 
         m_new.push_back(newInletPortList);
         m_new.push_back(newExhaustPortList);
         m_new.push_back(newZoneHVACEquipmentList);
 
         if (newFPTSecondaryInletConn) {
-          ss << newFPTSecondaryInletConn.get();
+          targetIdf.addObject(newFPTSecondaryInletConn.get());
         }
       }
     }
 
     for (const IdfObject& object : idf_0_9_1.objects()) {
       if (object.iddObject().name() != "OS:ThermalZone") {
-        ss << object;
+        targetIdf.addObject(object);
       }
     }
 
-    return ss.str();
+    return targetIdf;
   }
 
-  std::string VersionTranslator::update_0_9_5_to_0_9_6(const IdfFile& idf_0_9_5, const IddFileAndFactoryWrapper& idd_0_9_6) {
+  IdfFile VersionTranslator::update_0_9_5_to_0_9_6(const IdfFile& idf_0_9_5, const IddFileAndFactoryWrapper& idd_0_9_6) {
     // if multiple OS:RunPeriod objects remove them all
     bool skipRunPeriods = false;
     unsigned numRunPeriods = 0;
@@ -1507,13 +1548,10 @@ namespace osversion {
     }
 
     // use for version increments with no IDD changes
-    std::stringstream ss;
-
-    ss << idf_0_9_5.header() << '\n' << '\n';
 
     // new version object
     IdfFile targetIdf(idd_0_9_6.iddFile());
-    ss << targetIdf.versionObject().get();
+    targetIdf.setHeader(idf_0_9_5.header());
 
     for (const IdfObject& object : idf_0_9_5.objects()) {
       if (object.iddObject().name() == "OS:PlantLoop") {
@@ -1529,11 +1567,11 @@ namespace osversion {
 
         newSizingPlant.setDouble(4, 0.001);
 
-        ss << newSizingPlant;
+        targetIdf.addObject(newSizingPlant);
 
         m_new.push_back(newSizingPlant);
 
-        ss << object;
+        targetIdf.addObject(object);
       } else if (object.iddObject().name() == "OS:Sizing:Parameters") {
         IdfObject newSizingParameters = object.clone(true);
 
@@ -1545,30 +1583,26 @@ namespace osversion {
           newSizingParameters.setDouble(2, 1.15);
         }
 
-        ss << newSizingParameters;
+        targetIdf.addObject(newSizingParameters);
       } else if (object.iddObject().name() == "OS:RunPeriod") {
         if (skipRunPeriods) {
           // put the object in the untranslated list
           m_untranslated.push_back(object);
         } else {
-          ss << object;
+          targetIdf.addObject(object);
         }
       } else {
-        ss << object;
+        targetIdf.addObject(object);
       }
     }
 
-    return ss.str();
+    return targetIdf;
   }
 
-  std::string VersionTranslator::update_0_9_6_to_0_10_0(const IdfFile& idf_0_9_6, const IddFileAndFactoryWrapper& idd_0_10_0) {
-    std::stringstream ss;
-
-    ss << idf_0_9_6.header() << '\n' << '\n';
-
+  IdfFile VersionTranslator::update_0_9_6_to_0_10_0(const IdfFile& idf_0_9_6, const IddFileAndFactoryWrapper& idd_0_10_0) {
     // new version object
     IdfFile targetIdf(idd_0_10_0.iddFile());
-    ss << targetIdf.versionObject().get();
+    targetIdf.setHeader(idf_0_9_6.header());
 
     for (const IdfObject& object : idf_0_9_6.objects()) {
 
@@ -1576,33 +1610,30 @@ namespace osversion {
         boost::optional<std::string> value = object.getString(14);
 
         if (!value) {
-          ss << object;
+          targetIdf.addObject(object);
         } else if (*value == "146" || *value == "581" || *value == "2321") {
-          ss << object;
+          targetIdf.addObject(object);
         } else {
           IdfObject newParameters = object.clone(true);
           newParameters.setString(14, "");
           m_refactored.push_back(RefactoredObjectData(object, newParameters));
 
-          ss << newParameters;
+          targetIdf.addObject(newParameters);
         }
       } else {
-        ss << object;
+        targetIdf.addObject(object);
       }
     }
 
-    return ss.str();
+    return targetIdf;
   }
 
-  std::string VersionTranslator::update_0_11_0_to_0_11_1(const IdfFile& idf_0_11_0, const IddFileAndFactoryWrapper& idd_0_11_1) {
+  IdfFile VersionTranslator::update_0_11_0_to_0_11_1(const IdfFile& idf_0_11_0, const IddFileAndFactoryWrapper& idd_0_11_1) {
     // use for version increments with no IDD changes
-    std::stringstream ss;
-
-    ss << idf_0_11_0.header() << '\n' << '\n';
 
     // new version object
     IdfFile targetIdf(idd_0_11_1.iddFile());
-    ss << targetIdf.versionObject().get();
+    targetIdf.setHeader(idf_0_11_0.header());
 
     // hold OS:ComponentData objects for later
     std::vector<IdfObject> componentDataObjects;
@@ -1615,7 +1646,7 @@ namespace osversion {
       } else if (object.iddObject().name() == "OS:ComponentData") {
         componentDataObjects.push_back(object);
       } else {
-        ss << object;
+        targetIdf.addObject(object);
       }
     }
 
@@ -1640,6 +1671,7 @@ namespace osversion {
       }
 
       // translate base fields
+      std::stringstream ss;
       componentDataObject.printName(ss, true);
       componentDataObject.printField(ss, 0, false);  // Handle
       componentDataObject.printField(ss, 1, false);  // Name
@@ -1668,23 +1700,20 @@ namespace osversion {
           componentDataObject.printField(ss, *it, false);
         }
       }
+      addObjectText(targetIdf, ss.str());
     }
 
-    return ss.str();
+    return targetIdf;
   }
 
-  std::string VersionTranslator::update_0_11_1_to_0_11_2(const IdfFile& idf_0_11_1, const IddFileAndFactoryWrapper& idd_0_11_2) {
+  IdfFile VersionTranslator::update_0_11_1_to_0_11_2(const IdfFile& idf_0_11_1, const IddFileAndFactoryWrapper& idd_0_11_2) {
     // This version update has two things to do.
     // Make updates for new control related objects.
     // Make updates for component costs.
 
-    std::stringstream ss;
-
-    ss << idf_0_11_1.header() << '\n' << '\n';
-
     // new version object
     IdfFile targetIdf(idd_0_11_2.iddFile());
-    ss << targetIdf.versionObject().get();
+    targetIdf.setHeader(idf_0_11_1.header());
 
     // hold OS:ComponentData objects for later
     std::vector<IdfObject> componentDataObjects;
@@ -1739,9 +1768,9 @@ namespace osversion {
 
         alwaysOnSchedule->setString(2, typeLimits.getString(0).get());
 
-        ss << alwaysOnSchedule.get();
+        targetIdf.addObject(alwaysOnSchedule.get());
 
-        ss << typeLimits;
+        targetIdf.addObject(typeLimits);
 
         m_new.push_back(alwaysOnSchedule.get());
 
@@ -1766,9 +1795,9 @@ namespace osversion {
 
         newOAController.setString(20, newMechVentController.getString(0).get());
 
-        ss << newOAController;
+        targetIdf.addObject(newOAController);
 
-        ss << newMechVentController;
+        targetIdf.addObject(newMechVentController);
 
         m_new.push_back(newMechVentController);
       } else if (object.iddObject().name() == "OS:AirLoopHVAC" && !m_isComponent) {
@@ -1798,13 +1827,13 @@ namespace osversion {
 
         eg.setString(0, newAvailabilityManagerNightCycle.getString(0).get());
 
-        ss << newAirLoopHVAC;
+        targetIdf.addObject(newAirLoopHVAC);
 
-        ss << newAvailList;
+        targetIdf.addObject(newAvailList);
 
-        ss << newAvailabilityManagerScheduled;
+        targetIdf.addObject(newAvailabilityManagerScheduled);
 
-        ss << newAvailabilityManagerNightCycle;
+        targetIdf.addObject(newAvailabilityManagerNightCycle);
 
         m_new.push_back(newAvailList);
 
@@ -1816,7 +1845,7 @@ namespace osversion {
 
         // this was made unique, remove if more than 1
         if (numComponentCostAdjustment == 1) {
-          ss << object;
+          targetIdf.addObject(object);
         } else {
           numComponentCostAdjustmentRemoved += 1;
           removedItemHandles.push_back(toString(object.handle()));
@@ -1831,6 +1860,7 @@ namespace osversion {
         removedItemHandles.push_back(toString(object.handle()));
         m_untranslated.push_back(object);
       } else if (object.iddObject().name() == "OS:LifeCycleCost:Parameters") {
+        std::stringstream ss;
         object.printName(ss, true);
         object.printField(ss, 0, false);          // Handle
         ss << "Custom, !- AnalysisType" << '\n';  // Name -> AnalysisType
@@ -1842,10 +1872,11 @@ namespace osversion {
             object.printField(ss, i, false);
           }
         }
+        addObjectText(targetIdf, ss.str());
       } else if (object.iddObject().name() == "OS:ComponentData") {
         componentDataObjects.push_back(object);
       } else {
-        ss << object;
+        targetIdf.addObject(object);
       }
     }
 
@@ -1877,6 +1908,7 @@ namespace osversion {
       }
 
       // translate base fields
+      std::stringstream ss;
       componentDataObject.printName(ss, true);
       componentDataObject.printField(ss, 0, false);  // Handle
       componentDataObject.printField(ss, 1, false);  // Name
@@ -1904,21 +1936,18 @@ namespace osversion {
           componentDataObject.printField(ss, *it, false);
         }
       }
+      addObjectText(targetIdf, ss.str());
     }
 
-    return ss.str();
+    return targetIdf;
   }
 
-  std::string VersionTranslator::update_0_11_4_to_0_11_5(const IdfFile& idf_0_11_4, const IddFileAndFactoryWrapper& idd_0_11_5) {
+  IdfFile VersionTranslator::update_0_11_4_to_0_11_5(const IdfFile& idf_0_11_4, const IddFileAndFactoryWrapper& idd_0_11_5) {
     // Make updates for component costs.
 
-    std::stringstream ss;
-
-    ss << idf_0_11_4.header() << '\n' << '\n';
-
     // new version object
     IdfFile targetIdf(idd_0_11_5.iddFile());
-    ss << targetIdf.versionObject().get();
+    targetIdf.setHeader(idf_0_11_4.header());
 
     // hold OS:ComponentData objects for later
     std::vector<IdfObject> componentDataObjects;
@@ -1945,7 +1974,7 @@ namespace osversion {
       } else if (object.iddObject().name() == "OS:ComponentData") {
         componentDataObjects.push_back(object);
       } else {
-        ss << object;
+        targetIdf.addObject(object);
       }
     }
 
@@ -1977,6 +2006,7 @@ namespace osversion {
       }
 
       // translate base fields
+      std::stringstream ss;
       componentDataObject.printName(ss, true);
       componentDataObject.printField(ss, 0, false);  // Handle
       componentDataObject.printField(ss, 1, false);  // Name
@@ -2004,21 +2034,18 @@ namespace osversion {
           componentDataObject.printField(ss, *it, false);
         }
       }
+      addObjectText(targetIdf, ss.str());
     }
 
-    return ss.str();
+    return targetIdf;
   }
 
-  std::string VersionTranslator::update_0_11_5_to_0_11_6(const IdfFile& idf_0_11_5, const IddFileAndFactoryWrapper& idd_0_11_6) {
+  IdfFile VersionTranslator::update_0_11_5_to_0_11_6(const IdfFile& idf_0_11_5, const IddFileAndFactoryWrapper& idd_0_11_6) {
     // Update the OS:PortList object to point back to the OS:ThermalZone
 
-    std::stringstream ss;
-
-    ss << idf_0_11_5.header() << '\n' << '\n';
-
     // new version object
     IdfFile targetIdf(idd_0_11_6.iddFile());
-    ss << targetIdf.versionObject().get();
+    targetIdf.setHeader(idf_0_11_5.header());
 
     for (const IdfObject& object : idf_0_11_5.objects()) {
 
@@ -2063,13 +2090,13 @@ namespace osversion {
 
                 m_refactored.push_back(RefactoredObjectData(object2, newPortList));
 
-                ss << newPortList;
+                targetIdf.addObject(newPortList);
               }
             }
           }
         }
 
-        ss << object;
+        targetIdf.addObject(object);
 
       } else if (object.iddObject().name() == "OS:PortList") {
 
@@ -2077,21 +2104,17 @@ namespace osversion {
 
       } else {
 
-        ss << object;
+        targetIdf.addObject(object);
       }
     }
 
-    return ss.str();
+    return targetIdf;
   }
 
-  std::string VersionTranslator::update_1_0_1_to_1_0_2(const IdfFile& idf_1_0_1, const IddFileAndFactoryWrapper& idd_1_0_2) {
-    std::stringstream ss;
-
-    ss << idf_1_0_1.header() << '\n' << '\n';
-
+  IdfFile VersionTranslator::update_1_0_1_to_1_0_2(const IdfFile& idf_1_0_1, const IddFileAndFactoryWrapper& idd_1_0_2) {
     // new version object
     IdfFile targetIdf(idd_1_0_2.iddFile());
-    ss << targetIdf.versionObject().get();
+    targetIdf.setHeader(idf_1_0_1.header());
 
     for (const IdfObject& object : idf_1_0_1.objects()) {
 
@@ -2106,11 +2129,11 @@ namespace osversion {
 
           m_refactored.push_back(RefactoredObjectData(object, newBoiler));
 
-          ss << newBoiler;
+          targetIdf.addObject(newBoiler);
 
         } else {
 
-          ss << object;
+          targetIdf.addObject(object);
         }
       } else if (object.iddObject().name() == "OS:Boiler:HotWater") {
 
@@ -2123,30 +2146,26 @@ namespace osversion {
 
           m_refactored.push_back(RefactoredObjectData(object, newChiller));
 
-          ss << newChiller;
+          targetIdf.addObject(newChiller);
 
         } else {
 
-          ss << object;
+          targetIdf.addObject(object);
         }
 
       } else {
 
-        ss << object;
+        targetIdf.addObject(object);
       }
     }
 
-    return ss.str();
+    return targetIdf;
   }
 
-  std::string VersionTranslator::update_1_0_2_to_1_0_3(const IdfFile& idf_1_0_2, const IddFileAndFactoryWrapper& idd_1_0_3) {
-    std::stringstream ss;
-
-    ss << idf_1_0_2.header() << '\n' << '\n';
-
+  IdfFile VersionTranslator::update_1_0_2_to_1_0_3(const IdfFile& idf_1_0_2, const IddFileAndFactoryWrapper& idd_1_0_3) {
     // new version object
     IdfFile targetIdf(idd_1_0_3.iddFile());
-    ss << targetIdf.versionObject().get();
+    targetIdf.setHeader(idf_1_0_2.header());
 
     for (const IdfObject& object : idf_1_0_2.objects()) {
 
@@ -2164,26 +2183,22 @@ namespace osversion {
 
           m_refactored.push_back(RefactoredObjectData(object, newParameters));
 
-          ss << newParameters;
+          targetIdf.addObject(newParameters);
         } else {
-          ss << object;
+          targetIdf.addObject(object);
         }
       } else {
-        ss << object;
+        targetIdf.addObject(object);
       }
     }
 
-    return ss.str();
+    return targetIdf;
   }
 
-  std::string VersionTranslator::update_1_2_2_to_1_2_3(const IdfFile& idf_1_2_2, const IddFileAndFactoryWrapper& idd_1_2_3) {
-    std::stringstream ss;
-
-    ss << idf_1_2_2.header() << '\n' << '\n';
-
+  IdfFile VersionTranslator::update_1_2_2_to_1_2_3(const IdfFile& idf_1_2_2, const IddFileAndFactoryWrapper& idd_1_2_3) {
     // new version object
     IdfFile targetIdf(idd_1_2_3.iddFile());
-    ss << targetIdf.versionObject().get();
+    targetIdf.setHeader(idf_1_2_2.header());
 
     boost::optional<int> numberOfStories;
     boost::optional<int> numberOfAboveGroundStories;
@@ -2203,9 +2218,9 @@ namespace osversion {
             newObject.setString(2, "ExteriorFloor");
           }
           m_refactored.push_back(RefactoredObjectData(object, newObject));
-          ss << newObject;
+          targetIdf.addObject(newObject);
         } else {
-          ss << object;
+          targetIdf.addObject(object);
         }
 
       } else if (object.iddObject().name() == "OS:Building") {
@@ -2226,7 +2241,7 @@ namespace osversion {
         m_deprecated.push_back(object);
 
       } else {
-        ss << object;
+        targetIdf.addObject(object);
       }
     }
 
@@ -2310,20 +2325,16 @@ namespace osversion {
       }
 
       m_refactored.push_back(RefactoredObjectData(*buildingObject, newBuildingObject));
-      ss << newBuildingObject;
+      targetIdf.addObject(newBuildingObject);
     }
 
-    return ss.str();
+    return targetIdf;
   }
 
-  std::string VersionTranslator::update_1_3_4_to_1_3_5(const IdfFile& idf_1_3_4, const IddFileAndFactoryWrapper& idd_1_3_5) {
-    std::stringstream ss;
-
-    ss << idf_1_3_4.header() << '\n' << '\n';
-
+  IdfFile VersionTranslator::update_1_3_4_to_1_3_5(const IdfFile& idf_1_3_4, const IddFileAndFactoryWrapper& idd_1_3_5) {
     // new version object
     IdfFile targetIdf(idd_1_3_5.iddFile());
-    ss << targetIdf.versionObject().get();
+    targetIdf.setHeader(idf_1_3_4.header());
 
     for (const IdfObject& object : idf_1_3_4.objects()) {
 
@@ -2341,46 +2352,38 @@ namespace osversion {
 
         m_refactored.push_back(RefactoredObjectData(object, newWalkin));
 
-        ss << newWalkin;
+        targetIdf.addObject(newWalkin);
 
       } else {
 
-        ss << object;
+        targetIdf.addObject(object);
       }
     }
 
-    return ss.str();
+    return targetIdf;
   }
 
-  std::string VersionTranslator::update_1_5_3_to_1_5_4(const IdfFile& idf_1_5_3, const IddFileAndFactoryWrapper& idd_1_5_4) {
-    std::stringstream ss;
-
-    ss << idf_1_5_3.header() << '\n' << '\n';
-
+  IdfFile VersionTranslator::update_1_5_3_to_1_5_4(const IdfFile& idf_1_5_3, const IddFileAndFactoryWrapper& idd_1_5_4) {
     // new version object
     IdfFile targetIdf(idd_1_5_4.iddFile());
-    ss << targetIdf.versionObject().get();
+    targetIdf.setHeader(idf_1_5_3.header());
 
     for (const IdfObject& object : idf_1_5_3.objects()) {
       if (object.iddObject().name() == "OS:TimeDependentValuation") {
         // put the object in the untranslated list
         m_untranslated.push_back(object);
       } else {
-        ss << object;
+        targetIdf.addObject(object);
       }
     }
 
-    return ss.str();
+    return targetIdf;
   }
 
-  std::string VersionTranslator::update_1_7_1_to_1_7_2(const IdfFile& idf_1_7_1, const IddFileAndFactoryWrapper& idd_1_7_2) {
-    std::stringstream ss;
-
-    ss << idf_1_7_1.header() << '\n' << '\n';
-
+  IdfFile VersionTranslator::update_1_7_1_to_1_7_2(const IdfFile& idf_1_7_1, const IddFileAndFactoryWrapper& idd_1_7_2) {
     // new version object
     IdfFile targetIdf(idd_1_7_2.iddFile());
-    ss << targetIdf.versionObject().get();
+    targetIdf.setHeader(idf_1_7_1.header());
 
     for (const IdfObject& object : idf_1_7_1.objects()) {
       if (object.iddObject().name() == "OS:EvaporativeCooler:Direct:ResearchSpecial") {
@@ -2401,7 +2404,7 @@ namespace osversion {
         newObject.setDouble(11, 0.1);
 
         m_refactored.push_back(RefactoredObjectData(object, newObject));
-        ss << newObject;
+        targetIdf.addObject(newObject);
       } else if (object.iddObject().name() == "OS:EvaporativeCooler:Indirect:ResearchSpecial") {
         auto iddObject = idd_1_7_2.getObject("OS:EvaporativeCooler:Indirect:ResearchSpecial");
         OS_ASSERT(iddObject);
@@ -2421,23 +2424,19 @@ namespace osversion {
         newObject.setDouble(24, 1.0);
 
         m_refactored.push_back(RefactoredObjectData(object, newObject));
-        ss << newObject;
+        targetIdf.addObject(newObject);
       } else {
-        ss << object;
+        targetIdf.addObject(object);
       }
     }
 
-    return ss.str();
+    return targetIdf;
   }
 
-  std::string VersionTranslator::update_1_7_4_to_1_7_5(const IdfFile& idf_1_7_4, const IddFileAndFactoryWrapper& idd_1_7_5) {
-    std::stringstream ss;
-
-    ss << idf_1_7_4.header() << '\n' << '\n';
-
+  IdfFile VersionTranslator::update_1_7_4_to_1_7_5(const IdfFile& idf_1_7_4, const IddFileAndFactoryWrapper& idd_1_7_5) {
     // new version object
     IdfFile targetIdf(idd_1_7_5.iddFile());
-    ss << targetIdf.versionObject().get();
+    targetIdf.setHeader(idf_1_7_4.header());
 
     for (const IdfObject& object : idf_1_7_4.objects()) {
       if (object.iddObject().name() == "OS:Sizing:System") {
@@ -2470,7 +2469,7 @@ namespace osversion {
         newObject.setString(37, "OnOff");
 
         m_refactored.push_back(RefactoredObjectData(object, newObject));
-        ss << newObject;
+        targetIdf.addObject(newObject);
       } else if (object.iddObject().name() == "OS:Sizing:Plant") {
         auto iddObject = idd_1_7_5.getObject("OS:Sizing:Plant");
         OS_ASSERT(iddObject);
@@ -2487,7 +2486,7 @@ namespace osversion {
         newObject.setString(7, "None");
 
         m_refactored.push_back(RefactoredObjectData(object, newObject));
-        ss << newObject;
+        targetIdf.addObject(newObject);
       } else if (object.iddObject().name() == "OS:DistrictCooling") {
         IdfObject newObject = object.clone(true);
 
@@ -2496,7 +2495,7 @@ namespace osversion {
         }
 
         m_refactored.push_back(RefactoredObjectData(object, newObject));
-        ss << newObject;
+        targetIdf.addObject(newObject);
       } else if (object.iddObject().name() == "OS:DistrictHeating") {
         IdfObject newObject = object.clone(true);
 
@@ -2505,7 +2504,7 @@ namespace osversion {
         }
 
         m_refactored.push_back(RefactoredObjectData(object, newObject));
-        ss << newObject;
+        targetIdf.addObject(newObject);
       } else if (object.iddObject().name() == "OS:Humidifier:Steam:Electric") {
         IdfObject newObject = object.clone(true);
 
@@ -2514,23 +2513,19 @@ namespace osversion {
         }
 
         m_refactored.push_back(RefactoredObjectData(object, newObject));
-        ss << newObject;
+        targetIdf.addObject(newObject);
       } else {
-        ss << object;
+        targetIdf.addObject(object);
       }
     }
 
-    return ss.str();
+    return targetIdf;
   }
 
-  std::string VersionTranslator::update_1_8_3_to_1_8_4(const IdfFile& idf_1_8_3, const IddFileAndFactoryWrapper& idd_1_8_4) {
-    std::stringstream ss;
-
-    ss << idf_1_8_3.header() << '\n' << '\n';
-
+  IdfFile VersionTranslator::update_1_8_3_to_1_8_4(const IdfFile& idf_1_8_3, const IddFileAndFactoryWrapper& idd_1_8_4) {
     // new version object
     IdfFile targetIdf(idd_1_8_4.iddFile());
-    ss << targetIdf.versionObject().get();
+    targetIdf.setHeader(idf_1_8_3.header());
 
     for (const IdfObject& object : idf_1_8_3.objects()) {
       auto iddname = object.iddObject().name();
@@ -2552,7 +2547,7 @@ namespace osversion {
         }
 
         m_refactored.push_back(RefactoredObjectData(object, newObject));
-        ss << newObject;
+        targetIdf.addObject(newObject);
       } else if (iddname == "OS:AirLoopHVAC") {
         auto iddObject = idd_1_8_4.getObject("OS:AirLoopHVAC");
         OS_ASSERT(iddObject);
@@ -2612,7 +2607,7 @@ namespace osversion {
         }
 
         m_refactored.push_back(RefactoredObjectData(object, newObject));
-        ss << newObject;
+        targetIdf.addObject(newObject);
       } else if (iddname == "OS:AvailabilityManager:Scheduled") {
         m_deprecated.push_back(object);
       } else if (iddname == "OS:AvailabilityManagerAssignmentList") {
@@ -2622,26 +2617,22 @@ namespace osversion {
         if (controlType
             && (istringEqual("CycleOnAny", controlType.get()) || istringEqual("CycleOnControlZone", controlType.get())
                 || istringEqual("CycleOnAnyZoneFansOnly", controlType.get()))) {
-          ss << object;
+          targetIdf.addObject(object);
         } else {
           m_deprecated.push_back(object);
         }
       } else {
-        ss << object;
+        targetIdf.addObject(object);
       }
     }
 
-    return ss.str();
+    return targetIdf;
   }
 
-  std::string VersionTranslator::update_1_8_4_to_1_8_5(const IdfFile& idf_1_8_4, const IddFileAndFactoryWrapper& idd_1_8_5) {
-    std::stringstream ss;
-
-    ss << idf_1_8_4.header() << '\n' << '\n';
-
+  IdfFile VersionTranslator::update_1_8_4_to_1_8_5(const IdfFile& idf_1_8_4, const IddFileAndFactoryWrapper& idd_1_8_5) {
     // new version object
     IdfFile targetIdf(idd_1_8_5.iddFile());
-    ss << targetIdf.versionObject().get();
+    targetIdf.setHeader(idf_1_8_4.header());
 
     for (const IdfObject& object : idf_1_8_4.objects()) {
       auto iddname = object.iddObject().name();
@@ -2658,9 +2649,9 @@ namespace osversion {
               newObject.setString(i, s.get());
             }
           }
-          ss << newObject;
+          targetIdf.addObject(newObject);
         } else {
-          ss << object;
+          targetIdf.addObject(object);
         }
       } else if (iddname == "OS:PlantLoop") {
         if ((!object.getString(20)) || object.getString(20).get().empty()) {
@@ -2675,26 +2666,22 @@ namespace osversion {
               newObject.setString(i, s.get());
             }
           }
-          ss << newObject;
+          targetIdf.addObject(newObject);
         } else {
-          ss << object;
+          targetIdf.addObject(object);
         }
       } else {
-        ss << object;
+        targetIdf.addObject(object);
       }
     }
 
-    return ss.str();
+    return targetIdf;
   }
 
-  std::string VersionTranslator::update_1_8_5_to_1_9_0(const IdfFile& idf_1_8_5, const IddFileAndFactoryWrapper& idd_1_9_0) {
-    std::stringstream ss;
-
-    ss << idf_1_8_5.header() << '\n' << '\n';
-
+  IdfFile VersionTranslator::update_1_8_5_to_1_9_0(const IdfFile& idf_1_8_5, const IddFileAndFactoryWrapper& idd_1_9_0) {
     // new version object
     IdfFile targetIdf(idd_1_9_0.iddFile());
-    ss << targetIdf.versionObject().get();
+    targetIdf.setHeader(idf_1_8_5.header());
 
     for (const IdfObject& object : idf_1_8_5.objects()) {
       auto iddname = object.iddObject().name();
@@ -2713,23 +2700,19 @@ namespace osversion {
           }
         }
         m_refactored.push_back(RefactoredObjectData(object, newObject));
-        ss << newObject;
+        targetIdf.addObject(newObject);
       } else {
-        ss << object;
+        targetIdf.addObject(object);
       }
     }
 
-    return ss.str();
+    return targetIdf;
   }
 
-  std::string VersionTranslator::update_1_9_2_to_1_9_3(const IdfFile& idf_1_9_2, const IddFileAndFactoryWrapper& idd_1_9_3) {
-    std::stringstream ss;
-
-    ss << idf_1_9_2.header() << '\n' << '\n';
-
+  IdfFile VersionTranslator::update_1_9_2_to_1_9_3(const IdfFile& idf_1_9_2, const IddFileAndFactoryWrapper& idd_1_9_3) {
     // new version object
     IdfFile targetIdf(idd_1_9_3.iddFile());
-    ss << targetIdf.versionObject().get();
+    targetIdf.setHeader(idf_1_9_2.header());
 
     for (const IdfObject& object : idf_1_9_2.objects()) {
       auto iddname = object.iddObject().name();
@@ -2754,7 +2737,7 @@ namespace osversion {
             }
           }
         }
-        ss << newObject;
+        targetIdf.addObject(newObject);
         m_refactored.push_back(RefactoredObjectData(object, newObject));
 
       } else if (iddname == "OS:ZoneAirMassFlowConservation") {
@@ -2778,7 +2761,7 @@ namespace osversion {
           newObject.setString(2, value.get());
         }
         // new field Infiltration Balancing Zones is defaulted to MixingSourceZonesOnly
-        ss << newObject;
+        targetIdf.addObject(newObject);
         m_refactored.push_back(RefactoredObjectData(object, newObject));
       } else if (iddname == "OS:AirTerminal:SingleDuct:VAV:Reheat") {
         auto iddObject = idd_1_9_3.getObject("OS:AirTerminal:SingleDuct:VAV:Reheat");
@@ -2794,7 +2777,7 @@ namespace osversion {
         newObject.setString(18, "No");
 
         m_refactored.push_back(RefactoredObjectData(object, newObject));
-        ss << newObject;
+        targetIdf.addObject(newObject);
       } else if (iddname == "OS:AirTerminal:SingleDuct:VAV:NoReheat") {
         auto iddObject = idd_1_9_3.getObject("OS:AirTerminal:SingleDuct:VAV:NoReheat");
         OS_ASSERT(iddObject);
@@ -2809,23 +2792,19 @@ namespace osversion {
         newObject.setString(10, "No");
 
         m_refactored.push_back(RefactoredObjectData(object, newObject));
-        ss << newObject;
+        targetIdf.addObject(newObject);
       } else {
-        ss << object;
+        targetIdf.addObject(object);
       }
     }
 
-    return ss.str();
+    return targetIdf;
   }
 
-  std::string VersionTranslator::update_1_9_4_to_1_9_5(const IdfFile& idf_1_9_4, const IddFileAndFactoryWrapper& idd_1_9_5) {
-    std::stringstream ss;
-
-    ss << idf_1_9_4.header() << '\n' << '\n';
-
+  IdfFile VersionTranslator::update_1_9_4_to_1_9_5(const IdfFile& idf_1_9_4, const IddFileAndFactoryWrapper& idd_1_9_5) {
     // new version object
     IdfFile targetIdf(idd_1_9_5.iddFile());
-    ss << targetIdf.versionObject().get();
+    targetIdf.setHeader(idf_1_9_4.header());
 
     for (const IdfObject& object : idf_1_9_4.objects()) {
       auto iddname = object.iddObject().name();
@@ -2878,23 +2857,19 @@ namespace osversion {
         }
 
         m_refactored.push_back(RefactoredObjectData(object, newObject));
-        ss << newObject;
+        targetIdf.addObject(newObject);
       } else {
-        ss << object;
+        targetIdf.addObject(object);
       }
     }
 
-    return ss.str();
+    return targetIdf;
   }
 
-  std::string VersionTranslator::update_1_9_5_to_1_10_0(const IdfFile& idf_1_9_5, const IddFileAndFactoryWrapper& idd_1_10_0) {
-    std::stringstream ss;
-
-    ss << idf_1_9_5.header() << '\n' << '\n';
-
+  IdfFile VersionTranslator::update_1_9_5_to_1_10_0(const IdfFile& idf_1_9_5, const IddFileAndFactoryWrapper& idd_1_10_0) {
     // new version object
     IdfFile targetIdf(idd_1_10_0.iddFile());
-    ss << targetIdf.versionObject().get();
+    targetIdf.setHeader(idf_1_9_5.header());
 
     for (const IdfObject& object : idf_1_9_5.objects()) {
       auto iddname = object.iddObject().name();
@@ -2920,7 +2895,7 @@ namespace osversion {
         }
 
         m_refactored.push_back(RefactoredObjectData(object, newObject));
-        ss << newObject;
+        targetIdf.addObject(newObject);
       } else if (iddname == "OS:AirTerminal:SingleDuct:VAV:NoReheat") {
         auto iddObject = idd_1_10_0.getObject("OS:AirTerminal:SingleDuct:VAV:NoReheat");
         OS_ASSERT(iddObject);
@@ -2943,24 +2918,20 @@ namespace osversion {
         }
 
         m_refactored.push_back(RefactoredObjectData(object, newObject));
-        ss << newObject;
+        targetIdf.addObject(newObject);
       } else {
-        ss << object;
+        targetIdf.addObject(object);
       }
     }
 
-    return ss.str();
+    return targetIdf;
   }
 
-  std::string VersionTranslator::update_1_10_1_to_1_10_2(const IdfFile& idf_1_10_1, const IddFileAndFactoryWrapper& idd_1_10_2) {
-
-    std::stringstream ss;
-
-    ss << idf_1_10_1.header() << '\n' << '\n';
+  IdfFile VersionTranslator::update_1_10_1_to_1_10_2(const IdfFile& idf_1_10_1, const IddFileAndFactoryWrapper& idd_1_10_2) {
 
     // new version object
     IdfFile targetIdf(idd_1_10_2.iddFile());
-    ss << targetIdf.versionObject().get();
+    targetIdf.setHeader(idf_1_10_1.header());
 
     auto zones = idf_1_10_1.getObjectsByType(idf_1_10_1.iddFile().getObject("OS:ThermalZone").get());
 
@@ -2985,13 +2956,13 @@ namespace osversion {
             // but since we are messing with the name it is probably best
             auto newThermostat = object.clone();
             newThermostat.setName(referencingZone.nameString() + " Thermostat");
-            ss << newThermostat;
+            targetIdf.addObject(newThermostat);
             m_new.push_back(newThermostat);
             auto newHandle = newThermostat.getString(0).get();
             referencingZone.setString(19, newHandle);
           }
         }
-        ss << object;
+        targetIdf.addObject(object);
       } else if (iddname == "OS:Sizing:Zone") {
         auto iddObject = idd_1_10_2.getObject("OS:Sizing:Zone");
         OS_ASSERT(iddObject);
@@ -3027,9 +2998,9 @@ namespace osversion {
         newObject.setString(27, "Autosize");
 
         m_refactored.push_back(RefactoredObjectData(object, newObject));
-        ss << newObject;
+        targetIdf.addObject(newObject);
       } else {
-        ss << object;
+        targetIdf.addObject(object);
       }
     }
 
@@ -3050,20 +3021,16 @@ namespace osversion {
       newObject.setString(27, "Autosize");
 
       m_new.push_back(newObject);
-      ss << newObject;
+      targetIdf.addObject(newObject);
     }
 
-    return ss.str();
+    return targetIdf;
   }
 
-  std::string VersionTranslator::update_1_10_5_to_1_10_6(const IdfFile& idf_1_10_5, const IddFileAndFactoryWrapper& idd_1_10_6) {
-    std::stringstream ss;
-
-    ss << idf_1_10_5.header() << '\n' << '\n';
-
+  IdfFile VersionTranslator::update_1_10_5_to_1_10_6(const IdfFile& idf_1_10_5, const IddFileAndFactoryWrapper& idd_1_10_6) {
     // new version object
     IdfFile targetIdf(idd_1_10_6.iddFile());
-    ss << targetIdf.versionObject().get();
+    targetIdf.setHeader(idf_1_10_5.header());
 
     for (const IdfObject& object : idf_1_10_5.objects()) {
       auto iddname = object.iddObject().name();
@@ -3090,23 +3057,19 @@ namespace osversion {
         }
 
         m_refactored.push_back(RefactoredObjectData(object, newObject));
-        ss << newObject;
+        targetIdf.addObject(newObject);
       } else {
-        ss << object;
+        targetIdf.addObject(object);
       }
     }
 
-    return ss.str();
+    return targetIdf;
   }
 
-  std::string VersionTranslator::update_1_11_3_to_1_11_4(const IdfFile& idf_1_11_3, const IddFileAndFactoryWrapper& idd_1_11_4) {
-    std::stringstream ss;
-
-    ss << idf_1_11_3.header() << '\n' << '\n';
-
+  IdfFile VersionTranslator::update_1_11_3_to_1_11_4(const IdfFile& idf_1_11_3, const IddFileAndFactoryWrapper& idd_1_11_4) {
     // new version object
     IdfFile targetIdf(idd_1_11_4.iddFile());
-    ss << targetIdf.versionObject().get();
+    targetIdf.setHeader(idf_1_11_3.header());
 
     for (const IdfObject& object : idf_1_11_3.objects()) {
       auto iddname = object.iddObject().name();
@@ -3132,23 +3095,19 @@ namespace osversion {
         newObject.setDouble(5, 0.8);
 
         m_refactored.push_back(RefactoredObjectData(object, newObject));
-        ss << newObject;
+        targetIdf.addObject(newObject);
       } else {
-        ss << object;
+        targetIdf.addObject(object);
       }
     }
 
-    return ss.str();
+    return targetIdf;
   }
 
-  std::string VersionTranslator::update_1_11_4_to_1_11_5(const IdfFile& idf_1_11_4, const IddFileAndFactoryWrapper& idd_1_11_5) {
-    std::stringstream ss;
-
-    ss << idf_1_11_4.header() << '\n' << '\n';
-
+  IdfFile VersionTranslator::update_1_11_4_to_1_11_5(const IdfFile& idf_1_11_4, const IddFileAndFactoryWrapper& idd_1_11_5) {
     // new version object
     IdfFile targetIdf(idd_1_11_5.iddFile());
-    ss << targetIdf.versionObject().get();
+    targetIdf.setHeader(idf_1_11_4.header());
 
     for (const IdfObject& object : idf_1_11_4.objects()) {
       auto iddname = object.iddObject().name();
@@ -3175,23 +3134,19 @@ namespace osversion {
         }
 
         m_refactored.push_back(RefactoredObjectData(object, newObject));
-        ss << newObject;
+        targetIdf.addObject(newObject);
       } else {
-        ss << object;
+        targetIdf.addObject(object);
       }
     }
 
-    return ss.str();
+    return targetIdf;
   }
 
-  std::string VersionTranslator::update_1_12_0_to_1_12_1(const IdfFile& idf_1_12_0, const IddFileAndFactoryWrapper& idd_1_12_1) {
-    std::stringstream ss;
-
-    ss << idf_1_12_0.header() << '\n' << '\n';
-
+  IdfFile VersionTranslator::update_1_12_0_to_1_12_1(const IdfFile& idf_1_12_0, const IddFileAndFactoryWrapper& idd_1_12_1) {
     // new version object
     IdfFile targetIdf(idd_1_12_1.iddFile());
-    ss << targetIdf.versionObject().get();
+    targetIdf.setHeader(idf_1_12_0.header());
 
     for (const IdfObject& object : idf_1_12_0.objects()) {
       auto iddname = object.iddObject().name();
@@ -3209,21 +3164,18 @@ namespace osversion {
         }
 
         m_refactored.push_back(RefactoredObjectData(object, newObject));
-        ss << newObject;
+        targetIdf.addObject(newObject);
       } else {
-        ss << object;
+        targetIdf.addObject(object);
       }
     }
 
-    return ss.str();
+    return targetIdf;
   }
 
-  std::string VersionTranslator::update_1_12_3_to_1_12_4(const IdfFile& idf_1_12_3, const IddFileAndFactoryWrapper& idd_1_12_4) {
-    std::stringstream ss;
-
-    ss << idf_1_12_3.header() << '\n' << '\n';
+  IdfFile VersionTranslator::update_1_12_3_to_1_12_4(const IdfFile& idf_1_12_3, const IddFileAndFactoryWrapper& idd_1_12_4) {
     IdfFile targetIdf(idd_1_12_4.iddFile());
-    ss << targetIdf.versionObject().get();
+    targetIdf.setHeader(idf_1_12_3.header());
 
     for (const IdfObject& object : idf_1_12_3.objects()) {
       auto iddname = object.iddObject().name();
@@ -3247,21 +3199,18 @@ namespace osversion {
         }
 
         m_refactored.push_back(RefactoredObjectData(object, newObject));
-        ss << newObject;
+        targetIdf.addObject(newObject);
       } else {
-        ss << object;
+        targetIdf.addObject(object);
       }
     }
 
-    return ss.str();
+    return targetIdf;
   }
 
-  std::string VersionTranslator::update_2_1_0_to_2_1_1(const IdfFile& idf_2_1_0, const IddFileAndFactoryWrapper& idd_2_1_1) {
-    std::stringstream ss;
-
-    ss << idf_2_1_0.header() << '\n' << '\n';
+  IdfFile VersionTranslator::update_2_1_0_to_2_1_1(const IdfFile& idf_2_1_0, const IddFileAndFactoryWrapper& idd_2_1_1) {
     IdfFile targetIdf(idd_2_1_1.iddFile());
-    ss << targetIdf.versionObject().get();
+    targetIdf.setHeader(idf_2_1_0.header());
 
     for (const IdfObject& object : idf_2_1_0.objects()) {
       auto iddname = object.iddObject().name();
@@ -3283,7 +3232,7 @@ namespace osversion {
         }
 
         m_refactored.push_back(RefactoredObjectData(object, newObject));
-        ss << newObject;
+        targetIdf.addObject(newObject);
       } else if (iddname == "OS:HeatPump:WaterToWater:EquationFit:Heating") {
         auto iddObject = idd_2_1_1.getObject("OS:HeatPump:WaterToWater:EquationFit:Heating");
         IdfObject newObject(iddObject.get());
@@ -3298,7 +3247,7 @@ namespace osversion {
         newObject.setString(22, "");
 
         m_refactored.push_back(RefactoredObjectData(object, newObject));
-        ss << newObject;
+        targetIdf.addObject(newObject);
       } else if (iddname == "OS:HeatPump:WaterToWater:EquationFit:Cooling") {
         auto iddObject = idd_2_1_1.getObject("OS:HeatPump:WaterToWater:EquationFit:Cooling");
         IdfObject newObject(iddObject.get());
@@ -3313,21 +3262,18 @@ namespace osversion {
         newObject.setString(22, "");
 
         m_refactored.push_back(RefactoredObjectData(object, newObject));
-        ss << newObject;
+        targetIdf.addObject(newObject);
       } else {
-        ss << object;
+        targetIdf.addObject(object);
       }
     }
 
-    return ss.str();
+    return targetIdf;
   }
 
-  std::string VersionTranslator::update_2_1_1_to_2_1_2(const IdfFile& idf_2_1_1, const IddFileAndFactoryWrapper& idd_2_1_2) {
-    std::stringstream ss;
-
-    ss << idf_2_1_1.header() << '\n' << '\n';
+  IdfFile VersionTranslator::update_2_1_1_to_2_1_2(const IdfFile& idf_2_1_1, const IddFileAndFactoryWrapper& idd_2_1_2) {
     IdfFile targetIdf(idd_2_1_2.iddFile());
-    ss << targetIdf.versionObject().get();
+    targetIdf.setHeader(idf_2_1_1.header());
 
     for (const IdfObject& object : idf_2_1_1.objects()) {
       auto iddname = object.iddObject().name();
@@ -3350,7 +3296,7 @@ namespace osversion {
         }
 
         m_refactored.push_back(RefactoredObjectData(object, newObject));
-        ss << newObject;
+        targetIdf.addObject(newObject);
       } else if (iddname == "OS:ZoneHVAC:FourPipeFanCoil") {
         auto iddObject = idd_2_1_2.getObject("OS:ZoneHVAC:FourPipeFanCoil");
         IdfObject newObject(iddObject.get());
@@ -3366,21 +3312,18 @@ namespace osversion {
         newObject.setString(24, "Autosize");
 
         m_refactored.push_back(RefactoredObjectData(object, newObject));
-        ss << newObject;
+        targetIdf.addObject(newObject);
       } else {
-        ss << object;
+        targetIdf.addObject(object);
       }
     }
 
-    return ss.str();
+    return targetIdf;
   }
 
-  std::string VersionTranslator::update_2_3_0_to_2_3_1(const IdfFile& idf_2_3_0, const IddFileAndFactoryWrapper& idd_2_3_1) {
-    std::stringstream ss;
-
-    ss << idf_2_3_0.header() << '\n' << '\n';
+  IdfFile VersionTranslator::update_2_3_0_to_2_3_1(const IdfFile& idf_2_3_0, const IddFileAndFactoryWrapper& idd_2_3_1) {
     IdfFile targetIdf(idd_2_3_1.iddFile());
-    ss << targetIdf.versionObject().get();
+    targetIdf.setHeader(idf_2_3_0.header());
 
     boost::optional<std::string> value;
 
@@ -3402,7 +3345,7 @@ namespace osversion {
         newObject.setString(18, "1.282051282");
 
         m_refactored.push_back(RefactoredObjectData(object, newObject));
-        ss << newObject;
+        targetIdf.addObject(newObject);
       } else if (iddname == "OS:Pump:VariableSpeed") {
         auto iddObject = idd_2_3_1.getObject("OS:Pump:VariableSpeed");
         IdfObject newObject(iddObject.get());
@@ -3420,7 +3363,7 @@ namespace osversion {
         newObject.setString(29, "0.0");
 
         m_refactored.push_back(RefactoredObjectData(object, newObject));
-        ss << newObject;
+        targetIdf.addObject(newObject);
       } else if (iddname == "OS:CoolingTower:SingleSpeed") {
         auto iddObject = idd_2_3_1.getObject("OS:CoolingTower:SingleSpeed");
         IdfObject newObject(iddObject.get());
@@ -3442,7 +3385,7 @@ namespace osversion {
         newObject.setString(37, "General");
 
         m_refactored.push_back(RefactoredObjectData(object, newObject));
-        ss << newObject;
+        targetIdf.addObject(newObject);
       } else if (iddname == "OS:CoolingTower:TwoSpeed") {
         auto iddObject = idd_2_3_1.getObject("OS:CoolingTower:TwoSpeed");
         IdfObject newObject(iddObject.get());
@@ -3460,7 +3403,7 @@ namespace osversion {
         newObject.setString(45, "General");
 
         m_refactored.push_back(RefactoredObjectData(object, newObject));
-        ss << newObject;
+        targetIdf.addObject(newObject);
       } else if (iddname == "OS:CoolingTower:VariableSpeed") {
         auto iddObject = idd_2_3_1.getObject("OS:CoolingTower:VariableSpeed");
         IdfObject newObject(iddObject.get());
@@ -3474,7 +3417,7 @@ namespace osversion {
         newObject.setString(31, "General");
 
         m_refactored.push_back(RefactoredObjectData(object, newObject));
-        ss << newObject;
+        targetIdf.addObject(newObject);
 
       } else if (iddname == "OS:Chiller:Electric:EIR") {
         auto iddObject = idd_2_3_1.getObject("OS:Chiller:Electric:EIR");
@@ -3493,7 +3436,7 @@ namespace osversion {
         }
 
         m_refactored.push_back(RefactoredObjectData(object, newObject));
-        ss << newObject;
+        targetIdf.addObject(newObject);
       } else if (iddname == "OS:AirLoopHVAC") {
         auto iddObject = idd_2_3_1.getObject("OS:AirLoopHVAC");
         IdfObject newObject(iddObject.get());
@@ -3531,8 +3474,8 @@ namespace osversion {
         m_refactored.push_back(RefactoredObjectData(object, newObject));
         m_new.push_back(avmList);
 
-        ss << newObject;
-        ss << avmList;
+        targetIdf.addObject(newObject);
+        targetIdf.addObject(avmList);
 
       } else if (iddname == "OS:PlantLoop") {
         auto iddObject = idd_2_3_1.getObject("OS:PlantLoop");
@@ -3567,8 +3510,8 @@ namespace osversion {
         m_refactored.push_back(RefactoredObjectData(object, newObject));
         m_new.push_back(avmList);
 
-        ss << newObject;
-        ss << avmList;
+        targetIdf.addObject(newObject);
+        targetIdf.addObject(avmList);
 
       } else if (iddname == "OS:AvailabilityManager:NightCycle") {
         auto iddObject = idd_2_3_1.getObject("OS:AvailabilityManager:NightCycle");
@@ -3646,26 +3589,23 @@ namespace osversion {
         m_new.push_back(heatingControlThermalZoneList);
         m_new.push_back(heatingZoneFansOnlyThermalZoneList);
 
-        ss << newObject;
-        ss << controlThermalZoneList;
-        ss << coolingControlThermalZoneList;
-        ss << heatingControlThermalZoneList;
-        ss << heatingZoneFansOnlyThermalZoneList;
+        targetIdf.addObject(newObject);
+        targetIdf.addObject(controlThermalZoneList);
+        targetIdf.addObject(coolingControlThermalZoneList);
+        targetIdf.addObject(heatingControlThermalZoneList);
+        targetIdf.addObject(heatingZoneFansOnlyThermalZoneList);
 
       } else {
-        ss << object;
+        targetIdf.addObject(object);
       }
     }
 
-    return ss.str();
+    return targetIdf;
   }
 
-  std::string VersionTranslator::update_2_4_1_to_2_4_2(const IdfFile& idf_2_4_1, const IddFileAndFactoryWrapper& idd_2_4_2) {
-    std::stringstream ss;
-
-    ss << idf_2_4_1.header() << '\n' << '\n';
+  IdfFile VersionTranslator::update_2_4_1_to_2_4_2(const IdfFile& idf_2_4_1, const IddFileAndFactoryWrapper& idd_2_4_2) {
     IdfFile targetIdf(idd_2_4_2.iddFile());
-    ss << targetIdf.versionObject().get();
+    targetIdf.setHeader(idf_2_4_1.header());
 
     boost::optional<std::string> value;
 
@@ -3683,7 +3623,7 @@ namespace osversion {
         }
 
         m_refactored.push_back(RefactoredObjectData(object, newObject));
-        ss << newObject;
+        targetIdf.addObject(newObject);
 
         iddObject = idd_2_4_2.getObject("OS:AdditionalProperties");
         IdfObject additionalProperties(iddObject.get());
@@ -3698,7 +3638,7 @@ namespace osversion {
         }
 
         m_new.push_back(additionalProperties);
-        ss << additionalProperties;
+        targetIdf.addObject(additionalProperties);
 
       } else if (iddname == "OS:Boiler:HotWater") {
         auto iddObject = idd_2_4_2.getObject("OS:Boiler:HotWater");
@@ -3712,7 +3652,7 @@ namespace osversion {
         newObject.setString(18, "General");
 
         m_refactored.push_back(RefactoredObjectData(object, newObject));
-        ss << newObject;
+        targetIdf.addObject(newObject);
 
       } else if (iddname == "OS:Boiler:Steam") {
         auto iddObject = idd_2_4_2.getObject("OS:Boiler:Steam");
@@ -3726,7 +3666,7 @@ namespace osversion {
         newObject.setString(16, "General");
 
         m_refactored.push_back(RefactoredObjectData(object, newObject));
-        ss << newObject;
+        targetIdf.addObject(newObject);
 
       } else if (iddname == "OS:WaterHeater:Mixed") {
         auto iddObject = idd_2_4_2.getObject("OS:WaterHeater:Mixed");
@@ -3747,7 +3687,7 @@ namespace osversion {
         newObject.setString(42, "General");
 
         m_refactored.push_back(RefactoredObjectData(object, newObject));
-        ss << newObject;
+        targetIdf.addObject(newObject);
 
       } else if (iddname == "OS:Chiller:Electric:EIR") {
         auto iddObject = idd_2_4_2.getObject("OS:Chiller:Electric:EIR");
@@ -3772,23 +3712,20 @@ namespace osversion {
         newObject.setString(34, "General");
 
         m_refactored.push_back(RefactoredObjectData(object, newObject));
-        ss << newObject;
+        targetIdf.addObject(newObject);
 
         // Default case
       } else {
-        ss << object;
+        targetIdf.addObject(object);
       }
     }
 
-    return ss.str();
+    return targetIdf;
   }
 
-  std::string VersionTranslator::update_2_4_3_to_2_5_0(const IdfFile& idf_2_4_3, const IddFileAndFactoryWrapper& idd_2_5_0) {
-    std::stringstream ss;
-
-    ss << idf_2_4_3.header() << '\n' << '\n';
+  IdfFile VersionTranslator::update_2_4_3_to_2_5_0(const IdfFile& idf_2_4_3, const IddFileAndFactoryWrapper& idd_2_5_0) {
     IdfFile targetIdf(idd_2_5_0.iddFile());
-    ss << targetIdf.versionObject().get();
+    targetIdf.setHeader(idf_2_4_3.header());
 
     boost::optional<std::string> value;
 
@@ -3829,24 +3766,22 @@ namespace osversion {
         }
 
         m_refactored.push_back(RefactoredObjectData(object, newObject));
-        ss << newObject;
+        targetIdf.addObject(newObject);
 
         // Default case
       } else {
-        ss << object;
+        targetIdf.addObject(object);
       }
     }
 
-    return ss.str();
+    return targetIdf;
   }
 
-  std::string VersionTranslator::update_2_6_0_to_2_6_1(const IdfFile& idf_2_6_0, const IddFileAndFactoryWrapper& idd_2_6_1) {
-    std::stringstream ss;
+  IdfFile VersionTranslator::update_2_6_0_to_2_6_1(const IdfFile& idf_2_6_0, const IddFileAndFactoryWrapper& idd_2_6_1) {
     boost::optional<std::string> value;
 
-    ss << idf_2_6_0.header() << '\n' << '\n';
     IdfFile targetIdf(idd_2_6_1.iddFile());
-    ss << targetIdf.versionObject().get();
+    targetIdf.setHeader(idf_2_6_0.header());
 
     struct ConnectionInfo
     {
@@ -3899,8 +3834,8 @@ namespace osversion {
 
         m_refactored.push_back(RefactoredObjectData(object, newObject));
         m_new.push_back(newReturnPortList);
-        ss << newObject;
-        ss << newReturnPortList;
+        targetIdf.addObject(newObject);
+        targetIdf.addObject(newReturnPortList);
       } else if (iddname == "OS:Connection") {
         value = object.getString(0);
         OS_ASSERT(value);
@@ -3918,25 +3853,22 @@ namespace osversion {
           newConnection.setString(2, c->second.newPortListHandle);
           newConnection.setUnsigned(3, 3);
           m_refactored.push_back(RefactoredObjectData(object, newConnection));
-          ss << newConnection;
+          targetIdf.addObject(newConnection);
         } else {
-          ss << object;
+          targetIdf.addObject(object);
         }
         // No-op
       } else {
-        ss << object;
+        targetIdf.addObject(object);
       }
     }
 
-    return ss.str();
+    return targetIdf;
   }
 
-  std::string VersionTranslator::update_2_6_1_to_2_6_2(const IdfFile& idf_2_6_1, const IddFileAndFactoryWrapper& idd_2_6_2) {
-    std::stringstream ss;
-
-    ss << idf_2_6_1.header() << '\n' << '\n';
+  IdfFile VersionTranslator::update_2_6_1_to_2_6_2(const IdfFile& idf_2_6_1, const IddFileAndFactoryWrapper& idd_2_6_2) {
     IdfFile targetIdf(idd_2_6_2.iddFile());
-    ss << targetIdf.versionObject().get();
+    targetIdf.setHeader(idf_2_6_1.header());
 
     for (const IdfObject& object : idf_2_6_1.objects()) {
       auto iddname = object.iddObject().name();
@@ -3969,7 +3901,7 @@ namespace osversion {
         }
 
         m_refactored.push_back(RefactoredObjectData(object, newObject));
-        ss << newObject;
+        targetIdf.addObject(newObject);
 
       } else if (iddname == "OS:ZoneHVAC:EquipmentList") {
         // In 2.6.2, a field "Load Distribution Scheme" was inserted right after the thermal zone
@@ -3990,22 +3922,19 @@ namespace osversion {
         }
 
         m_refactored.push_back(RefactoredObjectData(object, newObject));
-        ss << newObject;
+        targetIdf.addObject(newObject);
 
       } else {
-        ss << object;
+        targetIdf.addObject(object);
       }
     }
 
-    return ss.str();
+    return targetIdf;
   }
 
-  std::string VersionTranslator::update_2_6_2_to_2_7_0(const IdfFile& idf_2_6_2, const IddFileAndFactoryWrapper& idd_2_7_0) {
-    std::stringstream ss;
-
-    ss << idf_2_6_2.header() << '\n' << '\n';
+  IdfFile VersionTranslator::update_2_6_2_to_2_7_0(const IdfFile& idf_2_6_2, const IddFileAndFactoryWrapper& idd_2_7_0) {
     IdfFile targetIdf(idd_2_7_0.iddFile());
-    ss << targetIdf.versionObject().get();
+    targetIdf.setHeader(idf_2_6_2.header());
 
     struct ConnectionInfo
     {
@@ -4085,8 +4014,8 @@ namespace osversion {
               // Register new objects
               m_new.push_back(newNode);
               m_new.push_back(newConnection);
-              ss << newNode;
-              ss << newConnection;
+              targetIdf.addObject(newNode);
+              targetIdf.addObject(newConnection);
 
             } else {
               // Otherwise, keep the same
@@ -4096,7 +4025,7 @@ namespace osversion {
         }
 
         m_refactored.push_back(RefactoredObjectData(object, newObject));
-        ss << newObject;
+        targetIdf.addObject(newObject);
 
       } else if (iddname == "OS:Connection") {
         // No-Op for now
@@ -4104,7 +4033,7 @@ namespace osversion {
         OS_ASSERT(value);
         if (connectionsToFix.find(value.get()) == connectionsToFix.end()) {
           // No need to fix it, we just push it
-          ss << object;
+          targetIdf.addObject(object);
         }
 
       } else if (iddname == "OS:Building") {
@@ -4128,7 +4057,7 @@ namespace osversion {
         // Field is optional string, so leave it empty
 
         m_refactored.push_back(RefactoredObjectData(object, newObject));
-        ss << newObject;
+        targetIdf.addObject(newObject);
 
       } else if (iddname == "OS:SpaceType") {
         // Added a field "Standards Template" at position 6
@@ -4151,10 +4080,10 @@ namespace osversion {
         // Field is optional string, so leave it empty
 
         m_refactored.push_back(RefactoredObjectData(object, newObject));
-        ss << newObject;
+        targetIdf.addObject(newObject);
 
       } else {
-        ss << object;
+        targetIdf.addObject(object);
       }
     }
 
@@ -4182,21 +4111,19 @@ namespace osversion {
           newConnection.setString(4, c->second.newNodeHandle);
           newConnection.setUnsigned(5, 2);
           m_refactored.push_back(RefactoredObjectData(object, newConnection));
-          ss << newConnection;
+          targetIdf.addObject(newConnection);
         }
       }
     }
 
-    return ss.str();
+    return targetIdf;
   }
 
-  std::string VersionTranslator::update_2_7_0_to_2_7_1(const IdfFile& idf_2_7_0, const IddFileAndFactoryWrapper& idd_2_7_1) {
-    std::stringstream ss;
+  IdfFile VersionTranslator::update_2_7_0_to_2_7_1(const IdfFile& idf_2_7_0, const IddFileAndFactoryWrapper& idd_2_7_1) {
     boost::optional<std::string> value;
 
-    ss << idf_2_7_0.header() << '\n' << '\n';
     IdfFile targetIdf(idd_2_7_1.iddFile());
-    ss << targetIdf.versionObject().get();
+    targetIdf.setHeader(idf_2_7_0.header());
 
     for (const IdfObject& object : idf_2_7_0.objects()) {
       auto iddname = object.iddObject().name();
@@ -4216,26 +4143,24 @@ namespace osversion {
                       << "'. Please review carefully.");
 
           m_refactored.push_back(RefactoredObjectData(object, newObject));
-          ss << newObject;
+          targetIdf.addObject(newObject);
         } else {
           // Nothing to do here
-          ss << object;
+          targetIdf.addObject(object);
         }
       } else {
-        ss << object;
+        targetIdf.addObject(object);
       }
     }
 
-    return ss.str();
+    return targetIdf;
   }
 
-  std::string VersionTranslator::update_2_7_1_to_2_7_2(const IdfFile& idf_2_7_1, const IddFileAndFactoryWrapper& idd_2_7_2) {
-    std::stringstream ss;
+  IdfFile VersionTranslator::update_2_7_1_to_2_7_2(const IdfFile& idf_2_7_1, const IddFileAndFactoryWrapper& idd_2_7_2) {
     boost::optional<std::string> value;
 
-    ss << idf_2_7_1.header() << '\n' << '\n';
     IdfFile targetIdf(idd_2_7_2.iddFile());
-    ss << targetIdf.versionObject().get();
+    targetIdf.setHeader(idf_2_7_1.header());
 
     for (const IdfObject& object : idf_2_7_1.objects()) {
       auto iddname = object.iddObject().name();
@@ -4248,10 +4173,10 @@ namespace osversion {
           IdfObject newObject = object.clone(true);
           newObject.setString(10, value.get().substr(7));
           m_refactored.push_back(RefactoredObjectData(object, newObject));
-          ss << newObject;
+          targetIdf.addObject(newObject);
         } else {
           // Nothing to do here
-          ss << object;
+          targetIdf.addObject(object);
         }
 
         // Both of these happen to have the url field at pos 2 (note: neither of these are actually implemented in the SDK, but let's be safe)
@@ -4263,10 +4188,10 @@ namespace osversion {
           IdfObject newObject = object.clone(true);
           newObject.setString(2, value.get().substr(7));
           m_refactored.push_back(RefactoredObjectData(object, newObject));
-          ss << newObject;
+          targetIdf.addObject(newObject);
         } else {
           // Nothing to do here
-          ss << object;
+          targetIdf.addObject(object);
         }
 
       } else if (iddname == "OS:ZoneHVAC:EquipmentList") {
@@ -4290,24 +4215,22 @@ namespace osversion {
         }
 
         m_refactored.push_back(RefactoredObjectData(object, newObject));
-        ss << newObject;
+        targetIdf.addObject(newObject);
 
         // No-op
       } else {
-        ss << object;
+        targetIdf.addObject(object);
       }
     }
 
-    return ss.str();
+    return targetIdf;
   }
 
-  std::string VersionTranslator::update_2_8_1_to_2_9_0(const IdfFile& idf_2_8_1, const IddFileAndFactoryWrapper& idd_2_9_0) {
-    std::stringstream ss;
+  IdfFile VersionTranslator::update_2_8_1_to_2_9_0(const IdfFile& idf_2_8_1, const IddFileAndFactoryWrapper& idd_2_9_0) {
     boost::optional<std::string> value;
 
-    ss << idf_2_8_1.header() << '\n' << '\n';
     IdfFile targetIdf(idd_2_9_0.iddFile());
-    ss << targetIdf.versionObject().get();
+    targetIdf.setHeader(idf_2_8_1.header());
 
     for (const IdfObject& object : idf_2_8_1.objects()) {
       auto iddname = object.iddObject().name();
@@ -4329,7 +4252,7 @@ namespace osversion {
         }
 
         m_refactored.push_back(RefactoredObjectData(object, newObject));
-        ss << newObject;
+        targetIdf.addObject(newObject);
 
       } else if (iddname == "OS:Schedule:FixedInterval") {
         auto iddObject = idd_2_9_0.getObject("OS:Schedule:FixedInterval");
@@ -4348,7 +4271,7 @@ namespace osversion {
         }
 
         m_refactored.push_back(RefactoredObjectData(object, newObject));
-        ss << newObject;
+        targetIdf.addObject(newObject);
 
       } else if (iddname == "OS:ZoneHVAC:EquipmentList") {
         auto iddObject = idd_2_9_0.getObject("OS:ZoneHVAC:EquipmentList");
@@ -4385,7 +4308,7 @@ namespace osversion {
                 scheduleConstant.setDouble(3, fraction.get());
 
                 m_new.push_back(scheduleConstant);
-                ss << scheduleConstant;
+                targetIdf.addObject(scheduleConstant);
 
                 new_eg.setString(i, uuid);
               }
@@ -4396,7 +4319,7 @@ namespace osversion {
         }
 
         m_refactored.push_back(RefactoredObjectData(object, newObject));
-        ss << newObject;
+        targetIdf.addObject(newObject);
 
       } else if (iddname == "OS:ThermalStorage:Ice:Detailed") {
         auto iddObject = idd_2_9_0.getObject("OS:ThermalStorage:Ice:Detailed");
@@ -4461,7 +4384,7 @@ namespace osversion {
            */
 
         m_refactored.push_back(RefactoredObjectData(object, newObject));
-        ss << newObject;
+        targetIdf.addObject(newObject);
 
       } else if (iddname == "OS:AirLoopHVAC:UnitaryHeatCool:VAVChangeoverBypass") {
         auto iddObject = idd_2_9_0.getObject("OS:AirLoopHVAC:UnitaryHeatCool:VAVChangeoverBypass");
@@ -4511,12 +4434,12 @@ namespace osversion {
         // Register new objects
         m_new.push_back(newNode);
         m_new.push_back(newConnection);
-        ss << newNode;
-        ss << newConnection;
+        targetIdf.addObject(newNode);
+        targetIdf.addObject(newConnection);
 
         // Register refactored
         m_refactored.push_back(RefactoredObjectData(object, newObject));
-        ss << newObject;
+        targetIdf.addObject(newObject);
 
         // Four fields were added but only the last (End Use Subcat) was implemented, but withotu transition rules either
       } else if ((iddname == "OS:HeaderedPumps:ConstantSpeed") || (iddname == "OS:HeaderedPumps:VariableSpeed")) {
@@ -4552,24 +4475,22 @@ namespace osversion {
 
         // Register refactored
         m_refactored.push_back(RefactoredObjectData(object, newObject));
-        ss << newObject;
+        targetIdf.addObject(newObject);
 
         // No-op
       } else {
-        ss << object;
+        targetIdf.addObject(object);
       }
     }
 
-    return ss.str();
+    return targetIdf;
   }
 
-  std::string VersionTranslator::update_2_9_0_to_2_9_1(const IdfFile& idf_2_9_0, const IddFileAndFactoryWrapper& idd_2_9_1) {
-    std::stringstream ss;
+  IdfFile VersionTranslator::update_2_9_0_to_2_9_1(const IdfFile& idf_2_9_0, const IddFileAndFactoryWrapper& idd_2_9_1) {
     boost::optional<std::string> value;
 
-    ss << idf_2_9_0.header() << '\n' << '\n';
     IdfFile targetIdf(idd_2_9_1.iddFile());
-    ss << targetIdf.versionObject().get();
+    targetIdf.setHeader(idf_2_9_0.header());
 
     boost::optional<IdfObject> alwaysOnDiscreteSchedule;
 
@@ -4606,8 +4527,8 @@ namespace osversion {
 
         alwaysOnDiscreteSchedule->setString(2, typeLimits.getString(0).get());
 
-        ss << alwaysOnDiscreteSchedule.get();
-        ss << typeLimits;
+        targetIdf.addObject(alwaysOnDiscreteSchedule.get());
+        targetIdf.addObject(typeLimits);
 
         // Register new objects
         m_new.push_back(alwaysOnDiscreteSchedule.get());
@@ -4632,24 +4553,22 @@ namespace osversion {
         newObject.setString(2, alwaysOnDiscreteSchedule->getString(0).get());
 
         m_refactored.push_back(RefactoredObjectData(object, newObject));
-        ss << newObject;
+        targetIdf.addObject(newObject);
 
         // No-op
       } else {
-        ss << object;
+        targetIdf.addObject(object);
       }
     }
 
-    return ss.str();
+    return targetIdf;
   }
 
-  std::string VersionTranslator::update_2_9_1_to_3_0_0(const IdfFile& idf_2_9_1, const IddFileAndFactoryWrapper& idd_3_0_0) {
-    std::stringstream ss;
+  IdfFile VersionTranslator::update_2_9_1_to_3_0_0(const IdfFile& idf_2_9_1, const IddFileAndFactoryWrapper& idd_3_0_0) {
     boost::optional<std::string> value;
 
-    ss << idf_2_9_1.header() << '\n' << '\n';
     IdfFile targetIdf(idd_3_0_0.iddFile());
-    ss << targetIdf.versionObject().get();
+    targetIdf.setHeader(idf_2_9_1.header());
 
     // Making the map case-insentive by providing a Comparator `IstringCompare`
     const std::map<std::string, std::string, openstudio::IstringCompare> replaceFuelTypesMap({
@@ -4733,10 +4652,10 @@ namespace osversion {
           }
 
           m_refactored.push_back(RefactoredObjectData(object, newObject));
-          ss << newObject;
+          targetIdf.addObject(newObject);
         } else {
           // No-op
-          ss << object;
+          targetIdf.addObject(object);
         }
 
       } else if (iddname == "OS:Material") {
@@ -4769,7 +4688,7 @@ namespace osversion {
         }
 
         m_refactored.push_back(RefactoredObjectData(object, newObject));
-        ss << newObject;
+        targetIdf.addObject(newObject);
 
       } else if (iddname == "OS:Schedule:Rule") {
         auto iddObject = idd_3_0_0.getObject(iddname);
@@ -4787,7 +4706,7 @@ namespace osversion {
         }
 
         m_refactored.push_back(RefactoredObjectData(object, newObject));
-        ss << newObject;
+        targetIdf.addObject(newObject);
 
         // Note: OS:ScheduleRuleset got a new optional field at the end, so no-op
         // } else if (iddname == "OS:Schedule:Ruleset") {
@@ -4811,7 +4730,7 @@ namespace osversion {
         }
 
         m_refactored.push_back(RefactoredObjectData(object, newObject));
-        ss << newObject;
+        targetIdf.addObject(newObject);
 
       } else if (iddname == "OS:ClimateZones") {
         auto iddObject = idd_3_0_0.getObject(iddname);
@@ -4831,7 +4750,7 @@ namespace osversion {
         }
 
         m_refactored.push_back(RefactoredObjectData(object, newObject));
-        ss << newObject;
+        targetIdf.addObject(newObject);
 
       } else if (iddname == "OS:Boiler:HotWater") {
         auto iddObject = idd_3_0_0.getObject(iddname);
@@ -4854,7 +4773,7 @@ namespace osversion {
         replaceForField(object, newObject, 2);
 
         m_refactored.push_back(RefactoredObjectData(object, newObject));
-        ss << newObject;
+        targetIdf.addObject(newObject);
 
       } else if (iddname == "OS:Chiller:Electric:EIR") {
         auto iddObject = idd_3_0_0.getObject(iddname);
@@ -4904,7 +4823,7 @@ namespace osversion {
         }
 
         m_refactored.push_back(RefactoredObjectData(object, newObject));
-        ss << newObject;
+        targetIdf.addObject(newObject);
 
       } else if (iddname == "OS:ShadowCalculation") {
         auto iddObject = idd_3_0_0.getObject(iddname);
@@ -4959,7 +4878,7 @@ namespace osversion {
         newObject.setString(10, "No");
 
         m_refactored.push_back(RefactoredObjectData(object, newObject));
-        ss << newObject;
+        targetIdf.addObject(newObject);
 
       } else if (iddname == "OS:Sizing:Zone") {
         auto iddObject = idd_3_0_0.getObject(iddname);
@@ -4986,7 +4905,7 @@ namespace osversion {
         // and  Design Minimum Zone Ventilation Efficiency, but both are optional (has default) so no-op there
 
         m_refactored.push_back(RefactoredObjectData(object, newObject));
-        ss << newObject;
+        targetIdf.addObject(newObject);
 
       } else if (iddname == "OS:ZoneHVAC:TerminalUnit:VariableRefrigerantFlow") {
         // Note #3687 was originally planned for 2.9.0 inclusion, so VT was there. But it was only merged to develop3 and hence relased in 3.0.0
@@ -5011,24 +4930,22 @@ namespace osversion {
 
         // Register refactored
         m_refactored.push_back(RefactoredObjectData(object, newObject));
-        ss << newObject;
+        targetIdf.addObject(newObject);
 
         // No-op
       } else {
-        ss << object;
+        targetIdf.addObject(object);
       }
     }
 
-    return ss.str();
+    return targetIdf;
   }
 
-  std::string VersionTranslator::update_3_0_0_to_3_0_1(const IdfFile& idf_3_0_0, const IddFileAndFactoryWrapper& idd_3_0_1) {
-    std::stringstream ss;
+  IdfFile VersionTranslator::update_3_0_0_to_3_0_1(const IdfFile& idf_3_0_0, const IddFileAndFactoryWrapper& idd_3_0_1) {
     boost::optional<std::string> value;
 
-    ss << idf_3_0_0.header() << '\n' << '\n';
     IdfFile targetIdf(idd_3_0_1.iddFile());
-    ss << targetIdf.versionObject().get();
+    targetIdf.setHeader(idf_3_0_0.header());
 
     for (const IdfObject& object : idf_3_0_0.objects()) {
       auto iddname = object.iddObject().name();
@@ -5054,7 +4971,7 @@ namespace osversion {
         newObject.setDouble(15, -25.0);
 
         m_refactored.push_back(RefactoredObjectData(object, newObject));
-        ss << newObject;
+        targetIdf.addObject(newObject);
 
       } else if (iddname == "OS:Coil:Cooling:DX:TwoStageWithHumidityControlMode") {
         // Inserted field 'Minimum Outdoor Dry-Bulb Temperature for Compressor Operation' at position 15 (0-indexed)
@@ -5077,7 +4994,7 @@ namespace osversion {
         newObject.setDouble(15, -25.0);
 
         m_refactored.push_back(RefactoredObjectData(object, newObject));
-        ss << newObject;
+        targetIdf.addObject(newObject);
 
       } else if (iddname == "OS:Coil:Cooling:DX:MultiSpeed") {
         // Inserted field 'Minimum Outdoor Dry-Bulb Temperature for Compressor Operation' at position 7 (0-indexed)
@@ -5100,7 +5017,7 @@ namespace osversion {
         newObject.setDouble(7, -25.0);
 
         m_refactored.push_back(RefactoredObjectData(object, newObject));
-        ss << newObject;
+        targetIdf.addObject(newObject);
 
       } else if (iddname == "OS:Coil:Cooling:DX:VariableSpeed") {
         // Inserted field 'Minimum Outdoor Dry-Bulb Temperature for Compressor Operation' at position 15 (0-indexed)
@@ -5123,7 +5040,7 @@ namespace osversion {
         newObject.setDouble(15, -25.0);
 
         m_refactored.push_back(RefactoredObjectData(object, newObject));
-        ss << newObject;
+        targetIdf.addObject(newObject);
 
       } else if (iddname == "OS:Coil:Cooling:DX:TwoSpeed") {
         // Inserted 'Unit Internal Static Air Pressure' at field 7
@@ -5153,25 +5070,23 @@ namespace osversion {
         newObject.setDouble(23, -25.0);
 
         m_refactored.push_back(RefactoredObjectData(object, newObject));
-        ss << newObject;
+        targetIdf.addObject(newObject);
 
         // No-op
       } else {
-        ss << object;
+        targetIdf.addObject(object);
       }
     }
 
-    return ss.str();
+    return targetIdf;
 
   }  // end update_3_0_0_to_3_0_1
 
-  std::string VersionTranslator::update_3_0_1_to_3_1_0(const IdfFile& idf_3_0_1, const IddFileAndFactoryWrapper& idd_3_1_0) {
-    std::stringstream ss;
+  IdfFile VersionTranslator::update_3_0_1_to_3_1_0(const IdfFile& idf_3_0_1, const IddFileAndFactoryWrapper& idd_3_1_0) {
     boost::optional<std::string> value;
 
-    ss << idf_3_0_1.header() << '\n' << '\n';
     IdfFile targetIdf(idd_3_1_0.iddFile());
-    ss << targetIdf.versionObject().get();
+    targetIdf.setHeader(idf_3_0_1.header());
 
     /*****************************************************************************************************************************************************
        *                                                               Output:Variable fuel                                                                *
@@ -5799,7 +5714,7 @@ namespace osversion {
         newObject.setDouble(18, 0.0);
 
         m_refactored.push_back(RefactoredObjectData(object, newObject));
-        ss << newObject;
+        targetIdf.addObject(newObject);
 
       } else if (iddname == "OS:AirLoopHVAC") {
 
@@ -5823,7 +5738,7 @@ namespace osversion {
         newObject.setDouble(6, 1.0);
 
         m_refactored.push_back(RefactoredObjectData(object, newObject));
-        ss << newObject;
+        targetIdf.addObject(newObject);
 
       } else if (iddname == "OS:Construction:InternalSource") {
 
@@ -5848,7 +5763,7 @@ namespace osversion {
         // newObject.setDouble(6, 0.0);
 
         m_refactored.push_back(RefactoredObjectData(object, newObject));
-        ss << newObject;
+        targetIdf.addObject(newObject);
 
       } else if (iddname == "OS:ZoneHVAC:LowTemperatureRadiant:Electric") {
 
@@ -5868,7 +5783,7 @@ namespace osversion {
         }
 
         m_refactored.push_back(RefactoredObjectData(object, newObject));
-        ss << newObject;
+        targetIdf.addObject(newObject);
 
       } else if (iddname == "OS:WaterHeater:HeatPump") {
 
@@ -5891,7 +5806,7 @@ namespace osversion {
         newObject.setDouble(16, 48.89);
 
         m_refactored.push_back(RefactoredObjectData(object, newObject));
-        ss << newObject;
+        targetIdf.addObject(newObject);
 
       } else if (iddname == "OS:ZoneHVAC:LowTemperatureRadiant:ConstantFlow") {
 
@@ -5944,7 +5859,7 @@ namespace osversion {
         // newObject.setDouble(10, 0.8);
 
         m_refactored.push_back(RefactoredObjectData(object, newObject));
-        ss << newObject;
+        targetIdf.addObject(newObject);
 
       } else if (iddname == "OS:ZoneHVAC:LowTemperatureRadiant:VariableFlow") {
 
@@ -5989,7 +5904,7 @@ namespace osversion {
         // newObject.setString(23, "HalfFlowPower");
 
         m_refactored.push_back(RefactoredObjectData(object, newObject));
-        ss << newObject;
+        targetIdf.addObject(newObject);
 
       } else if (iddname == "OS:Output:Meter") {
 
@@ -6001,7 +5916,7 @@ namespace osversion {
         }
         if (name == object.nameString()) {
           // No-op
-          ss << object;
+          targetIdf.addObject(object);
         } else {
 
           // Copy everything but 'Variable Name' field
@@ -6021,7 +5936,7 @@ namespace osversion {
           newObject.setName(name);
 
           m_refactored.push_back(RefactoredObjectData(object, newObject));
-          ss << newObject;
+          targetIdf.addObject(newObject);
         }
 
       } else if ((iddname == "OS:Output:Variable") || (iddname == "OS:EnergyManagementSystem:Sensor")
@@ -6042,7 +5957,7 @@ namespace osversion {
           auto it = replaceOutputVariablesMap.find(variableName);
           if (it == replaceOutputVariablesMap.end()) {
             // No-op
-            ss << object;
+            targetIdf.addObject(object);
           } else {
 
             // Copy everything but 'Variable Name' field
@@ -6061,11 +5976,11 @@ namespace osversion {
             newObject.setString(variableNameIndex, it->second);
 
             m_refactored.push_back(RefactoredObjectData(object, newObject));
-            ss << newObject;
+            targetIdf.addObject(newObject);
           }
         } else {
           // No-op
-          ss << object;
+          targetIdf.addObject(object);
         }
 
       } else if ((iddname == "OS:Meter:Custom") || (iddname == "OS:Meter:CustomDecrement")) {
@@ -6089,7 +6004,7 @@ namespace osversion {
         }
         if (!isReplaceNeeded) {
           // No-op
-          ss << object;
+          targetIdf.addObject(object);
         } else {
 
           // Copy everything but 'Variable Name' field
@@ -6125,7 +6040,7 @@ namespace osversion {
           }
 
           m_refactored.push_back(RefactoredObjectData(object, newObject));
-          ss << newObject;
+          targetIdf.addObject(newObject);
         }
 
         // Note: Would have needed to do UtilityCost:Tariff for Fuel Type renames too, but not wrapped
@@ -6155,7 +6070,7 @@ namespace osversion {
         }
 
         m_refactored.push_back(RefactoredObjectData(object, newObject));
-        ss << newObject;
+        targetIdf.addObject(newObject);
 
       } else if (iddname == "OS:SubSurface") {
 
@@ -6175,25 +6090,23 @@ namespace osversion {
         }
 
         m_refactored.push_back(RefactoredObjectData(object, newObject));
-        ss << newObject;
+        targetIdf.addObject(newObject);
 
         // No-op
       } else {
-        ss << object;
+        targetIdf.addObject(object);
       }
     }
 
-    return ss.str();
+    return targetIdf;
 
   }  // end update_3_0_1_to_3_1_0
 
-  std::string VersionTranslator::update_3_1_0_to_3_2_0(const IdfFile& idf_3_1_0, const IddFileAndFactoryWrapper& idd_3_2_0) {
-    std::stringstream ss;
+  IdfFile VersionTranslator::update_3_1_0_to_3_2_0(const IdfFile& idf_3_1_0, const IddFileAndFactoryWrapper& idd_3_2_0) {
     boost::optional<std::string> value;
 
-    ss << idf_3_1_0.header() << '\n' << '\n';
     IdfFile targetIdf(idd_3_2_0.iddFile());
-    ss << targetIdf.versionObject().get();
+    targetIdf.setHeader(idf_3_1_0.header());
 
     auto makeCurveQuadLinear = [&idd_3_2_0]() -> IdfObject {
       auto quadLinearIddObject = idd_3_2_0.getObject("OS:Curve:QuadLinear").get();
@@ -6270,7 +6183,7 @@ namespace osversion {
         newObject.setDouble(5, 1.0);
 
         m_refactored.push_back(RefactoredObjectData(object, newObject));
-        ss << newObject;
+        targetIdf.addObject(newObject);
 
       } else if ((iddname == "OS:Connection") || (iddname == "OS:PortList")) {
         // Deleted the 'Name' field
@@ -6288,7 +6201,7 @@ namespace osversion {
           }
         }
         m_refactored.push_back(RefactoredObjectData(object, newObject));
-        ss << newObject;
+        targetIdf.addObject(newObject);
 
       } else if (iddname == "OS:Construction:AirBoundary") {
 
@@ -6312,7 +6225,7 @@ namespace osversion {
         }
 
         m_refactored.push_back(RefactoredObjectData(object, newObject));
-        ss << newObject;
+        targetIdf.addObject(newObject);
 
       } else if (iddname == "OS:ZoneAirMassFlowConservation") {
 
@@ -6337,7 +6250,7 @@ namespace osversion {
         }
 
         m_refactored.push_back(RefactoredObjectData(object, newObject));
-        ss << newObject;
+        targetIdf.addObject(newObject);
 
       } else if (iddname == "OS:ZoneHVAC:TerminalUnit:VariableRefrigerantFlow") {
 
@@ -6355,7 +6268,7 @@ namespace osversion {
         newObject.setString(13, "DrawThrough");
 
         m_refactored.push_back(RefactoredObjectData(object, newObject));
-        ss << newObject;
+        targetIdf.addObject(newObject);
 
       } else if (iddname == "OS:Coil:Cooling:WaterToAirHeatPump:EquationFit") {
         auto iddObject = idd_3_2_0.getObject(iddname);
@@ -6424,15 +6337,15 @@ namespace osversion {
         newObject.setString(13, coolingPowerConsumptionCurve.nameString());
 
         m_refactored.push_back(RefactoredObjectData(object, newObject));
-        ss << newObject;
+        targetIdf.addObject(newObject);
 
         // Register new Curve objects
         m_new.push_back(totalCoolingCapacityCurve);
         m_new.push_back(sensibleCoolingCapacityCurve);
         m_new.push_back(coolingPowerConsumptionCurve);
-        ss << totalCoolingCapacityCurve;
-        ss << sensibleCoolingCapacityCurve;
-        ss << coolingPowerConsumptionCurve;
+        targetIdf.addObject(totalCoolingCapacityCurve);
+        targetIdf.addObject(sensibleCoolingCapacityCurve);
+        targetIdf.addObject(coolingPowerConsumptionCurve);
 
       } else if (iddname == "OS:Coil:Heating:WaterToAirHeatPump:EquationFit") {
         auto iddObject = idd_3_2_0.getObject(iddname);
@@ -6480,13 +6393,13 @@ namespace osversion {
         newObject.setString(11, heatingPowerConsumptionCurve.nameString());
 
         m_refactored.push_back(RefactoredObjectData(object, newObject));
-        ss << newObject;
+        targetIdf.addObject(newObject);
 
         // Register new Curve objects
         m_new.push_back(heatingCapacityCurve);
         m_new.push_back(heatingPowerConsumptionCurve);
-        ss << heatingCapacityCurve;
-        ss << heatingPowerConsumptionCurve;
+        targetIdf.addObject(heatingCapacityCurve);
+        targetIdf.addObject(heatingPowerConsumptionCurve);
 
       } else if (iddname == "OS:HeatPump:WaterToWater:EquationFit:Cooling") {
         auto iddObject = idd_3_2_0.getObject(iddname);
@@ -6542,13 +6455,13 @@ namespace osversion {
         newObject.setString(11, coolingCompressorPowerCurve.nameString());
 
         m_refactored.push_back(RefactoredObjectData(object, newObject));
-        ss << newObject;
+        targetIdf.addObject(newObject);
 
         // Register new Curve objects
         m_new.push_back(coolingCapacityCurve);
         m_new.push_back(coolingCompressorPowerCurve);
-        ss << coolingCapacityCurve;
-        ss << coolingCompressorPowerCurve;
+        targetIdf.addObject(coolingCapacityCurve);
+        targetIdf.addObject(coolingCompressorPowerCurve);
 
       } else if (iddname == "OS:HeatPump:WaterToWater:EquationFit:Heating") {
         auto iddObject = idd_3_2_0.getObject(iddname);
@@ -6604,21 +6517,21 @@ namespace osversion {
         newObject.setString(11, heatingCompressorPowerCurve.nameString());
 
         m_refactored.push_back(RefactoredObjectData(object, newObject));
-        ss << newObject;
+        targetIdf.addObject(newObject);
 
         // Register new Curve objects
         m_new.push_back(heatingCapacityCurve);
         m_new.push_back(heatingCompressorPowerCurve);
-        ss << heatingCapacityCurve;
-        ss << heatingCompressorPowerCurve;
+        targetIdf.addObject(heatingCapacityCurve);
+        targetIdf.addObject(heatingCompressorPowerCurve);
 
         // No-op
       } else {
-        ss << object;
+        targetIdf.addObject(object);
       }
     }
 
-    return ss.str();
+    return targetIdf;
 
   }  // end update_3_1_0_to_3_2_0
 
@@ -0,0 +1,50 @@
+#include <benchmark/benchmark.h>
+
+#include "../VersionTranslator.hpp"
+
+#include "../../model/Model.hpp"
+
+#include "../../utilities/core/Path.hpp"
+#include "../../utilities/idd/IddFile.hpp"
+#include "../../utilities/idf/IdfFile.hpp"
+#include "../../utilities/idf/IdfObject.hpp"
+#include <utilities/idd/IddFactory.hxx>
+
+#include <resources.hxx>
+
+#include <sstream>
+
+using namespace openstudio;
+
+// The 1.13.4 example model, the oldest one in resources/osversion, with n extra spaces. It goes through every update
+// method from 1.13.4 on
+static std::string makeOldModel(int n) {
+  IddFile iddFile = IddFactory::instance().getIddFile(IddFileType::OpenStudio, VersionString("1.13.4")).get();
+  IdfFile idfFile = IdfFile::load(resourcesPath() / toPath("osversion/1_13_4/example.osm"), iddFile).get();
+
+  IddObject spaceIdd = iddFile.getObject("OS:Space").get();
+  for (int i = 0; i < n; ++i) {
+    IdfObject space(spaceIdd);
+    space.setName("Space " + std::to_string(i));
+    idfFile.addObject(space);
+  }
+
+  std::stringstream ss;
+  idfFile.print(ss);
+  return ss.str();
+}
+
+static void BM_VersionTranslatorLoadModel(benchmark::State& state) {
+  std::string text = makeOldModel(state.range(0));
+
+  // Code inside this loop is measured repeatedly
+  for (auto _ : state) {
+    osversion::VersionTranslator translator;
+    boost::optional<model::Model> model = translator.loadModelFromString(text);
+    benchmark::DoNotOptimize(model);
+  }
+
+  state.SetComplexityN(state.range(0));
+}
+
+BENCHMARK(BM_VersionTranslatorLoadModel)->Unit(benchmark::kMillisecond)->RangeMultiplier(8)->Range(8, 4096)->Complexity();
@@ -31,10 +31,47 @@
 #include <boost/lexical_cast.hpp>
 #include <pugixml.hpp>
 
+#include <cctype>
+
 namespace openstudio {
 
 namespace sdd {
 
+  namespace {
+
+    // Next node of a depth-first, document order walk of the descendants of root, or an empty node when done
+    pugi::xml_node nextDescendant(const pugi::xml_node& node, const pugi::xml_node& root) {
+      if (pugi::xml_node child = node.first_child()) {
+        return child;
+      }
+      for (pugi::xml_node current = node; current && current != root; current = current.parent()) {
+        if (pugi::xml_node sibling = current.next_sibling()) {
+          return sibling;
+        }
+      }
+      return pugi::xml_node();
+    }
+
+    // Same case folding as istringEqual
+    std::string foldCase(const char* text) {
+      std::string result(text);
+      for (char& c : result) {
+        c = static_cast<char>(std::toupper(c));
+      }
+      return result;
+    }
+
+    std::string textIndexKey(const std::string& tagName, const std::string& childName) {
+      return tagName + '\n' + childName;
+    }
+
+    const std::vector<pugi::xml_node>& emptyNodes() {
+      static const std::vector<pugi::xml_node> result;
+      return result;
+    }
+
+  }  // namespace
+
   // Helper to make a vector of pugi::xml_node of all children
   std::vector<pugi::xml_node> makeVectorOfChildren(const pugi::xml_node& root) {
     std::vector<pugi::xml_node> result;
@@ -56,9 +93,11 @@ namespace sdd {
   // Helper to make a vector of pugi::xml_node matching a tag: any level
   std::vector<pugi::xml_node> makeVectorOfChildrenRecursive(const pugi::xml_node& root, const std::string& tagName) {
     std::vector<pugi::xml_node> result;
-    // We use xpath '//tagName'
-    for (const pugi::xpath_node& n : root.select_nodes((std::string("//") + tagName).c_str())) {
-      result.push_back(n.node());
+    // Walk the subtree directly, an xpath '//tagName' would be compiled on every call and search the whole document
+    for (pugi::xml_node node = nextDescendant(root, root); node; node = nextDescendant(node, root)) {
+      if ((node.type() == pugi::node_element) && (tagName == node.name())) {
+        result.push_back(node);
+      }
     }
     return result;
   }
@@ -144,5 +183,63 @@ namespace sdd {
     return result;
   }
 
+  ElementIndex::ElementIndex(const pugi::xml_node& element) : m_document(element.root()) {
+    for (pugi::xml_node node = nextDescendant(m_document, m_document); node; node = nextDescendant(node, m_document)) {
+      if (node.type() != pugi::node_element) {
+        continue;
+      }
+      std::string tagName = node.name();
+      if (pugi::xml_node nameElement = node.child("Name")) {
+        m_textIndices[textIndexKey(tagName, "Name")][foldCase(nameElement.text().as_string())].push_back(node);
+      }
+      m_elementsByTag[tagName].push_back(node);
+    }
+  }
+
+  pugi::xml_node ElementIndex::document() const {
+    return m_document;
+  }
+
+  bool ElementIndex::contains(const pugi::xml_node& element) const {
+    return m_document && (element.root() == m_document);
+  }
+
+  const std::vector<pugi::xml_node>& ElementIndex::elements(const std::string& tagName) const {
+    auto it = m_elementsByTag.find(tagName);
+    if (it == m_elementsByTag.end()) {
+      return emptyNodes();
+    }
+    return it->second;
+  }
+
+  const std::vector<pugi::xml_node>& ElementIndex::elementsNamed(const std::string& tagName, const std::string& name) const {
+    return elementsWithChildText(tagName, "Name", name);
+  }
+
+  const std::vector<pugi::xml_node>& ElementIndex::elementsWithChildText(const std::string& tagName, const std::string& childName,
+                                                                         const std::string& text) const {
+    const TextIndex& index = textIndex(tagName, childName);
+    auto it = index.find(foldCase(text.c_str()));
+    if (it == index.end()) {
+      return emptyNodes();
+    }
+    return it->second;
+  }
+
+  const ElementIndex::TextIndex& ElementIndex::textIndex(const std::string& tagName, const std::string& childName) const {
+    std::string key = textIndexKey(tagName, childName);
+    auto it = m_textIndices.find(key);
+    if (it != m_textIndices.end()) {
+      return it->second;
+    }
+    TextIndex& index = m_textIndices[key];
+    for (const pugi::xml_node& element : elements(tagName)) {
+      if (pugi::xml_node childElement = element.child(childName.c_str())) {
+        index[foldCase(childElement.text().as_string())].push_back(element);
+      }
+    }
+    return index;
+  }
+
 }  // namespace sdd
 }  // namespace openstudio
@@ -30,14 +30,17 @@
 #ifndef SDD_HELPERS_HPP
 #define SDD_HELPERS_HPP
 
+#include "SDDAPI.hpp"
+
 #include "../utilities/core/Optional.hpp"
 #include "../utilities/core/Logger.hpp"
 #include "../utilities/core/Assert.hpp"
 
-namespace pugi {
-class xml_node;
-class xml_attribute;
-}  // namespace pugi
+#include <pugixml.hpp>
+
+#include <string>
+#include <unordered_map>
+#include <vector>
 
 namespace openstudio {
 namespace sdd {
@@ -49,7 +52,7 @@ namespace sdd {
   std::vector<pugi::xml_node> makeVectorOfChildren(const pugi::xml_node& root, const char* tagName);
 
   // Helper to make a vector of pugi::xml_node of children matching a specific tag (any level descendants)
-  std::vector<pugi::xml_node> makeVectorOfChildrenRecursive(const pugi::xml_node& root, const std::string& tagName);
+  SDD_API std::vector<pugi::xml_node> makeVectorOfChildrenRecursive(const pugi::xml_node& root, const std::string& tagName);
 
   // Lexical cast the text() of a node as a double
   // Checks if the element actually exists, then if it can be converted to a double.
@@ -76,6 +79,43 @@ namespace sdd {
   // Returns the 'Proj' element from any element in the tree
   pugi::xml_node getProjectElement(const pugi::xml_node& element);
 
+  // Index of all the elements of a document by tag, and by tag and (case insensitive) text of a child element, built in one pass.
+  // Resolving a reference becomes a hash lookup instead of a scan of the document.
+  // The index holds pugi::xml_node handles into the document, so it must not outlive it
+  class SDD_API ElementIndex
+  {
+   public:
+    // Indexes the whole document that element belongs to, by tag and by tag and 'Name'
+    explicit ElementIndex(const pugi::xml_node& element);
+
+    // The document node that was indexed
+    pugi::xml_node document() const;
+
+    // Whether element belongs to the indexed document
+    bool contains(const pugi::xml_node& element) const;
+
+    // All elements with tag tagName, in document order
+    const std::vector<pugi::xml_node>& elements(const std::string& tagName) const;
+
+    // All elements with tag tagName that have a 'Name' child matching name (case insensitive), in document order
+    const std::vector<pugi::xml_node>& elementsNamed(const std::string& tagName, const std::string& name) const;
+
+    // All elements with tag tagName that have a childName child whose text matches text (case insensitive), in document order.
+    // The (tagName, childName) index is built the first time it is requested
+    const std::vector<pugi::xml_node>& elementsWithChildText(const std::string& tagName, const std::string& childName,
+                                                             const std::string& text) const;
+
+   private:
+    using TextIndex = std::unordered_map<std::string, std::vector<pugi::xml_node>>;
+
+    const TextIndex& textIndex(const std::string& tagName, const std::string& childName) const;
+
+    pugi::xml_node m_document;
+    std::unordered_map<std::string, std::vector<pugi::xml_node>> m_elementsByTag;
+    // keyed by tagName + '\n' + childName
+    mutable std::unordered_map<std::string, TextIndex> m_textIndices;
+  };
+
 }  // namespace sdd
 }  // namespace openstudio
 
@@ -8246,11 +8246,6 @@ namespace sdd {
 
   pugi::xml_node ReverseTranslator::findZnSysElement(const pugi::xml_node& znSysRefElement) {
     pugi::xml_node projectElement = getProjectElement(znSysRefElement);
-    // TODO: perhaps we should rely on the makeVectorOfChildrenRecursive instead (uses Xpath instead of having to harcoded the path)
-    // Not sure about speed penalties
-    // makeVectorOfChildrenRecursive("ZnSys") would work, regardless of which level 'ZnSys' is at
-    // Proj > Bldg > [ZnSys]
-    std::vector<pugi::xml_node> znSysElements = makeVectorOfChildren(projectElement.child("Bldg"), "ZnSys");
     std::string znSysName = znSysRefElement.text().as_string();
 
     if (znSysName.empty()) {
@@ -8258,11 +8253,11 @@ namespace sdd {
       OS_ASSERT(false);
     }
 
-    for (std::vector<pugi::xml_node>::size_type i = 0; i < znSysElements.size(); i++) {
-      pugi::xml_node znSysElement = znSysElements[i];
-      std::string znSysElementName = znSysElement.child("Name").text().as_string();
-
-      if (openstudio::istringEqual(znSysElementName, znSysName)) {
+    // Proj > Bldg > [ZnSys]
+    pugi::xml_node buildingElement = projectElement.child("Bldg");
+    std::shared_ptr<const ElementIndex> index = elementIndex(projectElement);
+    for (const pugi::xml_node& znSysElement : index->elementsNamed("ZnSys", znSysName)) {
+      if (znSysElement.parent() == buildingElement) {
         return znSysElement;
       }
     }
@@ -8273,24 +8268,19 @@ namespace sdd {
 
   pugi::xml_node ReverseTranslator::findTrmlUnitElementForZone(const pugi::xml_node& znNameElement) {
     pugi::xml_node projectElement = getProjectElement(znNameElement);
-    // Proj > Bldg > [AirSys]
-    std::vector<pugi::xml_node> airSystemElements = makeVectorOfChildren(projectElement.child("Bldg"), "AirSys");
     std::string zoneName = znNameElement.text().as_string();
     if (zoneName.empty()) {
       LOG(Error, "findTrmlUnitElementForZone called with an empty zoneName");
       OS_ASSERT(false);
     }
 
-    for (std::vector<pugi::xml_node>::size_type i = 0; i < airSystemElements.size(); i++) {
-      pugi::xml_node airSystemElement = airSystemElements[i];
-      std::vector<pugi::xml_node> terminalElements = makeVectorOfChildren(airSystemElement, "TrmlUnit");
-      for (std::vector<pugi::xml_node>::size_type j = 0; j < terminalElements.size(); j++) {
-        pugi::xml_node terminalElement = terminalElements[j];
-        std::string zoneServedElementName = terminalElement.child("ZnServedRef").text().as_string();
-
-        if (openstudio::istringEqual(zoneName, zoneServedElementName)) {
-          return terminalElement;
-        }
+    // Proj > Bldg > [AirSys] > [TrmlUnit]
+    pugi::xml_node buildingElement = projectElement.child("Bldg");
+    std::shared_ptr<const ElementIndex> index = elementIndex(projectElement);
+    for (const pugi::xml_node& terminalElement : index->elementsWithChildText("TrmlUnit", "ZnServedRef", zoneName)) {
+      pugi::xml_node airSystemElement = terminalElement.parent();
+      if ((airSystemElement.parent() == buildingElement) && (strcmp(airSystemElement.name(), "AirSys") == 0)) {
+        return terminalElement;
       }
     }
 
@@ -8317,13 +8307,10 @@ namespace sdd {
     }
 
     // Proj > Bldg > [AirSys]
-    std::vector<pugi::xml_node> airSystemElements = makeVectorOfChildren(projectElement.child("Bldg"), "AirSys");
-
-    for (std::vector<pugi::xml_node>::size_type i = 0; i < airSystemElements.size(); i++) {
-      pugi::xml_node airSystemElement = airSystemElements[i];
-      std::string airSystemElementName = airSystemElement.child("Name").text().as_string();
-
-      if (openstudio::istringEqual(airSysName, airSystemElementName)) {
+    pugi::xml_node buildingElement = projectElement.child("Bldg");
+    std::shared_ptr<const ElementIndex> index = elementIndex(projectElement);
+    for (const pugi::xml_node& airSystemElement : index->elementsNamed("AirSys", airSysName)) {
+      if (airSystemElement.parent() == buildingElement) {
         return airSystemElement;
       }
     }
@@ -220,7 +220,24 @@ namespace sdd {
   }
 
   boost::optional<model::Model> ReverseTranslator::convert(const pugi::xml_node& root) {
-    return translateSDD(root);
+    // Index the document once, the index refers to its nodes so it is dropped as soon as the translation is over
+    m_elementIndex = std::make_shared<const ElementIndex>(root);
+    boost::optional<model::Model> result;
+    try {
+      result = translateSDD(root);
+    } catch (...) {
+      m_elementIndex.reset();
+      throw;
+    }
+    m_elementIndex.reset();
+    return result;
+  }
+
+  std::shared_ptr<const ElementIndex> ReverseTranslator::elementIndex(const pugi::xml_node& element) const {
+    if (m_elementIndex && m_elementIndex->contains(element)) {
+      return m_elementIndex;
+    }
+    return std::make_shared<const ElementIndex>(element);
   }
 
   boost::optional<model::Model> ReverseTranslator::translateSDD(const pugi::xml_node& root) {
@@ -1909,15 +1926,17 @@ namespace sdd {
       OS_ASSERT(false);
     }
 
-    for (auto& fluidSysElement : projectElement.children("FluidSys")) {
-      for (auto& fluidSegmentElement : fluidSysElement.children("FluidSeg")) {
-        auto nameElement = fluidSegmentElement.child("Name");
-        auto typeElement = fluidSegmentElement.child("Type");
+    // Proj > [FluidSys] > [FluidSeg]
+    std::shared_ptr<const ElementIndex> index = elementIndex(projectElement);
+    for (const pugi::xml_node& fluidSegmentElement : index->elementsNamed("FluidSeg", fluidSegmentName)) {
+      auto fluidSysElement = fluidSegmentElement.parent();
+      if (fluidSysElement.parent() != projectElement || (strcmp(fluidSysElement.name(), "FluidSys") != 0)) {
+        continue;
+      }
+      auto typeElement = fluidSegmentElement.child("Type");
 
-        if ((istringEqual(typeElement.text().as_string(), "SECONDARYSUPPLY") || istringEqual(typeElement.text().as_string(), "PRIMARYSUPPLY"))
-            && istringEqual(nameElement.text().as_string(), fluidSegmentName)) {
-          return fluidSegmentElement;
-        }
+      if (istringEqual(typeElement.text().as_string(), "SECONDARYSUPPLY") || istringEqual(typeElement.text().as_string(), "PRIMARYSUPPLY")) {
+        return fluidSegmentElement;
       }
     }
 
@@ -1945,28 +1964,28 @@ namespace sdd {
 
     boost::optional<model::PlantLoop> result;
 
-    for (auto& fluidSysElement : projectElement.children("FluidSys")) {
+    // Proj > [FluidSys] > [FluidSeg]
+    std::shared_ptr<const ElementIndex> index = elementIndex(projectElement);
+    for (const pugi::xml_node& fluidSegmentElement : index->elementsNamed("FluidSeg", fluidSegmentName)) {
+      auto fluidSysElement = fluidSegmentElement.parent();
+      if (fluidSysElement.parent() != projectElement || (strcmp(fluidSysElement.name(), "FluidSys") != 0)) {
+        continue;
+      }
 
       auto fluidSysNameElement = fluidSysElement.child("Name");
 
       auto fluidSysTypeElement = fluidSysElement.child("Type");
 
-      if (openstudio::istringEqual(fluidSysTypeElement.text().as_string(), "SERVICEHOTWATER")) {
-        for (auto& fluidSegmentElement : fluidSysElement.children("FluidSeg")) {
+      auto typeElement = fluidSegmentElement.child("Type");
 
-          auto nameElement = fluidSegmentElement.child("Name");
-          auto typeElement = fluidSegmentElement.child("Type");
-
-          if ((openstudio::istringEqual(typeElement.text().as_string(), "SECONDARYSUPPLY")
-               || openstudio::istringEqual(typeElement.text().as_string(), "PRIMARYSUPPLY"))
-              && openstudio::istringEqual(nameElement.text().as_string(), fluidSegmentName)) {
-            if (boost::optional<model::PlantLoop> loop = model.getModelObjectByName<model::PlantLoop>(fluidSysNameElement.text().as_string())) {
-              return loop;
-            } else {
-              if (boost::optional<model::ModelObject> mo = translateFluidSys(fluidSysElement, model)) {
-                return mo->optionalCast<model::PlantLoop>();
-              }
-            }
+      if (openstudio::istringEqual(fluidSysTypeElement.text().as_string(), "SERVICEHOTWATER")
+          && (openstudio::istringEqual(typeElement.text().as_string(), "SECONDARYSUPPLY")
+              || openstudio::istringEqual(typeElement.text().as_string(), "PRIMARYSUPPLY"))) {
+        if (boost::optional<model::PlantLoop> loop = model.getModelObjectByName<model::PlantLoop>(fluidSysNameElement.text().as_string())) {
+          return loop;
+        } else {
+          if (boost::optional<model::ModelObject> mo = translateFluidSys(fluidSysElement, model)) {
+            return mo->optionalCast<model::PlantLoop>();
           }
         }
       }
@@ -43,6 +43,8 @@
 #include "../model/ConstructionBase.hpp"
 #include "../model/AirConditionerVariableRefrigerantFlow.hpp"
 
+#include <memory>
+
 namespace pugi {
 class xml_node;
 class xml_document;
@@ -66,6 +68,8 @@ namespace model {
 
 namespace sdd {
 
+  class ElementIndex;
+
   class SDD_API ReverseTranslator
   {
    public:
@@ -171,6 +175,12 @@ namespace sdd {
     // Return the "TrmlUnit" element serving a zone named znNameElement.text().as_string()
     pugi::xml_node findTrmlUnitElementForZone(const pugi::xml_node& znNameElement);
 
+    // Index of the document being translated, so the find* methods above are hash lookups.
+    // When called outside of a translation (no index, or one for another document), a temporary index is built for element's document
+    std::shared_ptr<const ElementIndex> elementIndex(const pugi::xml_node& element) const;
+    // Only set while convert() translates a document
+    std::shared_ptr<const ElementIndex> m_elementIndex;
+
     model::Schedule defaultDeckTempSchedule(openstudio::model::Model& model);
     boost::optional<model::Schedule> m_defaultDeckTempSchedule;
 
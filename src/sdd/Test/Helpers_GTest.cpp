@@ -0,0 +1,136 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2021, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#include <gtest/gtest.h>
+#include "SDDFixture.hpp"
+
+#include "../Helpers.hpp"
+
+#include <pugixml.hpp>
+
+#include <string>
+#include <vector>
+
+using namespace openstudio::sdd;
+
+namespace {
+
+std::vector<std::string> namesOf(const std::vector<pugi::xml_node>& nodes) {
+  std::vector<std::string> result;
+  for (const pugi::xml_node& node : nodes) {
+    result.push_back(node.child("Name").text().as_string());
+  }
+  return result;
+}
+
+// A small project with a nested Spc and a Spc sibling that live outside the first Story
+const char* helpersXml = R"xml(<SDDXML>
+  <Proj>
+    <Name>Project</Name>
+    <Bldg>
+      <Name>Building</Name>
+      <Story>
+        <Name>Story 1</Name>
+        <Spc>
+          <Name>Office</Name>
+          <ThrmlZnRef>Zone A</ThrmlZnRef>
+        </Spc>
+        <Spc>
+          <Name>Corridor</Name>
+          <ThrmlZnRef>zone a</ThrmlZnRef>
+        </Spc>
+      </Story>
+      <Story>
+        <Name>Story 2</Name>
+        <Spc>
+          <Name>Lobby</Name>
+          <ThrmlZnRef>ZONE A</ThrmlZnRef>
+        </Spc>
+      </Story>
+    </Bldg>
+    <ThrmlZn>
+      <Name>Zone A</Name>
+    </ThrmlZn>
+  </Proj>
+</SDDXML>)xml";
+
+}  // namespace
+
+TEST_F(SDDFixture, Helpers_ElementIndex) {
+  pugi::xml_document doc;
+  ASSERT_TRUE(doc.load_string(helpersXml));
+  pugi::xml_node projectElement = doc.child("SDDXML").child("Proj");
+
+  ElementIndex index(projectElement.child("Bldg"));
+  EXPECT_TRUE(doc.root() == index.document());
+  EXPECT_TRUE(index.contains(projectElement));
+  pugi::xml_document otherDoc;
+  EXPECT_FALSE(index.contains(otherDoc.append_child("Proj")));
+
+  EXPECT_EQ(std::vector<std::string>({"Office", "Corridor", "Lobby"}), namesOf(index.elements("Spc")));
+
+  // Names match case insensitively
+  const std::vector<pugi::xml_node>& zones = index.elementsNamed("ThrmlZn", "zone a");
+  ASSERT_EQ(1u, zones.size());
+  EXPECT_TRUE(projectElement.child("ThrmlZn") == zones[0]);
+  EXPECT_TRUE(zones == index.elementsNamed("ThrmlZn", "ZONE A"));
+  EXPECT_EQ(1u, index.elementsNamed("Spc", "OFFICE").size());
+
+  // Every Spc referencing the zone, whatever the case of the reference, comes back in document order
+  EXPECT_EQ(std::vector<std::string>({"Office", "Corridor", "Lobby"}), namesOf(index.elementsWithChildText("Spc", "ThrmlZnRef", "Zone A")));
+  // The (tag, child) index is built once and then reused
+  EXPECT_EQ(&index.elementsWithChildText("Spc", "ThrmlZnRef", "Zone A"), &index.elementsWithChildText("Spc", "ThrmlZnRef", "zone a"));
+
+  // A miss returns an empty vector
+  EXPECT_TRUE(index.elements("Wall").empty());
+  EXPECT_TRUE(index.elementsNamed("ThrmlZn", "Zone B").empty());
+  EXPECT_TRUE(index.elementsNamed("Wall", "Zone A").empty());
+  EXPECT_TRUE(index.elementsWithChildText("Spc", "ThrmlZnRef", "Zone B").empty());
+  EXPECT_TRUE(index.elementsWithChildText("Spc", "Area", "Zone A").empty());
+}
+
+TEST_F(SDDFixture, Helpers_makeVectorOfChildrenRecursive) {
+  pugi::xml_document doc;
+  ASSERT_TRUE(doc.load_string(helpersXml));
+  pugi::xml_node buildingElement = doc.child("SDDXML").child("Proj").child("Bldg");
+
+  // Only the subtree of root is searched, not the whole document
+  pugi::xml_node firstStory = buildingElement.child("Story");
+  EXPECT_EQ(std::vector<std::string>({"Office", "Corridor"}), namesOf(makeVectorOfChildrenRecursive(firstStory, "Spc")));
+  EXPECT_EQ(std::vector<std::string>({"Lobby"}), namesOf(makeVectorOfChildrenRecursive(firstStory.next_sibling("Story"), "Spc")));
+  EXPECT_EQ(std::vector<std::string>({"Office", "Corridor", "Lobby"}), namesOf(makeVectorOfChildrenRecursive(buildingElement, "Spc")));
+
+  // The root itself is not part of the result
+  EXPECT_TRUE(makeVectorOfChildrenRecursive(firstStory, "Story").empty());
+  EXPECT_EQ(2u, makeVectorOfChildrenRecursive(buildingElement, "Story").size());
+
+  // Matching is on the exact tag, and a sibling subtree is not searched
+  EXPECT_TRUE(makeVectorOfChildrenRecursive(firstStory, "spc").empty());
+  EXPECT_TRUE(makeVectorOfChildrenRecursive(buildingElement, "ThrmlZn").empty());
+}
@@ -35,6 +35,8 @@
 #include "../core/StringHelpers.hpp"
 #include "../core/FileReference.hpp"
 #include "../core/Assert.hpp"
+#include "../core/Checksum.hpp"
+#include "../core/System.hpp"
 
 #include <OpenStudio.hxx>
 
@@ -46,8 +48,176 @@
 
 #include <src/utilities/embedded_files.hxx>
 
+#include <atomic>
+#include <cstdint>
+#include <ctime>
+#include <map>
+#include <sstream>
+#include <thread>
+
 namespace openstudio {
 
+namespace {
+
+  // Name of the file, next to measure.xml, that caches the checksums of the measure's files
+  const char* fileChecksumCacheName = ".checksums";
+
+  // Checksums of a measure's files along with the size and write time they were computed for, so that files
+  // which did not change since are not read again. Written as "checksum size writeTime relativePath" lines.
+  class FileChecksumCache
+  {
+   public:
+    explicit FileChecksumCache(const openstudio::path& directory) : m_directory(directory) {
+      openstudio::filesystem::ifstream file(m_directory / toPath(fileChecksumCacheName));
+      std::string line;
+      while (std::getline(file, line)) {
+        std::istringstream ss(line);
+        Entry entry;
+        std::string relativePath;
+        if ((ss >> entry.checksum >> entry.size >> entry.writeTime) && (ss.get() == ' ') && std::getline(ss, relativePath)) {
+          m_loaded[relativePath] = entry;
+        }
+      }
+    }
+
+    // Returns the cached checksum of file if its size and write time did not change, remembers them otherwise for insert
+    boost::optional<std::string> find(const openstudio::path& file) {
+      boost::system::error_code ec;
+      Entry entry;
+      entry.size = openstudio::filesystem::file_size(file, ec);
+      if (!ec) {
+        entry.writeTime = openstudio::filesystem::last_write_time(file, ec);
+      }
+      if (ec) {
+        return boost::none;
+      }
+
+      std::string key = relativePath(file);
+      auto it = m_loaded.find(key);
+      if ((it != m_loaded.end()) && (it->second.size == entry.size) && (it->second.writeTime == entry.writeTime)) {
+        m_current[key] = it->second;
+        return it->second.checksum;
+      }
+      m_stats[key] = entry;
+      return boost::none;
+    }
+
+    // Caches the checksum computed for file after a find that missed
+    void insert(const openstudio::path& file, const std::string& checksum) {
+      std::string key = relativePath(file);
+      auto it = m_stats.find(key);
+      // a file written during the last second could change again without its write time changing
+      if ((it == m_stats.end()) || (it->second.writeTime >= std::time(nullptr) - 1)) {
+        return;
+      }
+      it->second.checksum = checksum;
+      m_current[key] = it->second;
+    }
+
+    // Writes the entries of the files found or inserted, if they differ from the ones loaded
+    void save() const {
+      if (m_current == m_loaded) {
+        return;
+      }
+      openstudio::filesystem::ofstream file(m_directory / toPath(fileChecksumCacheName), std::ios_base::trunc);
+      for (const auto& p : m_current) {
+        file << p.second.checksum << ' ' << p.second.size << ' ' << p.second.writeTime << ' ' << p.first << '\n';
+      }
+    }
+
+   private:
+    struct Entry
+    {
+      std::string checksum;
+      std::uintmax_t size = 0;
+      std::time_t writeTime = 0;
+
+      bool operator==(const Entry& other) const {
+        return (checksum == other.checksum) && (size == other.size) && (writeTime == other.writeTime);
+      }
+    };
+
+    std::string relativePath(const openstudio::path& file) const {
+      return file.lexically_relative(m_directory).generic_string();
+    }
+
+    openstudio::path m_directory;
+    std::map<std::string, Entry> m_loaded;
+    std::map<std::string, Entry> m_current;
+    std::map<std::string, Entry> m_stats;
+  };
+
+  // Computes the checksums of files on up to numThreads threads, in the same order
+  std::vector<std::string> computeChecksums(const std::vector<openstudio::path>& files, unsigned numThreads) {
+    std::vector<std::string> result(files.size());
+
+    if (numThreads == 0) {
+      numThreads = System::numberOfProcessors();
+    }
+
+    std::atomic<unsigned> next(0);
+    auto worker = [&files, &result, &next]() {
+      for (unsigned i = next++; i < files.size(); i = next++) {
+        result[i] = openstudio::checksum(files[i]);
+      }
+    };
+
+    std::vector<std::thread> threads;
+    for (unsigned t = 1; t < std::min<unsigned>(numThreads, files.size()); ++t) {
+      threads.emplace_back(worker);
+    }
+    worker();
+    for (std::thread& thread : threads) {
+      thread.join();
+    }
+
+    return result;
+  }
+
+  // Returns the checksums of files in each cache, only reading the files that changed since they were cached, and updates the caches
+  std::vector<std::vector<std::string>> cachedChecksums(std::vector<FileChecksumCache>& caches,
+                                                        const std::vector<std::vector<openstudio::path>>& files, unsigned numThreads) {
+    std::vector<std::vector<std::string>> result(files.size());
+    std::vector<openstudio::path> toCompute;
+    std::vector<std::pair<unsigned, unsigned>> toComputeIndices;
+    for (unsigned i = 0; i < files.size(); ++i) {
+      result[i].resize(files[i].size());
+      for (unsigned j = 0; j < files[i].size(); ++j) {
+        if (boost::optional<std::string> checksum = caches[i].find(files[i][j])) {
+          result[i][j] = *checksum;
+        } else {
+          toCompute.push_back(files[i][j]);
+          toComputeIndices.push_back(std::make_pair(i, j));
+        }
+      }
+    }
+
+    std::vector<std::string> computed = computeChecksums(toCompute, numThreads);
+    for (unsigned k = 0; k < computed.size(); ++k) {
+      unsigned i = toComputeIndices[k].first;
+      unsigned j = toComputeIndices[k].second;
+      result[i][j] = computed[k];
+      caches[i].insert(files[i][j], computed[k]);
+    }
+
+    for (const FileChecksumCache& cache : caches) {
+      cache.save();
+    }
+
+    return result;
+  }
+
+  // The files listed in measure.xml whose checksum checkForUpdatesFiles compares
+  bool isChecksummedFile(const BCLFileReference& file) {
+    std::string filename = file.fileName();
+    if (filename.empty() || boost::starts_with(filename, ".")) {
+      return false;
+    }
+    return exists(file.path());
+  }
+
+}  // namespace
+
 void BCLMeasure::createDirectory(const openstudio::path& dir) {
   if (exists(dir)) {
     if (!isEmptyDirectory(dir)) {
@@ -569,6 +739,23 @@ std::vector<BCLMeasure> BCLMeasure::getMeasuresInDir(const openstudio::path& dir
   return result;
 }
 
+void BCLMeasure::updateFileChecksumCaches(const openstudio::path& dir, unsigned numThreads) {
+  std::vector<FileChecksumCache> caches;
+  std::vector<std::vector<openstudio::path>> files;
+  for (const BCLMeasure& measure : getMeasuresInDir(dir)) {
+    caches.emplace_back(measure.directory());
+    files.emplace_back();
+    for (const BCLFileReference& file : measure.files()) {
+      if (isChecksummedFile(file)) {
+        files.back().push_back(file.path());
+      }
+    }
+  }
+
+  // one pool of files across all measures, so that a few large measures do not leave threads idle
+  cachedChecksums(caches, files, numThreads);
+}
+
 openstudio::path BCLMeasure::directory() const {
   return m_directory;
 }
@@ -926,9 +1113,28 @@ bool BCLMeasure::missingRequiredFields() const {
 bool BCLMeasure::checkForUpdatesFiles() {
   bool result = false;
 
+  std::vector<BCLFileReference> files = m_bclXML.files();
+
+  // checksum the files that changed since the last check, in parallel
+  std::vector<FileChecksumCache> caches{FileChecksumCache(m_directory)};
+  std::vector<std::vector<openstudio::path>> checksummedFiles(1);
+  std::vector<unsigned> checksummedIndices;
+  for (unsigned i = 0; i < files.size(); ++i) {
+    if (isChecksummedFile(files[i])) {
+      checksummedFiles[0].push_back(files[i].path());
+      checksummedIndices.push_back(i);
+    }
+  }
+  std::vector<std::string> checksums(files.size());
+  std::vector<std::string> computed = cachedChecksums(caches, checksummedFiles, 0)[0];
+  for (unsigned k = 0; k < computed.size(); ++k) {
+    checksums[checksummedIndices[k]] = computed[k];
+  }
+
   std::vector<BCLFileReference> filesToRemove;
   std::vector<BCLFileReference> filesToAdd;
-  for (BCLFileReference file : m_bclXML.files()) {
+  for (unsigned i = 0; i < files.size(); ++i) {
+    BCLFileReference file = files[i];
     std::string filename = file.fileName();
     if (!exists(file.path())) {
       result = true;
@@ -941,9 +1147,14 @@ bool BCLMeasure::checkForUpdatesFiles() {
         result = true;
         filesToRemove.push_back(file);
       }
-    } else if (file.checkForUpdate()) {
-      result = true;
-      filesToAdd.push_back(file);
+    } else {
+      // the file may have appeared since the checksums were computed
+      std::string newChecksum = checksums[i].empty() ? openstudio::checksum(file.path()) : checksums[i];
+      if (file.checksum() != newChecksum) {
+        file.setChecksum(newChecksum);
+        result = true;
+        filesToAdd.push_back(file);
+      }
     }
   }
 
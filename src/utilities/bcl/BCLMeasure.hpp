@@ -278,6 +278,10 @@ class UTILITIES_API BCLMeasure
   /// get all measures in an input directory
   static std::vector<BCLMeasure> getMeasuresInDir(const openstudio::path& dir);
 
+  /// Checksums the files of all measures in an input directory on numThreads threads (0 uses all processors)
+  /// and caches the results next to each measure.xml, so that checkForUpdatesFiles only reads files that changed since
+  static void updateFileChecksumCaches(const openstudio::path& dir, unsigned numThreads = 0);
+
   //@}
  private:
   // configure logging
@@ -33,6 +33,8 @@
 
 #include "../BCLMeasure.hpp"
 
+#include <ctime>
+
 using namespace openstudio;
 
 TEST_F(BCLFixture, BCLMeasure) {
@@ -157,6 +159,52 @@ TEST_F(BCLFixture, BCLMeasure_CTor) {
   boost::optional<BCLMeasure> measure = BCLMeasure::load(dir);
   ASSERT_TRUE(measure);
 }
+
+TEST_F(BCLFixture, BCLMeasure_ChecksumCache) {
+  openstudio::path measuresDir = openstudio::filesystem::system_complete(toPath("./ChecksumCacheMeasures/"));
+  if (exists(measuresDir)) {
+    removeDirectory(measuresDir);
+  }
+  ASSERT_FALSE(exists(measuresDir));
+
+  openstudio::path srcDir = resourcesPath() / toPath("/utilities/BCL/Measures/v2/SetWindowToWallRatioByFacade/");
+  boost::optional<BCLMeasure> srcMeasure = BCLMeasure::load(srcDir);
+  ASSERT_TRUE(srcMeasure);
+  openstudio::path dir = measuresDir / toPath("SetWindowToWallRatioByFacade");
+  boost::optional<BCLMeasure> measure = srcMeasure->clone(dir);
+  ASSERT_TRUE(measure);
+
+  // files written during the last second are not cached, so make them older
+  std::time_t past = std::time(nullptr) - 100;
+  for (const BCLFileReference& file : measure->files()) {
+    openstudio::filesystem::last_write_time(file.path(), past);
+  }
+
+  openstudio::path cachePath = dir / toPath(".checksums");
+  EXPECT_FALSE(exists(cachePath));
+  BCLMeasure::updateFileChecksumCaches(measuresDir, 2);
+  EXPECT_TRUE(exists(cachePath));
+
+  measure = BCLMeasure::load(dir);
+  ASSERT_TRUE(measure);
+  EXPECT_FALSE(measure->checkForUpdatesFiles());
+
+  // same size, different content and write time
+  ASSERT_TRUE(measure->primaryRubyScriptPath());
+  openstudio::path scriptPath = measure->primaryRubyScriptPath().get();
+  std::uintmax_t size = openstudio::filesystem::file_size(scriptPath);
+  openstudio::filesystem::ofstream file(scriptPath, std::ios_base::trunc);
+  ASSERT_TRUE(file.is_open());
+  file << std::string(size, '#');
+  file.close();
+  openstudio::filesystem::last_write_time(scriptPath, past + 10);
+  EXPECT_TRUE(measure->checkForUpdatesFiles());
+  EXPECT_FALSE(measure->checkForUpdatesFiles());
+
+  measure.reset();
+  srcMeasure.reset();
+  EXPECT_TRUE(removeDirectory(measuresDir));
+}
 /*
 TEST_F(BCLFixture, PatApplicationMeasures)
 {
@@ -29,7 +29,9 @@
 
 #include "Checksum.hpp"
 
+#include <algorithm>
 #include <sstream>
+#include <vector>
 
 #include <boost/crc.hpp>
 #include <fmt/format.h>
@@ -60,19 +62,17 @@ std::string checksum(std::string s) {
 /// return 8 character hex checksum of istream
 std::string checksum(std::istream& is) {
   boost::crc_32_type crc;
+  // read in large blocks and hash the runs between ignored characters in place, instead of copying every block
+  std::vector<char> buffer(64 * 1024);
   do {
-    const std::streamsize n = 1024;
-    char buffer[n];
-    is.read(buffer, n);
-    std::streamsize readSize = is.gcount();
-    //crc.process_bytes(buffer, readSize);
-
-    size_t stringSize = static_cast<size_t>(readSize);
-    std::string str(buffer, stringSize);
-    str.erase(std::remove_if(str.begin(), str.end(), openstudio::detail::checksumIgnore), str.end());
-    stringSize = str.size();
-
-    crc.process_bytes(str.c_str(), stringSize);
+    is.read(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+    const char* begin = buffer.data();
+    const char* end = begin + is.gcount();
+    while (begin != end) {
+      const char* ignored = std::find_if(begin, end, openstudio::detail::checksumIgnore);
+      crc.process_block(begin, ignored);
+      begin = (ignored == end) ? end : ignored + 1;
+    }
   } while (is);
 
   return fmt::format("{:0>8X}", crc.checksum());
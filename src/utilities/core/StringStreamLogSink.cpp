@@ -64,6 +64,16 @@ namespace detail {
     m_stringstream->str("");
   }
 
+  void StringStreamLogSink_Impl::appendLogMessages(const std::vector<LogMessage>& logMessages) {
+    // hold the backend so that these lines are not interleaved with messages being logged, same format as the sink's formatter
+    auto backend = this->sink()->locked_backend();
+    std::unique_lock l{m_mutex};
+
+    for (const LogMessage& logMessage : logMessages) {
+      *m_stringstream << "[" << logMessage.logChannel() << "] <" << logMessage.logLevel() << "> " << logMessage.logMessage() << '\n';
+    }
+  }
+
 }  // namespace detail
 
 StringStreamLogSink::StringStreamLogSink() : LogSink(boost::shared_ptr<detail::StringStreamLogSink_Impl>(new detail::StringStreamLogSink_Impl())) {
@@ -82,4 +92,8 @@ void StringStreamLogSink::resetStringStream() {
   this->getImpl<detail::StringStreamLogSink_Impl>()->resetStringStream();
 }
 
+void StringStreamLogSink::appendLogMessages(const std::vector<LogMessage>& logMessages) {
+  this->getImpl<detail::StringStreamLogSink_Impl>()->appendLogMessages(logMessages);
+}
+
 }  // namespace openstudio
@@ -50,6 +50,9 @@ class UTILITIES_API StringStreamLogSink : public LogSink
 
   /// reset the string stream's content
   void resetStringStream();
+
+  /// append messages to the string stream's content without logging them to any other sink
+  void appendLogMessages(const std::vector<LogMessage>& logMessages);
 };
 
 }  // namespace openstudio
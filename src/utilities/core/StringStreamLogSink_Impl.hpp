@@ -56,6 +56,9 @@ namespace detail {
     /// reset the string stream's content
     void resetStringStream();
 
+    /// append messages to the string stream's content without logging them to any other sink
+    void appendLogMessages(const std::vector<LogMessage>& logMessages);
+
    private:
     boost::shared_ptr<std::stringstream> m_stringstream;
   };
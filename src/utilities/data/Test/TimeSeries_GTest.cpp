@@ -2119,3 +2119,158 @@ TEST_F(DataFixture, TimeSeries_value_DateTime_NoYear) {
     }
   }
 }
+
+TEST_F(DataFixture, TimeSeries_SharedAxis) {
+  DateTime firstReportDateTime(Date(MonthOfYear(MonthOfYear::Jan), 1), Time(0, 1, 0, 0));
+  Vector values1(8760, 1.0);
+  Vector values2(8760, 2.0);
+
+  // series reported at the same times share one axis
+  openstudio::detail::TimeSeries_Impl impl1(firstReportDateTime, Time(0, 1, 0, 0), values1, "W");
+  openstudio::detail::TimeSeries_Impl impl2(firstReportDateTime, Time(0, 1, 0, 0), values2, "kW");
+  openstudio::detail::TimeSeries_Impl impl3(DateTime(firstReportDateTime.date(), Time(0, 2, 0, 0)), Time(0, 1, 0, 0), values2, "W");
+  EXPECT_EQ(impl1.axis(), impl2.axis());
+  EXPECT_EQ(impl1.axis(), impl3.axis());
+
+  // regardless of how the times are given
+  openstudio::detail::TimeSeries_Impl impl6(firstReportDateTime, impl1.secondsFromFirstReport(), values2, "W");
+  openstudio::detail::TimeSeries_Impl impl7(impl1.dateTimes(), values2, "W");
+  EXPECT_EQ(impl1.axis(), impl6.axis());
+  EXPECT_EQ(impl1.axis(), impl7.axis());
+
+  openstudio::detail::TimeSeries_Impl impl4(firstReportDateTime, Time(0, 0, 30, 0), values1, "W");
+  EXPECT_NE(impl1.axis(), impl4.axis());
+  ASSERT_TRUE(impl1.axis()->step());
+  EXPECT_EQ(3600, impl1.axis()->step().get());
+  ASSERT_TRUE(impl4.axis()->step());
+  EXPECT_EQ(1800, impl4.axis()->step().get());
+
+  // the axis is released with the last series using it
+  unsigned numInterned = openstudio::detail::TimeSeriesAxis::numInterned();
+  {
+    std::vector<long> uniqueSeconds{0, 17, 39};
+    openstudio::detail::TimeSeries_Impl impl5(firstReportDateTime, uniqueSeconds, Vector(3, 1.0), "W");
+    EXPECT_EQ(numInterned + 1, openstudio::detail::TimeSeriesAxis::numInterned());
+    EXPECT_FALSE(impl5.axis()->step());
+  }
+  EXPECT_EQ(numInterned, openstudio::detail::TimeSeriesAxis::numInterned());
+}
+
+TEST_F(DataFixture, TimeSeries_ValueAtSecondsFromFirstReport_MatchesInterp) {
+  DateTime firstReportDateTime(Date(MonthOfYear(MonthOfYear::Jan), 1), Time(0, 1, 0, 0));
+
+  std::vector<std::vector<long>> axes;
+  // evenly spaced, without an interval length
+  axes.push_back({0, 3600, 7200, 10800, 14400});
+  // unevenly spaced, with repeated times
+  axes.push_back({0, 60, 3600, 3600, 7000, 86400});
+  // single report
+  axes.push_back({0});
+
+  for (const std::vector<long>& secondsFromFirstReport : axes) {
+    Vector values(secondsFromFirstReport.size());
+    for (unsigned i = 0; i < values.size(); ++i) {
+      values[i] = i + 1;
+    }
+    openstudio::detail::TimeSeries_Impl timeSeries(firstReportDateTime, secondsFromFirstReport, values, "W");
+    EXPECT_FALSE(timeSeries.intervalLength());
+
+    Vector x = createVector(secondsFromFirstReport);
+    for (long seconds = 0; seconds <= secondsFromFirstReport.back(); seconds += 15) {
+      EXPECT_EQ(interp(x, values, seconds, HoldNextInterp, NoneExtrap), timeSeries.valueAtSecondsFromFirstReport(seconds)) << seconds;
+    }
+    EXPECT_EQ(0.0, timeSeries.valueAtSecondsFromFirstReport(-1));
+    EXPECT_EQ(0.0, timeSeries.valueAtSecondsFromFirstReport(secondsFromFirstReport.back() + 1));
+  }
+}
+
+TEST_F(DataFixture, TimeSeries_AlignedArithmetic) {
+  DateTime firstReportDateTime(Date(MonthOfYear(MonthOfYear::Jan), 1), Time(0, 1, 0, 0));
+  Time interval(0, 1, 0, 0);
+
+  std::vector<TimeSeries> timeSeriesVector;
+  std::vector<double> weights;
+  for (unsigned j = 0; j < 5; ++j) {
+    Vector values(8760);
+    for (unsigned i = 0; i < 8760; ++i) {
+      values[i] = (i % 24) + j;
+    }
+    timeSeriesVector.push_back(TimeSeries(firstReportDateTime, interval, values, "J"));
+    weights.push_back(j + 0.5);
+  }
+
+  // same result as adding the series one at a time through their date times
+  TimeSeries total = sum(timeSeriesVector);
+  TimeSeries weighted = weightedSum(timeSeriesVector, weights);
+  ASSERT_EQ(8760u, total.values().size());
+  ASSERT_EQ(8760u, weighted.values().size());
+  ASSERT_TRUE(total.intervalLength());
+  EXPECT_EQ(interval, total.intervalLength().get());
+  EXPECT_EQ(firstReportDateTime, total.firstReportDateTime());
+  for (unsigned i = 0; i < 8760; ++i) {
+    double expectedTotal = 0;
+    double expectedWeighted = 0;
+    for (unsigned j = 0; j < 5; ++j) {
+      expectedTotal += (i % 24) + j;
+      expectedWeighted += weights[j] * ((i % 24) + j);
+    }
+    EXPECT_DOUBLE_EQ(expectedTotal, total.values(i));
+    EXPECT_DOUBLE_EQ(expectedWeighted, weighted.values(i));
+  }
+
+  TimeSeries difference = timeSeriesVector[4] - timeSeriesVector[1];
+  EXPECT_DOUBLE_EQ(3.0, difference.values(100));
+  EXPECT_DOUBLE_EQ(3.0 * 8760 * 3600, difference.integrate());
+
+  // series at other report times take the general path
+  Vector values(2, 1.0);
+  TimeSeries shifted(DateTime(Date(MonthOfYear(MonthOfYear::Jan), 1), Time(0, 1, 30, 0)), interval, values, "J");
+  TimeSeries mixed = weightedSum(std::vector<TimeSeries>{timeSeriesVector[0], shifted}, std::vector<double>{1.0, 2.0});
+  EXPECT_DOUBLE_EQ(2.0, mixed.value(DateTime(Date(MonthOfYear(MonthOfYear::Jan), 1), Time(0, 1, 0, 0))));
+  EXPECT_DOUBLE_EQ(3.0, mixed.value(DateTime(Date(MonthOfYear(MonthOfYear::Jan), 1), Time(0, 1, 30, 0))));
+
+  EXPECT_THROW(weightedSum(timeSeriesVector, std::vector<double>(2, 1.0)), std::exception);
+}
+
+TEST_F(DataFixture, TimeSeries_Aggregation) {
+  // hourly values for a non leap year, reported at the end of each hour
+  DateTime firstReportDateTime(Date(MonthOfYear(MonthOfYear::Jan), 1, 2009), Time(0, 1, 0, 0));
+  Vector values(8760);
+  for (unsigned i = 0; i < 8760; ++i) {
+    values[i] = 1.0;
+  }
+  values[5000] = 10.0;
+  values[6000] = 10.0;
+  TimeSeries timeSeries(firstReportDateTime, Time(0, 1, 0, 0), values, "J");
+
+  TimeSeries daily = timeSeries.dailySums();
+  ASSERT_EQ(365u, daily.values().size());
+  EXPECT_EQ(DateTime(Date(MonthOfYear(MonthOfYear::Jan), 2, 2009), Time(0)), daily.firstReportDateTime());
+  ASSERT_TRUE(daily.intervalLength());
+  EXPECT_EQ(Time(1.0), daily.intervalLength().get());
+  EXPECT_DOUBLE_EQ(24.0, daily.values(0));
+  EXPECT_DOUBLE_EQ(24.0 + 9.0, daily.values(5000 / 24));
+  EXPECT_DOUBLE_EQ(24.0, daily.values(364));
+  EXPECT_DOUBLE_EQ(timeSeries.integrate(), daily.integrate() / 24.0);
+
+  TimeSeries monthly = timeSeries.monthlySums();
+  ASSERT_EQ(12u, monthly.values().size());
+  EXPECT_EQ(DateTime(Date(MonthOfYear(MonthOfYear::Feb), 1, 2009), Time(0)), monthly.firstReportDateTime());
+  EXPECT_DOUBLE_EQ(31 * 24.0, monthly.values(0));
+  EXPECT_DOUBLE_EQ(28 * 24.0, monthly.values(1));
+  // hours 5000 and 6000 are in July and September
+  EXPECT_DOUBLE_EQ(31 * 24.0 + 9.0, monthly.values(6));
+  EXPECT_DOUBLE_EQ(30 * 24.0 + 9.0, monthly.values(8));
+  EXPECT_DOUBLE_EQ(31 * 24.0, monthly.values(11));
+  EXPECT_DOUBLE_EQ(28 * 24.0, monthly.value(DateTime(Date(MonthOfYear(MonthOfYear::Feb), 15, 2009), Time(0, 12, 0, 0))));
+  EXPECT_DOUBLE_EQ(31 * 24.0, monthly.value(DateTime(Date(MonthOfYear(MonthOfYear::Mar), 31, 2009), Time(0, 24, 0, 0))));
+
+  boost::optional<std::pair<DateTime, double>> peak = timeSeries.peak();
+  ASSERT_TRUE(peak);
+  EXPECT_DOUBLE_EQ(10.0, peak->second);
+  EXPECT_EQ(firstReportDateTime + Time(0, 5000, 0, 0), peak->first);
+
+  EXPECT_FALSE(TimeSeries().peak());
+  EXPECT_TRUE(TimeSeries().dailySums().values().empty());
+  EXPECT_TRUE(TimeSeries().monthlySums().values().empty());
+}
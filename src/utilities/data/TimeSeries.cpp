@@ -30,6 +30,10 @@
 #include "TimeSeries.hpp"
 #include "../core/Assert.hpp"
 
+#include <algorithm>
+#include <mutex>
+#include <unordered_map>
+
 using namespace std;
 using namespace boost;
 
@@ -37,16 +41,121 @@ namespace openstudio {
 
 namespace detail {
 
-  TimeSeries_Impl::TimeSeries_Impl() : m_outOfRangeValue(0.0), m_wrapAround(false) {}
+  namespace {
+
+    std::mutex& timeSeriesAxisMutex() {
+      static std::mutex mutex;
+      return mutex;
+    }
+
+    // axes in use, by hash of their report times; entries expire with the last series using them
+    std::unordered_multimap<size_t, std::weak_ptr<const TimeSeriesAxis>>& timeSeriesAxisRegistry() {
+      static std::unordered_multimap<size_t, std::weak_ptr<const TimeSeriesAxis>> registry;
+      return registry;
+    }
+
+    size_t hashSecondsFromFirstReport(const std::vector<long>& secondsFromFirstReport) {
+      size_t result = secondsFromFirstReport.size();
+      for (long seconds : secondsFromFirstReport) {
+        result ^= std::hash<long>()(seconds) + 0x9e3779b9 + (result << 6) + (result >> 2);
+      }
+      return result;
+    }
+
+  }  // namespace
+
+  TimeSeriesAxis::TimeSeriesAxis(std::vector<long> secondsFromFirstReport) : m_secondsFromFirstReport(std::move(secondsFromFirstReport)) {
+    if (m_secondsFromFirstReport.size() > 1) {
+      long step = m_secondsFromFirstReport[1] - m_secondsFromFirstReport[0];
+      bool constantStep = (step > 0);
+      for (unsigned i = 0; constantStep && i < m_secondsFromFirstReport.size(); ++i) {
+        constantStep = (m_secondsFromFirstReport[i] == m_secondsFromFirstReport[0] + i * step);
+      }
+      if (constantStep) {
+        m_step = step;
+      }
+    }
+  }
+
+  std::shared_ptr<const TimeSeriesAxis> TimeSeriesAxis::intern(std::vector<long> secondsFromFirstReport) {
+    size_t hash = hashSecondsFromFirstReport(secondsFromFirstReport);
+
+    std::lock_guard<std::mutex> lock(timeSeriesAxisMutex());
+    auto& registry = timeSeriesAxisRegistry();
+
+    auto range = registry.equal_range(hash);
+    for (auto it = range.first; it != range.second;) {
+      std::shared_ptr<const TimeSeriesAxis> axis = it->second.lock();
+      if (!axis) {
+        it = registry.erase(it);
+      } else if (axis->secondsFromFirstReport() == secondsFromFirstReport) {
+        return axis;
+      } else {
+        ++it;
+      }
+    }
+
+    // drop expired axes once in a while so the registry does not grow with every series ever created
+    if (registry.size() >= 64 && registry.size() % 64 == 0) {
+      for (auto it = registry.begin(); it != registry.end();) {
+        if (it->second.expired()) {
+          it = registry.erase(it);
+        } else {
+          ++it;
+        }
+      }
+    }
+
+    std::shared_ptr<const TimeSeriesAxis> result(new TimeSeriesAxis(std::move(secondsFromFirstReport)));
+    registry.emplace(hash, result);
+    return result;
+  }
+
+  unsigned TimeSeriesAxis::numInterned() {
+    std::lock_guard<std::mutex> lock(timeSeriesAxisMutex());
+    unsigned result = 0;
+    for (const auto& entry : timeSeriesAxisRegistry()) {
+      if (!entry.second.expired()) {
+        ++result;
+      }
+    }
+    return result;
+  }
+
+  const std::vector<long>& TimeSeriesAxis::secondsFromFirstReport() const {
+    return m_secondsFromFirstReport;
+  }
+
+  boost::optional<long> TimeSeriesAxis::step() const {
+    return m_step;
+  }
+
+  unsigned TimeSeriesAxis::nextReportIndex(long secondsFromFirstReport) const {
+    OS_ASSERT(!m_secondsFromFirstReport.empty());
+    unsigned last = m_secondsFromFirstReport.size() - 1;
+
+    // same conventions as interp with HoldNextInterp, exact matches at either end are found first
+    if (secondsFromFirstReport <= m_secondsFromFirstReport.front()) {
+      return 0;
+    }
+    if (secondsFromFirstReport >= m_secondsFromFirstReport.back()) {
+      return last;
+    }
+
+    if (m_step) {
+      long offset = secondsFromFirstReport - m_secondsFromFirstReport.front();
+      return static_cast<unsigned>((offset + *m_step - 1) / *m_step);
+    }
+
+    auto it = std::lower_bound(m_secondsFromFirstReport.begin(), m_secondsFromFirstReport.end(), secondsFromFirstReport);
+    return static_cast<unsigned>(it - m_secondsFromFirstReport.begin());
+  }
+
+  TimeSeries_Impl::TimeSeries_Impl()
+    : m_axis(TimeSeriesAxis::intern(std::vector<long>())), m_firstIntervalSeconds(0), m_outOfRangeValue(0.0), m_wrapAround(false) {}
 
   TimeSeries_Impl::TimeSeries_Impl(const Date& startDate, const Time& intervalLength, const Vector& values, const std::string& units)
-    : m_secondsFromFirstReport(values.size()),
-      m_secondsFromStart(values.size()),
-      m_values(values),
-      m_units(units),
-      m_intervalLength(intervalLength),
-      m_outOfRangeValue(0.0),
-      m_wrapAround(false) {
+    : m_values(values), m_units(units), m_intervalLength(intervalLength), m_outOfRangeValue(0.0), m_wrapAround(false) {
     if (values.empty()) {
       LOG(Warn, "Creating empty timeseries");
     }
@@ -60,36 +169,18 @@ namespace detail {
 
     m_startDateTime = DateTime(startDate, Time(0));
 
+    std::vector<long> secondsFromFirstReport(values.size());
     for (unsigned i = 0; i < values.size(); ++i) {
-      m_secondsFromFirstReport[i] = i * secondsPerInterval;
-      m_secondsFromStart[i] = (i + 1) * secondsPerInterval;
+      secondsFromFirstReport[i] = i * secondsPerInterval;
     }
-    m_secondsFromFirstReportAsVector = createVector(m_secondsFromFirstReport);
+    m_axis = TimeSeriesAxis::intern(std::move(secondsFromFirstReport));
+    m_firstIntervalSeconds = secondsPerInterval;
 
-    long durationSeconds = 0;
-    if (!m_secondsFromFirstReport.empty()) {
-      durationSeconds = m_secondsFromFirstReport.back();
-    }
-
-    // check for wrap around
-    boost::optional<int> calendarYear = m_firstReportDateTime.date().baseYear();
-    if (!calendarYear) {
-      DateTime lastDateTime = m_firstReportDateTime + Time(0, 0, 0, durationSeconds);
-      Date lastDate(lastDateTime.date().monthOfYear(), lastDateTime.date().dayOfMonth());
-      if ((durationSeconds > Time(366.0).totalSeconds()) || (lastDate < m_firstReportDateTime.date())) {
-        m_wrapAround = true;
-      }
-    }
+    checkWrapAround();
   }
 
   TimeSeries_Impl::TimeSeries_Impl(const DateTime& firstReportDateTime, const Time& intervalLength, const Vector& values, const std::string& units)
-    : m_secondsFromFirstReport(values.size()),
-      m_secondsFromStart(values.size()),
-      m_values(values),
-      m_units(units),
-      m_intervalLength(intervalLength),
-      m_outOfRangeValue(0.0),
-      m_wrapAround(false) {
+    : m_values(values), m_units(units), m_intervalLength(intervalLength), m_outOfRangeValue(0.0), m_wrapAround(false) {
     if (values.empty()) {
       LOG(Warn, "Creating empty timeseries");
     }
@@ -102,43 +193,29 @@ namespace detail {
 
     m_startDateTime = m_firstReportDateTime - intervalLength;
 
+    std::vector<long> secondsFromFirstReport(values.size());
     for (unsigned i = 0; i < values.size(); ++i) {
-      m_secondsFromFirstReport[i] = i * secondsPerInterval;
-      m_secondsFromStart[i] = (i + 1) * secondsPerInterval;
+      secondsFromFirstReport[i] = i * secondsPerInterval;
     }
-    m_secondsFromFirstReportAsVector = createVector(m_secondsFromFirstReport);
+    m_axis = TimeSeriesAxis::intern(std::move(secondsFromFirstReport));
+    m_firstIntervalSeconds = secondsPerInterval;
 
-    long durationSeconds = 0;
-    if (!m_secondsFromFirstReport.empty()) {
-      durationSeconds = m_secondsFromFirstReport.back();
-    }
-
-    // check for wrap around
-    boost::optional<int> calendarYear = m_firstReportDateTime.date().baseYear();
-    if (!calendarYear) {
-      DateTime lastDateTime = m_firstReportDateTime + Time(0, 0, 0, durationSeconds);
-      Date lastDate(lastDateTime.date().monthOfYear(), lastDateTime.date().dayOfMonth());
-      if ((durationSeconds > Time(366.0).totalSeconds()) || (lastDate < m_firstReportDateTime.date())) {
-        m_wrapAround = true;
-      }
-    }
+    checkWrapAround();
   }
 
   TimeSeries_Impl::TimeSeries_Impl(const DateTime& firstReportDateTime, const Vector& timeInDays, const Vector& values, const std::string& units)
-    : m_secondsFromFirstReport(values.size()),
-      m_secondsFromStart(values.size()),
-      m_values(values),
-      m_units(units),
-      m_outOfRangeValue(0.0),
-      m_wrapAround(false) {
+    : m_firstIntervalSeconds(0), m_values(values), m_units(units), m_outOfRangeValue(0.0), m_wrapAround(false) {
     if (timeInDays.size() != values.size()) {
       LOG_AND_THROW("Length of values (" << values.size() << ") must match length of times (" << timeInDays.size() << ")");
     }
 
+    std::vector<long> secondsFromFirstReport(values.size());
+
     if (values.empty() || timeInDays.empty()) {
       LOG(Warn, "Creating empty timeseries");
       m_startDateTime = firstReportDateTime;
       m_firstReportDateTime = firstReportDateTime;
+      m_axis = TimeSeriesAxis::intern(std::move(secondsFromFirstReport));
     } else {
 
       // DLM: firstReportDateTime may or may not have baseYear defined
@@ -154,65 +231,50 @@ namespace detail {
         LOG(Warn, "Assuming time series begins at the start of the day of first report. This behavior is deprecated and will instead be an error in "
                   "the future.");
         m_startDateTime = DateTime(m_firstReportDateTime.date());
+        m_firstIntervalSeconds = firstIntervalSeconds;
 
         for (unsigned i = 0; i < values.size(); ++i) {
-          m_secondsFromFirstReport[i] = Time(timeInDays[i]).totalSeconds();
-          m_secondsFromStart[i] = m_secondsFromFirstReport[i] + firstIntervalSeconds;
+          secondsFromFirstReport[i] = Time(timeInDays[i]).totalSeconds();
           if (i > 0) {
-            if (m_secondsFromFirstReport[i] < m_secondsFromFirstReport[i - 1]) {
+            if (secondsFromFirstReport[i] < secondsFromFirstReport[i - 1]) {
               LOG_AND_THROW("Days from first report must be monotonically increasing");
             }
           }
         }
       } else {  // This is the new way
         m_startDateTime = m_firstReportDateTime - Time(timeInDays[0]);
+        m_firstIntervalSeconds = Time(timeInDays[0]).totalSeconds();
         for (unsigned i = 0; i < values.size(); ++i) {
-          m_secondsFromStart[i] = Time(timeInDays[i]).totalSeconds();
-          m_secondsFromFirstReport[i] = m_secondsFromStart[i] - m_secondsFromStart[0];
+          secondsFromFirstReport[i] = Time(timeInDays[i]).totalSeconds() - m_firstIntervalSeconds;
           if (i > 0) {
-            if (m_secondsFromFirstReport[i] < m_secondsFromFirstReport[i - 1]) {
+            if (secondsFromFirstReport[i] < secondsFromFirstReport[i - 1]) {
               LOG_AND_THROW("Days from first report must be monotonically increasing");
             }
           }
         }
       }
 
-      m_secondsFromFirstReportAsVector = createVector(m_secondsFromFirstReport);
-
-      long durationSeconds = 0;
-      if (!m_secondsFromFirstReport.empty()) {
-        durationSeconds = m_secondsFromFirstReport.back();
-      }
+      m_axis = TimeSeriesAxis::intern(std::move(secondsFromFirstReport));
 
-      // check for wrap around
-      boost::optional<int> calendarYear = m_firstReportDateTime.date().baseYear();
-      if (!calendarYear) {
-        DateTime lastDateTime = m_firstReportDateTime + Time(0, 0, 0, durationSeconds);
-        Date lastDate(lastDateTime.date().monthOfYear(), lastDateTime.date().dayOfMonth());
-        if ((durationSeconds > Time(366.0).totalSeconds()) || (lastDate < m_firstReportDateTime.date())) {
-          m_wrapAround = true;
-        }
-      }
+      checkWrapAround();
     }
   }
 
   TimeSeries_Impl::TimeSeries_Impl(const DateTime& firstReportDateTime, const std::vector<double>& timeInDays, const std::vector<double>& values,
                                    const std::string& units)
-    : m_secondsFromFirstReport(timeInDays.size()),
-      m_secondsFromStart(values.size()),
-      m_values(values.size()),
-      m_units(units),
-      m_outOfRangeValue(0.0),
-      m_wrapAround(false) {
+    : m_firstIntervalSeconds(0), m_values(values.size()), m_units(units), m_outOfRangeValue(0.0), m_wrapAround(false) {
 
     if (timeInDays.size() != values.size()) {
       LOG_AND_THROW("Length of values (" << values.size() << ") must match length of times (" << timeInDays.size() << ")");
     }
 
+    std::vector<long> secondsFromFirstReport(timeInDays.size());
+
     if (values.empty() || timeInDays.empty()) {
       LOG(Warn, "Creating empty timeseries");
       m_startDateTime = firstReportDateTime;
       m_firstReportDateTime = firstReportDateTime;
+      m_axis = TimeSeriesAxis::intern(std::move(secondsFromFirstReport));
     } else {
 
       // DLM: firstReportDateTime may or may not have baseYear defined
@@ -228,57 +290,41 @@ namespace detail {
         LOG(Warn, "Assuming time series begins at the start of the day of first report. This behavior is deprecated and will instead be an error in "
                   "the future.");
         m_startDateTime = DateTime(m_firstReportDateTime.date());
+        m_firstIntervalSeconds = firstIntervalSeconds;
 
         for (unsigned i = 0; i < values.size(); ++i) {
-          m_secondsFromFirstReport[i] = Time(timeInDays[i]).totalSeconds();
-          m_secondsFromStart[i] = m_secondsFromFirstReport[i] + firstIntervalSeconds;
+          secondsFromFirstReport[i] = Time(timeInDays[i]).totalSeconds();
           if (i > 0) {
-            if (m_secondsFromFirstReport[i] < m_secondsFromFirstReport[i - 1]) {
+            if (secondsFromFirstReport[i] < secondsFromFirstReport[i - 1]) {
               LOG_AND_THROW("Days from first report must be monotonically increasing");
             }
           }
         }
       } else {  // This is the new way
         m_startDateTime = m_firstReportDateTime - Time(timeInDays[0]);
+        m_firstIntervalSeconds = Time(timeInDays[0]).totalSeconds();
         for (unsigned i = 0; i < values.size(); ++i) {
-          m_secondsFromStart[i] = Time(timeInDays[i]).totalSeconds();
-          m_secondsFromFirstReport[i] = m_secondsFromStart[i] - m_secondsFromStart[0];
+          secondsFromFirstReport[i] = Time(timeInDays[i]).totalSeconds() - m_firstIntervalSeconds;
           if (i > 0) {
-            if (m_secondsFromFirstReport[i] < m_secondsFromFirstReport[i - 1]) {
+            if (secondsFromFirstReport[i] < secondsFromFirstReport[i - 1]) {
               LOG_AND_THROW("Days from first report must be monotonically increasing");
             }
           }
         }
       }
 
-      m_secondsFromFirstReportAsVector = createVector(m_secondsFromFirstReport);
-
-      long durationSeconds = 0;
-      if (!m_secondsFromFirstReport.empty()) {
-        durationSeconds = m_secondsFromFirstReport.back();
-      }
+      m_axis = TimeSeriesAxis::intern(std::move(secondsFromFirstReport));
 
-      // check for wrap around
-      boost::optional<int> calendarYear = m_firstReportDateTime.date().baseYear();
-      if (!calendarYear) {
-        DateTime lastDateTime = m_firstReportDateTime + Time(0, 0, 0, durationSeconds);
-        Date lastDate(lastDateTime.date().monthOfYear(), lastDateTime.date().dayOfMonth());
-        if ((durationSeconds > Time(366.0).totalSeconds()) || (lastDate < m_firstReportDateTime.date())) {
-          m_wrapAround = true;
-        }
-      }
+      checkWrapAround();
     }
   }
 
   TimeSeries_Impl::TimeSeries_Impl(const DateTimeVector& inDateTimes, const Vector& values, const std::string& units)
-    : m_secondsFromFirstReport(values.size()),
-      m_secondsFromStart(values.size()),
-      m_values(values),
-      m_units(units),
-      m_outOfRangeValue(0.0),
-      m_wrapAround(false) {
+    : m_firstIntervalSeconds(0), m_values(values), m_units(units), m_outOfRangeValue(0.0), m_wrapAround(false) {
     // DLM: this seems to be a pretty fragile constructor with a lot going on
 
+    std::vector<long> secondsFromFirstReport(values.size());
+
     if (values.empty() || inDateTimes.empty()) {
       LOG(Warn, "Creating empty timeseries");
     } else {
@@ -313,8 +359,7 @@ namespace detail {
 
       // Compute the seconds from first report
       if (m_wrapAround) {
-        m_secondsFromFirstReport[0] = 0;
-        m_secondsFromStart[0] = 0;
+        secondsFromFirstReport[0] = 0;
         int delta = 0;
         DateTime firstReportDateTimeWithYear =
           DateTime(Date(m_firstReportDateTime.date().monthOfYear(), m_firstReportDateTime.date().dayOfMonth(), m_firstReportDateTime.date().year()),
@@ -329,20 +374,17 @@ namespace detail {
               DateTime(Date(dateTimes[i].date().monthOfYear(), dateTimes[i].date().dayOfMonth(), m_firstReportDateTime.date().year() + delta),
                        dateTimes[i].time());
           }
-          m_secondsFromFirstReport[i] = (wrappedDateTime - firstReportDateTimeWithYear).totalSeconds();
-          m_secondsFromStart[i] = (wrappedDateTime - firstReportDateTimeWithYear).totalSeconds();
+          secondsFromFirstReport[i] = (wrappedDateTime - firstReportDateTimeWithYear).totalSeconds();
         }
       } else {
-        m_secondsFromFirstReport[0] = 0;
-        m_secondsFromStart[0] = 0;
+        secondsFromFirstReport[0] = 0;
         for (unsigned i = 1; i < dateTimes.size(); i++) {
-          m_secondsFromFirstReport[i] = (dateTimes[i] - m_firstReportDateTime).totalSeconds();
-          m_secondsFromStart[i] = (dateTimes[i] - m_firstReportDateTime).totalSeconds();
+          secondsFromFirstReport[i] = (dateTimes[i] - m_firstReportDateTime).totalSeconds();
         }
       }
 
       for (unsigned i = 1; i < dateTimes.size(); i++) {
-        if (m_secondsFromStart[i] < m_secondsFromStart[i - 1]) {
+        if (secondsFromFirstReport[i] < secondsFromFirstReport[i - 1]) {
           LOG_AND_THROW("Dates from first report must be monotonically increasing");
         }
       }
@@ -351,12 +393,12 @@ namespace detail {
       if (!extraTime) {
         int delta;
         bool foundInterval = false;
-        if (m_secondsFromStart.size() > 1) {
+        if (secondsFromFirstReport.size() > 1) {
           // check if all data is reported at a constant interval
-          delta = m_secondsFromStart[1] - m_secondsFromStart[0];
+          delta = secondsFromFirstReport[1] - secondsFromFirstReport[0];
           foundInterval = true;
-          for (unsigned i = 2; i < m_secondsFromStart.size(); i++) {
-            if (delta != m_secondsFromStart[i] - m_secondsFromStart[i - 1]) foundInterval = false;
+          for (unsigned i = 2; i < secondsFromFirstReport.size(); i++) {
+            if (delta != secondsFromFirstReport[i] - secondsFromFirstReport[i - 1]) foundInterval = false;
             break;
           }
         }
@@ -375,29 +417,21 @@ namespace detail {
         }
       }
 
-      int firstIntervalSeconds = (m_firstReportDateTime - m_startDateTime).totalSeconds();
-
-      // Compute the seconds from start
-      m_secondsFromStart[0] = firstIntervalSeconds;
-      for (unsigned i = 1; i < dateTimes.size(); i++) {
-        m_secondsFromStart[i] = m_secondsFromStart[i] + firstIntervalSeconds;
-      }
-
-      m_secondsFromFirstReportAsVector = createVector(m_secondsFromFirstReport);
+      m_firstIntervalSeconds = (m_firstReportDateTime - m_startDateTime).totalSeconds();
     }
+
+    m_axis = TimeSeriesAxis::intern(std::move(secondsFromFirstReport));
   }
 
   TimeSeries_Impl::TimeSeries_Impl(const DateTime& firstReportDateTime, const std::vector<long>& timeInSeconds, const Vector& values,
                                    const std::string& units)
-    : m_secondsFromFirstReport(values.size()),
-      m_secondsFromStart(values.size()),
-      m_values(values),
-      m_units(units),
-      m_outOfRangeValue(0.0),
-      m_wrapAround(false) {
+    : m_firstIntervalSeconds(0), m_values(values), m_units(units), m_outOfRangeValue(0.0), m_wrapAround(false) {
     if (timeInSeconds.size() != values.size()) {
       LOG_AND_THROW("Length of values (" << values.size() << ") must match length of times (" << timeInSeconds.size() << ")");
     }
+
+    std::vector<long> secondsFromFirstReport(values.size());
+
     if (values.empty() || timeInSeconds.empty()) {
       LOG(Warn, "Creating empty timeseries");
       m_startDateTime = firstReportDateTime;
@@ -418,31 +452,46 @@ namespace detail {
                   "the future.");
         m_startDateTime = DateTime(firstReportDateTime.date());
         m_firstReportDateTime = firstReportDateTime;
-        int firstIntervalSeconds = m_firstReportDateTime.time().totalSeconds();
-        m_secondsFromStart = timeInSeconds;
-        for (unsigned i = 0; i < m_secondsFromStart.size(); i++) {
-          m_secondsFromStart[i] += firstIntervalSeconds;
-        }
-        m_secondsFromFirstReport = timeInSeconds;
+        m_firstIntervalSeconds = m_firstReportDateTime.time().totalSeconds();
+        secondsFromFirstReport = timeInSeconds;
 
       } else {  // This is the new behavior
         m_startDateTime = firstReportDateTime - Time(0, 0, 0, timeInSeconds[0]);
         m_firstReportDateTime = firstReportDateTime;
-        m_secondsFromStart = timeInSeconds;
+        m_firstIntervalSeconds = timeInSeconds[0];
 
         // Get rid of this later
-        m_secondsFromFirstReport[0] = 0;
+        secondsFromFirstReport[0] = 0;
         for (unsigned i = 1; i < values.size(); ++i) {
-          m_secondsFromFirstReport[i] = timeInSeconds[i] - timeInSeconds[0];
+          secondsFromFirstReport[i] = timeInSeconds[i] - timeInSeconds[0];
         }
       }
     }
 
-    m_secondsFromFirstReportAsVector = createVector(m_secondsFromFirstReport);
+    m_axis = TimeSeriesAxis::intern(std::move(secondsFromFirstReport));
+
+    checkWrapAround();
+  }
+
+  TimeSeries_Impl::TimeSeries_Impl(const TimeSeries_Impl& other, const Vector& values, const std::string& units)
+    : m_firstReportDateTime(other.m_firstReportDateTime),
+      m_startDateTime(other.m_startDateTime),
+      m_axis(other.m_axis),
+      m_firstIntervalSeconds(other.m_firstIntervalSeconds),
+      m_values(values),
+      m_units(units),
+      m_intervalLength(other.m_intervalLength),
+      m_outOfRangeValue(0.0),
+      m_wrapAround(other.m_wrapAround) {
+    if (values.size() != m_axis->secondsFromFirstReport().size()) {
+      LOG_AND_THROW("Length of values (" << values.size() << ") must match length of times (" << m_axis->secondsFromFirstReport().size() << ")");
+    }
+  }
 
+  void TimeSeries_Impl::checkWrapAround() {
     long durationSeconds = 0;
-    if (!m_secondsFromFirstReport.empty()) {
-      durationSeconds = m_secondsFromFirstReport.back();
+    if (!m_axis->secondsFromFirstReport().empty()) {
+      durationSeconds = m_axis->secondsFromFirstReport().back();
     }
 
     // check for wrap around
@@ -462,18 +511,20 @@ namespace detail {
   }
 
   DateTimeVector TimeSeries_Impl::dateTimes() const {
-    DateTimeVector dateTimeObjs(m_secondsFromFirstReport.size());
-    for (unsigned i = 0; i < m_secondsFromFirstReport.size(); i++) {
-      dateTimeObjs[i] = m_firstReportDateTime + openstudio::Time(0, 0, 0, m_secondsFromFirstReport[i]);
+    const std::vector<long>& secondsFromFirstReport = m_axis->secondsFromFirstReport();
+    DateTimeVector dateTimeObjs(secondsFromFirstReport.size());
+    for (unsigned i = 0; i < secondsFromFirstReport.size(); i++) {
+      dateTimeObjs[i] = m_firstReportDateTime + openstudio::Time(0, 0, 0, secondsFromFirstReport[i]);
     }
     return dateTimeObjs;
   }
 
   /// time in days from end of the first reporting interval
   Vector TimeSeries_Impl::daysFromFirstReport() const {
-    Vector daysFromFirstReport(m_secondsFromFirstReport.size());
-    for (unsigned i = 0; i < m_secondsFromFirstReport.size(); i++) {
-      daysFromFirstReport[i] = Time(0, 0, 0, m_secondsFromFirstReport[i]).totalDays();
+    const std::vector<long>& secondsFromFirstReport = m_axis->secondsFromFirstReport();
+    Vector daysFromFirstReport(secondsFromFirstReport.size());
+    for (unsigned i = 0; i < secondsFromFirstReport.size(); i++) {
+      daysFromFirstReport[i] = Time(0, 0, 0, secondsFromFirstReport[i]).totalDays();
     }
     return daysFromFirstReport;
   }
@@ -481,23 +532,23 @@ namespace detail {
   /// time in days from end of the first reporting interval at index i
   double TimeSeries_Impl::daysFromFirstReport(const unsigned& i) const {
     double value = m_outOfRangeValue;
-    if (i < m_secondsFromFirstReport.size()) {
-      value = Time(0, 0, 0, m_secondsFromFirstReport[i]).totalDays();
+    if (i < m_axis->secondsFromFirstReport().size()) {
+      value = Time(0, 0, 0, m_axis->secondsFromFirstReport()[i]).totalDays();
     }
     return value;
   }
 
   /// time in seconds from end of the first reporting interval
   std::vector<long> TimeSeries_Impl::secondsFromFirstReport() const {
-    return m_secondsFromFirstReport;
+    return m_axis->secondsFromFirstReport();
   }
 
   /// time in seconds from end of the first reporting interval at index i
   long TimeSeries_Impl::secondsFromFirstReport(const unsigned& i) const {
     //double value = m_outOfRangeValue; // JWD: Shouldn't the out of range value be for values only?
     long value = 0;
-    if (i < m_secondsFromFirstReport.size()) {
-      value = m_secondsFromFirstReport[i];
+    if (i < m_axis->secondsFromFirstReport().size()) {
+      value = m_axis->secondsFromFirstReport()[i];
     }
     return value;
   }
@@ -530,12 +581,13 @@ namespace detail {
   double TimeSeries_Impl::valueAtSecondsFromFirstReport(long secondsFromFirstReport) const {
     double result = m_outOfRangeValue;
 
-    if (m_secondsFromFirstReport.empty()) {
+    const std::vector<long>& secondsFromFirstReports = m_axis->secondsFromFirstReport();
+    if (secondsFromFirstReports.empty()) {
       LOG(Debug, "Cannot compute value because timeseries is empty");
       return result;
     }
 
-    long duration = m_secondsFromFirstReport.back();
+    long duration = secondsFromFirstReports.back();
 
     if (m_intervalLength) {
 
@@ -581,8 +633,12 @@ namespace detail {
         LOG(Debug,
             "Cannot compute value " << secondsFromFirstReport << " seconds after first reporting time when duration is " << duration << " seconds");
       } else {
-        // normal interpolation
-        result = interp(m_secondsFromFirstReportAsVector, m_values, secondsFromFirstReport, HoldNextInterp, NoneExtrap);
+        // hold next value, as interp with HoldNextInterp, constant time if reports are evenly spaced
+        if (m_values.size() == secondsFromFirstReports.size()) {
+          result = m_values(m_axis->nextReportIndex(secondsFromFirstReport));
+        } else {
+          result = 0.0;
+        }
       }
     }
 
@@ -687,12 +743,13 @@ namespace detail {
     double endSecondsFromFirstReport = (endDateTimeWithYear - firstReportDateTimeWithYear).totalSeconds();
 
     unsigned numValues = m_values.size();
-    OS_ASSERT(numValues == m_secondsFromFirstReport.size());
+    const std::vector<long>& secondsFromFirstReport = m_axis->secondsFromFirstReport();
+    OS_ASSERT(numValues == secondsFromFirstReport.size());
 
     Vector result(numValues);
     unsigned resultSize = 0;
     for (unsigned i = 0; i < numValues; ++i) {
-      if ((m_secondsFromFirstReport[i] >= startSecondsFromFirstReport) && (m_secondsFromFirstReport[i] <= endSecondsFromFirstReport)) {
+      if ((secondsFromFirstReport[i] >= startSecondsFromFirstReport) && (secondsFromFirstReport[i] <= endSecondsFromFirstReport)) {
         result[resultSize] = m_values[i];
         ++resultSize;
       }
@@ -722,7 +779,13 @@ namespace detail {
     std::shared_ptr<TimeSeries_Impl> result(new TimeSeries_Impl());
 
     // if same units
-    if (m_units == other.units()) {
+    if (m_units == other.units() && isAligned(other)) {
+
+      // same report times, values can be added index by index
+      Vector values = m_values + other.m_values;
+      result = std::shared_ptr<TimeSeries_Impl>(new TimeSeries_Impl(*this, values, m_units));
+
+    } else if (m_units == other.units()) {
 
       // make unique, ordered set of all date times
       std::set<DateTime> dateTimesSet;
@@ -760,7 +823,13 @@ namespace detail {
     std::shared_ptr<TimeSeries_Impl> result(new TimeSeries_Impl());
 
     // if same units
-    if (m_units == other.units()) {
+    if (m_units == other.units() && isAligned(other)) {
+
+      // same report times, values can be subtracted index by index
+      Vector values = m_values - other.m_values;
+      result = std::shared_ptr<TimeSeries_Impl>(new TimeSeries_Impl(*this, values, m_units));
+
+    } else if (m_units == other.units()) {
 
       // make unique, ordered set of all date times
       std::set<DateTime> dateTimesSet;
@@ -794,10 +863,14 @@ namespace detail {
   }
 
   std::shared_ptr<TimeSeries_Impl> TimeSeries_Impl::operator*(double d) const {
+    if (m_values.size() == m_axis->secondsFromFirstReport().size()) {
+      // same report times, no need to rebuild the time axis
+      return std::shared_ptr<TimeSeries_Impl>(new TimeSeries_Impl(*this, m_values * d, m_units));
+    }
     if (m_intervalLength) {
       return std::shared_ptr<TimeSeries_Impl>(new TimeSeries_Impl(m_firstReportDateTime, m_intervalLength.get(), m_values * d, m_units));
     }
-    return std::shared_ptr<TimeSeries_Impl>(new TimeSeries_Impl(m_firstReportDateTime, m_secondsFromFirstReport, m_values * d, m_units));
+    return std::shared_ptr<TimeSeries_Impl>(new TimeSeries_Impl(m_firstReportDateTime, m_axis->secondsFromFirstReport(), m_values * d, m_units));
   }
 
   double TimeSeries_Impl::integrate() const {
@@ -809,23 +882,172 @@ namespace detail {
         result += secs * m_values[i];
       }
     } else {
+      const std::vector<long>& secondsFromFirstReport = m_axis->secondsFromFirstReport();
       double lastTime = 0;
       // Use a Riemann sum to integrate under the curve
       for (unsigned i = 0; i < m_values.size(); i++) {
-        result += (m_secondsFromStart[i] - lastTime) * m_values[i];
-        lastTime = m_secondsFromStart[i];
+        long secondsFromStart = m_firstIntervalSeconds + secondsFromFirstReport[i];
+        result += (secondsFromStart - lastTime) * m_values[i];
+        lastTime = secondsFromStart;
       }
     }
     return result;
   }
 
   double TimeSeries_Impl::averageValue() const {
-    if (m_secondsFromStart.size() > 0) {
-      return integrate() / m_secondsFromStart.back();
+    if (!m_axis->secondsFromFirstReport().empty()) {
+      return integrate() / (m_firstIntervalSeconds + m_axis->secondsFromFirstReport().back());
     }
     return 0;
   }
 
+  std::shared_ptr<TimeSeries_Impl> TimeSeries_Impl::dailySums() const {
+    const std::vector<long>& secondsFromFirstReport = m_axis->secondsFromFirstReport();
+    if (secondsFromFirstReport.empty() || (m_values.size() != secondsFromFirstReport.size())) {
+      return std::shared_ptr<TimeSeries_Impl>(new TimeSeries_Impl());
+    }
+
+    const long secondsPerDay = 24 * 60 * 60;
+
+    // seconds from first report to the end of the day it is reported in, a report at midnight ends its day
+    long firstReportTimeOfDay = m_firstReportDateTime.time().totalSeconds();
+    long firstDayEnd = (firstReportTimeOfDay == 0) ? 0 : secondsPerDay - firstReportTimeOfDay;
+
+    auto dayIndex = [firstDayEnd, secondsPerDay](long seconds) -> unsigned {
+      if (seconds <= firstDayEnd) {
+        return 0;
+      }
+      return static_cast<unsigned>((seconds - firstDayEnd + secondsPerDay - 1) / secondsPerDay);
+    };
+
+    Vector values(dayIndex(secondsFromFirstReport.back()) + 1, 0.0);
+    for (unsigned i = 0; i < m_values.size(); ++i) {
+      values[dayIndex(secondsFromFirstReport[i])] += m_values[i];
+    }
+
+    return std::shared_ptr<TimeSeries_Impl>(
+      new TimeSeries_Impl(m_firstReportDateTime + Time(0, 0, 0, firstDayEnd), Time(1.0), values, m_units));
+  }
+
+  std::shared_ptr<TimeSeries_Impl> TimeSeries_Impl::monthlySums() const {
+    const std::vector<long>& secondsFromFirstReport = m_axis->secondsFromFirstReport();
+    if (secondsFromFirstReport.empty() || (m_values.size() != secondsFromFirstReport.size())) {
+      return std::shared_ptr<TimeSeries_Impl>(new TimeSeries_Impl());
+    }
+
+    // If our timeseries doesn't have a year, we force it to the assumed one so months have the right length
+    DateTime firstReportDateTimeWithYear = m_firstReportDateTime;
+    if (!m_firstReportDateTime.date().baseYear()) {
+      firstReportDateTimeWithYear =
+        DateTime(Date(m_firstReportDateTime.date().monthOfYear(), m_firstReportDateTime.date().dayOfMonth(), m_firstReportDateTime.date().year()),
+                 m_firstReportDateTime.time());
+    }
+
+    auto nextMonthStart = [](const DateTime& monthStart) {
+      unsigned monthNumber = month(monthStart.date().monthOfYear());
+      int year = monthStart.date().year();
+      if (monthNumber == 12) {
+        return DateTime(Date(MonthOfYear::Jan, 1, year + 1));
+      }
+      return DateTime(Date(monthOfYear(monthNumber + 1), 1, year));
+    };
+
+    // a report at midnight on the first of a month ends the previous month
+    Date firstMonthDate = (firstReportDateTimeWithYear - Time(0, 0, 0, 1)).date();
+    DateTime monthStart(Date(firstMonthDate.monthOfYear(), 1, firstMonthDate.year()));
+    long firstMonthStart = (monthStart - firstReportDateTimeWithYear).totalSeconds();
+
+    DateTime monthEnd = nextMonthStart(monthStart);
+    std::vector<long> monthEnds(1, (monthEnd - firstReportDateTimeWithYear).totalSeconds());
+    std::vector<double> values(1, 0.0);
+    for (unsigned i = 0; i < m_values.size(); ++i) {
+      while (secondsFromFirstReport[i] > monthEnds.back()) {
+        monthEnd = nextMonthStart(monthEnd);
+        monthEnds.push_back((monthEnd - firstReportDateTimeWithYear).totalSeconds());
+        values.push_back(0.0);
+      }
+      values.back() += m_values[i];
+    }
+
+    // seconds from the start of the first month to the end of each month
+    std::vector<long> timeInSeconds(monthEnds.size());
+    for (unsigned i = 0; i < monthEnds.size(); ++i) {
+      timeInSeconds[i] = monthEnds[i] - firstMonthStart;
+    }
+
+    return std::shared_ptr<TimeSeries_Impl>(
+      new TimeSeries_Impl(m_firstReportDateTime + Time(0, 0, 0, monthEnds.front()), timeInSeconds, createVector(values), m_units));
+  }
+
+  boost::optional<std::pair<DateTime, double>> TimeSeries_Impl::peak() const {
+    const std::vector<long>& secondsFromFirstReport = m_axis->secondsFromFirstReport();
+    if (m_values.empty() || (m_values.size() != secondsFromFirstReport.size())) {
+      return boost::none;
+    }
+
+    unsigned peakIndex = 0;
+    for (unsigned i = 1; i < m_values.size(); ++i) {
+      if (m_values[i] > m_values[peakIndex]) {
+        peakIndex = i;
+      }
+    }
+
+    return std::make_pair(m_firstReportDateTime + Time(0, 0, 0, secondsFromFirstReport[peakIndex]), m_values[peakIndex]);
+  }
+
+  std::shared_ptr<const TimeSeriesAxis> TimeSeries_Impl::axis() const {
+    return m_axis;
+  }
+
+  bool TimeSeries_Impl::isAligned(const TimeSeries_Impl& other) const {
+    return (m_axis == other.m_axis) && (m_firstIntervalSeconds == other.m_firstIntervalSeconds)
+           && (m_firstReportDateTime == other.m_firstReportDateTime) && (m_values.size() == m_axis->secondsFromFirstReport().size())
+           && (other.m_values.size() == m_values.size());
+  }
+
+  std::shared_ptr<TimeSeries_Impl> TimeSeries_Impl::alignedSum(const std::vector<std::shared_ptr<TimeSeries_Impl>>& series,
+                                                               const std::vector<double>& weights) {
+    OS_ASSERT(weights.empty() || (weights.size() == series.size()));
+    if (series.empty()) {
+      return nullptr;
+    }
+
+    const TimeSeries_Impl& first = *series.front();
+    for (const auto& impl : series) {
+      if ((impl->m_units != first.m_units) || !first.isAligned(*impl)) {
+        return nullptr;
+      }
+    }
+
+    unsigned numValues = first.m_values.size();
+    Vector values(numValues, 0.0);
+    if (numValues == 0) {
+      return std::shared_ptr<TimeSeries_Impl>(new TimeSeries_Impl(first, values, first.m_units));
+    }
+
+    // accumulate block by block so the partial sums stay in cache while every series is added to them
+    const unsigned blockSize = 1024;
+    double* result = &values[0];
+    for (unsigned blockBegin = 0; blockBegin < numValues; blockBegin += blockSize) {
+      unsigned blockEnd = std::min(numValues, blockBegin + blockSize);
+      for (unsigned j = 0; j < series.size(); ++j) {
+        const double* seriesValues = &series[j]->m_values[0];
+        double weight = weights.empty() ? 1.0 : weights[j];
+        if (j == 0) {
+          for (unsigned i = blockBegin; i < blockEnd; ++i) {
+            result[i] = weight * seriesValues[i];
+          }
+        } else {
+          for (unsigned i = blockBegin; i < blockEnd; ++i) {
+            result[i] += weight * seriesValues[i];
+          }
+        }
+      }
+    }
+
+    return std::shared_ptr<TimeSeries_Impl>(new TimeSeries_Impl(first, values, first.m_units));
+  }
+
 }  // namespace detail
 
 TimeSeries::TimeSeries() : m_impl(std::shared_ptr<detail::TimeSeries_Impl>(new detail::TimeSeries_Impl())) {}
@@ -941,6 +1163,18 @@ double TimeSeries::averageValue() const {
   return m_impl->averageValue();
 }
 
+TimeSeries TimeSeries::dailySums() const {
+  return TimeSeries(m_impl->dailySums());
+}
+
+TimeSeries TimeSeries::monthlySums() const {
+  return TimeSeries(m_impl->monthlySums());
+}
+
+boost::optional<std::pair<DateTime, double>> TimeSeries::peak() const {
+  return m_impl->peak();
+}
+
 TimeSeries::TimeSeries(std::shared_ptr<detail::TimeSeries_Impl> impl) : m_impl(impl) {}
 
 TimeSeries operator*(double d, const TimeSeries& series) {
@@ -948,6 +1182,17 @@ TimeSeries operator*(double d, const TimeSeries& series) {
 }
 
 TimeSeries sum(const std::vector<TimeSeries>& timeSeriesVector) {
+  if (timeSeriesVector.size() > 1) {
+    std::vector<std::shared_ptr<detail::TimeSeries_Impl>> impls;
+    impls.reserve(timeSeriesVector.size());
+    for (const TimeSeries& ts : timeSeriesVector) {
+      impls.push_back(ts.m_impl);
+    }
+    if (std::shared_ptr<detail::TimeSeries_Impl> impl = detail::TimeSeries_Impl::alignedSum(impls, std::vector<double>())) {
+      return TimeSeries(impl);
+    }
+  }
+
   TimeSeries result;
   bool first = true;
   for (const TimeSeries& ts : timeSeriesVector) {
@@ -967,6 +1212,37 @@ TimeSeries sum(const std::vector<TimeSeries>& timeSeriesVector) {
   return result;
 }
 
+TimeSeries weightedSum(const std::vector<TimeSeries>& timeSeriesVector, const std::vector<double>& weights) {
+  if (weights.size() != timeSeriesVector.size()) {
+    LOG_FREE_AND_THROW("utilities.TimeSeries",
+                       "Number of weights (" << weights.size() << ") must match number of time series (" << timeSeriesVector.size() << ")");
+  }
+
+  if (timeSeriesVector.empty()) {
+    return TimeSeries();
+  }
+
+  std::vector<std::shared_ptr<detail::TimeSeries_Impl>> impls;
+  impls.reserve(timeSeriesVector.size());
+  for (const TimeSeries& ts : timeSeriesVector) {
+    impls.push_back(ts.m_impl);
+  }
+  if (std::shared_ptr<detail::TimeSeries_Impl> impl = detail::TimeSeries_Impl::alignedSum(impls, weights)) {
+    return TimeSeries(impl);
+  }
+
+  // series at different report times, combine them one at a time
+  TimeSeries result = timeSeriesVector.front() * weights.front();
+  for (unsigned i = 1; i < timeSeriesVector.size(); ++i) {
+    result = result + timeSeriesVector[i] * weights[i];
+    if (result.values().empty()) {
+      LOG_FREE(Info, "utilities.TimeSeries", "Could not sum the timeSeriesVector, the units are incompatible.");
+      break;
+    }
+  }
+  return result;
+}
+
 boost::function1<TimeSeries, const std::vector<TimeSeries>&> sumTimeSeriesFunctor() {
   typedef TimeSeries (*functype)(const std::vector<TimeSeries>&);
   return std::function<TimeSeries(const std::vector<TimeSeries>&)>(functype(&sum));
@@ -40,12 +40,42 @@
 #include <boost/optional.hpp>
 #include <boost/function.hpp>
 
+#include <memory>
+#include <utility>
 #include <vector>
 
 namespace openstudio {
 
 namespace detail {
 
+  /** TimeSeriesAxis is the immutable list of report times, in seconds from the first report, of a TimeSeries.
+   *  Axes are interned: TimeSeries_Impl objects built with the same report times, e.g. all series read
+   *  from one SqlFile environment period, share a single TimeSeriesAxis instead of each holding a copy. */
+  class UTILITIES_API TimeSeriesAxis
+  {
+   public:
+    /// returns the shared axis with these report times, creating it if no live series uses it
+    static std::shared_ptr<const TimeSeriesAxis> intern(std::vector<long> secondsFromFirstReport);
+
+    /// number of distinct axes currently shared by live series
+    static unsigned numInterned();
+
+    const std::vector<long>& secondsFromFirstReport() const;
+
+    /// spacing between consecutive reports if it is constant and positive
+    boost::optional<long> step() const;
+
+    /** index of the first report at or after secondsFromFirstReport, which must be in [0, duration].
+     *  Constant time if the reports are evenly spaced, binary search otherwise. */
+    unsigned nextReportIndex(long secondsFromFirstReport) const;
+
+   private:
+    explicit TimeSeriesAxis(std::vector<long> secondsFromFirstReport);
+
+    std::vector<long> m_secondsFromFirstReport;
+    boost::optional<long> m_step;
+  };
+
   class UTILITIES_API TimeSeries_Impl
   {
    public:
@@ -64,6 +94,9 @@ namespace detail {
 
     TimeSeries_Impl(const DateTime& firstReportDateTime, const std::vector<long>& timeInSeconds, const Vector& values, const std::string& units);
 
+    /// series reported at the same date and times as other, values must have one entry per report of other
+    TimeSeries_Impl(const TimeSeries_Impl& other, const Vector& values, const std::string& units);
+
     ~TimeSeries_Impl() {}
 
     openstudio::OptionalTime intervalLength() const;
@@ -110,18 +143,41 @@ namespace detail {
 
     double averageValue() const;
 
+    std::shared_ptr<TimeSeries_Impl> dailySums() const;
+
+    std::shared_ptr<TimeSeries_Impl> monthlySums() const;
+
+    boost::optional<std::pair<DateTime, double>> peak() const;
+
+    /// the shared time axis of this series
+    std::shared_ptr<const TimeSeriesAxis> axis() const;
+
+    /// true if other is reported at the same date and times as this, so values can be combined index by index
+    bool isAligned(const TimeSeries_Impl& other) const;
+
+    /** sum of weights[i] * series[i], computed in one pass over the values if all series are aligned and
+     *  have the same units, otherwise returns nullptr. weights may be empty to sum the series as they are. */
+    static std::shared_ptr<TimeSeries_Impl> alignedSum(const std::vector<std::shared_ptr<TimeSeries_Impl>>& series,
+                                                       const std::vector<double>& weights);
+
    private:
     REGISTER_LOGGER("utilities.TimeSeries_Impl");
+
+    // sets m_wrapAround for series whose first report date has no year, from the duration of the series
+    void checkWrapAround();
+
     // fully qualified first report date
     DateTime m_firstReportDateTime;
 
     // start date and time of time series
     DateTime m_startDateTime;
 
-    // integer seconds from first report date time, used for quick interpolation
-    std::vector<long> m_secondsFromFirstReport;
-    Vector m_secondsFromFirstReportAsVector;  // same as m_secondsFromFirstReport but stored as Vector
-    std::vector<long> m_secondsFromStart;
+    // integer seconds from first report date time, shared with other series reported at the same times
+    std::shared_ptr<const TimeSeriesAxis> m_axis;
+
+    // seconds from start date and time to first report date time, seconds from start of report i are
+    // m_firstIntervalSeconds + seconds from first report of report i
+    long m_firstIntervalSeconds;
 
     // values reported at m_dateTimes
     Vector m_values;
@@ -298,9 +354,25 @@ class UTILITIES_API TimeSeries
   /** Compute the time series average value */
   double averageValue() const;
 
+  /** Sum of the values reported in each day, reported at the end of the day. Each day ends at midnight,
+   *  so a value reported at 24:00 counts toward the day that ends then. */
+  TimeSeries dailySums() const;
+
+  /** Sum of the values reported in each month, reported at the end of the month. As for dailySums, a value
+   *  reported at 24:00 on the last day of a month counts toward that month. */
+  TimeSeries monthlySums() const;
+
+  /** Largest value and the date and time it was reported at, the first one if it is reported more than once.
+   *  Returns none if the series is empty. */
+  boost::optional<std::pair<DateTime, double>> peak() const;
+
   //@}
  private:
   REGISTER_LOGGER("utilities.TimeSeries");
+
+  friend UTILITIES_API TimeSeries sum(const std::vector<TimeSeries>& timeSeriesVector);
+  friend UTILITIES_API TimeSeries weightedSum(const std::vector<TimeSeries>& timeSeriesVector, const std::vector<double>& weights);
+
   // constructor from impl
   TimeSeries(std::shared_ptr<detail::TimeSeries_Impl> impl);
 
@@ -324,6 +396,11 @@ UTILITIES_API TimeSeries operator*(double d, const TimeSeries& series);
 // Helper function to add up all the TimeSeries in timeSeriesVector.
 UTILITIES_API TimeSeries sum(const std::vector<TimeSeries>& timeSeriesVector);
 
+/** Adds up weights[i] * timeSeriesVector[i]. Series reported at the same date and times, such as all series of one
+ *  SqlFile environment period and reporting frequency, are combined in a single pass without intermediate series.
+ *  An exception is thrown if weights and timeSeriesVector differ in size. */
+UTILITIES_API TimeSeries weightedSum(const std::vector<TimeSeries>& timeSeriesVector, const std::vector<double>& weights);
+
 /** Returns std::function pointer to sum(const std::vector<TimeSeries>&). */
 UTILITIES_API boost::function1<TimeSeries, const std::vector<TimeSeries>&> sumTimeSeriesFunctor();
 
@@ -11,6 +11,9 @@
 
 %ignore openstudio::detail;
 
+// no wrapper for boost::optional<std::pair<DateTime, double>>
+%ignore openstudio::TimeSeries::peak;
+
 %template(TimeSeriesPtr) std::shared_ptr<openstudio::TimeSeries>;
 
 // create an instantiation of the optional class
@@ -37,6 +37,13 @@
 
 #include <fmt/format.h>
 
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <string_view>
+
 namespace openstudio {
 
 static double psat(double T) {
@@ -628,65 +635,7 @@ boost::optional<EpwDataPoint> EpwDataPoint::fromEpwStrings(const std::vector<std
 
 boost::optional<EpwDataPoint> EpwDataPoint::fromEpwStrings(int year, int month, int day, int hour, int minute, const std::vector<std::string>& list,
                                                            bool pedantic) {
-  EpwDataPoint pt;
-  // Expect 30 items in the list
-  if (list.size() < 35) {
-    if (pedantic) {
-      LOG_FREE(Error, "openstudio.EpwFile", "Expected 35 fields in EPW data instead of the " << list.size() << " received");
-      return boost::none;
-    } else {
-      LOG_FREE(Warn, "openstudio.EpwFile",
-               "Expected 35 fields in EPW data instead of the " << list.size() << " received. The remaining fields will not be available");
-    }
-  } else if (list.size() > 35) {
-    LOG_FREE(Warn, "openstudio.EpwFile",
-             "Expected 35 fields in EPW data instead of the " << list.size() << " received. The additional data will be ignored");
-  }
-  // Use the appropriate setter on each field
-  pt.setYear(year);
-  if (!pt.setMonth(month)) {
-    return boost::none;
-  }
-  if (!pt.setDay(day)) {
-    return boost::none;
-  }
-  if (!pt.setHour(hour)) {
-    return boost::none;
-  }
-  if (!pt.setMinute(minute)) {
-    return boost::none;
-  }
-  pt.setDataSourceandUncertaintyFlags(list[EpwDataField::DataSourceandUncertaintyFlags]);
-  pt.setDryBulbTemperature(list[EpwDataField::DryBulbTemperature]);
-  pt.setDewPointTemperature(list[EpwDataField::DewPointTemperature]);
-  pt.setRelativeHumidity(list[EpwDataField::RelativeHumidity]);
-  pt.setAtmosphericStationPressure(list[EpwDataField::AtmosphericStationPressure]);
-  pt.setExtraterrestrialHorizontalRadiation(list[EpwDataField::ExtraterrestrialHorizontalRadiation]);
-  pt.setExtraterrestrialDirectNormalRadiation(list[EpwDataField::ExtraterrestrialDirectNormalRadiation]);
-  pt.setHorizontalInfraredRadiationIntensity(list[EpwDataField::HorizontalInfraredRadiationIntensity]);
-  pt.setGlobalHorizontalRadiation(list[EpwDataField::GlobalHorizontalRadiation]);
-  pt.setDirectNormalRadiation(list[EpwDataField::DirectNormalRadiation]);
-  pt.setDiffuseHorizontalRadiation(list[EpwDataField::DiffuseHorizontalRadiation]);
-  pt.setGlobalHorizontalIlluminance(list[EpwDataField::GlobalHorizontalIlluminance]);
-  pt.setDirectNormalIlluminance(list[EpwDataField::DirectNormalIlluminance]);
-  pt.setDiffuseHorizontalIlluminance(list[EpwDataField::DiffuseHorizontalIlluminance]);
-  pt.setZenithLuminance(list[EpwDataField::ZenithLuminance]);
-  pt.setWindDirection(list[EpwDataField::WindDirection]);
-  pt.setWindSpeed(list[EpwDataField::WindSpeed]);
-  pt.setTotalSkyCover(list[EpwDataField::TotalSkyCover]);
-  pt.setOpaqueSkyCover(list[EpwDataField::OpaqueSkyCover]);
-  pt.setVisibility(list[EpwDataField::Visibility]);
-  pt.setCeilingHeight(list[EpwDataField::CeilingHeight]);
-  pt.setPresentWeatherObservation(list[EpwDataField::PresentWeatherObservation]);
-  pt.setPresentWeatherCodes(list[EpwDataField::PresentWeatherCodes]);
-  pt.setPrecipitableWater(list[EpwDataField::PrecipitableWater]);
-  pt.setAerosolOpticalDepth(list[EpwDataField::AerosolOpticalDepth]);
-  pt.setSnowDepth(list[EpwDataField::SnowDepth]);
-  pt.setDaysSinceLastSnowfall(list[EpwDataField::DaysSinceLastSnowfall]);
-  pt.setAlbedo(list[EpwDataField::Albedo]);
-  pt.setLiquidPrecipitationDepth(list[EpwDataField::LiquidPrecipitationDepth]);
-  pt.setLiquidPrecipitationQuantity(list[EpwDataField::LiquidPrecipitationQuantity]);
-  return boost::optional<EpwDataPoint>(pt);
+  return fromEpwStrings(year, month, day, hour, minute, list, pedantic, true);
 }
 
 boost::optional<EpwDesignCondition> EpwDesignCondition::fromDesignConditionsString(const std::string& line) {
@@ -1585,6 +1534,243 @@ static double stringToDouble(const std::string& string, bool* ok) {
   return value;
 }
 
+// Returns str if it converts to a double (a non-negative one if nonNegative is true), missing otherwise
+static std::string checkedField(const std::string& str, const std::string& missing, bool nonNegative) {
+  bool ok;
+  double value = stringToDouble(str, &ok);
+  if (!ok || (nonNegative && 0 > value)) {
+    return missing;
+  }
+  return str;
+}
+
+boost::optional<EpwDataPoint> EpwDataPoint::fromEpwStrings(int year, int month, int day, int hour, int minute, const std::vector<std::string>& list,
+                                                           bool pedantic, bool logWarnings) {
+  EpwDataPoint pt;
+  // Expect 30 items in the list
+  if (list.size() < 35) {
+    if (pedantic) {
+      LOG_FREE(Error, "openstudio.EpwFile", "Expected 35 fields in EPW data instead of the " << list.size() << " received");
+      return boost::none;
+    } else {
+      LOG_FREE(Warn, "openstudio.EpwFile",
+               "Expected 35 fields in EPW data instead of the " << list.size() << " received. The remaining fields will not be available");
+    }
+  } else if (list.size() > 35 && logWarnings) {
+    LOG_FREE(Warn, "openstudio.EpwFile",
+             "Expected 35 fields in EPW data instead of the " << list.size() << " received. The additional data will be ignored");
+  }
+  // Use the appropriate setter on each field
+  pt.setYear(year);
+  if (!pt.setMonth(month)) {
+    return boost::none;
+  }
+  if (!pt.setDay(day)) {
+    return boost::none;
+  }
+  if (!pt.setHour(hour)) {
+    return boost::none;
+  }
+  if (!pt.setMinute(minute)) {
+    return boost::none;
+  }
+  pt.setDataSourceandUncertaintyFlags(list[EpwDataField::DataSourceandUncertaintyFlags]);
+  if (logWarnings) {
+    pt.setDryBulbTemperature(list[EpwDataField::DryBulbTemperature]);
+    pt.setDewPointTemperature(list[EpwDataField::DewPointTemperature]);
+    pt.setRelativeHumidity(list[EpwDataField::RelativeHumidity]);
+    pt.setAtmosphericStationPressure(list[EpwDataField::AtmosphericStationPressure]);
+    pt.setWindSpeed(list[EpwDataField::WindSpeed]);
+  } else {
+    // Store these the way their setters do, minus the range warnings
+    pt.m_dryBulbTemperature = checkedField(list[EpwDataField::DryBulbTemperature], "99.9", false);
+    pt.m_dewPointTemperature = checkedField(list[EpwDataField::DewPointTemperature], "99.9", false);
+    pt.m_relativeHumidity = checkedField(list[EpwDataField::RelativeHumidity], "999", true);
+    pt.m_atmosphericStationPressure = checkedField(list[EpwDataField::AtmosphericStationPressure], "999999", false);
+    bool ok;
+    double windSpeed = stringToDouble(list[EpwDataField::WindSpeed], &ok);
+    pt.m_windSpeed = (!ok || 0 > windSpeed) ? "999" : std::to_string(windSpeed);
+  }
+  pt.setExtraterrestrialHorizontalRadiation(list[EpwDataField::ExtraterrestrialHorizontalRadiation]);
+  pt.setExtraterrestrialDirectNormalRadiation(list[EpwDataField::ExtraterrestrialDirectNormalRadiation]);
+  pt.setHorizontalInfraredRadiationIntensity(list[EpwDataField::HorizontalInfraredRadiationIntensity]);
+  pt.setGlobalHorizontalRadiation(list[EpwDataField::GlobalHorizontalRadiation]);
+  pt.setDirectNormalRadiation(list[EpwDataField::DirectNormalRadiation]);
+  pt.setDiffuseHorizontalRadiation(list[EpwDataField::DiffuseHorizontalRadiation]);
+  pt.setGlobalHorizontalIlluminance(list[EpwDataField::GlobalHorizontalIlluminance]);
+  pt.setDirectNormalIlluminance(list[EpwDataField::DirectNormalIlluminance]);
+  pt.setDiffuseHorizontalIlluminance(list[EpwDataField::DiffuseHorizontalIlluminance]);
+  pt.setZenithLuminance(list[EpwDataField::ZenithLuminance]);
+  pt.setWindDirection(list[EpwDataField::WindDirection]);
+  pt.setTotalSkyCover(list[EpwDataField::TotalSkyCover]);
+  pt.setOpaqueSkyCover(list[EpwDataField::OpaqueSkyCover]);
+  pt.setVisibility(list[EpwDataField::Visibility]);
+  pt.setCeilingHeight(list[EpwDataField::CeilingHeight]);
+  pt.setPresentWeatherObservation(list[EpwDataField::PresentWeatherObservation]);
+  pt.setPresentWeatherCodes(list[EpwDataField::PresentWeatherCodes]);
+  pt.setPrecipitableWater(list[EpwDataField::PrecipitableWater]);
+  pt.setAerosolOpticalDepth(list[EpwDataField::AerosolOpticalDepth]);
+  pt.setSnowDepth(list[EpwDataField::SnowDepth]);
+  pt.setDaysSinceLastSnowfall(list[EpwDataField::DaysSinceLastSnowfall]);
+  pt.setAlbedo(list[EpwDataField::Albedo]);
+  pt.setLiquidPrecipitationDepth(list[EpwDataField::LiquidPrecipitationDepth]);
+  pt.setLiquidPrecipitationQuantity(list[EpwDataField::LiquidPrecipitationQuantity]);
+  return boost::optional<EpwDataPoint>(pt);
+}
+
+// Convert a field of a data line the same way stringToDouble does, without allocating for typical field widths
+static double fieldToDouble(const char* begin, const char* end, bool* ok) {
+  char buffer[64];
+  std::string longField;
+  const char* str = buffer;
+  auto length = static_cast<std::size_t>(end - begin);
+  if (length < sizeof(buffer)) {
+    std::memcpy(buffer, begin, length);
+    buffer[length] = '\0';
+  } else {
+    longField.assign(begin, end);
+    str = longField.c_str();
+  }
+  char* parsed = nullptr;
+  errno = 0;
+  double value = std::strtod(str, &parsed);
+  *ok = (parsed != str) && (errno != ERANGE);
+  return *ok ? value : 0.0;
+}
+
+// Convert a field of a data line the same way stringToInteger does
+static int fieldToInteger(const char* begin, const char* end, bool* ok) {
+  char buffer[64];
+  std::string longField;
+  const char* str = buffer;
+  auto length = static_cast<std::size_t>(end - begin);
+  if (length < sizeof(buffer)) {
+    std::memcpy(buffer, begin, length);
+    buffer[length] = '\0';
+  } else {
+    longField.assign(begin, end);
+    str = longField.c_str();
+  }
+  char* parsed = nullptr;
+  errno = 0;
+  long value = std::strtol(str, &parsed, 10);
+  *ok = (parsed != str) && (errno != ERANGE) && (value >= std::numeric_limits<int>::min()) && (value <= std::numeric_limits<int>::max());
+  return *ok ? static_cast<int>(value) : 0;
+}
+
+// Record the start of each comma separated field of line, followed by one past the end of the line, so that field i
+// is [starts[i], starts[i + 1] - 1). The number of fields matches what splitString would return
+static void fieldStarts(const std::string& line, std::vector<std::string::size_type>& starts) {
+  starts.clear();
+  if (line.empty()) {
+    return;
+  }
+  starts.push_back(0);
+  for (std::string::size_type pos = line.find(','); pos != std::string::npos; pos = line.find(',', pos + 1)) {
+    starts.push_back(pos + 1);
+  }
+  starts.push_back(line.size() + 1);
+}
+
+// Compute the value of a numeric field the way the EpwDataPoint string setter followed by the getter would,
+// returns false if the field is missing
+static bool fieldValue(EpwDataField::domain field, const char* begin, const char* end, double* value) {
+  bool ok;
+  std::string_view token(begin, end - begin);
+  auto warn = [&]() {
+    LOG_FREE(Warn, "openstudio.EpwFile", EpwDataField::valueName(field) << " value '" << *value << "' not within the expected limits");
+  };
+  switch (field) {
+    case EpwDataField::DryBulbTemperature:
+    case EpwDataField::DewPointTemperature:
+      *value = fieldToDouble(begin, end, &ok);
+      if (!ok) {
+        return false;
+      } else if (-70 >= *value || 70 <= *value) {
+        warn();
+      }
+      return token != "99.9";
+    case EpwDataField::RelativeHumidity:
+      *value = fieldToDouble(begin, end, &ok);
+      if (!ok || 0 > *value) {
+        return false;
+      } else if (110 < *value) {
+        warn();
+      }
+      return token != "999";
+    case EpwDataField::AtmosphericStationPressure:
+      *value = fieldToDouble(begin, end, &ok);
+      if (!ok) {
+        return false;
+      } else if (31000 >= *value || 120000 <= *value) {
+        warn();
+      }
+      return token != "999999";
+    case EpwDataField::ExtraterrestrialHorizontalRadiation:
+    case EpwDataField::ExtraterrestrialDirectNormalRadiation:
+    case EpwDataField::HorizontalInfraredRadiationIntensity:
+    case EpwDataField::DirectNormalRadiation:
+    case EpwDataField::DiffuseHorizontalRadiation:
+      *value = fieldToDouble(begin, end, &ok);
+      return ok && 0 <= *value && *value != 9999 && token != "9999";
+    case EpwDataField::GlobalHorizontalRadiation:
+      // The setter stores the converted value, so the token itself is never compared to the missing value
+      *value = fieldToDouble(begin, end, &ok);
+      return ok && 0 <= *value && *value != 9999;
+    case EpwDataField::GlobalHorizontalIlluminance:
+    case EpwDataField::DirectNormalIlluminance:
+    case EpwDataField::DiffuseHorizontalIlluminance:
+      *value = fieldToDouble(begin, end, &ok);
+      return ok && 0 <= *value && 999900 >= *value;
+    case EpwDataField::ZenithLuminance:
+      *value = fieldToDouble(begin, end, &ok);
+      return ok && 0 <= *value && 9999 > *value;
+    case EpwDataField::WindDirection:
+      *value = fieldToDouble(begin, end, &ok);
+      return ok && 0 <= *value && 360 >= *value;
+    case EpwDataField::WindSpeed:
+      // The setter stores the converted value, so the token itself is never compared to the missing value
+      *value = fieldToDouble(begin, end, &ok);
+      if (!ok || 0 > *value) {
+        return false;
+      } else if (40 < *value) {
+        warn();
+      }
+      return true;
+    case EpwDataField::TotalSkyCover:
+    case EpwDataField::OpaqueSkyCover: {
+      int ivalue = fieldToInteger(begin, end, &ok);
+      *value = (!ok || 0 > ivalue || 10 < ivalue) ? 99 : ivalue;
+      return true;
+    }
+    case EpwDataField::PresentWeatherObservation:
+    case EpwDataField::PresentWeatherCodes:
+      *value = fieldToInteger(begin, end, &ok);
+      return true;
+    case EpwDataField::Visibility:
+      *value = fieldToDouble(begin, end, &ok);
+      return ok && *value != 9999 && token != "9999";
+    case EpwDataField::CeilingHeight:
+      *value = fieldToDouble(begin, end, &ok);
+      return ok && *value != 99999 && token != "99999";
+    case EpwDataField::PrecipitableWater:
+    case EpwDataField::SnowDepth:
+    case EpwDataField::Albedo:
+    case EpwDataField::LiquidPrecipitationDepth:
+      *value = fieldToDouble(begin, end, &ok);
+      return ok && *value != 999 && token != "999";
+    case EpwDataField::AerosolOpticalDepth:
+      *value = fieldToDouble(begin, end, &ok);
+      return ok && *value != 0.999 && token != ".999";
+    case EpwDataField::DaysSinceLastSnowfall:
+    case EpwDataField::LiquidPrecipitationQuantity:
+      *value = fieldToDouble(begin, end, &ok);
+      return ok && *value != 99 && token != "99";
+    default:
+      return false;
+  }
+}
+
 Date EpwDataPoint::date() const {
   return Date(MonthOfYear(m_month), m_day, m_year);
 }
@@ -2457,34 +2643,32 @@ bool EpwDataPoint::setLiquidPrecipitationQuantity(const std::string& liquidPreci
   return true;
 }
 
-boost::optional<AirState> EpwDataPoint::airState() const {
-  boost::optional<double> value = dryBulbTemperature();
-  if (!value) {
+static boost::optional<AirState> airStateFromFields(const boost::optional<double>& drybulb, const boost::optional<double>& pressure,
+                                                    const boost::optional<double>& relativeHumidity,
+                                                    const boost::optional<double>& dewPointTemperature) {
+  if (!drybulb) {
     return boost::none;  // Have to have dry bulb
   }
-  double drybulb = value.get();
 
-  value = atmosphericStationPressure();
-  if (!value) {
+  if (!pressure) {
     return boost::none;  // Have to have pressure
   }
-  double pressure = value.get();
 
-  value = relativeHumidity();
-  if (!value) {  // Don't have relative humidity
-    value = dewPointTemperature();
-    if (value) {
-      double dewpoint = value.get();
-      return AirState::fromDryBulbDewPointPressure(drybulb, dewpoint, pressure);
+  if (!relativeHumidity) {  // Don't have relative humidity
+    if (dewPointTemperature) {
+      return AirState::fromDryBulbDewPointPressure(drybulb.get(), dewPointTemperature.get(), pressure.get());
     }
   } else {  // Have relative humidity
-    double RH = value.get();
-    return AirState::fromDryBulbRelativeHumidityPressure(drybulb, RH, pressure);
+    return AirState::fromDryBulbRelativeHumidityPressure(drybulb.get(), relativeHumidity.get(), pressure.get());
   }
 
   return boost::none;
 }
 
+boost::optional<AirState> EpwDataPoint::airState() const {
+  return airStateFromFields(dryBulbTemperature(), atmosphericStationPressure(), relativeHumidity(), dewPointTemperature());
+}
+
 boost::optional<double> EpwDataPoint::saturationPressure() const {
   boost::optional<double> optdrybulb = dryBulbTemperature();
   if (optdrybulb) {
@@ -2651,7 +2835,7 @@ boost::optional<int> EpwFile::endDateActualYear() const {
 }
 
 std::vector<EpwDataPoint> EpwFile::data() {
-  if (m_data.size() == 0) {
+  if (m_dataLineEnds.empty()) {
     if (!openstudio::filesystem::exists(m_path) || !openstudio::filesystem::is_regular_file(m_path)) {
       LOG_AND_THROW("Path '" << m_path << "' is not an EPW file");
     }
@@ -2669,6 +2853,22 @@ std::vector<EpwDataPoint> EpwFile::data() {
       ifs.close();
     }
   }
+  if (m_data.size() != m_dataLineEnds.size()) {
+    // Build the data points from the stored lines, these have already been checked (and any warnings logged) by parse
+    m_data.clear();
+    m_data.reserve(m_dataLineEnds.size());
+    std::string::size_type begin = 0;
+    for (std::size_t i = 0; i < m_dataLineEnds.size(); ++i) {
+      std::vector<std::string> strings = splitString(m_dataLines.substr(begin, m_dataLineEnds[i] - begin), ',');
+      boost::optional<EpwDataPoint> pt = EpwDataPoint::fromEpwStrings(
+        static_cast<int>(m_dataColumns[EpwDataField::Year][i]), static_cast<int>(m_dataColumns[EpwDataField::Month][i]),
+        static_cast<int>(m_dataColumns[EpwDataField::Day][i]), static_cast<int>(m_dataColumns[EpwDataField::Hour][i]),
+        static_cast<int>(m_dataColumns[EpwDataField::Minute][i]), strings, true, false);
+      OS_ASSERT(pt);
+      m_data.push_back(pt.get());
+      begin = m_dataLineEnds[i];
+    }
+  }
   return m_data;
 }
 
@@ -3647,7 +3847,7 @@ std::vector<EpwDesignCondition> EpwFile::designConditions() {
 }
 
 boost::optional<TimeSeries> EpwFile::getTimeSeries(const std::string& name) {
-  if (m_data.size() == 0) {
+  if (m_dataLineEnds.empty()) {
     if (!openstudio::filesystem::exists(m_path) || !openstudio::filesystem::is_regular_file(m_path)) {
       LOG_AND_THROW("Path '" << m_path << "' is not an EPW file");
     }
@@ -3672,23 +3872,23 @@ boost::optional<TimeSeries> EpwFile::getTimeSeries(const std::string& name) {
     LOG(Warn, "Unrecognized EPW data field '" << name << "'");
     return boost::none;
   }
-  if (m_data.size() > 0) {
+  // Only the numeric fields are available, see EpwDataPoint::getField
+  if (id.value() < EpwDataField::DryBulbTemperature) {
+    return boost::none;
+  }
+  if (!m_dataLineEnds.empty()) {
     std::string units = EpwDataPoint::getUnits(id);
+    const std::vector<double>& column = m_dataColumns[id.value()];
+    const std::vector<bool>& missing = m_dataMissing[id.value()];
     DateTimeVector dates;
+    dates.reserve(column.size() + 1);
     dates.push_back(DateTime());  // Use a placeholder to avoid an insert
     std::vector<double> values;
-    for (unsigned int i = 0; i < m_data.size(); i++) {
-      DateTime dateTime = m_data[i].dateTime();
-      // Time time=m_data[i].time();
-      boost::optional<double> value = m_data[i].getField(id);
-      if (value) {
-        if (isActual()) {
-          dates.push_back(DateTime(dateTime));
-        } else {
-          // Strip year
-          dates.push_back(DateTime(Date(dateTime.date().monthOfYear(), dateTime.date().dayOfMonth()), dateTime.time()));
-        }
-        values.push_back(value.get());
+    values.reserve(column.size());
+    for (std::size_t i = 0; i < column.size(); i++) {
+      if (!missing[i]) {
+        dates.push_back(dataDateTime(i));
+        values.push_back(column[i]);
       }
     }
     if (values.size()) {
@@ -3701,7 +3901,7 @@ boost::optional<TimeSeries> EpwFile::getTimeSeries(const std::string& name) {
 }
 
 boost::optional<TimeSeries> EpwFile::getComputedTimeSeries(const std::string& name) {
-  if (m_data.size() == 0) {
+  if (m_dataLineEnds.empty()) {
     if (!openstudio::filesystem::exists(m_path) || !openstudio::filesystem::is_regular_file(m_path)) {
       LOG_AND_THROW("Path '" << m_path << "' is not an EPW file");
     }
@@ -3728,38 +3928,57 @@ boost::optional<TimeSeries> EpwFile::getComputedTimeSeries(const std::string& na
   }
 
   std::string units = EpwDataPoint::getUnits(id);
-  boost::optional<double> (EpwDataPoint::*compute)() const;
+  double (AirState::*compute)() const = nullptr;
   switch (id.value()) {
     case EpwComputedField::SaturationPressure:
-      compute = &EpwDataPoint::saturationPressure;
       break;
     case EpwComputedField::Enthalpy:
-      compute = &EpwDataPoint::enthalpy;
+      compute = &AirState::enthalpy;
       break;
     case EpwComputedField::HumidityRatio:
-      compute = &EpwDataPoint::humidityRatio;
+      compute = &AirState::humidityRatio;
       break;
     case EpwComputedField::WetBulbTemperature:
-      compute = &EpwDataPoint::wetbulb;
+      compute = &AirState::wetbulb;
       break;
     case EpwComputedField::Density:
-      compute = &EpwDataPoint::density;
+      compute = &AirState::density;
       break;
     case EpwComputedField::SpecificVolume:
-      compute = &EpwDataPoint::specificVolume;
+      compute = &AirState::specificVolume;
       break;
     default:
       return boost::none;
   }
+  auto field = [this](EpwDataField::domain dataField, std::size_t i) -> boost::optional<double> {
+    if (m_dataMissing[dataField][i]) {
+      return boost::none;
+    }
+    return m_dataColumns[dataField][i];
+  };
   DateTimeVector dates;
+  dates.reserve(m_dataLineEnds.size() + 1);
   dates.push_back(DateTime());  // Use a placeholder to avoid an insert
   std::vector<double> values;
-  for (unsigned int i = 0; i < m_data.size(); i++) {
-    Date date = m_data[i].date();
-    Time time = m_data[i].time();
-    boost::optional<double> value = (m_data[i].*compute)();
+  values.reserve(m_dataLineEnds.size());
+  for (std::size_t i = 0; i < m_dataLineEnds.size(); i++) {
+    boost::optional<double> drybulb = field(EpwDataField::DryBulbTemperature, i);
+    boost::optional<double> value;
+    if (!compute) {
+      // Same as EpwDataPoint::saturationPressure
+      if (drybulb && drybulb.get() >= -100.0 && drybulb.get() <= 200.0) {
+        value = openstudio::psat(drybulb.get());
+      }
+    } else {
+      boost::optional<AirState> state =
+        airStateFromFields(drybulb, field(EpwDataField::AtmosphericStationPressure, i), field(EpwDataField::RelativeHumidity, i),
+                           field(EpwDataField::DewPointTemperature, i));
+      if (state) {
+        value = (state.get().*compute)();
+      }
+    }
     if (value) {
-      dates.push_back(DateTime(date, time));
+      dates.push_back(dataDateTime(i));
       values.push_back(value.get());
     }
   }
@@ -3772,7 +3991,7 @@ boost::optional<TimeSeries> EpwFile::getComputedTimeSeries(const std::string& na
 }
 
 bool EpwFile::translateToWth(openstudio::path path, std::string description) {
-  if (m_data.size() == 0) {
+  if (m_dataLineEnds.empty()) {
     if (!openstudio::filesystem::exists(m_path) || !openstudio::filesystem::is_regular_file(m_path)) {
       LOG_AND_THROW("Path '" << m_path << "' is not an EPW file");
     }
@@ -3913,14 +4132,30 @@ bool EpwFile::parse(std::istream& ifs, bool storeData) {
   OS_ASSERT((60 % m_recordsPerHour) == 0);
   int minutesPerRecord = 60 / m_recordsPerHour;
   int currentMinute = 0;
+  if (storeData) {
+    m_dataColumns.assign(EpwDataField::LiquidPrecipitationQuantity + 1, std::vector<double>());
+    m_dataMissing.assign(EpwDataField::LiquidPrecipitationQuantity + 1, std::vector<bool>());
+    m_dataLines.clear();
+    m_dataLineEnds.clear();
+    m_data.clear();
+  }
+  std::vector<std::string::size_type> starts;
   while (std::getline(ifs, line)) {
     lineNumber++;
-    std::vector<std::string> strings = splitString(line, ',');
-    if (strings.size() >= 5) {
+    fieldStarts(line, starts);
+    if (starts.size() > 5) {
       try {
-        int year = std::stoi(strings[0]);
-        int month = std::stoi(strings[1]);
-        int day = std::stoi(strings[2]);
+        auto integerField = [&line, &starts](unsigned i) {
+          bool ok;
+          int value = fieldToInteger(line.data() + starts[i], line.data() + starts[i + 1] - 1, &ok);
+          if (!ok) {
+            throw std::invalid_argument("Field " + std::to_string(i) + " is not an integer");
+          }
+          return value;
+        };
+        int year = integerField(0);
+        int month = integerField(1);
+        int day = integerField(2);
 
         Date date(month, day, year);
         if (!startDate) {
@@ -3947,8 +4182,8 @@ bool EpwFile::parse(std::istream& ifs, bool storeData) {
 
         // Store the data if requested
         if (storeData) {
-          int hour = std::stoi(strings[3]);
-          int minutesInFile = std::stoi(strings[4]);
+          int hour = integerField(3);
+          int minutesInFile = integerField(4);
           // Due to issues with some EPW files, we need to check stuff here
           if (m_recordsPerHour != 1) {
             currentMinute += minutesPerRecord;
@@ -3964,10 +4199,7 @@ bool EpwFile::parse(std::istream& ifs, bool storeData) {
               m_minutesMatch = false;
             }
           }
-          boost::optional<EpwDataPoint> pt = EpwDataPoint::fromEpwStrings(year, month, day, hour, currentMinute, strings);
-          if (pt) {
-            m_data.push_back(pt.get());
-          } else {
+          if (!parseDataRow(year, month, day, hour, currentMinute, line, starts)) {
             LOG(Error, "Failed to parse line " << lineNumber << " of EPW file '" << m_path << "'");
             return false;
           }
@@ -4030,6 +4262,61 @@ bool EpwFile::parse(std::istream& ifs, bool storeData) {
   return result;
 }
 
+DateTime EpwFile::dataDateTime(std::size_t row) const {
+  MonthOfYear monthOfYear(static_cast<int>(m_dataColumns[EpwDataField::Month][row]));
+  auto dayOfMonth = static_cast<unsigned>(m_dataColumns[EpwDataField::Day][row]);
+  Time time(0, static_cast<int>(m_dataColumns[EpwDataField::Hour][row]), static_cast<int>(m_dataColumns[EpwDataField::Minute][row]));
+  if (isActual()) {
+    return DateTime(Date(monthOfYear, dayOfMonth, static_cast<int>(m_dataColumns[EpwDataField::Year][row])), time);
+  }
+  // Strip year, typical files mix data from different years
+  return DateTime(Date(monthOfYear, dayOfMonth), time);
+}
+
+bool EpwFile::parseDataRow(int year, int month, int day, int hour, int minute, const std::string& line,
+                           const std::vector<std::string::size_type>& fieldStarts) {
+  // Same checks as EpwDataPoint::fromEpwStrings, but the values go straight into the columns
+  std::size_t numberOfFields = fieldStarts.size() - 1;
+  if (numberOfFields < 35) {
+    LOG(Error, "Expected 35 fields in EPW data instead of the " << numberOfFields << " received");
+    return false;
+  } else if (numberOfFields > 35) {
+    LOG(Warn, "Expected 35 fields in EPW data instead of the " << numberOfFields << " received. The additional data will be ignored");
+  }
+  if (1 > month || 12 < month) {
+    LOG(Error, "Month value " << month << " out of range");
+    return false;
+  }
+  if (1 > day || 31 < day) {
+    LOG(Error, "Day value " << day << " out of range");
+    return false;
+  }
+  if (1 > hour || 24 < hour) {
+    LOG(Error, "Hour value " << hour << " out of range");
+    return false;
+  }
+  if (0 > minute || 59 < minute) {
+    LOG(Error, "Minute value " << minute << " out of range");
+    return false;
+  }
+
+  m_dataColumns[EpwDataField::Year].push_back(year);
+  m_dataColumns[EpwDataField::Month].push_back(month);
+  m_dataColumns[EpwDataField::Day].push_back(day);
+  m_dataColumns[EpwDataField::Hour].push_back(hour);
+  m_dataColumns[EpwDataField::Minute].push_back(minute);
+  for (int i = EpwDataField::DryBulbTemperature; i <= EpwDataField::LiquidPrecipitationQuantity; ++i) {
+    double value = 0.0;
+    bool present = fieldValue(EpwDataField::domain(i), line.data() + fieldStarts[i], line.data() + fieldStarts[i + 1] - 1, &value);
+    m_dataColumns[i].push_back(value);
+    m_dataMissing[i].push_back(!present);
+  }
+
+  m_dataLines += line;
+  m_dataLineEnds.push_back(m_dataLines.size());
+  return true;
+}
+
 bool EpwFile::parseLocation(const std::string& line) {
   // LOCATION,Chicago Ohare Intl Ap,IL,USA,TMY3,725300,41.98,-87.92,-6.0,201.0
   // LOCATION, city, stateProvinceRegion, country, dataSource, wmoNumber, latitude, longitude, timeZone, elevation
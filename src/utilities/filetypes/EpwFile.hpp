@@ -367,6 +367,11 @@ class UTILITIES_API EpwDataPoint
   boost::optional<double> wetbulb() const;
 
  private:
+  /** As the public overload, but if logWarnings is false the field count and range warnings are not logged. Used by
+      EpwFile::data to rebuild points from lines that were already checked, and warned about, when the file was parsed */
+  static boost::optional<EpwDataPoint> fromEpwStrings(int year, int month, int day, int hour, int minute, const std::vector<std::string>& list,
+                                                      bool pedantic, bool logWarnings);
+  friend class EpwFile;
   // One billion setters
   void setDate(Date date);
   void setTime(Time time);
@@ -965,6 +970,9 @@ class UTILITIES_API EpwFile
  private:
   EpwFile();
   bool parse(std::istream& is, bool storeData = false);
+  bool parseDataRow(int year, int month, int day, int hour, int minute, const std::string& line,
+                    const std::vector<std::string::size_type>& fieldStarts);
+  openstudio::DateTime dataDateTime(std::size_t row) const;
   bool parseLocation(const std::string& line);
   bool parseDesignConditions(const std::string& line);
   bool parseDataPeriod(const std::string& line);
@@ -990,6 +998,12 @@ class UTILITIES_API EpwFile
   Date m_endDate;
   boost::optional<int> m_startDateActualYear;
   boost::optional<int> m_endDateActualYear;
+  // Weather data is stored by column, one contiguous array per EpwDataField (indexed by field value) and a bitmap of
+  // missing values. The data lines are kept in a single buffer so that data() can build the EpwDataPoints on demand
+  std::vector<std::vector<double>> m_dataColumns;
+  std::vector<std::vector<bool>> m_dataMissing;
+  std::string m_dataLines;
+  std::vector<std::string::size_type> m_dataLineEnds;
   std::vector<EpwDataPoint> m_data;
   std::vector<EpwDesignCondition> m_designs;
 
@@ -31,7 +31,13 @@
 #include "../EpwFile.hpp"
 #include "../../time/Time.hpp"
 #include "../../time/Date.hpp"
+#include "../../data/TimeSeries.hpp"
 #include "../../core/Checksum.hpp"
+#include "../../core/StringStreamLogSink.hpp"
+
+#include <algorithm>
+#include <fstream>
+#include <sstream>
 
 #include <resources.hxx>
 
@@ -575,6 +581,107 @@ TEST(Filetypes, EpwFile_NonActualTimeSeries) {
   }
 }
 
+TEST(Filetypes, EpwFile_ColumnarTimeSeries) {
+  // The time series are built from the parsed columns, check that they agree with the data points
+  std::vector<std::string> files = {"USA_CO_Golden-NREL.724666_TMY3.epw", "leapday-test.epw", "USA_CT_New.Haven-Tweed.AP.725045_TMY3.epw"};
+  for (const std::string& file : files) {
+    path p = resourcesPath() / toPath("utilities/Filetypes") / toPath(file);
+    EpwFile epwFile(p, true);
+    std::vector<EpwDataPoint> data = epwFile.data();
+    ASSERT_FALSE(data.empty());
+
+    for (int i = EpwDataField::DryBulbTemperature; i <= EpwDataField::LiquidPrecipitationQuantity; ++i) {
+      EpwDataField field(i);
+      std::vector<double> expected;
+      for (EpwDataPoint& pt : data) {
+        if (boost::optional<double> value = pt.getField(field)) {
+          expected.push_back(value.get());
+        }
+      }
+      boost::optional<TimeSeries> series = epwFile.getTimeSeries(field.valueDescription());
+      if (expected.empty()) {
+        EXPECT_FALSE(series) << file << " " << field.valueDescription();
+        continue;
+      }
+      ASSERT_TRUE(series) << file << " " << field.valueDescription();
+      Vector values = series->values();
+      ASSERT_EQ(expected.size(), values.size()) << file << " " << field.valueDescription();
+      for (unsigned j = 0; j < expected.size(); ++j) {
+        EXPECT_DOUBLE_EQ(expected[j], values[j]) << file << " " << field.valueDescription() << " " << j;
+      }
+    }
+    EXPECT_FALSE(epwFile.getTimeSeries("Year"));
+
+    std::vector<double> expectedEnthalpy;
+    std::vector<double> expectedSaturationPressure;
+    for (EpwDataPoint& pt : data) {
+      if (boost::optional<double> value = pt.enthalpy()) {
+        expectedEnthalpy.push_back(value.get());
+      }
+      if (boost::optional<double> value = pt.saturationPressure()) {
+        expectedSaturationPressure.push_back(value.get());
+      }
+    }
+    boost::optional<TimeSeries> enthalpy = epwFile.getComputedTimeSeries("Enthalpy");
+    boost::optional<TimeSeries> saturationPressure = epwFile.getComputedTimeSeries("Saturation Pressure");
+    ASSERT_TRUE(enthalpy);
+    ASSERT_TRUE(saturationPressure);
+    ASSERT_EQ(expectedEnthalpy.size(), enthalpy->values().size());
+    ASSERT_EQ(expectedSaturationPressure.size(), saturationPressure->values().size());
+    for (unsigned j = 0; j < expectedEnthalpy.size(); ++j) {
+      EXPECT_DOUBLE_EQ(expectedEnthalpy[j], enthalpy->values()[j]) << file << " " << j;
+    }
+    for (unsigned j = 0; j < expectedSaturationPressure.size(); ++j) {
+      EXPECT_DOUBLE_EQ(expectedSaturationPressure[j], saturationPressure->values()[j]) << file << " " << j;
+    }
+  }
+}
+
+TEST(Filetypes, EpwFile_DataWarnsOnce) {
+  // Out of range values are warned about when the file is parsed, building the data points should not warn again
+  path p = resourcesPath() / toPath("utilities/Filetypes/USA_CO_Golden-NREL.724666_TMY3.epw");
+  std::ifstream ifs(toSystemFilename(p));
+  std::stringstream epwText;
+  std::string line;
+  int lineNumber = 0;
+  auto replaceField = [&line](int field, const std::string& value) {
+    std::string::size_type pos = 0;
+    for (int i = 0; i < field; ++i) {
+      pos = line.find(',', pos) + 1;
+    }
+    line.replace(pos, line.find(',', pos) - pos, value);
+  };
+  while (std::getline(ifs, line)) {
+    if (++lineNumber == 9) {
+      // First data line, replace the dry bulb temperature and the wind speed with out of range values
+      replaceField(EpwDataField::DryBulbTemperature, "75.0");
+      replaceField(EpwDataField::WindSpeed, "45.0");
+    }
+    epwText << line << '\n';
+  }
+
+  StringStreamLogSink sink;
+  sink.setLogLevel(Warn);
+  boost::optional<EpwFile> epwFile = EpwFile::loadFromString(epwText.str(), true);
+  ASSERT_TRUE(epwFile);
+  auto countMessages = [&sink](const std::string& text) {
+    std::vector<LogMessage> messages = sink.logMessages();
+    return std::count_if(messages.begin(), messages.end(),
+                         [&text](const LogMessage& message) { return message.logMessage().find(text) != std::string::npos; });
+  };
+  EXPECT_EQ(1, countMessages("DryBulbTemperature"));
+  EXPECT_EQ(1, countMessages("WindSpeed"));
+
+  sink.resetStringStream();
+  std::vector<EpwDataPoint> data = epwFile->data();
+  ASSERT_EQ(8760u, data.size());
+  ASSERT_TRUE(data[0].dryBulbTemperature());
+  EXPECT_DOUBLE_EQ(75.0, data[0].dryBulbTemperature().get());
+  ASSERT_TRUE(data[0].windSpeed());
+  EXPECT_DOUBLE_EQ(45.0, data[0].windSpeed().get());
+  EXPECT_TRUE(sink.logMessages().empty());
+}
+
 TEST(Filetypes, EpwFile_International_Data) {
   try {
     path p = resourcesPath() / toPath("utilities/Filetypes/CHN_Guangdong.Shaoguan.590820_CSWD.epw");
@@ -0,0 +1,209 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2021, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#include "BoundingBoxTree.hpp"
+
+#include "Transformation.hpp"
+
+#include "../core/Assert.hpp"
+
+#include <algorithm>
+
+namespace openstudio {
+
+namespace {
+
+  // maximum number of boxes stored in a leaf
+  constexpr unsigned leafSize = 4;
+
+}  // namespace
+
+BoundingBoxTree::BoundingBoxTree(const std::vector<BoundingBox>& boxes) : m_size(boxes.size()) {
+  build(boxes);
+}
+
+BoundingBoxTree::BoundingBoxTree(const std::vector<BoundingBox>& boxes, const std::vector<Transformation>& transformations)
+  : m_size(boxes.size()) {
+  OS_ASSERT(boxes.size() == transformations.size());
+  std::vector<BoundingBox> transformed;
+  transformed.reserve(boxes.size());
+  for (unsigned i = 0; i < boxes.size(); ++i) {
+    transformed.push_back(transformations[i] * boxes[i]);
+  }
+  build(transformed);
+}
+
+unsigned BoundingBoxTree::size() const {
+  return m_size;
+}
+
+std::vector<unsigned> BoundingBoxTree::intersecting(const BoundingBox& box, double tol) const {
+  std::vector<unsigned> result;
+  if (box.isEmpty() || m_nodes.empty()) {
+    return result;
+  }
+
+  Extent extent{{box.minX().get(), box.minY().get(), box.minZ().get()}, {box.maxX().get(), box.maxY().get(), box.maxZ().get()}};
+  query(extent, tol, result);
+  std::sort(result.begin(), result.end());
+  return result;
+}
+
+std::vector<std::pair<unsigned, unsigned>> BoundingBoxTree::intersectingPairs(double tol) const {
+  std::vector<std::pair<unsigned, unsigned>> result;
+  if (m_nodes.empty()) {
+    return result;
+  }
+
+  std::vector<unsigned> candidates;
+  for (unsigned k = 0; k < m_extents.size(); ++k) {
+    candidates.clear();
+    query(m_extents[k], tol, candidates);
+    std::sort(candidates.begin(), candidates.end());
+    unsigned i = m_indices[k];
+    for (unsigned j : candidates) {
+      if (j > i) {
+        result.push_back(std::make_pair(i, j));
+      }
+    }
+  }
+  return result;
+}
+
+void BoundingBoxTree::build(const std::vector<BoundingBox>& boxes) {
+  // m_indices is ascending, so the extents of the non-empty boxes are stored in input order
+  for (unsigned i = 0; i < boxes.size(); ++i) {
+    const BoundingBox& box = boxes[i];
+    if (box.isEmpty()) {
+      continue;
+    }
+    m_extents.push_back(Extent{{box.minX().get(), box.minY().get(), box.minZ().get()}, {box.maxX().get(), box.maxY().get(), box.maxZ().get()}});
+    m_indices.push_back(i);
+  }
+
+  if (m_extents.empty()) {
+    return;
+  }
+
+  m_order.resize(m_extents.size());
+  for (unsigned k = 0; k < m_order.size(); ++k) {
+    m_order[k] = k;
+  }
+
+  // a binary tree with leaves of at least one box has fewer than 2n nodes
+  m_nodes.reserve(2 * m_extents.size());
+  buildNode(0, m_order.size());
+}
+
+unsigned BoundingBoxTree::buildNode(unsigned begin, unsigned end) {
+  unsigned nodeIndex = m_nodes.size();
+  m_nodes.push_back(Node());
+
+  Extent extent = m_extents[m_order[begin]];
+  double centerMin[3];
+  double centerMax[3];
+  for (unsigned d = 0; d < 3; ++d) {
+    centerMin[d] = centerMax[d] = 0.5 * (extent.min[d] + extent.max[d]);
+  }
+  for (unsigned k = begin + 1; k < end; ++k) {
+    const Extent& other = m_extents[m_order[k]];
+    for (unsigned d = 0; d < 3; ++d) {
+      extent.min[d] = std::min(extent.min[d], other.min[d]);
+      extent.max[d] = std::max(extent.max[d], other.max[d]);
+      double center = 0.5 * (other.min[d] + other.max[d]);
+      centerMin[d] = std::min(centerMin[d], center);
+      centerMax[d] = std::max(centerMax[d], center);
+    }
+  }
+
+  Node node;
+  node.extent = extent;
+  node.begin = begin;
+  node.end = end;
+  node.left = 0;
+  node.right = 0;
+
+  if (end - begin > leafSize) {
+    // split at the median box center along the axis where box centers are most spread out
+    unsigned axis = 0;
+    for (unsigned d = 1; d < 3; ++d) {
+      if ((centerMax[d] - centerMin[d]) > (centerMax[axis] - centerMin[axis])) {
+        axis = d;
+      }
+    }
+
+    unsigned mid = begin + (end - begin) / 2;
+    std::nth_element(m_order.begin() + begin, m_order.begin() + mid, m_order.begin() + end, [this, axis](unsigned a, unsigned b) {
+      return (m_extents[a].min[axis] + m_extents[a].max[axis]) < (m_extents[b].min[axis] + m_extents[b].max[axis]);
+    });
+
+    node.left = buildNode(begin, mid);
+    node.right = buildNode(mid, end);
+  }
+
+  m_nodes[nodeIndex] = node;
+  return nodeIndex;
+}
+
+void BoundingBoxTree::query(const Extent& extent, double tol, std::vector<unsigned>& result) const {
+  std::vector<unsigned> stack;
+  stack.push_back(0);
+  while (!stack.empty()) {
+    const Node& node = m_nodes[stack.back()];
+    stack.pop_back();
+
+    if (!overlaps(node.extent, extent, tol)) {
+      continue;
+    }
+
+    if (node.left == 0) {
+      // leaf, root is never a child so 0 is free to mean none
+      for (unsigned k = node.begin; k < node.end; ++k) {
+        if (overlaps(m_extents[m_order[k]], extent, tol)) {
+          result.push_back(m_indices[m_order[k]]);
+        }
+      }
+    } else {
+      stack.push_back(node.left);
+      stack.push_back(node.right);
+    }
+  }
+}
+
+bool BoundingBoxTree::overlaps(const Extent& a, const Extent& b, double tol) {
+  // same test as BoundingBox::intersects
+  for (unsigned d = 0; d < 3; ++d) {
+    if ((a.min[d] > b.max[d] + tol) || (b.min[d] > a.max[d] + tol)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+}  // namespace openstudio
@@ -0,0 +1,104 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2021, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#ifndef UTILITIES_GEOMETRY_BOUNDINGBOXTREE_HPP
+#define UTILITIES_GEOMETRY_BOUNDINGBOXTREE_HPP
+
+#include "../UtilitiesAPI.hpp"
+#include "BoundingBox.hpp"
+
+#include <utility>
+#include <vector>
+
+namespace openstudio {
+
+// forward declaration
+class Transformation;
+
+/** BoundingBoxTree is a static bounding volume hierarchy over a set of BoundingBoxes. It answers
+   *  "which boxes intersect this one" without testing every box, which turns all-pairs geometry
+   *  operations from O(n^2) into roughly O(n log n). Boxes are identified by their index in the
+   *  vector passed to the constructor; empty boxes are kept for indexing but never intersect anything.
+   *  As with BoundingBox, all boxes must be specified in the same coordinate system.
+   */
+class UTILITIES_API BoundingBoxTree
+{
+ public:
+  /// build the tree over boxes
+  explicit BoundingBoxTree(const std::vector<BoundingBox>& boxes);
+
+  /// build the tree over boxes, each first transformed by the corresponding transformation
+  BoundingBoxTree(const std::vector<BoundingBox>& boxes, const std::vector<Transformation>& transformations);
+
+  /// number of boxes the tree was built from, including empty ones
+  unsigned size() const;
+
+  /// indices of the boxes that intersect box, in ascending order. Default tolerance is 1cm
+  std::vector<unsigned> intersecting(const BoundingBox& box, double tol = 0.01) const;
+
+  /// all index pairs (i, j) with i < j whose boxes intersect, sorted by i then j. Default tolerance is 1cm
+  std::vector<std::pair<unsigned, unsigned>> intersectingPairs(double tol = 0.01) const;
+
+ private:
+  REGISTER_LOGGER("utilities.BoundingBoxTree");
+
+  struct Extent
+  {
+    double min[3];
+    double max[3];
+  };
+
+  // leaves reference the range [begin, end) of m_order, interior nodes have two children
+  struct Node
+  {
+    Extent extent;
+    unsigned begin;
+    unsigned end;
+    unsigned left;
+    unsigned right;
+  };
+
+  void build(const std::vector<BoundingBox>& boxes);
+
+  unsigned buildNode(unsigned begin, unsigned end);
+
+  void query(const Extent& extent, double tol, std::vector<unsigned>& result) const;
+
+  static bool overlaps(const Extent& a, const Extent& b, double tol);
+
+  unsigned m_size;
+  std::vector<Extent> m_extents;  // one per non-empty box, parallel to m_indices
+  std::vector<unsigned> m_indices;
+  std::vector<unsigned> m_order;  // permutation of m_extents, grouped by leaf
+  std::vector<Node> m_nodes;
+};
+
+}  // namespace openstudio
+
+#endif  //UTILITIES_GEOMETRY_BOUNDINGBOXTREE_HPP
@@ -0,0 +1,141 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2021, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#include <gtest/gtest.h>
+#include "GeometryFixture.hpp"
+
+#include "../BoundingBox.hpp"
+#include "../BoundingBoxTree.hpp"
+#include "../Point3d.hpp"
+#include "../Transformation.hpp"
+#include "../Vector3d.hpp"
+
+#include <random>
+
+using namespace openstudio;
+
+TEST_F(GeometryFixture, BoundingBoxTree_Empty) {
+  BoundingBoxTree emptyTree(std::vector<BoundingBox>{});
+  EXPECT_EQ(0u, emptyTree.size());
+  EXPECT_TRUE(emptyTree.intersectingPairs().empty());
+
+  BoundingBox b1;
+  b1.addPoint(Point3d(0, 0, 0));
+  b1.addPoint(Point3d(1, 1, 1));
+  EXPECT_TRUE(emptyTree.intersecting(b1).empty());
+
+  // empty boxes keep their index but never intersect
+  BoundingBoxTree tree(std::vector<BoundingBox>{BoundingBox(), b1, BoundingBox(), b1});
+  EXPECT_EQ(4u, tree.size());
+  std::vector<unsigned> hits = tree.intersecting(b1);
+  ASSERT_EQ(2u, hits.size());
+  EXPECT_EQ(1u, hits[0]);
+  EXPECT_EQ(3u, hits[1]);
+  EXPECT_TRUE(tree.intersecting(BoundingBox()).empty());
+
+  std::vector<std::pair<unsigned, unsigned>> pairs = tree.intersectingPairs();
+  ASSERT_EQ(1u, pairs.size());
+  EXPECT_EQ(1u, pairs[0].first);
+  EXPECT_EQ(3u, pairs[0].second);
+}
+
+TEST_F(GeometryFixture, BoundingBoxTree_Tolerance) {
+  BoundingBox b1;
+  b1.addPoint(Point3d(0, 0, 0));
+  b1.addPoint(Point3d(1, 1, 1));
+
+  BoundingBox b2;
+  b2.addPoint(Point3d(1.005, 0, 0));
+  b2.addPoint(Point3d(2, 1, 1));
+
+  BoundingBoxTree tree(std::vector<BoundingBox>{b1, b2});
+  EXPECT_EQ(1u, tree.intersectingPairs().size());
+  EXPECT_EQ(1u, tree.intersectingPairs(0.01).size());
+  EXPECT_EQ(0u, tree.intersectingPairs(0.001).size());
+  EXPECT_EQ(b1.intersects(b2, 0.001), !tree.intersectingPairs(0.001).empty());
+}
+
+TEST_F(GeometryFixture, BoundingBoxTree_MatchesAllPairs) {
+  std::mt19937 gen(42);
+  std::uniform_real_distribution<double> position(0.0, 100.0);
+  std::uniform_real_distribution<double> dimension(0.0, 8.0);
+
+  std::vector<BoundingBox> boxes;
+  for (unsigned i = 0; i < 500; ++i) {
+    BoundingBox box;
+    if (i % 50 != 0) {
+      Point3d corner(position(gen), position(gen), position(gen) / 10.0);
+      box.addPoint(corner);
+      box.addPoint(corner + Vector3d(dimension(gen), dimension(gen), dimension(gen) / 4.0));
+    }
+    boxes.push_back(box);
+  }
+
+  std::vector<std::pair<unsigned, unsigned>> expected;
+  for (unsigned i = 0; i < boxes.size(); ++i) {
+    for (unsigned j = i + 1; j < boxes.size(); ++j) {
+      if (boxes[i].intersects(boxes[j])) {
+        expected.push_back(std::make_pair(i, j));
+      }
+    }
+  }
+  ASSERT_FALSE(expected.empty());
+
+  BoundingBoxTree tree(boxes);
+  EXPECT_EQ(boxes.size(), tree.size());
+  EXPECT_EQ(expected, tree.intersectingPairs());
+
+  for (unsigned i = 0; i < boxes.size(); i += 7) {
+    std::vector<unsigned> expectedHits;
+    for (unsigned j = 0; j < boxes.size(); ++j) {
+      if (boxes[i].intersects(boxes[j])) {
+        expectedHits.push_back(j);
+      }
+    }
+    EXPECT_EQ(expectedHits, tree.intersecting(boxes[i]));
+  }
+}
+
+TEST_F(GeometryFixture, BoundingBoxTree_Transformations) {
+  BoundingBox unit;
+  unit.addPoint(Point3d(0, 0, 0));
+  unit.addPoint(Point3d(1, 1, 1));
+
+  std::vector<BoundingBox> boxes(3, unit);
+  std::vector<Transformation> transformations;
+  transformations.push_back(Transformation());
+  transformations.push_back(Transformation::translation(Vector3d(1, 0, 0)));
+  transformations.push_back(Transformation::translation(Vector3d(5, 0, 0)));
+
+  BoundingBoxTree tree(boxes, transformations);
+  std::vector<std::pair<unsigned, unsigned>> pairs = tree.intersectingPairs();
+  ASSERT_EQ(1u, pairs.size());
+  EXPECT_EQ(0u, pairs[0].first);
+  EXPECT_EQ(1u, pairs[0].second);
+}
@@ -29,9 +29,11 @@
 
 #include "IddField.hpp"
 #include "IddField_Impl.hpp"
+#include "IddKey_Impl.hpp"
 
 #include "IddRegex.hpp"
 #include "CommentRegex.hpp"
+#include "IddSnapshot.hpp"
 #include <utilities/idd/IddFactory.hxx>
 
 #include "../units/UnitFactory.hpp"
@@ -261,6 +263,31 @@ namespace detail {
     return os;
   }
 
+  void IddField_Impl::writeSnapshot(IddSnapshotWriter& writer) const {
+    writer.writeString(m_name);
+    writer.writeString(m_fieldId);
+    writer.writeString(m_objectName);
+    writer.write(m_properties);
+    writer.writeUnsigned(m_keys.size());
+    for (const IddKey& key : m_keys) {
+      key.m_impl->writeSnapshot(writer);
+    }
+  }
+
+  std::shared_ptr<IddField_Impl> IddField_Impl::readSnapshot(IddSnapshotReader& reader) {
+    std::string name = reader.readString();
+    std::shared_ptr<IddField_Impl> result(new IddField_Impl(name, std::string()));
+    result->m_fieldId = reader.readString();
+    result->m_objectName = reader.readString();
+    reader.read(result->m_properties);
+    unsigned n = reader.readUnsigned();
+    result->m_keys.reserve(n);
+    for (unsigned i = 0; i < n; ++i) {
+      result->m_keys.push_back(IddKey(IddKey_Impl::readSnapshot(reader)));
+    }
+    return result;
+  }
+
   void IddField_Impl::parse(const std::string& text) {
     boost::smatch matches;
     if (boost::regex_search(text, matches, iddRegex::field())) {
@@ -49,6 +49,7 @@ class IddKey;
 // forward declarations
 namespace detail {
   class IddField_Impl;
+  class IddObject_Impl;
 }
 
 /** IddField represents a field in an IddObject, that is, the schema for a single piece of
@@ -150,6 +151,7 @@ class UTILITIES_API IddField
 
   // construct from impl
   IddField(const std::shared_ptr<detail::IddField_Impl>& impl);
+  friend class detail::IddObject_Impl;
   ///@endcond
 
   // configure logging
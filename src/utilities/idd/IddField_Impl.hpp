@@ -47,6 +47,9 @@ class Unit;
 
 namespace detail {
 
+  class IddSnapshotReader;
+  class IddSnapshotWriter;
+
   // implementation of IddField
   class UTILITIES_API IddField_Impl
   {
@@ -135,6 +138,12 @@ namespace detail {
      *  comma will be used (consistent with IDD formatting). */
     std::ostream& print(std::ostream& os, bool lastField) const;
 
+    /** Write this field to a binary IDD snapshot. */
+    void writeSnapshot(IddSnapshotWriter& writer) const;
+
+    /** Read a field written by writeSnapshot. Throws if the snapshot is invalid. */
+    static std::shared_ptr<IddField_Impl> readSnapshot(IddSnapshotReader& reader);
+
     //@}
    private:
     std::string m_name;
@@ -31,6 +31,8 @@
 #include "IddFile_Impl.hpp"
 
 #include "IddRegex.hpp"
+#include "IddObject_Impl.hpp"
+#include "IddSnapshot.hpp"
 #include "IddEnums.hpp"
 #include <utilities/idd/IddEnums.hxx>
 
@@ -205,6 +207,43 @@ namespace detail {
     return os;
   }
 
+  std::shared_ptr<IddFile_Impl> IddFile_Impl::loadSnapshot(const std::string& data) {
+    std::shared_ptr<IddFile_Impl> result(new IddFile_Impl());
+
+    try {
+      IddSnapshotReader reader(data.data(), data.data() + data.size());
+      reader.readHeader();
+      result->m_version = reader.readString();
+      result->m_build = reader.readString();
+      result->m_header = reader.readString();
+      unsigned n = reader.readUnsigned();
+      result->m_objects.reserve(n);
+      for (unsigned i = 0; i < n; ++i) {
+        result->m_objects.push_back(IddObject(IddObject_Impl::readSnapshot(reader)));
+      }
+      if (!reader.atEnd()) {
+        throw std::runtime_error("Unexpected data after the last object of the IDD snapshot.");
+      }
+    } catch (const std::exception& e) {
+      LOG(Error, "Unable to load IDD snapshot: " << e.what());
+      return std::shared_ptr<IddFile_Impl>();
+    }
+
+    return result;
+  }
+
+  void IddFile_Impl::saveSnapshot(std::ostream& os) const {
+    IddSnapshotWriter writer(os);
+    writer.writeHeader();
+    writer.writeString(m_version);
+    writer.writeString(m_build);
+    writer.writeString(m_header);
+    writer.writeUnsigned(m_objects.size());
+    for (const IddObject& object : m_objects) {
+      object.m_impl->writeSnapshot(writer);
+    }
+  }
+
   // PRIVATE
 
   void IddFile_Impl::parse(std::istream& is) {
@@ -451,6 +490,18 @@ std::ostream& IddFile::print(std::ostream& os) const {
   return m_impl->print(os);
 }
 
+OptionalIddFile IddFile::loadSnapshot(const std::string& data) {
+  std::shared_ptr<detail::IddFile_Impl> p = detail::IddFile_Impl::loadSnapshot(data);
+  if (p) {
+    return IddFile(p);
+  }
+  return boost::none;
+}
+
+void IddFile::saveSnapshot(std::ostream& os) const {
+  m_impl->saveSnapshot(os);
+}
+
 std::pair<VersionString, std::string> IddFile::parseVersionBuild(const openstudio::path& p) {
   std::ifstream ifs(openstudio::toSystemFilename(p));
 
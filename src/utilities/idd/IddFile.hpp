@@ -128,6 +128,15 @@ class UTILITIES_API IddFile
   /** Prints this file to std::ostream os. */
   std::ostream& print(std::ostream& os) const;
 
+  /** Load an IddFile from a binary snapshot written by saveSnapshot. No IDD text is parsed, so
+   *  this is much faster than load. Snapshots are build artifacts (see GenerateIddSnapshots) and
+   *  can only be read by the build that wrote them. Returns boost::none if data is not a
+   *  valid snapshot. */
+  static boost::optional<IddFile> loadSnapshot(const std::string& data);
+
+  /** Writes this file to os as a binary snapshot that loadSnapshot can read back. */
+  void saveSnapshot(std::ostream& os) const;
+
   /** Saves file to path p. Will construct the parent folder if necessary and if its parent
    *  folder already exists. Will only overwrite an existing file if overwrite==true. If no
    *  extension is provided will use 'idd'. */
@@ -116,6 +116,12 @@ namespace detail {
     /// print
     std::ostream& print(std::ostream& os) const;
 
+    /// load from a binary snapshot written by saveSnapshot, returns null if data is not a valid snapshot
+    static std::shared_ptr<IddFile_Impl> loadSnapshot(const std::string& data);
+
+    /// write a binary snapshot
+    void saveSnapshot(std::ostream& os) const;
+
     //@}
 
    private:
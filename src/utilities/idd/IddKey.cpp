@@ -31,6 +31,7 @@
 #include "IddKey_Impl.hpp"
 
 #include "IddRegex.hpp"
+#include "IddSnapshot.hpp"
 
 namespace openstudio {
 
@@ -72,6 +73,17 @@ namespace detail {
     return os;
   }
 
+  void IddKey_Impl::writeSnapshot(IddSnapshotWriter& writer) const {
+    writer.writeString(m_name);
+    writer.write(m_properties);
+  }
+
+  std::shared_ptr<IddKey_Impl> IddKey_Impl::readSnapshot(IddSnapshotReader& reader) {
+    std::shared_ptr<IddKey_Impl> result(new IddKey_Impl(reader.readString()));
+    reader.read(result->m_properties);
+    return result;
+  }
+
   // PRIVATE
 
   IddKey_Impl::IddKey_Impl(const std::string& name) : m_name(name) {}
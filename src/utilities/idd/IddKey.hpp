@@ -46,6 +46,7 @@ struct IddKeyProperties;
 
 namespace detail {
   class IddKey_Impl;
+  class IddField_Impl;
 }
 
 /** IddKey represents an enumeration value for an IDD field of type choice. */
@@ -99,6 +100,7 @@ class UTILITIES_API IddKey
 
   // construct from impl
   IddKey(const std::shared_ptr<detail::IddKey_Impl>& impl);
+  friend class detail::IddField_Impl;
   ///@endcond
 
   // configure logging
@@ -44,6 +44,9 @@ namespace openstudio {
 // private namespace
 namespace detail {
 
+  class IddSnapshotReader;
+  class IddSnapshotWriter;
+
   /** Implementation class for IddKey. */
   class UTILITIES_API IddKey_Impl
   {
@@ -66,6 +69,12 @@ namespace detail {
     /// print idd
     std::ostream& print(std::ostream& os) const;
 
+    /// write to a binary IDD snapshot
+    void writeSnapshot(IddSnapshotWriter& writer) const;
+
+    /// read from a binary IDD snapshot, throws if the snapshot is invalid
+    static std::shared_ptr<IddKey_Impl> readSnapshot(IddSnapshotReader& reader);
+
    private:
     /// partial constructor used by load
     IddKey_Impl(const std::string& name);
@@ -36,6 +36,8 @@
 #include <utilities/idd/IddEnums.hxx>
 #include "IddKey.hpp"
 #include "CommentRegex.hpp"
+#include "IddField_Impl.hpp"
+#include "IddSnapshot.hpp"
 
 #include "../core/Assert.hpp"
 #include "../core/ASCIIStrings.hpp"
@@ -65,6 +67,7 @@ namespace detail {
     oField = IddField::load("Generic Data Field", "A2; \\field Generic Data Field \n \\type alpha \n \\begin-extensible", m_name);
     OS_ASSERT(oField);
     m_extensibleFields.push_back(*oField);
+    updateNameField();
   }
 
   // GETTERS
@@ -180,6 +183,7 @@ namespace detail {
         unsigned newMaxFields = m_properties.maxFields.get() + 1;
         m_properties.maxFields = newMaxFields;
       }
+      updateNameField();
     }
   }
 
@@ -234,22 +238,12 @@ namespace detail {
   }
 
   bool IddObject_Impl::hasNameField() const {
-    if (m_nameFieldCache) {
-      return m_nameFieldCache->first;
-    }
-
-    unsigned index = 0;
-    if (hasHandleField()) {
-      index = 1;
-    }
-    bool result = ((m_fields.size() > index) && (m_fields[index].isNameField()));
-    m_nameFieldCache = std::pair<bool, unsigned>(result, index);
-    return result;
+    return m_nameField.first;
   }
 
   boost::optional<unsigned> IddObject_Impl::nameFieldIndex() const {
     if (hasNameField()) {
-      return m_nameFieldCache->second;
+      return m_nameField.second;
     }
     return boost::none;
   }
@@ -448,6 +442,50 @@ namespace detail {
     return os;
   }
 
+  void IddObject_Impl::writeSnapshot(IddSnapshotWriter& writer) const {
+    writer.writeString(m_name);
+    writer.writeString(m_group);
+    writer.writeString(m_type.valueName());
+    writer.write(m_properties);
+    writer.writeUnsigned(m_fields.size());
+    for (const IddField& field : m_fields) {
+      field.m_impl->writeSnapshot(writer);
+    }
+    writer.writeUnsigned(m_extensibleFields.size());
+    for (const IddField& field : m_extensibleFields) {
+      field.m_impl->writeSnapshot(writer);
+    }
+    writer.writeUnsigned(m_urlIdx.size());
+    for (unsigned index : m_urlIdx) {
+      writer.writeUnsigned(index);
+    }
+  }
+
+  std::shared_ptr<IddObject_Impl> IddObject_Impl::readSnapshot(IddSnapshotReader& reader) {
+    std::string name = reader.readString();
+    std::string group = reader.readString();
+    IddObjectType type(reader.readString());
+    std::shared_ptr<IddObject_Impl> result(new IddObject_Impl(name, group, type));
+    reader.read(result->m_properties);
+    unsigned n = reader.readUnsigned();
+    result->m_fields.reserve(n);
+    for (unsigned i = 0; i < n; ++i) {
+      result->m_fields.push_back(IddField(IddField_Impl::readSnapshot(reader)));
+    }
+    n = reader.readUnsigned();
+    result->m_extensibleFields.reserve(n);
+    for (unsigned i = 0; i < n; ++i) {
+      result->m_extensibleFields.push_back(IddField(IddField_Impl::readSnapshot(reader)));
+    }
+    n = reader.readUnsigned();
+    result->m_urlIdx.reserve(n);
+    for (unsigned i = 0; i < n; ++i) {
+      result->m_urlIdx.push_back(reader.readUnsigned());
+    }
+    result->updateNameField();
+    return result;
+  }
+
   // PRIVATE
 
   IddObject_Impl::IddObject_Impl(const string& name, const string& group, IddObjectType type) : m_name(name), m_group(group), m_type(type) {}
@@ -476,6 +514,16 @@ namespace detail {
     if (m_properties.extensible) {
       makeExtensible();
     }
+
+    updateNameField();
+  }
+
+  void IddObject_Impl::updateNameField() {
+    unsigned index = 0;
+    if (hasHandleField()) {
+      index = 1;
+    }
+    m_nameField = std::make_pair((m_fields.size() > index) && m_fields[index].isNameField(), index);
   }
 
   void IddObject_Impl::makeExtensible() {
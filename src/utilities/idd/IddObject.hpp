@@ -49,6 +49,7 @@ struct IddObjectType;
 
 namespace detail {
   class IddObject_Impl;
+  class IddFile_Impl;
 }  // namespace detail
 
 /** IddObject represents an object in the Idd.  IddObject is a shared object. */
@@ -211,6 +212,7 @@ class UTILITIES_API IddObject
 
   // construct from impl
   IddObject(const std::shared_ptr<detail::IddObject_Impl>& impl);
+  friend class detail::IddFile_Impl;
   ///@endcond
 
   // configure logging
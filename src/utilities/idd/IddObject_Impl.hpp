@@ -51,6 +51,9 @@ class ExtensibleIndex;
 
 namespace detail {
 
+  class IddSnapshotReader;
+  class IddSnapshotWriter;
+
   /** Implementation of IddObject */
   class UTILITIES_API IddObject_Impl
   {
@@ -179,6 +182,13 @@ namespace detail {
     // print
     std::ostream& print(std::ostream& os) const;
 
+    /** Write this object and its fields to a binary IDD snapshot. */
+    void writeSnapshot(IddSnapshotWriter& writer) const;
+
+    /** Read an object written by writeSnapshot. No text is parsed. Throws if the snapshot is
+     *  invalid. */
+    static std::shared_ptr<IddObject_Impl> readSnapshot(IddSnapshotReader& reader);
+
     //@}
 
    private:
@@ -190,8 +200,11 @@ namespace detail {
     IddFieldVector m_extensibleFields;  // vector of extensible fields, forms single
                                         // extensible field group
     std::vector<unsigned> m_urlIdx;
-    // .first = hasNameField(); .second = nameFieldIndex
-    mutable boost::optional<std::pair<bool, unsigned>> m_nameFieldCache;
+    // .first = hasNameField(); .second = nameFieldIndex. Kept up to date by updateNameField whenever
+    // m_fields changes, so that IddObjects shared between threads are only read.
+    std::pair<bool, unsigned> m_nameField{false, 0u};
+
+    void updateNameField();
 
     // partial constructor used by load
     IddObject_Impl(const std::string& name, const std::string& group, IddObjectType type);
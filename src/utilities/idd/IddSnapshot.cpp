@@ -0,0 +1,280 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2021, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+
+#include "IddSnapshot.hpp"
+
+#include "IddFieldProperties.hpp"
+#include "IddKeyProperties.hpp"
+#include "IddObjectProperties.hpp"
+
+#include <cstring>
+#include <stdexcept>
+
+namespace openstudio {
+namespace detail {
+
+  namespace {
+
+    const char snapshotMagic[8] = {'O', 'S', 'I', 'D', 'D', 'S', 'N', 'P'};
+
+    // bump whenever the encoding of any IDD class changes
+    const std::uint32_t snapshotFormatVersion = 1;
+
+  }  // namespace
+
+  IddSnapshotWriter::IddSnapshotWriter(std::ostream& os) : m_os(os) {}
+
+  void IddSnapshotWriter::writeHeader() {
+    m_os.write(snapshotMagic, sizeof(snapshotMagic));
+    writeUnsigned(snapshotFormatVersion);
+  }
+
+  void IddSnapshotWriter::writeUnsigned(unsigned value) {
+    auto temp = static_cast<std::uint32_t>(value);
+    m_os.write(reinterpret_cast<const char*>(&temp), sizeof(temp));
+  }
+
+  void IddSnapshotWriter::writeBool(bool value) {
+    char temp = value ? 1 : 0;
+    m_os.write(&temp, 1);
+  }
+
+  void IddSnapshotWriter::writeDouble(double value) {
+    m_os.write(reinterpret_cast<const char*>(&value), sizeof(value));
+  }
+
+  void IddSnapshotWriter::writeString(const std::string& value) {
+    writeUnsigned(value.size());
+    m_os.write(value.data(), value.size());
+  }
+
+  void IddSnapshotWriter::writeStrings(const std::vector<std::string>& values) {
+    writeUnsigned(values.size());
+    for (const std::string& value : values) {
+      writeString(value);
+    }
+  }
+
+  void IddSnapshotWriter::writeOptionalUnsigned(const boost::optional<unsigned>& value) {
+    writeBool(value.is_initialized());
+    if (value) {
+      writeUnsigned(*value);
+    }
+  }
+
+  void IddSnapshotWriter::writeOptionalDouble(const boost::optional<double>& value) {
+    writeBool(value.is_initialized());
+    if (value) {
+      writeDouble(*value);
+    }
+  }
+
+  void IddSnapshotWriter::writeOptionalString(const boost::optional<std::string>& value) {
+    writeBool(value.is_initialized());
+    if (value) {
+      writeString(*value);
+    }
+  }
+
+  void IddSnapshotWriter::write(const IddObjectProperties& properties) {
+    writeString(properties.memo);
+    writeBool(properties.unique);
+    writeBool(properties.required);
+    writeBool(properties.obsolete);
+    writeBool(properties.hasURL);
+    writeBool(properties.extensible);
+    writeUnsigned(properties.numExtensible);
+    writeUnsigned(properties.numExtensibleGroupsRequired);
+    writeString(properties.format);
+    writeUnsigned(properties.minFields);
+    writeOptionalUnsigned(properties.maxFields);
+  }
+
+  void IddSnapshotWriter::write(const IddFieldProperties& properties) {
+    writeUnsigned(properties.type.value());
+    writeString(properties.note);
+    writeBool(properties.required);
+    writeBool(properties.autosizable);
+    writeBool(properties.autocalculatable);
+    writeBool(properties.retaincase);
+    writeBool(properties.deprecated);
+    writeBool(properties.beginExtensible);
+    writeOptionalString(properties.units);
+    writeOptionalString(properties.ipUnits);
+    writeUnsigned(properties.minBoundType);
+    writeOptionalDouble(properties.minBoundValue);
+    writeOptionalString(properties.minBoundText);
+    writeUnsigned(properties.maxBoundType);
+    writeOptionalDouble(properties.maxBoundValue);
+    writeOptionalString(properties.maxBoundText);
+    writeOptionalString(properties.stringDefault);
+    writeOptionalDouble(properties.numericDefault);
+    writeStrings(properties.objectLists);
+    writeStrings(properties.references);
+    writeStrings(properties.referenceClassNames);
+    writeStrings(properties.externalLists);
+  }
+
+  void IddSnapshotWriter::write(const IddKeyProperties& properties) {
+    writeString(properties.note);
+  }
+
+  IddSnapshotReader::IddSnapshotReader(const char* begin, const char* end) : m_pos(begin), m_end(end) {}
+
+  void IddSnapshotReader::readHeader() {
+    char magic[sizeof(snapshotMagic)];
+    readBytes(magic, sizeof(magic));
+    if (std::memcmp(magic, snapshotMagic, sizeof(magic)) != 0) {
+      throw std::runtime_error("Data is not an IDD snapshot.");
+    }
+    if (readUnsigned() != snapshotFormatVersion) {
+      throw std::runtime_error("IDD snapshot was written with an incompatible format version.");
+    }
+  }
+
+  bool IddSnapshotReader::atEnd() const {
+    return m_pos == m_end;
+  }
+
+  unsigned IddSnapshotReader::readUnsigned() {
+    std::uint32_t result;
+    readBytes(&result, sizeof(result));
+    return result;
+  }
+
+  bool IddSnapshotReader::readBool() {
+    char result;
+    readBytes(&result, 1);
+    return (result != 0);
+  }
+
+  double IddSnapshotReader::readDouble() {
+    double result;
+    readBytes(&result, sizeof(result));
+    return result;
+  }
+
+  std::string IddSnapshotReader::readString() {
+    unsigned size = readUnsigned();
+    if (static_cast<std::size_t>(m_end - m_pos) < size) {
+      throw std::runtime_error("IDD snapshot is truncated.");
+    }
+    std::string result(m_pos, size);
+    m_pos += size;
+    return result;
+  }
+
+  std::vector<std::string> IddSnapshotReader::readStrings() {
+    unsigned n = readUnsigned();
+    std::vector<std::string> result;
+    result.reserve(n);
+    for (unsigned i = 0; i < n; ++i) {
+      result.push_back(readString());
+    }
+    return result;
+  }
+
+  boost::optional<unsigned> IddSnapshotReader::readOptionalUnsigned() {
+    boost::optional<unsigned> result;
+    if (readBool()) {
+      result = readUnsigned();
+    }
+    return result;
+  }
+
+  boost::optional<double> IddSnapshotReader::readOptionalDouble() {
+    boost::optional<double> result;
+    if (readBool()) {
+      result = readDouble();
+    }
+    return result;
+  }
+
+  boost::optional<std::string> IddSnapshotReader::readOptionalString() {
+    boost::optional<std::string> result;
+    if (readBool()) {
+      result = readString();
+    }
+    return result;
+  }
+
+  void IddSnapshotReader::read(IddObjectProperties& properties) {
+    properties.memo = readString();
+    properties.unique = readBool();
+    properties.required = readBool();
+    properties.obsolete = readBool();
+    properties.hasURL = readBool();
+    properties.extensible = readBool();
+    properties.numExtensible = readUnsigned();
+    properties.numExtensibleGroupsRequired = readUnsigned();
+    properties.format = readString();
+    properties.minFields = readUnsigned();
+    properties.maxFields = readOptionalUnsigned();
+  }
+
+  void IddSnapshotReader::read(IddFieldProperties& properties) {
+    properties.type = IddFieldType(static_cast<int>(readUnsigned()));
+    properties.note = readString();
+    properties.required = readBool();
+    properties.autosizable = readBool();
+    properties.autocalculatable = readBool();
+    properties.retaincase = readBool();
+    properties.deprecated = readBool();
+    properties.beginExtensible = readBool();
+    properties.units = readOptionalString();
+    properties.ipUnits = readOptionalString();
+    properties.minBoundType = static_cast<IddFieldProperties::BoundTypes>(readUnsigned());
+    properties.minBoundValue = readOptionalDouble();
+    properties.minBoundText = readOptionalString();
+    properties.maxBoundType = static_cast<IddFieldProperties::BoundTypes>(readUnsigned());
+    properties.maxBoundValue = readOptionalDouble();
+    properties.maxBoundText = readOptionalString();
+    properties.stringDefault = readOptionalString();
+    properties.numericDefault = readOptionalDouble();
+    properties.objectLists = readStrings();
+    properties.references = readStrings();
+    properties.referenceClassNames = readStrings();
+    properties.externalLists = readStrings();
+  }
+
+  void IddSnapshotReader::read(IddKeyProperties& properties) {
+    properties.note = readString();
+  }
+
+  void IddSnapshotReader::readBytes(void* dest, std::size_t size) {
+    if (static_cast<std::size_t>(m_end - m_pos) < size) {
+      throw std::runtime_error("IDD snapshot is truncated.");
+    }
+    std::memcpy(dest, m_pos, size);
+    m_pos += size;
+  }
+
+}  // namespace detail
+}  // namespace openstudio
@@ -0,0 +1,134 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2021, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+
+#ifndef UTILITIES_IDD_IDDSNAPSHOT_HPP
+#define UTILITIES_IDD_IDDSNAPSHOT_HPP
+
+#include "../UtilitiesAPI.hpp"
+
+#include <boost/optional.hpp>
+
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace openstudio {
+
+struct IddFieldProperties;
+struct IddKeyProperties;
+struct IddObjectProperties;
+
+namespace detail {
+
+  /** Writes the binary IDD snapshot encoding used by IddFile::saveSnapshot. Integers and doubles
+   *  are written in native byte order, strings and lists are length prefixed. Snapshots are build
+   *  artifacts meant to be read back by the same build, they are not a portable exchange format. */
+  class UTILITIES_API IddSnapshotWriter
+  {
+   public:
+    explicit IddSnapshotWriter(std::ostream& os);
+
+    /** Writes the snapshot magic number and format version. */
+    void writeHeader();
+
+    void writeUnsigned(unsigned value);
+
+    void writeBool(bool value);
+
+    void writeDouble(double value);
+
+    void writeString(const std::string& value);
+
+    void writeStrings(const std::vector<std::string>& values);
+
+    void writeOptionalUnsigned(const boost::optional<unsigned>& value);
+
+    void writeOptionalDouble(const boost::optional<double>& value);
+
+    void writeOptionalString(const boost::optional<std::string>& value);
+
+    void write(const IddObjectProperties& properties);
+
+    void write(const IddFieldProperties& properties);
+
+    void write(const IddKeyProperties& properties);
+
+   private:
+    std::ostream& m_os;
+  };
+
+  /** Reads the encoding written by IddSnapshotWriter directly from a memory buffer. Throws
+   *  std::runtime_error if the buffer is truncated or was not written by a compatible build. */
+  class UTILITIES_API IddSnapshotReader
+  {
+   public:
+    /** The buffer must outlive the reader. */
+    IddSnapshotReader(const char* begin, const char* end);
+
+    /** Reads and checks the snapshot magic number and format version. */
+    void readHeader();
+
+    /** Returns true if the whole buffer has been read. */
+    bool atEnd() const;
+
+    unsigned readUnsigned();
+
+    bool readBool();
+
+    double readDouble();
+
+    std::string readString();
+
+    std::vector<std::string> readStrings();
+
+    boost::optional<unsigned> readOptionalUnsigned();
+
+    boost::optional<double> readOptionalDouble();
+
+    boost::optional<std::string> readOptionalString();
+
+    void read(IddObjectProperties& properties);
+
+    void read(IddFieldProperties& properties);
+
+    void read(IddKeyProperties& properties);
+
+   private:
+    const char* m_pos;
+    const char* m_end;
+
+    void readBytes(void* dest, std::size_t size);
+  };
+
+}  // namespace detail
+}  // namespace openstudio
+
+#endif  // UTILITIES_IDD_IDDSNAPSHOT_HPP
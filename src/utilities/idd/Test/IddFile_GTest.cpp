@@ -372,3 +372,45 @@ TEST_F(IddFixture, IddFile_EpGroups) {
                                                                      << " object groups, including the first, unnamed group: " << '\n'
                                                                      << ss.str());
 }
+
+TEST_F(IddFixture, IddFile_Snapshot) {
+  // text-parsed file with UserCustom objects
+  path iddPath = resourcesPath() / toPath("model/OpenStudio.idd");
+  openstudio::filesystem::ifstream inFile(iddPath);
+  ASSERT_TRUE(inFile ? true : false);
+  OptionalIddFile loadedIddFile = IddFile::load(inFile);
+  ASSERT_TRUE(loadedIddFile);
+  inFile.close();
+
+  for (const IddFile& iddFile : {*loadedIddFile, osIddFile, epIddFile}) {
+    std::stringstream ss;
+    iddFile.saveSnapshot(ss);
+    OptionalIddFile snapshot = IddFile::loadSnapshot(ss.str());
+    ASSERT_TRUE(snapshot);
+
+    EXPECT_EQ(iddFile.version(), snapshot->version());
+    EXPECT_EQ(iddFile.build(), snapshot->build());
+    EXPECT_EQ(iddFile.header(), snapshot->header());
+    IddObjectVector objects = iddFile.objects();
+    IddObjectVector snapshotObjects = snapshot->objects();
+    ASSERT_EQ(objects.size(), snapshotObjects.size());
+    for (unsigned i = 0, n = objects.size(); i < n; ++i) {
+      EXPECT_TRUE(objects[i] == snapshotObjects[i]) << objects[i].name();
+      EXPECT_EQ(objects[i].type(), snapshotObjects[i].type());
+      EXPECT_EQ(objects[i].group(), snapshotObjects[i].group());
+      EXPECT_EQ(objects[i].urlFields(), snapshotObjects[i].urlFields());
+    }
+
+    std::stringstream printed, snapshotPrinted;
+    iddFile.print(printed);
+    snapshot->print(snapshotPrinted);
+    EXPECT_EQ(printed.str(), snapshotPrinted.str());
+
+    // truncated or foreign data is rejected
+    std::string data = ss.str();
+    EXPECT_FALSE(IddFile::loadSnapshot(data.substr(0, data.size() / 2)));
+    EXPECT_FALSE(IddFile::loadSnapshot(data + "x"));
+  }
+  EXPECT_FALSE(IddFile::loadSnapshot(""));
+  EXPECT_FALSE(IddFile::loadSnapshot("IDD_Version 1.0.0"));
+}
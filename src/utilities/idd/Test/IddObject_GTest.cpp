@@ -143,6 +143,16 @@ TEST_F(IddFixture, IddObject_nameField) {
   auto i = nodeList.nameFieldIndex();
   ASSERT_TRUE(i);
   ASSERT_EQ(0u, i.get());
+
+  // the name field moves behind an inserted handle field
+  std::stringstream ss;
+  nodeList.print(ss);
+  IddObject withHandle = IddObject::load("NodeList", "Node-Branch Management", ss.str()).get();
+  ASSERT_TRUE(withHandle.hasNameField());
+  EXPECT_EQ(0u, withHandle.nameFieldIndex().get());
+  withHandle.insertHandleField();
+  ASSERT_TRUE(withHandle.hasNameField());
+  EXPECT_EQ(1u, withHandle.nameFieldIndex().get());
 }
 
 // E+ no longer allows non-unique names, so we need to check that we enforce a strict naming policy
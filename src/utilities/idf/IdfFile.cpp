@@ -30,6 +30,7 @@
 #include "IdfFile.hpp"
 #include <utilities/idf/IdfObject_Impl.hpp>  // needed for serialization
 #include "IdfRegex.hpp"
+#include "IdfTokenizer.hpp"
 #include "ValidityReport.hpp"
 
 #include "../idd/IddRegex.hpp"
@@ -42,11 +43,38 @@
 #include "../core/PathHelpers.hpp"
 #include "../core/Assert.hpp"
 
-#include <boost/iostreams/filter/newline.hpp>
-#include <boost/iostreams/filtering_stream.hpp>
+#include <sstream>
 
 namespace openstudio {
 
+namespace {
+
+  // read the rest of the stream in one go
+  std::string readStream(std::istream& is) {
+    std::string result;
+    std::istream::pos_type start = is.tellg();
+    if (start != std::istream::pos_type(-1)) {
+      is.seekg(0, std::ios_base::end);
+      std::istream::pos_type end = is.tellg();
+      is.seekg(start);
+      if ((end != std::istream::pos_type(-1)) && is) {
+        result.resize(static_cast<std::size_t>(end - start));
+        is.read(&result[0], static_cast<std::streamsize>(result.size()));
+        // text mode may translate line endings
+        result.resize(static_cast<std::size_t>(is.gcount()));
+        return result;
+      }
+    }
+
+    // not seekable
+    is.clear();
+    std::ostringstream ss;
+    ss << is.rdbuf();
+    return ss.str();
+  }
+
+}  // namespace
+
 // CONSTRUCTORS
 
 IdfFile::IdfFile(IddFileType iddFileType) : m_iddFileAndFactoryWrapper(iddFileType) {
@@ -459,58 +487,24 @@ std::ostream& IdfFile::print(std::ostream& os) const {
 }
 
 bool IdfFile::save(const openstudio::path& p, bool overwrite) {
-
-  // default extension
-  std::string expectedExtension;
-  bool enforceExtension = false;
-  OptionalIddFileType iddType = m_iddFileAndFactoryWrapper.iddFileType();
-  if (iddType) {
-    if (*iddType == IddFileType::EnergyPlus) {
-      expectedExtension = "idf";
-      enforceExtension = true;
-    } else if (*iddType == IddFileType::OpenStudio) {
-      std::string ext = getFileExtension(p);
-      if (ext == componentFileExtension()) {
-        expectedExtension = componentFileExtension();
-        // no need to enforce b/c already checked
-      } else {
-        expectedExtension = modelFileExtension();
-        enforceExtension = true;
-      }
-    }
-  }
-
-  // set extension if appropriate
-  path wp(p);
-  if (enforceExtension) {
-    wp = setFileExtension(p, expectedExtension, false, true);
+  boost::optional<path> wp = savePath(p, m_iddFileAndFactoryWrapper, overwrite);
+  if (!wp) {
+    return false;
   }
 
-  // do not overwrite if not allowed
-  if (!overwrite) {
-    path temp = completePathToFile(wp, path());
-    if (!temp.empty()) {
-      LOG(Info, "Save method failed because instructed not to overwrite path '" << toString(wp) << "'.");
+  openstudio::filesystem::ofstream outFile(*wp);
+  if (outFile) {
+    try {
+      print(outFile);
+      outFile.close();
+      return true;
+    } catch (...) {
+      LOG(Error, "Unable to write file to path '" << toString(*wp) << "'.");
       return false;
     }
   }
 
-  if (makeParentFolder(wp)) {
-    openstudio::filesystem::ofstream outFile(wp);
-    if (outFile) {
-      try {
-        print(outFile);
-        outFile.close();
-        return true;
-      } catch (...) {
-        LOG(Error, "Unable to write file to path '" << toString(wp) << "'.");
-        return false;
-      }
-    }
-  }
-
-  LOG(Error, "Unable to write file to path '" << toString(wp) << "', because parent directory "
-                                              << "could not be created.");
+  LOG(Error, "Unable to write file to path '" << toString(*wp) << "'.");
   return false;
 }
 
@@ -522,8 +516,7 @@ bool IdfFile::m_load(std::istream& is, ProgressBar* progressBar, bool versionOnl
 
   int lineNum = 0;         // Idf line number
   int objectNum = 0;       // number of objects, first is #1
-  std::string line;        // temp string to help with reading
-  boost::smatch matches;   // matches to regular expressions
+  std::string_view line;   // view into buffer for the current line
   std::string comment;     // keep running comment
   bool firstBlock = true;  // to capture first comment block as the header
 
@@ -535,38 +528,25 @@ bool IdfFile::m_load(std::istream& is, ProgressBar* progressBar, bool versionOnl
     is.seekg(0, std::ios_base::beg);
   }
 
-  // Use a boost filter to make sure that no matter what line endings come in,
-  // they are converted to what is expected by the current os
-  boost::iostreams::filtering_istream filt;
-
-  //#ifdef _POSIX_VERSION
-  filt.push(boost::iostreams::newline_filter(boost::iostreams::newline::posix));
-  //#else
-  //  filt.push(boost::iostreams::newline_filter(boost::iostreams::newline::dos));
-  //#endif
-  filt.push(is);
+  // read the whole file once, lines are views into this buffer
+  // the line reader treats "\r\n", "\r" and "\n" line endings the same, no matter which os we are on
+  const std::string buffer = readStream(is);
+  idfTokenizer::LineReader reader(buffer);
 
-  // read the file line by line using regexes
-  while (std::getline(filt, line)) {
-
-    if (line == "\r") {
-      // This is not a real line at all, just the vestiges from the
-      // previous windows formatted line being parsed on unix, skip it,
-      // don't even count it
-      continue;
-    }
+  // read the file line by line
+  while (reader.getline(line)) {
 
     ++lineNum;
 
     if (progressBar) {
-      int current = static_cast<int>(is.tellg());
-      progressBar->setValue(current);
+      progressBar->setValue(static_cast<int>(reader.position()));
     }
 
-    if (boost::regex_match(line, idfRegex::commentOnlyLine())) {
+    if (idfTokenizer::matchCommentOnlyLine(line)) {
       // continue comment
-      comment += (line + idfRegex::newLinestring());
-    } else if (boost::regex_match(line, commentRegex::whitespaceOnlyLine())) {
+      comment += line;
+      comment += idfRegex::newLinestring();
+    } else if (idfTokenizer::isWhitespaceOnlyLine(line)) {
       // end comment
       boost::trim(comment);
 
@@ -607,17 +587,16 @@ bool IdfFile::m_load(std::istream& is, ProgressBar* progressBar, bool versionOnl
       // peek at the object type and name for indexing in map
       std::string objectType;
 
-      if (boost::regex_search(line, matches, idfRegex::line())) {
-        objectType = std::string(matches[1].first, matches[1].second);
-        boost::trim(objectType);
+      if (boost::optional<idfTokenizer::LineMatch> match = idfTokenizer::searchLine(line)) {
+        objectType = std::string(idfTokenizer::trim(match->content));
       } else {
         // can't figure out the object's type
         if (!versionOnly) {
-          LOG(Warn, "Unrecognizable object type '" + line + "'. Defaulting to 'Catchall'.");
+          LOG(Warn, "Unrecognizable object type '" << line << "'. Defaulting to 'Catchall'.");
         }
         objectType = "Catchall";
       }
-      if (boost::regex_match(objectType, iddRegex::versionObjectName())) {
+      if (idfTokenizer::isVersionObjectName(objectType)) {
         isVersion = true;
       }
 
@@ -635,24 +614,28 @@ bool IdfFile::m_load(std::istream& is, ProgressBar* progressBar, bool versionOnl
       }
 
       // put the text for this object in a new string with a newline
-      std::string text(comment + idfRegex::newLinestring() + line + idfRegex::newLinestring());
+      std::string text(comment);
+      text += idfRegex::newLinestring();
+      text += line;
+      text += idfRegex::newLinestring();
       comment = "";
 
       // check if this line also matches closing line object
-      if (boost::regex_match(line, idfRegex::objectEnd())) {
+      if (idfTokenizer::isObjectEnd(line)) {
         foundEndLine = true;
       }
 
       // continue reading until we have seen the entire object
       // last line will be thrown away, requires empty line between objects in Idf
-      while ((!foundEndLine) && (std::getline(filt, line))) {
+      while ((!foundEndLine) && (reader.getline(line))) {
         ++lineNum;
 
         // add line to text, include newline separator
-        text += (line + idfRegex::newLinestring());
+        text += line;
+        text += idfRegex::newLinestring();
 
         // check if we have found the last field
-        if (boost::regex_match(line, idfRegex::objectEnd())) {
+        if (idfTokenizer::isObjectEnd(line)) {
           foundEndLine = true;
         }
       }
@@ -693,6 +676,8 @@ bool IdfFile::m_load(std::istream& is, ProgressBar* progressBar, bool versionOnl
   }
 }
 
+// PROTECTED
+
 IddFileAndFactoryWrapper IdfFile::iddFileAndFactoryWrapper() const {
   return m_iddFileAndFactoryWrapper;
 }
@@ -701,6 +686,53 @@ void IdfFile::setIddFileAndFactoryWrapper(const IddFileAndFactoryWrapper& iddFil
   m_iddFileAndFactoryWrapper = iddFileAndFactoryWrapper;
 }
 
+boost::optional<openstudio::path> IdfFile::savePath(const openstudio::path& p, const IddFileAndFactoryWrapper& iddFileAndFactoryWrapper,
+                                                    bool overwrite) {
+
+  // default extension
+  std::string expectedExtension;
+  bool enforceExtension = false;
+  OptionalIddFileType iddType = iddFileAndFactoryWrapper.iddFileType();
+  if (iddType) {
+    if (*iddType == IddFileType::EnergyPlus) {
+      expectedExtension = "idf";
+      enforceExtension = true;
+    } else if (*iddType == IddFileType::OpenStudio) {
+      std::string ext = getFileExtension(p);
+      if (ext == componentFileExtension()) {
+        expectedExtension = componentFileExtension();
+        // no need to enforce b/c already checked
+      } else {
+        expectedExtension = modelFileExtension();
+        enforceExtension = true;
+      }
+    }
+  }
+
+  // set extension if appropriate
+  path wp(p);
+  if (enforceExtension) {
+    wp = setFileExtension(p, expectedExtension, false, true);
+  }
+
+  // do not overwrite if not allowed
+  if (!overwrite) {
+    path temp = completePathToFile(wp, path());
+    if (!temp.empty()) {
+      LOG(Info, "Save method failed because instructed not to overwrite path '" << toString(wp) << "'.");
+      return boost::none;
+    }
+  }
+
+  if (!makeParentFolder(wp)) {
+    LOG(Error, "Unable to write file to path '" << toString(wp) << "', because parent directory "
+                                                << "could not be created.");
+    return boost::none;
+  }
+
+  return wp;
+}
+
 // PRIVATE
 
 // SETTERS
@@ -219,6 +219,11 @@ class UTILITIES_API IdfFile
   IddFileAndFactoryWrapper iddFileAndFactoryWrapper() const;
   void setIddFileAndFactoryWrapper(const IddFileAndFactoryWrapper& iddFileAndFactoryWrapper);
 
+  /** Path that save(p, overwrite) writes to for files using iddFileAndFactoryWrapper, with the
+   *  parent folder created. Returns boost::none, after logging, if the file cannot be written. */
+  static boost::optional<openstudio::path> savePath(const openstudio::path& p, const IddFileAndFactoryWrapper& iddFileAndFactoryWrapper,
+                                                    bool overwrite);
+
  private:
   std::string m_header;
   std::vector<IdfObject> m_objects;
@@ -32,6 +32,7 @@
 
 #include "IdfExtensibleGroup.hpp"
 #include "IdfRegex.hpp"
+#include "IdfTokenizer.hpp"
 #include "ValidityReport.hpp"
 
 #include "../idd/IddKey.hpp"
@@ -61,6 +62,7 @@ namespace detail {
 
   IdfObject_Impl::IdfObject_Impl(const IdfObject_Impl& other, bool keepHandle)
     : m_comment(other.comment()), m_iddObject(other.iddObject()), m_fields(other.fields()), m_fieldComments(other.fieldComments()) {
+    resizeNumericFields();
     if (keepHandle) {
       OS_ASSERT(!other.handle().isNull());
       m_handle = other.handle();
@@ -146,20 +148,7 @@ namespace detail {
     }
 
     if (returnDefault && result.empty()) {
-      if (OptionalIddField iddField = m_iddObject.getField(index)) {
-        std::stringstream ss;
-        ss << makeIdfEditorComment(iddField->name());
-        if (m_iddObject.isExtensibleField(index)) {
-          ExtensibleIndex ei = m_iddObject.extensibleIndex(index);
-          ss << " " << ei.group + 1;
-        }
-        if (OptionalString units = iddField->properties().units) {
-          if (units) {
-            ss << " {" << *units << "}";
-          }
-        }
-        result = ss.str();
-      }
+      appendDefaultFieldComment(result, index);
     }
     return result;
   }
@@ -234,6 +223,15 @@ namespace detail {
   }
 
   boost::optional<double> IdfObject_Impl::getDouble(unsigned index, bool returnDefault) const {
+    if (const NumericField* field = numericField(index)) {
+      if (field->state == NumericField::Number) {
+        return field->value;
+      } else if ((field->state == NumericField::AutoValue) || ((field->state == NumericField::Blank) && !returnDefault)) {
+        return boost::none;
+      }
+      // blank fields that may have a default and invalid text take the string path
+    }
+
     OptionalDouble result;
     OptionalString value = getString(index, returnDefault, false);
     if (value) {
@@ -254,6 +252,18 @@ namespace detail {
   }
 
   boost::optional<unsigned> IdfObject_Impl::getUnsigned(unsigned index, bool returnDefault) const {
+    if (const NumericField* field = numericField(index)) {
+      if (field->state == NumericField::Number) {
+        try {
+          return boost::numeric_cast<unsigned>(field->value);
+        } catch (const std::exception&) {
+          // out of range, the string path logs the error
+        }
+      } else if ((field->state == NumericField::AutoValue) || ((field->state == NumericField::Blank) && !returnDefault)) {
+        return boost::none;
+      }
+    }
+
     OptionalUnsigned result;
     OptionalString value = getString(index, returnDefault, false);
     if (value) {
@@ -270,6 +280,18 @@ namespace detail {
   }
 
   boost::optional<int> IdfObject_Impl::getInt(unsigned index, bool returnDefault) const {
+    if (const NumericField* field = numericField(index)) {
+      if (field->state == NumericField::Number) {
+        try {
+          return boost::numeric_cast<int>(field->value);
+        } catch (const std::exception&) {
+          // out of range, the string path logs the error
+        }
+      } else if ((field->state == NumericField::AutoValue) || ((field->state == NumericField::Blank) && !returnDefault)) {
+        return boost::none;
+      }
+    }
+
     OptionalInt result;
     OptionalString value = getString(index, returnDefault, false);
     if (value) {
@@ -315,6 +337,7 @@ namespace detail {
   }
 
   void IdfObject_Impl::setComment(const std::string& comment, bool checkValidity) {
+    journalChange();
     m_comment = makeComment(comment);
     m_diffs.push_back(IdfObjectDiff(boost::none, boost::none, boost::none));
   }
@@ -328,6 +351,8 @@ namespace detail {
   }
 
   bool IdfObject_Impl::setFieldComment(unsigned index, const std::string& cmnt, bool checkValidity) {
+    journalChange();
+
     if (index < m_fields.size()) {
       if (index >= m_fieldComments.size()) {
         m_fieldComments.resize(index + 1);
@@ -351,6 +376,8 @@ namespace detail {
   }
 
   boost::optional<std::string> IdfObject_Impl::setName(const std::string& _newName, bool checkValidity) {
+    journalChange();
+
     std::string newName = encodeString(_newName);
 
     switch (m_iddObject.type().value()) {
@@ -399,6 +426,7 @@ namespace detail {
       if (i < n) {
         std::string oldName = m_fields[i];
         m_fields[i] = newName;
+        resetNumericField(i);
         m_diffs.push_back(IdfObjectDiff(i, oldName, newName));
       } else {
         m_fields.push_back(newName);
@@ -435,6 +463,8 @@ namespace detail {
   }
 
   bool IdfObject_Impl::setString(unsigned index, const std::string& _value, bool checkValidity) {
+    journalChange();
+
     std::string value = encodeString(_value);
 
     if (m_iddObject.hasNameField() && (index == m_iddObject.nameFieldIndex().get())) {
@@ -474,6 +504,7 @@ namespace detail {
         if (m_fieldComments.size() > n) {
           m_fieldComments.resize(n);
         }
+        resizeNumericFields();
 
         return false;
       }
@@ -481,6 +512,7 @@ namespace detail {
       OS_ASSERT(index < m_fields.size());
 
       m_fields[index] = value;
+      resetNumericField(index);
       m_diffs.emplace_back(index, oldValue, value);
       return result;
     }
@@ -574,6 +606,8 @@ namespace detail {
   }
 
   bool IdfObject_Impl::pushString(const std::string& value, bool checkValidity) {
+    journalChange();
+
     // get new index
     unsigned index = m_fields.size();
     if (m_iddObject.hasNameField() && (index == m_iddObject.nameFieldIndex().get())) {
@@ -583,6 +617,7 @@ namespace detail {
     // ok if nonextensible, or extensible w/ group size 1
     if (m_iddObject.isNonextensibleField(index) || (m_iddObject.isExtensibleField(index) && (m_iddObject.properties().numExtensible == 1))) {
       m_fields.push_back(value);
+      resizeNumericFields();
       m_diffs.push_back(IdfObjectDiff(index, boost::none, value));
       return true;
     }
@@ -598,6 +633,8 @@ namespace detail {
   }
 
   IdfExtensibleGroup IdfObject_Impl::pushExtensibleGroup(const std::vector<std::string>& values, bool checkValidity) {
+    journalChange();
+
     unsigned groupSize = m_iddObject.properties().numExtensible;
     unsigned n = numFields();
     IdfObject_ImplPtr p = nullptr;
@@ -624,6 +661,7 @@ namespace detail {
         if (m_fieldComments.size() > n) {
           m_fieldComments.resize(n);
         }
+        resizeNumericFields();
         return result;
       }
     }
@@ -641,6 +679,7 @@ namespace detail {
       }
 
       m_fields.resize(n + groupSize);
+      resizeNumericFields();
 
       for (unsigned i = 0; i < groupSize; ++i) {
 
@@ -654,6 +693,7 @@ namespace detail {
           if (m_fieldComments.size() > n) {
             m_fieldComments.resize(n);
           }
+          resizeNumericFields();
           return result;
         }
       }
@@ -675,6 +715,8 @@ namespace detail {
   }
 
   IdfExtensibleGroup IdfObject_Impl::insertExtensibleGroup(unsigned groupIndex, const std::vector<std::string>& values, bool checkValidity) {
+    journalChange();
+
     // if really a push request, send it there
     if (groupIndex == numExtensibleGroups()) {
       return pushExtensibleGroup(values, checkValidity);
@@ -788,6 +830,7 @@ namespace detail {
   /** Pops the final extensible group from the object, if possible. Returns the popped data if
    *  successful. Otherwise, the returned vector will be empty. */
   std::vector<std::string> IdfObject_Impl::popExtensibleGroup(bool checkValidity) {
+    journalChange();
 
     unsigned groupSize = m_iddObject.properties().numExtensible;
     unsigned numBeforePop = numFields();
@@ -810,6 +853,7 @@ namespace detail {
       if (m_fieldComments.size() > m_fields.size()) {
         m_fieldComments.resize(numAfterPop);
       }
+      resizeNumericFields();
       OS_ASSERT(egToPop.empty());
     }
 
@@ -828,6 +872,8 @@ namespace detail {
   }
 
   std::vector<std::string> IdfObject_Impl::eraseExtensibleGroup(unsigned groupIndex, bool checkValidity) {
+    journalChange();
+
     StringVector result;
     if (groupIndex >= numExtensibleGroups()) {
       return result;
@@ -886,6 +932,7 @@ namespace detail {
   }
 
   std::vector<std::vector<std::string>> IdfObject_Impl::clearExtensibleGroups(bool checkValidity) {
+    journalChange();
 
     // data to restore if cannot delete all groups
     std::vector<StringVector> rollbackValues;
@@ -1236,104 +1283,183 @@ namespace detail {
     return result;
   }
 
-  std::ostream& IdfObject_Impl::print(std::ostream& os) const {
-    unsigned n = numFields();
-    if (n == 0) {
-      printName(os, false);
-    } else {
-      printName(os, true);
+  std::shared_ptr<IdfObject_Impl> IdfObject_Impl::rebind(const IddObject& iddObject) const {
+    StringVector fields = m_fields;
+    StringVector fieldComments = m_fieldComments;
+
+    // Catchall objects carry their object type in the first field
+    bool fromCatchall = (m_iddObject.type() == IddObjectType::Catchall);
+    bool toCatchall = (iddObject.type() == IddObjectType::Catchall);
+    if (fromCatchall && !toCatchall) {
+      if (!fields.empty()) {
+        fields.erase(fields.begin());
+      }
+      if (!fieldComments.empty()) {
+        fieldComments.erase(fieldComments.begin());
+      }
+    } else if (!fromCatchall && toCatchall) {
+      fields.insert(fields.begin(), m_iddObject.name());
+      if (!fieldComments.empty()) {
+        fieldComments.insert(fieldComments.begin(), std::string());
+      }
     }
 
-    for (unsigned i = 0; i < n; ++i) {
-      if (i < n - 1) {
-        printField(os, i);
-      } else {
-        printField(os, i, true);
+    // same cut-off as parseFields
+    for (unsigned i = 0, n = fields.size(); i < n; ++i) {
+      if (!iddObject.getField(i)) {
+        LOG(Error, "IdfObject of type '" << iddObject.name() << "' "
+                                         << "cannot have field index of " << i << ". "
+                                         << "Dropping the remaining " << n - i << " fields.");
+        fields.resize(i);
+        if (fieldComments.size() > i) {
+          fieldComments.resize(i);
+        }
+        break;
       }
     }
 
-    os << '\n';
+    // keep the handle if the handle field has one, as parseFields does
+    Handle handle = openstudio::createUUID();
+    if (iddObject.hasHandleField()) {
+      handle = m_handle;
+      if (!fields.empty()) {
+        Handle candidate = toUUID(fields[0]);
+        if (!candidate.isNull()) {
+          handle = candidate;
+        }
+      }
+    }
+    return std::shared_ptr<IdfObject_Impl>(new IdfObject_Impl(handle, m_comment, iddObject, fields, fieldComments));
+  }
 
+  std::ostream& IdfObject_Impl::print(std::ostream& os) const {
+    std::string buffer;
+    appendText(buffer, false);
+    os << buffer;
     return os;
   }
 
   std::ostream& IdfObject_Impl::printName(std::ostream& os, bool hasFields) const {
+    std::string buffer;
+    appendName(buffer, hasFields);
+    os << buffer;
+    return os;
+  }
+
+  std::ostream& IdfObject_Impl::printField(std::ostream& os, unsigned index, bool isLastField) const {
+    if (index < numFields()) {
+      // making this static is a bad idea,
+      // it makes no sense in a threaded environment
+      static int textWidth(0);
+      std::string buffer;
+      appendField(buffer, index, m_fields[index], isLastField, textWidth);
+      os << buffer;
+    }  // if index < numFields()
+    return os;
+  }
+
+  void IdfObject_Impl::appendText(std::string& buffer) const {
+    appendText(buffer, true);
+  }
+
+  void IdfObject_Impl::appendText(std::string& buffer, bool printedFields) const {
+    unsigned n = numFields();
+    appendName(buffer, n != 0);
+
+    int textWidth = 0;
+    std::string scratch;
+    for (unsigned i = 0; i < n; ++i) {
+      appendField(buffer, i, printedFields ? printedField(i, scratch) : m_fields[i], i == n - 1, textWidth);
+    }
+
+    buffer += '\n';
+  }
+
+  void IdfObject_Impl::appendName(std::string& buffer, bool hasFields) const {
     // print comment, if any
     if (!m_comment.empty()) {
-      os << m_comment << '\n';
+      buffer += m_comment;
+      buffer += '\n';
     }
 
     // if this is a comment only object, return
     // todo, tighten up handling of comments with comment only object type
     if (boost::iequals(m_iddObject.name(), iddRegex::commentOnlyObjectName())) {
-      return os;
-    }
-
-    os << m_iddObject.name();
-
-    if (hasFields) {
-      os << "," << '\n';
-    } else {
-      os << ";" << '\n';
+      return;
     }
 
-    return os;
+    buffer += m_iddObject.name();
+    buffer += hasFields ? ",\n" : ";\n";
   }
 
-  std::ostream& IdfObject_Impl::printField(std::ostream& os, unsigned index, bool isLastField) const {
-    if (index < numFields()) {
-      // different formatting for vertices
-      if ((m_iddObject.properties().format == "vertices") && (m_iddObject.isExtensibleField(index))) {
-        ExtensibleIndex eIndex = m_iddObject.extensibleIndex(index);
-        // making this static is a bad idea,
-        // it makes no sense in a threaded environment
-        static int textWidth(0);
-        if (eIndex.field == 0) {
-          os << "  ";
-          textWidth = 0;
-        } else {
-          os << " ";
-        }
-        // field value
-        os << m_fields[index];
-        // delimiter
-        if (isLastField) {
-          os << ";";
-        } else {
-          os << ",";
-        }
-        textWidth += m_fields[index].size();
-        // comment
-        if (eIndex.field == m_iddObject.properties().numExtensible - 1) {
-          int numSpaces = IdfObject::printedFieldSpace() - textWidth - 4;
-          if (numSpaces > 0) {
-            os << std::setw(numSpaces) << " ";
-          }
-          os << " !- X,Y,Z Vertex " << eIndex.group + 1;
-          IddField iddField = m_iddObject.getField(index).get();
-          if (OptionalString units = iddField.properties().units) {
-            os << " {" << *units << "}";
-          }
-          os << '\n';
-        }
+  void IdfObject_Impl::appendField(std::string& buffer, unsigned index, const std::string& value, bool isLastField, int& textWidth) const {
+    // different formatting for vertices
+    if ((m_iddObject.properties().format == "vertices") && (m_iddObject.isExtensibleField(index))) {
+      ExtensibleIndex eIndex = m_iddObject.extensibleIndex(index);
+      if (eIndex.field == 0) {
+        buffer += "  ";
+        textWidth = 0;
       } else {
-        // field value
-        os << "  " << m_fields[index];
-        // delimiter
-        if (isLastField) {
-          os << ";";
-        } else {
-          os << ",";
-        }
-        // field comment
-        int numSpaces = IdfObject::printedFieldSpace() - int(m_fields[index].size());
+        buffer += ' ';
+      }
+      // field value and delimiter
+      buffer += value;
+      buffer += isLastField ? ';' : ',';
+      textWidth += value.size();
+      // comment
+      if (eIndex.field == m_iddObject.properties().numExtensible - 1) {
+        int numSpaces = IdfObject::printedFieldSpace() - textWidth - 4;
         if (numSpaces > 0) {
-          os << std::setw(numSpaces) << " ";
+          buffer.append(numSpaces, ' ');
         }
-        os << " " << fieldComment(index, true) << '\n';
+        buffer += " !- X,Y,Z Vertex ";
+        buffer += std::to_string(eIndex.group + 1);
+        IddField iddField = m_iddObject.getField(index).get();
+        if (OptionalString units = iddField.properties().units) {
+          buffer += " {";
+          buffer += *units;
+          buffer += '}';
+        }
+        buffer += '\n';
       }
-    }  // if index < numFields()
-    return os;
+    } else {
+      // field value and delimiter
+      buffer += "  ";
+      buffer += value;
+      buffer += isLastField ? ';' : ',';
+      // field comment
+      int numSpaces = IdfObject::printedFieldSpace() - int(value.size());
+      if (numSpaces > 0) {
+        buffer.append(numSpaces, ' ');
+      }
+      buffer += ' ';
+      if ((index < m_fieldComments.size()) && !m_fieldComments[index].empty()) {
+        buffer += m_fieldComments[index];
+      } else {
+        appendDefaultFieldComment(buffer, index);
+      }
+      buffer += '\n';
+    }
+  }
+
+  void IdfObject_Impl::appendDefaultFieldComment(std::string& buffer, unsigned index) const {
+    if (OptionalIddField iddField = m_iddObject.getField(index)) {
+      buffer += makeIdfEditorComment(iddField->name());
+      if (m_iddObject.isExtensibleField(index)) {
+        ExtensibleIndex ei = m_iddObject.extensibleIndex(index);
+        buffer += ' ';
+        buffer += std::to_string(ei.group + 1);
+      }
+      if (OptionalString units = iddField->properties().units) {
+        buffer += " {";
+        buffer += *units;
+        buffer += '}';
+      }
+    }
+  }
+
+  const std::string& IdfObject_Impl::printedField(unsigned index, std::string& scratch) const {
+    return m_fields[index];
   }
 
   void IdfObject_Impl::emitChangeSignals() {
@@ -1376,6 +1502,8 @@ namespace detail {
     m_diffs.clear();
   }
 
+  void IdfObject_Impl::journalChange() {}
+
   // PRIVATE
 
   void IdfObject_Impl::resizeToMinFields() {
@@ -1396,37 +1524,33 @@ namespace detail {
         }
       }
     }
+    resizeNumericFields();
   }
 
   void IdfObject_Impl::parse(const std::string& text, bool getIddFromFactory) {
     std::string objectType;
 
-    // cut down on this text as we parse
-    std::string parsedText(text);
+    // cut down on this text as we parse, views into text so nothing is copied
+    std::string_view parsedText(text);
 
     // get preceding comments
-    boost::smatch matches;
-    while (boost::regex_match(parsedText, idfRegex::commentOnlyLine()) && boost::regex_search(parsedText, matches, idfRegex::commentOnlyLine())) {
-      std::string comment(matches[1].first, matches[1].second);
-      std::string otherText(matches[2].first, matches[2].second);
-      boost::trim_left(otherText);
-
+    while (boost::optional<idfTokenizer::CommentMatch> match = idfTokenizer::matchCommentOnlyLine(parsedText)) {
       // append the comment
-      if (!comment.empty()) {
-        m_comment += "!" + comment + idfRegex::newLinestring();
+      if (!match->comment.empty()) {
+        m_comment += "!";
+        m_comment += match->comment;
+        m_comment += idfRegex::newLinestring();
       }
 
       // reduce the parsed text
-      parsedText = otherText;
+      parsedText = idfTokenizer::trimLeft(match->next);
     }
 
     // the first entry will be the object type
-    if (boost::regex_search(parsedText, matches, idfRegex::line())) {
-      objectType = std::string(matches[1].first, matches[1].second);
-      boost::trim(objectType);
-      std::string commentOrOtherText(matches[2].first, matches[2].second);
-      boost::trim_left(commentOrOtherText);
-      std::string otherText(matches[3].first, matches[3].second);
+    if (boost::optional<idfTokenizer::LineMatch> match = idfTokenizer::searchLine(parsedText)) {
+      objectType = std::string(idfTokenizer::trim(match->content));
+      std::string_view commentOrOtherText = idfTokenizer::trimLeft(match->remainder);
+      std::string_view otherText = match->next;
 
       if (getIddFromFactory) {
         // find appropriate IddObject in IddFactory
@@ -1452,8 +1576,7 @@ namespace detail {
         }
       }
 
-      if (boost::regex_match(commentOrOtherText, idfRegex::commentOnlyLine())
-          || boost::regex_match(commentOrOtherText, commentRegex::whitespaceOnlyBlock())) {
+      if (idfTokenizer::matchCommentOnlyLine(commentOrOtherText) || idfTokenizer::isWhitespaceOnlyBlock(commentOrOtherText)) {
 
         // set comment
         m_comment += commentOrOtherText;
@@ -1461,8 +1584,8 @@ namespace detail {
         // reduce the parsed text
         parsedText = otherText;
       } else {
-        // reduce the parsed text
-        parsedText = commentOrOtherText + otherText;
+        // reduce the parsed text, commentOrOtherText runs on into otherText
+        parsedText = std::string_view(commentOrOtherText.data(), otherText.data() + otherText.size() - commentOrOtherText.data());
       }
 
     } else {
@@ -1470,18 +1593,16 @@ namespace detail {
     }
 
     // get trailing comments
-    while (boost::regex_match(parsedText, idfRegex::commentOnlyLine()) && boost::regex_search(parsedText, matches, idfRegex::commentOnlyLine())) {
-      std::string comment(matches[1].first, matches[1].second);
-      std::string otherText(matches[2].first, matches[2].second);
-      boost::trim_left(otherText);
-
+    while (boost::optional<idfTokenizer::CommentMatch> match = idfTokenizer::matchCommentOnlyLine(parsedText)) {
       // append the comment
-      if (!comment.empty()) {
-        m_comment += "!" + comment + idfRegex::newLinestring();
+      if (!match->comment.empty()) {
+        m_comment += "!";
+        m_comment += match->comment;
+        m_comment += idfRegex::newLinestring();
       }
 
       // reduce the parsed text
-      parsedText = otherText;
+      parsedText = idfTokenizer::trimLeft(match->next);
     }
 
     // remove trailing whitespace and new lines
@@ -1491,35 +1612,27 @@ namespace detail {
     parseFields(parsedText);
   }
 
-  void IdfObject_Impl::parseFields(const std::string& text) {
-    // match variables
-    boost::match_results<std::string::const_iterator> matches;
-
+  void IdfObject_Impl::parseFields(std::string_view text) {
     // cut down on this text as we parse
-    std::string::const_iterator start = text.begin();
-    std::string::const_iterator stop = text.end();
+    std::string_view remainingText = text;
 
     // current idd field index
     unsigned iddFieldIndex = 0;
 
     // parse all the fields
-    while (boost::regex_search(start, stop, matches, idfRegex::line())) {
-      std::string fieldText(matches[1].first, matches[1].second);
-      boost::trim(fieldText);
-      std::string commentOrOtherText(matches[2].first, matches[2].second);
-      boost::trim(commentOrOtherText);
+    while (boost::optional<idfTokenizer::LineMatch> match = idfTokenizer::searchLine(remainingText)) {
+      std::string fieldText(idfTokenizer::trim(match->content));
+      std::string_view commentOrOtherText = idfTokenizer::trim(match->remainder);
 
-      if (commentOrOtherText.empty() || boost::regex_match(commentOrOtherText, idfRegex::commentOnlyLine())) {
+      if (commentOrOtherText.empty() || idfTokenizer::matchCommentOnlyLine(commentOrOtherText)) {
         // reduce the text
-        start = matches[3].first;
-        stop = matches[3].second;
+        remainingText = match->next;
       } else {
         // reduce the text; there may be multiple fields on this line
-        start = matches[2].first;
-        stop = matches[3].second;
+        remainingText = std::string_view(match->remainder.data(), match->next.data() + match->next.size() - match->remainder.data());
 
-        // matches[2] is not a comment
-        commentOrOtherText.clear();
+        // match->remainder is not a comment
+        commentOrOtherText = std::string_view();
       }
 
       // get the idd field
@@ -1532,9 +1645,9 @@ namespace detail {
 
         if (!commentOrOtherText.empty()) {
           // drop default comments
-          if (!boost::regex_match(commentOrOtherText, commentRegex::editorCommentWhitespaceOnlyLine())) {
+          if (!idfTokenizer::isEditorCommentWhitespaceOnlyLine(commentOrOtherText)) {
             m_fieldComments.resize(m_fields.size());
-            m_fieldComments.back() = commentOrOtherText;
+            m_fieldComments.back() = std::string(commentOrOtherText);
           }
         }
 
@@ -1552,7 +1665,7 @@ namespace detail {
                                          << "Cutting off IdfObject field parsing here, with the following text "
                                          << "remaining: " << '\n'
                                          << fieldText << '\n'
-                                         << std::string(start, stop));
+                                         << remainingText);
         return;
       }
 
@@ -1560,8 +1673,7 @@ namespace detail {
       ++iddFieldIndex;
     }  // while line matches
 
-    std::string unparsedText(start, stop);
-    boost::trim(unparsedText);
+    std::string_view unparsedText = idfTokenizer::trim(remainingText);
     if (!unparsedText.empty()) {
       LOG(Warn, "After parsing IdfObject fields, the following text remains unprocessed: " << '\n' << unparsedText);
     }
@@ -1571,6 +1683,8 @@ namespace detail {
 
   bool IdfObject_Impl::setIddObject(const IddObject& iddObject) {
     m_iddObject = iddObject;
+    // field types may have changed
+    m_numericFields.clear();
     if (m_fields.size() < minFields()) {
       m_fields.resize(minFields());
     } else {
@@ -1585,6 +1699,7 @@ namespace detail {
         }
       }
     }
+    resizeNumericFields();
     return true;
   }
 
@@ -1937,6 +2052,48 @@ namespace detail {
     return m_fieldComments;
   }
 
+  const IdfObject_Impl::NumericField* IdfObject_Impl::numericField(unsigned index) const {
+    if ((index >= m_numericFields.size()) || (m_numericFields[index].state == NumericField::NotNumeric)) {
+      return nullptr;
+    }
+    return &m_numericFields[index];
+  }
+
+  IdfObject_Impl::NumericField IdfObject_Impl::parseNumericField(unsigned index) const {
+    NumericField result;
+    OptionalIddField iddField = m_iddObject.getField(index);
+    if (iddField && ((iddField->properties().type == IddFieldType::RealType) || (iddField->properties().type == IddFieldType::IntegerType))) {
+      std::string value = decodeString(m_fields[index]);
+      if (value.empty()) {
+        result.state = NumericField::Blank;
+      } else if (istringEqual(value, "autosize") || istringEqual(value, "autocalculate")) {
+        result.state = NumericField::AutoValue;
+      } else {
+        try {
+          result.value = boost::lexical_cast<double>(value);
+          result.state = NumericField::Number;
+        } catch (const std::exception&) {
+          result.state = NumericField::Invalid;
+        }
+      }
+    }
+    return result;
+  }
+
+  void IdfObject_Impl::resizeNumericFields() {
+    unsigned n = m_numericFields.size();
+    m_numericFields.resize(m_fields.size());
+    for (unsigned i = n; i < m_numericFields.size(); ++i) {
+      m_numericFields[i] = parseNumericField(i);
+    }
+  }
+
+  void IdfObject_Impl::resetNumericField(unsigned index) {
+    if (index < m_numericFields.size()) {
+      m_numericFields[index] = parseNumericField(index);
+    }
+  }
+
   std::string IdfObject_Impl::encodeString(const std::string& value) const {
     std::string result;
     for (auto const& s : value) {
@@ -2257,6 +2414,10 @@ OptionalIdfObject IdfObject::load(const std::string& text, const IddObject& iddO
   return boost::none;
 }
 
+IdfObject IdfObject::rebind(const IddObject& iddObject) const {
+  return IdfObject(m_impl->rebind(iddObject));
+}
+
 int IdfObject::printedFieldSpace() {
   return 38;
 }
@@ -348,6 +348,13 @@ class UTILITIES_API IdfObject
   /** Constructor from text and an explicit iddObject. */
   static boost::optional<IdfObject> load(const std::string& text, const IddObject& iddObject);
 
+  /** Returns a deep copy of this object that uses iddObject, typically the IddObject of the same
+   *  name in a newer IddFile. The result matches what printing this object and loading the text
+   *  with load(text, iddObject) would give: the handle is kept, fields that iddObject does not
+   *  have are dropped and required fields are added. If iddObject is Catchall, the object type
+   *  is moved into the first field (and back out of it for the reverse). */
+  IdfObject rebind(const IddObject& iddObject) const;
+
   /** Returns the width, in characters, of the default amount of space given to field data
    *  during printing. */
   static int printedFieldSpace();
@@ -42,6 +42,7 @@
 #include <boost/optional.hpp>
 
 #include <string>
+#include <string_view>
 #include <ostream>
 #include <vector>
 
@@ -332,6 +333,10 @@ namespace detail {
      *  be invalid at enums::Strictness level None.) */
     static std::shared_ptr<IdfObject_Impl> load(const std::string& text, const IddObject& iddObject);
 
+    /** Deep copy of this object that uses iddObject. Fields and comments are carried over as they
+     *  would be by printing this object and loading the text with load(text, iddObject). */
+    std::shared_ptr<IdfObject_Impl> rebind(const IddObject& iddObject) const;
+
     /** Serialize this object to os as Idf text. */
     std::ostream& print(std::ostream& os) const;
 
@@ -344,6 +349,10 @@ namespace detail {
      *  field value is followed by a ','. Otherwise, the object is ended by using a ';'. */
     std::ostream& printField(std::ostream& os, unsigned index, bool isLastField = false) const;
 
+    /** Append the same text as print to buffer. Goes through neither an ostream nor a copy of this
+     *  object, so many objects can be serialized into one reused buffer. */
+    void appendText(std::string& buffer) const;
+
     //@}
     /** @name Type Casting */
     //@{
@@ -362,6 +371,10 @@ namespace detail {
     /** Emits signals after batch update and error checking is complete, clears the diffs */
     virtual void emitChangeSignals();
 
+    /** Called before the fields or comments of this object change. Does nothing here, WorkspaceObject_Impl
+     *  uses it to save the object's state in its Workspace's journal. */
+    virtual void journalChange();
+
     //@}
 
     //@}
@@ -394,6 +407,25 @@ namespace detail {
     std::vector<std::string> m_fields;
     std::vector<std::string> m_fieldComments;  // only populated if encounter non-empty, non-default comment
 
+    // parsed values of Real and Integer fields. m_fields remains the data of record; entries are
+    // parsed whenever their field is set, and the cache is kept the same size as m_fields by the
+    // methods that add or remove fields. Const getters only read it, so shared objects can be read
+    // from several threads.
+    struct NumericField
+    {
+      enum State : unsigned char
+      {
+        NotNumeric,  // not a Real or Integer field
+        Number,
+        Blank,
+        AutoValue,  // autosize or autocalculate
+        Invalid     // text does not convert, left to the string path so the error is logged
+      };
+      double value = 0.0;
+      State state = NotNumeric;
+    };
+    std::vector<NumericField> m_numericFields;
+
     // idf differences
     std::vector<IdfObjectDiff> m_diffs;
 
@@ -403,6 +435,25 @@ namespace detail {
 
     std::vector<std::string> fieldComments() const;
 
+    // Returns the parsed value of a Real or Integer field. Returns nullptr for other fields, and for
+    // fields the cache does not cover.
+    const NumericField* numericField(unsigned index) const;
+
+    // Parses the text of field index according to its IddField.
+    NumericField parseNumericField(unsigned index) const;
+
+    // Text appendText prints for field index. WorkspaceObject_Impl prints pointers as handles or
+    // target names instead of the stored text; scratch holds any value computed here.
+    virtual const std::string& printedField(unsigned index, std::string& scratch) const;
+
+    // SETTER HELPERS
+
+    // Call after the number of fields changes. Parses the fields added at the end.
+    void resizeNumericFields();
+
+    // Call after the text of field index changes. Parses it again.
+    void resetNumericField(unsigned index);
+
     virtual OSOptionalQuantity getQuantityFromDouble(unsigned index, boost::optional<double> value, bool returnIP) const;
 
     virtual boost::optional<double> getDoubleFromQuantity(unsigned index, const Quantity& q) const;
@@ -436,7 +487,18 @@ namespace detail {
     void parse(const std::string& text, bool getIddFromFactory);
 
     // parse fields
-    void parseFields(const std::string& text);
+    void parseFields(std::string_view text);
+
+    // SERIALIZATION HELPERS
+
+    // The one IDF text formatter behind print, printName, printField and appendText. If printedFields,
+    // field values come from printedField, otherwise from m_fields.
+    void appendText(std::string& buffer, bool printedFields) const;
+    void appendName(std::string& buffer, bool hasFields) const;
+    // textWidth carries the width of the current vertex across its fields
+    void appendField(std::string& buffer, unsigned index, const std::string& value, bool isLastField, int& textWidth) const;
+    // default comment for field index, as returned by fieldComment(index, true) when no comment is set
+    void appendDefaultFieldComment(std::string& buffer, unsigned index) const;
 
     // GETTER AND SETTER HELPERS
 
@@ -0,0 +1,196 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2021, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#include "IdfTokenizer.hpp"
+
+namespace openstudio {
+namespace idfTokenizer {
+
+  namespace {
+
+    // \s and std::isspace in the classic locale
+    bool isSpace(char c) {
+      return (c == ' ') || (c == '\t') || (c == '\n') || (c == '\v') || (c == '\f') || (c == '\r');
+    }
+
+    // \h
+    bool isHorizontalSpace(char c) {
+      return (c == ' ') || (c == '\t');
+    }
+
+    // characters after which ^ matches, except between "\r" and "\n"
+    bool isLineSeparator(char c) {
+      return (c == '\n') || (c == '\r') || (c == '\f');
+    }
+
+  }  // namespace
+
+  boost::optional<LineMatch> searchLine(std::string_view text) {
+    // "^([^!]*?)[,;]([^\\n]*[\\n]?)(.*)"
+    std::size_t start = 0;
+    while (true) {
+      std::size_t separator = text.find_first_of("!,;", start);
+      if (separator == std::string_view::npos) {
+        // no separator can follow any later line start either
+        return boost::none;
+      }
+
+      if (text[separator] != '!') {
+        std::size_t newLine = text.find('\n', separator + 1);
+        std::size_t next = (newLine == std::string_view::npos) ? text.size() : newLine + 1;
+        return LineMatch{text.substr(start, separator - start), text.substr(separator + 1, next - separator - 1), text.substr(next)};
+      }
+
+      // no match from this line start, or any line start before the '!', try the next line start after it
+      std::size_t lineStart = std::string_view::npos;
+      for (std::size_t i = separator + 1; i < text.size(); ++i) {
+        if (isLineSeparator(text[i]) && !((text[i] == '\r') && (i + 1 < text.size()) && (text[i + 1] == '\n'))) {
+          lineStart = i + 1;
+          break;
+        }
+      }
+      if (lineStart == std::string_view::npos) {
+        return boost::none;
+      }
+      start = lineStart;
+    }
+  }
+
+  boost::optional<CommentMatch> matchCommentOnlyLine(std::string_view text) {
+    // "^[\\s\\t]*[!]([^\\n]*)[\\n]?(.*)"
+    std::size_t i = 0;
+    while ((i < text.size()) && isSpace(text[i])) {
+      ++i;
+    }
+    if ((i == text.size()) || (text[i] != '!')) {
+      return boost::none;
+    }
+    ++i;
+
+    std::size_t newLine = text.find('\n', i);
+    if (newLine == std::string_view::npos) {
+      return CommentMatch{text.substr(i), text.substr(text.size())};
+    }
+    return CommentMatch{text.substr(i, newLine - i), text.substr(newLine + 1)};
+  }
+
+  bool isObjectEnd(std::string_view line) {
+    // "^[^!]*?[;].*"
+    std::size_t i = line.find_first_of("!;");
+    return (i != std::string_view::npos) && (line[i] == ';');
+  }
+
+  bool isVersionObjectName(std::string_view objectType) {
+    // ".*[vV]ersion.*"
+    return (objectType.find("version") != std::string_view::npos) || (objectType.find("Version") != std::string_view::npos);
+  }
+
+  bool isWhitespaceOnlyLine(std::string_view line) {
+    // "^[\\h]*$"
+    for (char c : line) {
+      if (!isHorizontalSpace(c)) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  bool isWhitespaceOnlyBlock(std::string_view text) {
+    // "[\\s]*"
+    for (char c : text) {
+      if (!isSpace(c)) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  bool isEditorCommentWhitespaceOnlyLine(std::string_view line) {
+    // "^[\\h]*(?:!-([^\\n\\r\\v]*))?$"
+    std::size_t i = 0;
+    while ((i < line.size()) && isHorizontalSpace(line[i])) {
+      ++i;
+    }
+    if (i == line.size()) {
+      return true;
+    }
+    if (line.substr(i, 2) != "!-") {
+      return false;
+    }
+    return line.find_first_of("\n\r\v", i + 2) == std::string_view::npos;
+  }
+
+  std::string_view trimLeft(std::string_view text) {
+    std::size_t i = 0;
+    while ((i < text.size()) && isSpace(text[i])) {
+      ++i;
+    }
+    return text.substr(i);
+  }
+
+  std::string_view trimRight(std::string_view text) {
+    std::size_t n = text.size();
+    while ((n > 0) && isSpace(text[n - 1])) {
+      --n;
+    }
+    return text.substr(0, n);
+  }
+
+  std::string_view trim(std::string_view text) {
+    return trimRight(trimLeft(text));
+  }
+
+  LineReader::LineReader(std::string_view buffer) : m_buffer(buffer), m_position(0) {}
+
+  bool LineReader::getline(std::string_view& line) {
+    if (m_position >= m_buffer.size()) {
+      return false;
+    }
+
+    std::size_t end = m_buffer.find_first_of("\r\n", m_position);
+    if (end == std::string_view::npos) {
+      line = m_buffer.substr(m_position);
+      m_position = m_buffer.size();
+      return true;
+    }
+
+    line = m_buffer.substr(m_position, end - m_position);
+    m_position = end + 1;
+    if ((m_buffer[end] == '\r') && (m_position < m_buffer.size()) && (m_buffer[m_position] == '\n')) {
+      ++m_position;
+    }
+    return true;
+  }
+
+  std::size_t LineReader::position() const {
+    return m_position;
+  }
+
+}  // namespace idfTokenizer
+}  // namespace openstudio
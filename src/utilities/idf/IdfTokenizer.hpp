@@ -0,0 +1,108 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2021, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#ifndef UTILITIES_IDF_IDFTOKENIZER_HPP
+#define UTILITIES_IDF_IDFTOKENIZER_HPP
+
+#include "../UtilitiesAPI.hpp"
+
+#include <boost/optional.hpp>
+
+#include <string_view>
+
+namespace openstudio {
+namespace idfTokenizer {
+
+  // Hand written equivalents of the regular expressions in idfRegex, iddRegex and commentRegex used to load Idf text.
+  // Each function gives exactly the same result as the regular expression it names, but works on string_views into
+  // the original text so that loading does not copy or backtrack.
+
+  // Groups of a match of idfRegex::line()
+  struct LineMatch
+  {
+    std::string_view content;    // matches[1], before separator
+    std::string_view remainder;  // matches[2], after separator and up to and including new line
+    std::string_view next;       // matches[3], after new line
+  };
+
+  // Equivalent to boost::regex_search(text, matches, idfRegex::line())
+  UTILITIES_API boost::optional<LineMatch> searchLine(std::string_view text);
+
+  // Groups of a match of idfRegex::commentOnlyLine()
+  struct CommentMatch
+  {
+    std::string_view comment;  // matches[1], the comment
+    std::string_view next;     // matches[2], after new line
+  };
+
+  // Equivalent to boost::regex_match(text, matches, idfRegex::commentOnlyLine())
+  UTILITIES_API boost::optional<CommentMatch> matchCommentOnlyLine(std::string_view text);
+
+  // Equivalent to boost::regex_match(line, idfRegex::objectEnd())
+  UTILITIES_API bool isObjectEnd(std::string_view line);
+
+  // Equivalent to boost::regex_match(objectType, iddRegex::versionObjectName())
+  UTILITIES_API bool isVersionObjectName(std::string_view objectType);
+
+  // Equivalent to boost::regex_match(line, commentRegex::whitespaceOnlyLine())
+  UTILITIES_API bool isWhitespaceOnlyLine(std::string_view line);
+
+  // Equivalent to boost::regex_match(text, commentRegex::whitespaceOnlyBlock())
+  UTILITIES_API bool isWhitespaceOnlyBlock(std::string_view text);
+
+  // Equivalent to boost::regex_match(line, commentRegex::editorCommentWhitespaceOnlyLine())
+  UTILITIES_API bool isEditorCommentWhitespaceOnlyLine(std::string_view line);
+
+  // Equivalent to boost::trim_left, boost::trim_right and boost::trim in the classic locale
+  UTILITIES_API std::string_view trimLeft(std::string_view text);
+  UTILITIES_API std::string_view trimRight(std::string_view text);
+  UTILITIES_API std::string_view trim(std::string_view text);
+
+  /** LineReader splits a buffer into lines exactly as std::getline does on a stream passed through a posix
+   *  boost::iostreams::newline_filter, ie "\r\n", "\r" and "\n" all end a line and are not part of it. */
+  class UTILITIES_API LineReader
+  {
+   public:
+    explicit LineReader(std::string_view buffer);
+
+    // sets line to the next line and returns true, returns false at the end of the buffer
+    bool getline(std::string_view& line);
+
+    // offset of the next line in the buffer
+    std::size_t position() const;
+
+   private:
+    std::string_view m_buffer;
+    std::size_t m_position;
+  };
+
+}  // namespace idfTokenizer
+}  // namespace openstudio
+
+#endif  // UTILITIES_IDF_IDFTOKENIZER_HPP
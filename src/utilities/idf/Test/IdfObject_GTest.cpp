@@ -849,3 +849,96 @@ TEST_F(IdfFixture, IdfObject_ExtensibleGroup_Failure_4268_TruncatedExtensibleFie
   ASSERT_NO_THROW(obj.numExtensibleGroups());
   EXPECT_EQ(2, obj.numExtensibleGroups());
 }
+
+TEST_F(IdfFixture, IdfObject_Rebind) {
+  IdfObject building(IddObjectType::OS_Building);
+  EXPECT_TRUE(building.setName("My Building"));
+  EXPECT_TRUE(building.setDouble(OS_BuildingFields::NorthAxis, 30.0));
+  building.setComment("! Rebind me");
+  IddObject iddObject = building.iddObject();
+
+  // same result as printing and loading the text
+  std::stringstream ss;
+  building.print(ss);
+  OptionalIdfObject loaded = IdfObject::load(ss.str(), iddObject);
+  ASSERT_TRUE(loaded);
+
+  IdfObject rebound = building.rebind(iddObject);
+  EXPECT_FALSE(rebound == building);
+  EXPECT_EQ(building.handle(), rebound.handle());
+  EXPECT_EQ(loaded->handle(), rebound.handle());
+  EXPECT_EQ(building.comment(), rebound.comment());
+  ASSERT_EQ(loaded->numFields(), rebound.numFields());
+  for (unsigned i = 0, n = rebound.numFields(); i < n; ++i) {
+    EXPECT_EQ(loaded->getString(i).get(), rebound.getString(i).get());
+  }
+
+  // the copy does not share data
+  EXPECT_TRUE(rebound.setName("Other Building"));
+  EXPECT_EQ("My Building", building.nameString());
+
+  // Catchall objects keep the object type in the first field
+  IdfObject catchall = building.rebind(IddObject());
+  EXPECT_EQ(IddObjectType::Catchall, catchall.iddObject().type());
+  ASSERT_EQ(building.numFields() + 1, catchall.numFields());
+  EXPECT_EQ("OS:Building", catchall.getString(0).get());
+  EXPECT_EQ("My Building", catchall.getString(OS_BuildingFields::Name + 1).get());
+
+  IdfObject back = catchall.rebind(iddObject);
+  EXPECT_EQ(building.handle(), back.handle());
+  ASSERT_EQ(building.numFields(), back.numFields());
+  for (unsigned i = 0, n = back.numFields(); i < n; ++i) {
+    EXPECT_EQ(building.getString(i).get(), back.getString(i).get());
+  }
+}
+
+TEST_F(IdfFixture, IdfObject_NumericFieldCache) {
+  IdfObject building(IddObjectType::OS_Building);
+
+  // blank field falls back to the default only when asked
+  EXPECT_FALSE(building.getDouble(OS_BuildingFields::NorthAxis));
+  ASSERT_TRUE(building.getDouble(OS_BuildingFields::NorthAxis, true));
+  EXPECT_DOUBLE_EQ(0.0, building.getDouble(OS_BuildingFields::NorthAxis, true).get());
+
+  // repeated reads see every change to the field
+  EXPECT_TRUE(building.setDouble(OS_BuildingFields::NorthAxis, 30.0));
+  ASSERT_TRUE(building.getDouble(OS_BuildingFields::NorthAxis));
+  EXPECT_DOUBLE_EQ(30.0, building.getDouble(OS_BuildingFields::NorthAxis).get());
+  EXPECT_TRUE(building.setString(OS_BuildingFields::NorthAxis, "45.5"));
+  ASSERT_TRUE(building.getDouble(OS_BuildingFields::NorthAxis));
+  EXPECT_DOUBLE_EQ(45.5, building.getDouble(OS_BuildingFields::NorthAxis).get());
+  EXPECT_TRUE(building.setString(OS_BuildingFields::NorthAxis, "autocalculate"));
+  EXPECT_FALSE(building.getDouble(OS_BuildingFields::NorthAxis));
+  EXPECT_TRUE(building.setString(OS_BuildingFields::NorthAxis, "not a number"));
+  EXPECT_FALSE(building.getDouble(OS_BuildingFields::NorthAxis));
+  EXPECT_TRUE(building.setString(OS_BuildingFields::NorthAxis, ""));
+  EXPECT_FALSE(building.getDouble(OS_BuildingFields::NorthAxis));
+
+  // integer fields
+  EXPECT_TRUE(building.setInt(OS_BuildingFields::StandardsNumberofStories, 3));
+  ASSERT_TRUE(building.getInt(OS_BuildingFields::StandardsNumberofStories));
+  EXPECT_EQ(3, building.getInt(OS_BuildingFields::StandardsNumberofStories).get());
+  ASSERT_TRUE(building.getUnsigned(OS_BuildingFields::StandardsNumberofStories));
+  EXPECT_EQ(3u, building.getUnsigned(OS_BuildingFields::StandardsNumberofStories).get());
+  EXPECT_TRUE(building.setInt(OS_BuildingFields::StandardsNumberofStories, -1));
+  EXPECT_EQ(-1, building.getInt(OS_BuildingFields::StandardsNumberofStories).get());
+  EXPECT_FALSE(building.getUnsigned(OS_BuildingFields::StandardsNumberofStories));
+
+  // the text is what gets written out
+  EXPECT_TRUE(building.setString(OS_BuildingFields::NominalFloortoFloorHeight, "3.50"));
+  ASSERT_TRUE(building.getDouble(OS_BuildingFields::NominalFloortoFloorHeight));
+  EXPECT_DOUBLE_EQ(3.5, building.getDouble(OS_BuildingFields::NominalFloortoFloorHeight).get());
+  EXPECT_EQ("3.50", building.getString(OS_BuildingFields::NominalFloortoFloorHeight).get());
+  std::stringstream ss;
+  building.print(ss);
+  OptionalIdfObject loaded = IdfObject::load(ss.str());
+  ASSERT_TRUE(loaded);
+  EXPECT_EQ("3.50", loaded->getString(OS_BuildingFields::NominalFloortoFloorHeight).get());
+  ASSERT_TRUE(loaded->getDouble(OS_BuildingFields::NominalFloortoFloorHeight));
+  EXPECT_DOUBLE_EQ(3.5, loaded->getDouble(OS_BuildingFields::NominalFloortoFloorHeight).get());
+
+  // clones read the same values
+  IdfObject clone = building.clone();
+  EXPECT_EQ(-1, clone.getInt(OS_BuildingFields::StandardsNumberofStories).get());
+  EXPECT_DOUBLE_EQ(3.5, clone.getDouble(OS_BuildingFields::NominalFloortoFloorHeight).get());
+}
@@ -0,0 +1,389 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2021, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#include <gtest/gtest.h>
+#include "IdfFixture.hpp"
+
+#include "../IdfTokenizer.hpp"
+#include "../IdfRegex.hpp"
+#include "../IdfObject.hpp"
+#include "../../idd/IddRegex.hpp"
+#include "../../idd/CommentRegex.hpp"
+#include "../../core/Filesystem.hpp"
+
+#include <utilities/idd/IddEnums.hxx>
+
+#include <boost/algorithm/string.hpp>
+#include <boost/iostreams/filter/newline.hpp>
+#include <boost/iostreams/filtering_stream.hpp>
+
+#include <sstream>
+
+using namespace openstudio;
+
+namespace {
+
+// Lines that exercise the corner cases of the regular expressions
+std::vector<std::string> edgeCases() {
+  return {"",
+          " ",
+          "\t \t",
+          "\f",
+          "\v",
+          "!",
+          "  ! comment",
+          "\n\n  ! comment\nZone,",
+          "Zone,",
+          "  Zone ,  Name;  !- Name",
+          "Zone; ! comment",
+          "Zone, ! comment; not a field",
+          "! comment, with a comma",
+          "a, b, c;",
+          "a!b,c",
+          "a!b\nc,d",
+          "a!b\rc,d",
+          "a!b\r\nc,d",
+          "a!b\fc,d",
+          "a!b\vc,d",
+          "a!\r",
+          "a!\n",
+          "a,\r\nb;",
+          "a,\nb,\n  ! standalone\nc;",
+          "   ,  ;  ",
+          ";",
+          "!- Name",
+          "  !- Name",
+          "!-",
+          "!- Name\r",
+          "!- Name\v",
+          "!- Name\nmore",
+          "! Name",
+          "Version",
+          "version",
+          "VERSION",
+          "OS:Version",
+          "Output:Variable,*,Site Outdoor Air Drybulb Temperature,hourly; !- comment",
+          std::string("a\0b,c", 5)};
+}
+
+// Every line and every object sized chunk of the resource idf and osm files
+std::vector<openstudio::path> corpusPaths() {
+  std::vector<openstudio::path> result;
+  for (const auto& subdirectory : {"energyplus", "model"}) {
+    for (openstudio::filesystem::recursive_directory_iterator it(resourcesPath() / toPath(subdirectory)), itEnd; it != itEnd; ++it) {
+      std::string ext = toString(it->path().extension());
+      if ((ext == ".idf") || (ext == ".osm")) {
+        result.push_back(it->path());
+      }
+    }
+  }
+  std::sort(result.begin(), result.end());
+  return result;
+}
+
+std::string readFile(const openstudio::path& p) {
+  openstudio::filesystem::ifstream file(p, std::ios_base::binary);
+  std::stringstream ss;
+  ss << file.rdbuf();
+  return ss.str();
+}
+
+void expectLineMatchesRegex(const std::string& text) {
+  boost::smatch matches;
+  bool regexResult = boost::regex_search(text, matches, idfRegex::line());
+  boost::optional<idfTokenizer::LineMatch> result = idfTokenizer::searchLine(text);
+  ASSERT_EQ(regexResult, result.has_value()) << "'" << text << "'";
+  if (result) {
+    EXPECT_EQ(std::string(matches[1].first, matches[1].second), result->content) << "'" << text << "'";
+    EXPECT_EQ(std::string(matches[2].first, matches[2].second), result->remainder) << "'" << text << "'";
+    EXPECT_EQ(std::string(matches[3].first, matches[3].second), result->next) << "'" << text << "'";
+  }
+}
+
+void expectMatchesRegex(const std::string& text) {
+  expectLineMatchesRegex(text);
+
+  boost::smatch matches;
+  bool regexResult = boost::regex_match(text, matches, idfRegex::commentOnlyLine());
+  boost::optional<idfTokenizer::CommentMatch> comment = idfTokenizer::matchCommentOnlyLine(text);
+  ASSERT_EQ(regexResult, comment.has_value()) << "'" << text << "'";
+  if (comment) {
+    EXPECT_EQ(std::string(matches[1].first, matches[1].second), comment->comment) << "'" << text << "'";
+    EXPECT_EQ(std::string(matches[2].first, matches[2].second), comment->next) << "'" << text << "'";
+  }
+
+  EXPECT_EQ(boost::regex_match(text, idfRegex::objectEnd()), idfTokenizer::isObjectEnd(text)) << "'" << text << "'";
+  EXPECT_EQ(boost::regex_match(text, iddRegex::versionObjectName()), idfTokenizer::isVersionObjectName(text)) << "'" << text << "'";
+  EXPECT_EQ(boost::regex_match(text, commentRegex::whitespaceOnlyLine()), idfTokenizer::isWhitespaceOnlyLine(text)) << "'" << text << "'";
+  EXPECT_EQ(boost::regex_match(text, commentRegex::whitespaceOnlyBlock()), idfTokenizer::isWhitespaceOnlyBlock(text)) << "'" << text << "'";
+  EXPECT_EQ(boost::regex_match(text, commentRegex::editorCommentWhitespaceOnlyLine()), idfTokenizer::isEditorCommentWhitespaceOnlyLine(text))
+    << "'" << text << "'";
+
+  EXPECT_EQ(boost::trim_left_copy(text), idfTokenizer::trimLeft(text));
+  EXPECT_EQ(boost::trim_right_copy(text), idfTokenizer::trimRight(text));
+  EXPECT_EQ(boost::trim_copy(text), idfTokenizer::trim(text));
+}
+
+std::vector<std::string> filteredLines(const std::string& text) {
+  std::istringstream is(text);
+  boost::iostreams::filtering_istream filt;
+  filt.push(boost::iostreams::newline_filter(boost::iostreams::newline::posix));
+  filt.push(is);
+
+  std::vector<std::string> result;
+  std::string line;
+  while (std::getline(filt, line)) {
+    result.push_back(line);
+  }
+  return result;
+}
+
+std::vector<std::string> readerLines(const std::string& text) {
+  idfTokenizer::LineReader reader(text);
+  std::vector<std::string> result;
+  std::string_view line;
+  while (reader.getline(line)) {
+    result.push_back(std::string(line));
+  }
+  return result;
+}
+
+// Reference object parse, the regular expression based implementation of IdfObject_Impl::parse that the tokenizer replaced
+struct ReferenceObject
+{
+  std::string comment;
+  std::vector<std::string> fields;
+  std::vector<std::string> fieldComments;
+};
+
+ReferenceObject referenceParse(const std::string& text, const IddObject& iddObject) {
+  ReferenceObject result;
+  IddObject idd(iddObject);
+  std::string parsedText(text);
+  boost::smatch matches;
+
+  auto parseComments = [&]() {
+    while (boost::regex_match(parsedText, idfRegex::commentOnlyLine()) && boost::regex_search(parsedText, matches, idfRegex::commentOnlyLine())) {
+      std::string comment(matches[1].first, matches[1].second);
+      std::string otherText(matches[2].first, matches[2].second);
+      boost::trim_left(otherText);
+      if (!comment.empty()) {
+        result.comment += "!" + comment + idfRegex::newLinestring();
+      }
+      parsedText = otherText;
+    }
+  };
+
+  parseComments();
+  if (boost::regex_search(parsedText, matches, idfRegex::line())) {
+    std::string objectType(matches[1].first, matches[1].second);
+    boost::trim(objectType);
+    std::string commentOrOtherText(matches[2].first, matches[2].second);
+    boost::trim_left(commentOrOtherText);
+    std::string otherText(matches[3].first, matches[3].second);
+    if (!boost::iequals(objectType, idd.name())) {
+      idd = IddObject();
+      result.fields.push_back(objectType);
+    }
+    if (boost::regex_match(commentOrOtherText, idfRegex::commentOnlyLine())
+        || boost::regex_match(commentOrOtherText, commentRegex::whitespaceOnlyBlock())) {
+      result.comment += commentOrOtherText;
+      parsedText = otherText;
+    } else {
+      parsedText = commentOrOtherText + otherText;
+    }
+  }
+  parseComments();
+  boost::trim_right(result.comment);
+
+  boost::match_results<std::string::const_iterator> fieldMatches;
+  std::string::const_iterator start = parsedText.begin();
+  std::string::const_iterator stop = parsedText.end();
+  unsigned iddFieldIndex = 0;
+  while (boost::regex_search(start, stop, fieldMatches, idfRegex::line())) {
+    std::string fieldText(fieldMatches[1].first, fieldMatches[1].second);
+    boost::trim(fieldText);
+    std::string commentOrOtherText(fieldMatches[2].first, fieldMatches[2].second);
+    boost::trim(commentOrOtherText);
+    if (commentOrOtherText.empty() || boost::regex_match(commentOrOtherText, idfRegex::commentOnlyLine())) {
+      start = fieldMatches[3].first;
+      stop = fieldMatches[3].second;
+    } else {
+      start = fieldMatches[2].first;
+      stop = fieldMatches[3].second;
+      commentOrOtherText.clear();
+    }
+    if (!idd.getField(iddFieldIndex)) {
+      break;
+    }
+    result.fields.push_back(fieldText);
+    if (!commentOrOtherText.empty() && !boost::regex_match(commentOrOtherText, commentRegex::editorCommentWhitespaceOnlyLine())) {
+      result.fieldComments.resize(result.fields.size());
+      result.fieldComments.back() = commentOrOtherText;
+    }
+    ++iddFieldIndex;
+  }
+  return result;
+}
+
+// Reference file split, the regular expression based implementation of IdfFile::m_load that the tokenizer replaced
+std::vector<std::pair<std::string, IddObject>> referenceObjectTexts(const std::string& fileText, const IddFile& iddFile) {
+  std::vector<std::pair<std::string, IddObject>> result;
+  std::vector<std::string> lines = filteredLines(fileText);
+  std::string comment;
+  bool firstBlock = true;
+  boost::smatch matches;
+  for (auto it = lines.begin(); it != lines.end(); ++it) {
+    const std::string& line = *it;
+    if (boost::regex_match(line, idfRegex::commentOnlyLine())) {
+      comment += (line + idfRegex::newLinestring());
+    } else if (boost::regex_match(line, commentRegex::whitespaceOnlyLine())) {
+      boost::trim(comment);
+      if (!comment.empty()) {
+        if (firstBlock) {
+          firstBlock = false;
+        } else if (boost::optional<IddObject> commentOnly = iddFile.getObject(IddObjectType::CommentOnly)) {
+          result.push_back(std::make_pair(commentOnly->name() + ";" + comment, *commentOnly));
+        }
+      }
+      comment = "";
+    } else {
+      firstBlock = false;
+      std::string objectType = "Catchall";
+      if (boost::regex_search(line, matches, idfRegex::line())) {
+        objectType = std::string(matches[1].first, matches[1].second);
+        boost::trim(objectType);
+      }
+      boost::optional<IddObject> iddObject = iddFile.getObject(objectType);
+      if (!iddObject) {
+        iddObject = IddObject();
+      }
+      std::string text(comment + idfRegex::newLinestring() + line + idfRegex::newLinestring());
+      comment = "";
+      bool foundEndLine = boost::regex_match(line, idfRegex::objectEnd());
+      while (!foundEndLine && (it + 1 != lines.end())) {
+        ++it;
+        text += (*it + idfRegex::newLinestring());
+        foundEndLine = boost::regex_match(*it, idfRegex::objectEnd());
+      }
+      if (foundEndLine) {
+        result.push_back(std::make_pair(text, *iddObject));
+      }
+    }
+  }
+  return result;
+}
+
+}  // namespace
+
+TEST_F(IdfFixture, IdfTokenizer_EdgeCases) {
+  for (const std::string& text : edgeCases()) {
+    expectMatchesRegex(text);
+  }
+}
+
+TEST_F(IdfFixture, IdfTokenizer_LineReader) {
+  for (const std::string& text : {std::string(""), std::string("\n"), std::string("a"), std::string("a\n"), std::string("a\nb"),
+                                  std::string("a\r\nb\r\n"), std::string("a\rb\r"), std::string("a\r\r\nb"), std::string("a\n\rb"),
+                                  std::string("\r\n\r\n"), std::string("a\n\n\nb\n")}) {
+    EXPECT_EQ(filteredLines(text), readerLines(text)) << "'" << text << "'";
+  }
+}
+
+TEST_F(IdfFixture, IdfTokenizer_MatchesRegexOnResources) {
+  for (const openstudio::path& p : corpusPaths()) {
+    SCOPED_TRACE(toString(p));
+    std::string text = readFile(p);
+
+    std::vector<std::string> lines = filteredLines(text);
+    EXPECT_EQ(lines, readerLines(text));
+
+    // single lines as seen by IdfFile::m_load, and the remainder of the file from each line as seen by IdfObject_Impl::parseFields
+    std::string remainder;
+    for (auto it = lines.rbegin(); it != lines.rend(); ++it) {
+      expectMatchesRegex(*it);
+      remainder = (*it + "\n" + remainder).substr(0, 2000);
+      expectLineMatchesRegex(remainder);
+    }
+  }
+}
+
+TEST_F(IdfFixture, IdfTokenizer_LoadMatchesReference) {
+  for (const openstudio::path& p : corpusPaths()) {
+    SCOPED_TRACE(toString(p));
+    std::string text = readFile(p);
+
+    IddFileType iddFileType = (toString(p.extension()) == ".osm") ? IddFileType::OpenStudio : IddFileType::EnergyPlus;
+    IdfFile emptyFile(iddFileType);
+    std::vector<std::pair<std::string, IddObject>> objectTexts = referenceObjectTexts(text, emptyFile.iddFile());
+
+    std::vector<IdfObject> objects;
+    for (const auto& objectText : objectTexts) {
+      boost::optional<IdfObject> object = IdfObject::load(objectText.first, objectText.second);
+      if (!object) {
+        continue;
+      }
+      if (!object->iddObject().isVersionObject()) {
+        objects.push_back(*object);
+      }
+
+      ReferenceObject reference = referenceParse(objectText.first, objectText.second);
+      EXPECT_EQ(reference.comment, object->comment());
+      ASSERT_LE(reference.fields.size(), object->numFields());
+      for (unsigned i = 0; i < reference.fields.size(); ++i) {
+        EXPECT_EQ(reference.fields[i], object->getString(i, false, false).get());
+        std::string fieldComment = (i < reference.fieldComments.size()) ? reference.fieldComments[i] : std::string();
+        EXPECT_EQ(fieldComment, object->fieldComment(i).get());
+      }
+    }
+
+    // whole file goes through the same objects in the same order, version is handled separately
+    std::istringstream is(text);
+    boost::optional<IdfFile> idfFile = IdfFile::load(is, iddFileType);
+    if (objects.empty()) {
+      continue;
+    }
+    ASSERT_TRUE(idfFile);
+    std::vector<IdfObject> loaded = idfFile->objects();
+    unsigned j = 0;
+    for (const IdfObject& object : loaded) {
+      if (object.iddObject().isVersionObject()) {
+        continue;
+      }
+      ASSERT_LT(j, objects.size());
+      std::stringstream expected;
+      std::stringstream actual;
+      objects[j].print(expected);
+      object.print(actual);
+      EXPECT_EQ(expected.str(), actual.str());
+      ++j;
+    }
+    EXPECT_EQ(objects.size(), j);
+  }
+}
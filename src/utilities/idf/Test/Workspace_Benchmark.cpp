@@ -14,6 +14,8 @@
 #include <utilities/idd/IddEnums.hxx>
 #include <utilities/idd/IddFactory.hxx>
 
+#include <sstream>
+
 //#include <iostream>
 
 using namespace openstudio;
@@ -84,6 +86,32 @@ static void BM_WorkspaceSetNameWithoutAnyChecks(benchmark::State& state) {
   state.SetComplexityN(state.range(0));
 }
 
+static void BM_WorkspaceToIdfFilePrint(benchmark::State& state) {
+  Workspace w = setUpMinimalWorkspace(state.range(0));
+
+  // Code inside this loop is measured repeatedly
+  for (auto _ : state) {
+    std::stringstream ss;
+    w.toIdfFile().print(ss);
+    benchmark::DoNotOptimize(ss);
+  }
+
+  state.SetComplexityN(state.range(0));
+}
+
+static void BM_WorkspacePrint(benchmark::State& state) {
+  Workspace w = setUpMinimalWorkspace(state.range(0));
+
+  // Code inside this loop is measured repeatedly
+  for (auto _ : state) {
+    std::stringstream ss;
+    w.print(ss);
+    benchmark::DoNotOptimize(ss);
+  }
+
+  state.SetComplexityN(state.range(0));
+}
+
 // Regular run, with n=512
 /*
 BENCHMARK(BM_WorkspaceSetNameWithChecks)->Unit(benchmark::kMillisecond)->Arg(512);
@@ -102,3 +130,8 @@ BENCHMARK(BM_WorkspaceSetNameWithoutAnyChecks)
   ->RangeMultiplier(8)
   ->Range(2, 2048)
   ->Complexity();
+
+// 1k to 128k spaces
+BENCHMARK(BM_WorkspaceToIdfFilePrint)->Unit(benchmark::kMillisecond)->RangeMultiplier(8)->Range(1024, 131072)->Complexity();
+
+BENCHMARK(BM_WorkspacePrint)->Unit(benchmark::kMillisecond)->RangeMultiplier(8)->Range(1024, 131072)->Complexity();
@@ -105,6 +105,55 @@ TEST_F(IdfFixture, IdfFile_Workspace_Roundtrip) {
   outFile.close();
 }
 
+TEST_F(IdfFixture, Workspace_Print) {
+  auto readFile = [](const openstudio::path& p) {
+    openstudio::filesystem::ifstream inFile(p, std::ios_base::binary);
+    std::stringstream ss;
+    ss << inFile.rdbuf();
+    return ss.str();
+  };
+
+  // names as pointers
+  Workspace workspace(epIdfFile, StrictnessLevel::None);
+  std::stringstream expected;
+  workspace.toIdfFile().print(expected);
+  std::stringstream printed;
+  workspace.print(printed);
+  EXPECT_EQ(expected.str(), printed.str());
+
+  openstudio::path outPath = outDir / toPath("printedWorkspace.idf");
+  EXPECT_TRUE(workspace.save(outPath, true));
+  EXPECT_FALSE(workspace.save(outPath, false));
+  EXPECT_EQ(expected.str(), readFile(outPath));
+
+  // handles as pointers
+  Workspace osWorkspace(StrictnessLevel::Draft, IddFileType::OpenStudio);
+  OptionalWorkspaceObject zone = osWorkspace.addObject(IdfObject(IddObjectType::OS_ThermalZone));
+  ASSERT_TRUE(zone);
+  OptionalWorkspaceObject space = osWorkspace.addObject(IdfObject(IddObjectType::OS_Space));
+  ASSERT_TRUE(space);
+  OptionalInt zoneIndex = space->iddObject().getFieldIndex("Thermal Zone Name");
+  ASSERT_TRUE(zoneIndex);
+  EXPECT_TRUE(space->setPointer(*zoneIndex, zone->handle()));
+
+  expected.str("");
+  osWorkspace.toIdfFile().print(expected);
+  printed.str("");
+  printed << osWorkspace;
+  EXPECT_EQ(expected.str(), printed.str());
+  EXPECT_NE(std::string::npos, printed.str().find(toString(zone->handle())));
+
+  // compressed
+  openstudio::path gzPath = outDir / toPath("printedWorkspace.osm.gz");
+  EXPECT_TRUE(osWorkspace.saveGzip(outDir / toPath("printedWorkspace"), true));
+  ASSERT_TRUE(openstudio::filesystem::exists(gzPath));
+  std::string compressed = readFile(gzPath);
+  ASSERT_GE(compressed.size(), 2u);
+  EXPECT_EQ('\x1f', compressed[0]);
+  EXPECT_EQ('\x8b', compressed[1]);
+  EXPECT_FALSE(osWorkspace.saveGzip(gzPath, false));
+}
+
 TEST_F(IdfFixture, ObjectHasURL) {
   Workspace workspace(epIdfFile, StrictnessLevel::None);
   workspace.addObject(IdfObject(IddObjectType::Schedule_File));
@@ -2115,3 +2164,117 @@ TEST_F(IdfFixture, Workspace_getObjects_Type_StringOverload) {
     EXPECT_EQ(expectedErrorMessage, std::string(e.what()));
   }
 }
+
+TEST_F(IdfFixture, Workspace_NameIndex) {
+  Workspace ws(StrictnessLevel::Draft, IddFileType::EnergyPlus);
+
+  boost::optional<WorkspaceObject> zone = ws.addObject(IdfObject(IddObjectType::Zone));
+  ASSERT_TRUE(zone);
+  EXPECT_TRUE(zone->setName("Office Zone"));
+  boost::optional<WorkspaceObject> construction = ws.addObject(IdfObject(IddObjectType::Construction));
+  ASSERT_TRUE(construction);
+  EXPECT_TRUE(construction->setName("Office Zone"));
+
+  // lookups are case insensitive
+  EXPECT_EQ(2u, ws.getObjectsByName("OFFICE ZONE").size());
+  ASSERT_TRUE(ws.getObjectByTypeAndName(IddObjectType::Zone, "office zone"));
+  EXPECT_EQ(zone->handle(), ws.getObjectByTypeAndName(IddObjectType::Zone, "office zone")->handle());
+  ASSERT_TRUE(ws.getObjectByTypeAndName(IddObjectType::Construction, "Office ZONE"));
+  EXPECT_EQ(construction->handle(), ws.getObjectByTypeAndName(IddObjectType::Construction, "Office ZONE")->handle());
+  EXPECT_FALSE(ws.getObjectByTypeAndName(IddObjectType::Lights, "Office Zone"));
+
+  std::vector<std::string> zoneNames = zone->iddObject().references();
+  ASSERT_FALSE(zoneNames.empty());
+  ASSERT_TRUE(ws.getObjectByNameAndReference("office zone", zoneNames));
+  EXPECT_EQ(zone->handle(), ws.getObjectByNameAndReference("office zone", zoneNames)->handle());
+
+  // renaming re-files the object
+  EXPECT_TRUE(zone->setName("Lobby"));
+  EXPECT_FALSE(ws.getObjectByTypeAndName(IddObjectType::Zone, "Office Zone"));
+  EXPECT_FALSE(ws.getObjectByNameAndReference("Office Zone", zoneNames));
+  EXPECT_EQ(1u, ws.getObjectsByName("Office Zone").size());
+  ASSERT_TRUE(ws.getObjectByTypeAndName(IddObjectType::Zone, "LOBBY"));
+  EXPECT_TRUE(ws.getObjectByNameAndReference("lobby", zoneNames));
+
+  // so does setString on the name field
+  EXPECT_TRUE(zone->setString(ZoneFields::Name, "Atrium"));
+  EXPECT_FALSE(ws.getObjectByTypeAndName(IddObjectType::Zone, "Lobby"));
+  EXPECT_TRUE(ws.getObjectByTypeAndName(IddObjectType::Zone, "atrium"));
+
+  // removal takes the object out of the index
+  Handle zoneHandle = zone->handle();
+  EXPECT_TRUE(ws.removeObject(zoneHandle));
+  EXPECT_FALSE(ws.getObjectByTypeAndName(IddObjectType::Zone, "Atrium"));
+  EXPECT_TRUE(ws.getObjectsByName("Atrium").empty());
+
+  // clones and swapped workspaces carry their own index
+  Workspace clone = ws.clone();
+  EXPECT_TRUE(clone.getObjectByTypeAndName(IddObjectType::Construction, "office zone"));
+  Workspace other(StrictnessLevel::Draft, IddFileType::EnergyPlus);
+  ws.swap(other);
+  EXPECT_TRUE(ws.getObjectsByName("Office Zone").empty());
+  EXPECT_TRUE(other.getObjectByTypeAndName(IddObjectType::Construction, "office zone"));
+}
+
+TEST_F(IdfFixture, Workspace_Journal) {
+  Workspace ws(epIdfFile, StrictnessLevel::Draft);
+
+  std::map<Handle, std::string> before;
+  for (const WorkspaceObject& object : ws.objects()) {
+    std::stringstream ss;
+    object.idfObject().print(ss);
+    before[object.handle()] = ss.str();
+  }
+
+  WorkspaceObjectVector lights = ws.getObjectsByType(IddObjectType::Lights);
+  ASSERT_FALSE(lights.empty());
+  OptionalWorkspaceObject zone = lights[0].getTarget(LightsFields::ZoneorZoneListName);
+  ASSERT_TRUE(zone);
+  Handle zoneHandle = zone->handle();
+  std::string zoneName = zone->name().get();
+  unsigned numSources = zone->sources().size();
+
+  EXPECT_FALSE(ws.commitJournal());
+  EXPECT_FALSE(ws.rollbackJournal());
+  EXPECT_TRUE(ws.startJournal());
+  EXPECT_FALSE(ws.startJournal());
+
+  // change, add and remove objects, including a target
+  EXPECT_TRUE(lights[0].setString(LightsFields::Name, "Renamed Lights"));
+  EXPECT_TRUE(lights[0].setString(LightsFields::FractionRadiant, "0.5"));
+  EXPECT_TRUE(zone->setName("Renamed Zone"));
+  OptionalWorkspaceObject newLights = ws.addObject(IdfObject(IddObjectType::Lights));
+  ASSERT_TRUE(newLights);
+  Handle newLightsHandle = newLights->handle();
+  EXPECT_TRUE(newLights->setPointer(LightsFields::ZoneorZoneListName, zoneHandle));
+  EXPECT_EQ(numSources + 1, zone->sources().size());
+  EXPECT_TRUE(ws.removeObject(zoneHandle));
+  EXPECT_FALSE(ws.getObject(zoneHandle));
+  EXPECT_FALSE(lights[0].getTarget(LightsFields::ZoneorZoneListName));
+
+  EXPECT_TRUE(ws.rollbackJournal());
+  EXPECT_FALSE(ws.rollbackJournal());
+
+  EXPECT_FALSE(ws.getObject(newLightsHandle));
+  ASSERT_TRUE(ws.getObject(zoneHandle));
+  EXPECT_EQ(numSources, ws.getObject(zoneHandle)->sources().size());
+  ASSERT_TRUE(lights[0].getTarget(LightsFields::ZoneorZoneListName));
+  EXPECT_EQ(zoneHandle, lights[0].getTarget(LightsFields::ZoneorZoneListName)->handle());
+  ASSERT_TRUE(ws.getObjectByTypeAndName(IddObjectType::Zone, zoneName));
+  EXPECT_EQ(zoneHandle, ws.getObjectByTypeAndName(IddObjectType::Zone, zoneName)->handle());
+  EXPECT_FALSE(ws.getObjectByTypeAndName(IddObjectType::Zone, "Renamed Zone"));
+
+  ASSERT_EQ(before.size(), ws.objects().size());
+  for (const WorkspaceObject& object : ws.objects()) {
+    ASSERT_TRUE(before.find(object.handle()) != before.end());
+    std::stringstream ss;
+    object.idfObject().print(ss);
+    EXPECT_EQ(before[object.handle()], ss.str());
+  }
+
+  // committed changes stay
+  EXPECT_TRUE(ws.startJournal());
+  EXPECT_TRUE(lights[0].setString(LightsFields::Name, "Renamed Lights"));
+  EXPECT_TRUE(ws.commitJournal());
+  EXPECT_EQ("Renamed Lights", lights[0].name().get());
+}
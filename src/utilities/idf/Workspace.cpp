@@ -39,10 +39,16 @@
 #include "../plot/ProgressBar.hpp"
 
 #include "../core/Assert.hpp"
+#include "../core/ASCIIStrings.hpp"
 #include "../core/StringHelpers.hpp"
+#include "../core/PathHelpers.hpp"
+#include "../core/Filesystem.hpp"
+#include "../idd/Comments.hpp"
 
 #include <boost/lexical_cast.hpp>
 
+#include <zlib.h>
+
 using namespace std;
 using openstudio::istringEqual;  // used for all name comparisons
 
@@ -174,6 +180,9 @@ namespace detail {
     IdfReferencesMap tirm = m_idfReferencesMap;
     m_idfReferencesMap = otherImpl->m_idfReferencesMap;
     otherImpl->m_idfReferencesMap = tirm;
+
+    m_nameIndex.swap(otherImpl->m_nameIndex);
+    m_indexedNames.swap(otherImpl->m_indexedNames);
   }
 
   // GETTERS
@@ -337,12 +346,8 @@ namespace detail {
   std::vector<WorkspaceObject> Workspace_Impl::getObjectsByName(const std::string& name, bool exactMatch) const {
     WorkspaceObjectVector result;
     if (exactMatch) {
-      for (const WorkspaceObjectMap::value_type& p : m_workspaceObjectMap) {
-        if (OptionalString candidate = p.second->name()) {
-          if (istringEqual(*candidate, name)) {
-            result.push_back(WorkspaceObject(p.second));
-          }
-        }
+      for (const std::shared_ptr<WorkspaceObject_Impl>& candidate : nameIndexCandidates(name)) {
+        result.push_back(WorkspaceObject(candidate));
       }
     } else {
       std::string baseName = getBaseName(name);
@@ -380,11 +385,32 @@ namespace detail {
     return result;
   }
 
+  std::vector<std::shared_ptr<WorkspaceObject_Impl>> Workspace_Impl::getObjectImplsByType(const ObjectTypeFilter& typeFilter) const {
+    std::vector<std::shared_ptr<WorkspaceObject_Impl>> result;
+    OptionalIddObject versionIdd = m_iddFileAndFactoryWrapper.versionObject();
+    if (!versionIdd) {
+      return result;
+    }
+    for (const IddObjectTypeMap::value_type& p : m_iddObjectTypeMap) {
+      if (p.second.empty() || !typeFilter(p.first, p.second.begin()->second)) {
+        continue;
+      }
+      bool checkVersion = (p.first == versionIdd->type());
+      result.reserve(result.size() + p.second.size());
+      for (const WorkspaceObjectMap::value_type& q : p.second) {
+        if (checkVersion && (q.second->iddObject() == versionIdd.get())) {
+          continue;
+        }
+        result.push_back(q.second);
+      }
+    }
+    return result;
+  }
+
   boost::optional<WorkspaceObject> Workspace_Impl::getObjectByTypeAndName(IddObjectType objectType, const std::string& name) const {
-    for (const WorkspaceObject& object : getObjectsByType(objectType)) {
-      OptionalString candidate = object.name();
-      if (candidate && istringEqual(*candidate, name)) {
-        return object;
+    for (const std::shared_ptr<WorkspaceObject_Impl>& candidate : nameIndexCandidates(name)) {
+      if (candidate->iddObject().type() == objectType) {
+        return WorkspaceObject(candidate);
       }
     }
     return boost::none;
@@ -434,10 +460,9 @@ namespace detail {
 
   boost::optional<WorkspaceObject> Workspace_Impl::getObjectByNameAndReference(std::string name,
                                                                                const std::vector<std::string>& referenceNames) const {
-    for (const WorkspaceObject& object : getObjectsByReference(referenceNames)) {
-      OptionalString candidate = object.name();
-      if (candidate && istringEqual(*candidate, name)) {
-        return object;
+    for (const std::shared_ptr<WorkspaceObject_Impl>& candidate : nameIndexCandidates(name)) {
+      if (isInReferenceLists(candidate->handle(), referenceNames)) {
+        return WorkspaceObject(candidate);
       }
     }
     return boost::none;
@@ -579,6 +604,8 @@ namespace detail {
       m_workspaceObjectMap.insert(WorkspaceObjectMap::value_type(newHandles.back(), ptr));
       insertIntoIddObjectTypeMap(ptr);
       insertIntoIdfReferencesMap(ptr);
+      insertIntoNameIndex(ptr);
+      journalAddition(ptr->handle());
       this->progressValue.nano_emit(++i);
     }
 
@@ -1397,6 +1424,7 @@ namespace detail {
     if (!objectData) {
       return true;
     }  // trivially satisfied
+    journalObject(handle);
 
     this->removeWorkspaceObject.nano_emit(WorkspaceObject(objectData->objectImplPtr), objectData->objectImplPtr->iddObject().type(),
                                           objectData->handle);
@@ -1408,6 +1436,7 @@ namespace detail {
     // can only be invalid if removal results in null and required
     if ((m_strictnessLevel < StrictnessLevel::Final) || isValid()) {
       std::vector<Handle> removedHandles(1, handle);
+      journalRemoval(*objectData);
       registerRemovalOfObject(objectData->objectImplPtr, sources, removedHandles);
       this->onChange.nano_emit();
       return true;
@@ -1427,6 +1456,7 @@ namespace detail {
     for (const Handle& handle : handles) {
       OptionalSavedWorkspaceObject candidate = savedWorkspaceObject(handle);
       if (candidate) {
+        journalObject(handle);
         objectData.push_back(*candidate);
       }
     }
@@ -1441,6 +1471,9 @@ namespace detail {
     std::vector<WorkspaceObjectVector> sources = nominallyRemoveObjects(handles);
 
     if ((m_strictnessLevel < StrictnessLevel::Final) || isValid()) {
+      for (const SavedWorkspaceObject& savedObject : objectData) {
+        journalRemoval(savedObject);
+      }
       registerRemovalOfObjects(objectData, sources, handles);
       this->onChange.nano_emit();
       return true;
@@ -1512,6 +1545,71 @@ namespace detail {
     }
   }
 
+  bool Workspace_Impl::startJournal() {
+    if (m_journal) {
+      return false;
+    }
+    m_journal = Journal();
+    return true;
+  }
+
+  bool Workspace_Impl::commitJournal() {
+    if (!m_journal) {
+      return false;
+    }
+    m_journal.reset();
+    return true;
+  }
+
+  bool Workspace_Impl::rollbackJournal() {
+    if (!m_journal) {
+      return false;
+    }
+    Journal journal = std::move(*m_journal);
+    m_journal.reset();
+
+    // undo additions and removals, last first, so that the original objects are all back
+    for (auto it = journal.events.rbegin(), itEnd = journal.events.rend(); it != itEnd; ++it) {
+      if (it->second) {
+        SavedWorkspaceObject& savedObject = *(it->second);
+        savedObject.objectImplPtr->reconnect(this, savedObject.handle);
+        restoreObject(savedObject);
+      } else if (isMember(it->first)) {
+        removeObject(it->first);
+      }
+    }
+
+    // then restore fields, and once every target is back, pointers
+    std::vector<std::pair<WorkspaceObject_ImplPtr, ForwardPointerSet>> restored;
+    for (const auto& savedState : journal.savedStates) {
+      auto womIt = m_workspaceObjectMap.find(savedState.first);
+      if (womIt != m_workspaceObjectMap.end()) {
+        restored.emplace_back(womIt->second, womIt->second->restoreJournalFields(savedState.second));
+      }
+    }
+    for (const auto& p : restored) {
+      p.first->restoreJournalPointers(journal.savedStates[p.first->handle()], p.second);
+    }
+    for (const auto& p : restored) {
+      updateNameIndex(p.first->handle());
+      p.first->emitChangeSignals();
+    }
+    // restored fields do not record diffs, so observers of the workspace are told here
+    this->onChange.nano_emit();
+
+    return true;
+  }
+
+  void Workspace_Impl::journalObject(const Handle& handle) {
+    if (!m_journal || (m_journal->addedHandles.count(handle) > 0) || (m_journal->savedStates.count(handle) > 0)) {
+      return;
+    }
+    auto womIt = m_workspaceObjectMap.find(handle);
+    if (womIt != m_workspaceObjectMap.end()) {
+      m_journal->savedStates.insert(std::make_pair(handle, womIt->second->journalState()));
+    }
+  }
+
   void Workspace_Impl::setFastNaming(bool fastNaming) {
     m_fastNaming = fastNaming;
   }
@@ -1577,6 +1675,16 @@ namespace detail {
     return false;
   }
 
+  bool Workspace_Impl::isInReferenceLists(const Handle& handle, const std::vector<std::string>& referenceNames) const {
+    for (const std::string& referenceName : referenceNames) {
+      auto irmLoc = m_idfReferencesMap.find(referenceName);
+      if ((irmLoc != m_idfReferencesMap.end()) && (irmLoc->second.find(handle) != irmLoc->second.end())) {
+        return true;
+      }
+    }
+    return false;
+  }
+
   bool Workspace_Impl::isInIddFile(IddObjectType type) const {
     return m_iddFileAndFactoryWrapper.isInFile(type);
   }
@@ -1759,7 +1867,57 @@ namespace detail {
   // SERIALIZATION
 
   bool Workspace_Impl::save(const openstudio::path& p, bool overwrite) {
-    return toIdfFile().save(p, overwrite);
+    boost::optional<path> wp = IdfFile::savePath(p, m_iddFileAndFactoryWrapper, overwrite);
+    if (!wp) {
+      return false;
+    }
+
+    openstudio::filesystem::ofstream outFile(*wp);
+    if (outFile) {
+      print(outFile);
+      outFile.close();
+      if (outFile) {
+        return true;
+      }
+    }
+
+    LOG(Error, "Unable to write file to path '" << toString(*wp) << "'.");
+    return false;
+  }
+
+  bool Workspace_Impl::saveGzip(const openstudio::path& p, bool overwrite) {
+    path base(p);
+    if (getFileExtension(p) == "gz") {
+      base = p.parent_path() / p.stem();
+    }
+
+    // overwrite is checked against the compressed file below
+    boost::optional<path> wp = IdfFile::savePath(base, m_iddFileAndFactoryWrapper, true);
+    if (!wp) {
+      return false;
+    }
+    path gzPath = wp->parent_path() / toPath(toString(wp->filename()) + ".gz");
+    if (!overwrite && openstudio::filesystem::exists(gzPath)) {
+      LOG(Info, "Save method failed because instructed not to overwrite path '" << toString(gzPath) << "'.");
+      return false;
+    }
+
+    gzFile file = gzopen(toString(gzPath).c_str(), "wb");
+    if (!file) {
+      LOG(Error, "Unable to write file to path '" << toString(gzPath) << "'.");
+      return false;
+    }
+    gzbuffer(file, 1 << 18);
+
+    bool result = writeText([file](const std::string& text) {
+      return gzwrite(file, text.data(), static_cast<unsigned>(text.size())) == static_cast<int>(text.size());
+    });
+    result = (gzclose(file) == Z_OK) && result;
+
+    if (!result) {
+      LOG(Error, "Unable to write file to path '" << toString(gzPath) << "'.");
+    }
+    return result;
   }
 
   IdfFile Workspace_Impl::toIdfFile() {
@@ -1789,6 +1947,14 @@ namespace detail {
     return result;
   }
 
+  std::ostream& Workspace_Impl::print(std::ostream& os) const {
+    writeText([&os](const std::string& text) {
+      os.write(text.data(), text.size());
+      return bool(os);
+    });
+    return os;
+  }
+
   // PRIVATE
 
   // GETTER HELPERS
@@ -1801,6 +1967,38 @@ namespace detail {
     return result;
   }
 
+  // SERIALIZATION
+
+  bool Workspace_Impl::writeText(const std::function<bool(const std::string&)>& write) const {
+    const std::string::size_type blockSize = 1 << 20;
+    std::string buffer;
+    buffer.reserve(blockSize + (1 << 16));
+
+    // same layout as toIdfFile().print(os): header, version object, then objects in order
+    std::string header = makeComment(m_header);
+    if (!header.empty()) {
+      buffer += header;
+      buffer += '\n';
+    }
+    buffer += '\n';
+
+    if (OptionalWorkspaceObject vo = versionObject()) {
+      vo->getImpl<WorkspaceObject_Impl>()->appendText(buffer);
+    }
+
+    for (const WorkspaceObject& obj : objects(true)) {
+      obj.getImpl<WorkspaceObject_Impl>()->appendText(buffer);
+      if (buffer.size() >= blockSize) {
+        if (!write(buffer)) {
+          return false;
+        }
+        buffer.clear();
+      }
+    }
+
+    return buffer.empty() || write(buffer);
+  }
+
   bool Workspace_Impl::baseNamesMatch(const std::string& baseName, const std::string& objectName) const {
     return istringEqual(baseName, getBaseName(objectName));
   }
@@ -1947,6 +2145,11 @@ namespace detail {
     // IdfReferencesMap
     insertIntoIdfReferencesMap(ptr);
 
+    // NameIndex
+    insertIntoNameIndex(ptr);
+
+    journalAddition(h);
+
     return true;
   }
 
@@ -1964,6 +2167,53 @@ namespace detail {
       m_idfReferencesMap[referenceName].insert(std::make_pair(objectImplPtr->handle(), objectImplPtr));
     }
   }
+
+  void Workspace_Impl::insertIntoNameIndex(const std::shared_ptr<WorkspaceObject_Impl>& objectImplPtr) {
+    OptionalString name = objectImplPtr->name();
+    if (!name) {
+      return;
+    }
+    std::string key = ascii_to_lower_copy(*name);
+    m_nameIndex.insert(NameIndex::value_type(key, objectImplPtr));
+    m_indexedNames[objectImplPtr->handle()] = std::move(key);
+  }
+
+  void Workspace_Impl::eraseFromNameIndex(const Handle& handle) {
+    auto inIt = m_indexedNames.find(handle);
+    if (inIt == m_indexedNames.end()) {
+      return;
+    }
+    auto range = m_nameIndex.equal_range(inIt->second);
+    for (auto it = range.first; it != range.second; ++it) {
+      if (it->second->handle() == handle) {
+        m_nameIndex.erase(it);
+        break;
+      }
+    }
+    m_indexedNames.erase(inIt);
+  }
+
+  void Workspace_Impl::updateNameIndex(const Handle& handle) {
+    auto womIt = m_workspaceObjectMap.find(handle);
+    if (womIt == m_workspaceObjectMap.end()) {
+      return;
+    }
+    eraseFromNameIndex(handle);
+    insertIntoNameIndex(womIt->second);
+  }
+
+  std::vector<std::shared_ptr<WorkspaceObject_Impl>> Workspace_Impl::nameIndexCandidates(const std::string& name) const {
+    std::vector<std::shared_ptr<WorkspaceObject_Impl>> result;
+    auto range = m_nameIndex.equal_range(ascii_to_lower_copy(name));
+    for (auto it = range.first; it != range.second; ++it) {
+      // guard against a name change that has not been re-filed yet
+      OptionalString candidate = it->second->name();
+      if (candidate && istringEqual(*candidate, name)) {
+        result.push_back(it->second);
+      }
+    }
+    return result;
+  }
   bool Workspace_Impl::resolvePotentialNameConflicts(Workspace& other) {
     return resolvePotentialNameConflicts(other, std::vector<unsigned>());
   }
@@ -2153,6 +2403,9 @@ namespace detail {
       }
     }
 
+    // NameIndex
+    eraseFromNameIndex(handle);
+
     // IddObjectTypeMap
     auto iotmLoc = m_iddObjectTypeMap.find(objectImplPtr->iddObject().type());
     OS_ASSERT(iotmLoc != m_iddObjectTypeMap.end());
@@ -2213,6 +2466,20 @@ namespace detail {
     this->onChange.nano_emit();
   }
 
+  void Workspace_Impl::journalAddition(const Handle& handle) {
+    if (m_journal) {
+      m_journal->addedHandles.insert(handle);
+      m_journal->events.push_back(std::make_pair(handle, OptionalSavedWorkspaceObject()));
+    }
+  }
+
+  void Workspace_Impl::journalRemoval(const SavedWorkspaceObject& savedObject) {
+    // objects added since startJournal() are simply gone on rollback
+    if (m_journal && (m_journal->addedHandles.count(savedObject.handle) == 0)) {
+      m_journal->events.push_back(std::make_pair(savedObject.handle, OptionalSavedWorkspaceObject(savedObject)));
+    }
+  }
+
   void Workspace_Impl::restoreObject(SavedWorkspaceObject& savedObject) {
     // WorkspaceObjectMap
     m_workspaceObjectMap.insert(WorkspaceObjectMap::value_type(savedObject.handle, savedObject.objectImplPtr));
@@ -2228,6 +2495,9 @@ namespace detail {
     // IdfReferencesMap
     insertIntoIdfReferencesMap(savedObject.objectImplPtr);
 
+    // NameIndex
+    insertIntoNameIndex(savedObject.objectImplPtr);
+
     // Fix Pointers
     savedObject.objectImplPtr->restorePointers();
 
@@ -2602,6 +2872,18 @@ bool Workspace::removeObjects(const std::vector<Handle>& handles) {
   return m_impl->removeObjects(handles);
 }
 
+bool Workspace::startJournal() {
+  return m_impl->startJournal();
+}
+
+bool Workspace::commitJournal() {
+  return m_impl->commitJournal();
+}
+
+bool Workspace::rollbackJournal() {
+  return m_impl->rollbackJournal();
+}
+
 void Workspace::setFastNaming(bool fastNaming) {
   m_impl->setFastNaming(fastNaming);
 }
@@ -2711,6 +2993,10 @@ bool Workspace::save(const openstudio::path& p, bool overwrite) {
   return m_impl->save(p, overwrite);
 }
 
+bool Workspace::saveGzip(const openstudio::path& p, bool overwrite) {
+  return m_impl->saveGzip(p, overwrite);
+}
+
 boost::optional<Workspace> Workspace::load(const openstudio::path& p) {
   OptionalIdfFile oIdfFile = IdfFile::load(p);
   if (oIdfFile) {
@@ -2739,6 +3025,10 @@ IdfFile Workspace::toIdfFile() const {
   return m_impl->toIdfFile();
 }
 
+std::ostream& Workspace::print(std::ostream& os) const {
+  return m_impl->print(os);
+}
+
 // OVERLOADED FUNCTIONS THAT TAKE IN A std::string INSTEAD OF AN IddObjecTtype
 
 std::vector<WorkspaceObject> Workspace::getObjectsByType(const std::string& objectTypeName) const {
@@ -2774,8 +3064,7 @@ void Workspace::addVersionObject() {
 }
 
 std::ostream& operator<<(std::ostream& os, const Workspace& workspace) {
-  os << workspace.toIdfFile();
-  return os;
+  return workspace.print(os);
 }
 
 }  // namespace openstudio
@@ -334,6 +334,18 @@ class UTILITIES_API Workspace
    */
   bool removeObjects(const std::vector<Handle>& handles);
 
+  /** Starts recording every object addition, removal and field change so that they can be undone by
+   *  rollbackJournal(), which is much cheaper than cloning the Workspace when only a few objects change.
+   *  Returns false if a journal is already open. */
+  bool startJournal();
+
+  /** Keeps all changes made since startJournal() and stops recording. Returns false if no journal is open. */
+  bool commitJournal();
+
+  /** Undoes all changes made since startJournal() and stops recording. Objects removed in the meantime are
+   *  restored with their original handles, objects added are removed. Returns false if no journal is open. */
+  bool rollbackJournal();
+
   /** Setting fast naming to true reduces the time taken to create and verify the uniqueness
    *  of names by using a UUID as the name. The name UUID is not the same as the object's
    *  handle. */
@@ -414,6 +426,10 @@ class UTILITIES_API Workspace
    *  and 'idf' otherwise. Returns true if the save operation is successful; false otherwise. */
   bool save(const openstudio::path& p, bool overwrite = false);
 
+  /** Save this Workspace as gzip compressed text. The path is chosen as by save, with any ".gz"
+   *  extension of p set aside, and then ".gz" is appended, e.g. "model.osm.gz". */
+  bool saveGzip(const openstudio::path& p, bool overwrite = false);
+
   /** Load a Workspace from path using the IddFactory, and choosing iddFileType based on file
    *  extension, if possible. (IddFileType::OpenStudio if extension is modelFileExtension() or
    *  componentFileExtension(), IddFileType::EnergyPlus otherwise.) */
@@ -430,6 +446,10 @@ class UTILITIES_API Workspace
    *  serialized as names. */
   IdfFile toIdfFile() const;
 
+  /** Print this Workspace to os as IDF text. Same as toIdfFile().print(os), but objects are formatted
+   *  directly from the Workspace, so no copy of the data is made. */
+  std::ostream& print(std::ostream& os) const;
+
   //@}
   /** @name GUI Helpers */
   //@{
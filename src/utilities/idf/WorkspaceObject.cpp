@@ -374,17 +374,23 @@ namespace detail {
       if (!result) {
         return result;
       }
+      m_workspace->updateNameIndex(m_handle);
 
       // check collection NameConflict
       if (!newName.empty() && iddObject().isRequiredField(*index) && !uniquelyIdentifiableByName()) {
         result = IdfObject_Impl::setName(workspace().nextName(*result, false));
         OS_ASSERT(result);
+        m_workspace->updateNameIndex(m_handle);
       }
 
       return result;
     }
 
-    return IdfObject_Impl::setName(newName, checkValidity);
+    OptionalString result = IdfObject_Impl::setName(newName, checkValidity);
+    if (result) {
+      m_workspace->updateNameIndex(m_handle);
+    }
+    return result;
   }
 
   boost::optional<std::string> WorkspaceObject_Impl::createName() {
@@ -676,6 +682,8 @@ namespace detail {
   }
 
   std::vector<std::string> WorkspaceObject_Impl::popExtensibleGroup(bool checkValidity) {
+    journalChange();
+
     StringVector result;
     if (!initialized()) {
       UnsignedVector olFields = iddObject().objectListFields();
@@ -937,6 +945,23 @@ namespace detail {
     return result;
   }
 
+  const std::string& WorkspaceObject_Impl::printedField(unsigned index, std::string& scratch) const {
+    if (m_sourceData) {
+      auto it = m_sourceData->pointers.find(ForwardPointer(index, Handle()));
+      if ((it != m_sourceData->pointers.end()) && !it->targetHandle.isNull()) {
+        if (m_iddObject.hasHandleField()) {
+          scratch = toString(it->targetHandle);
+        } else {
+          OptionalString targetName = m_workspace->name(it->targetHandle);
+          OS_ASSERT(targetName);
+          scratch = *targetName;
+        }
+        return scratch;
+      }
+    }
+    return m_fields[index];
+  }
+
   /** Returns equivalent IdfObject, naming targets if necessary. All data is cloned. */
   IdfObject WorkspaceObject_Impl::idfObject() {
     return getObject<WorkspaceObject>().idfObject();
@@ -1003,6 +1028,12 @@ namespace detail {
     m_diffs.clear();
   }
 
+  void WorkspaceObject_Impl::journalChange() {
+    if (m_initialized && m_workspace) {
+      m_workspace->journalObject(m_handle);
+    }
+  }
+
   // PROTECTED
 
   void WorkspaceObject_Impl::setInitialized() {
@@ -1015,11 +1046,100 @@ namespace detail {
     m_workspace = nullptr;
   }
 
+  void WorkspaceObject_Impl::reconnect(Workspace_Impl* workspace, const Handle& handle) {
+    OS_ASSERT(m_handle.isNull());
+    m_handle = handle;
+    m_workspace = workspace;
+  }
+
+  WorkspaceObject_Impl::JournalState WorkspaceObject_Impl::journalState() const {
+    JournalState result;
+    result.comment = m_comment;
+    result.fields = m_fields;
+    result.fieldComments = m_fieldComments;
+    if (m_sourceData) {
+      result.pointers = m_sourceData->pointers;
+    }
+    return result;
+  }
+
+  ForwardPointerSet WorkspaceObject_Impl::restoreJournalFields(const JournalState& state) {
+    OS_ASSERT(!m_handle.isNull());
+    ForwardPointerSet result;
+    if (m_sourceData) {
+      result = m_sourceData->pointers;
+      for (const ForwardPointer& fp : result) {
+        if (!fp.targetHandle.isNull()) {
+          nullifyPointer(fp.fieldIndex);
+        }
+      }
+      m_sourceData->pointers.clear();
+    }
+
+    for (unsigned i = 0, n = std::max(m_fields.size(), state.fields.size()); i < n; ++i) {
+      if (canBeSource(i)) {
+        continue;
+      }
+      OptionalString oldValue;
+      if (i < m_fields.size()) {
+        oldValue = m_fields[i];
+      }
+      OptionalString newValue;
+      if (i < state.fields.size()) {
+        newValue = state.fields[i];
+      }
+      if (oldValue != newValue) {
+        m_diffs.push_back(IdfObjectDiff(i, oldValue, newValue));
+      }
+    }
+    if (m_comment != state.comment) {
+      m_diffs.push_back(IdfObjectDiff(boost::none, boost::none, boost::none));
+    }
+
+    m_comment = state.comment;
+    m_fields = state.fields;
+    m_fieldComments = state.fieldComments;
+    m_numericFields.clear();
+    resizeNumericFields();
+
+    return result;
+  }
+
+  void WorkspaceObject_Impl::restoreJournalPointers(const JournalState& state, const ForwardPointerSet& oldPointers) {
+    OS_ASSERT(!m_handle.isNull());
+    if (!m_sourceData) {
+      return;
+    }
+
+    for (const ForwardPointer& fp : state.pointers) {
+      Handle th = fp.targetHandle;
+      if (!th.isNull() && !m_workspace->isMember(th)) {
+        th = Handle();
+      }
+      m_sourceData->pointers.insert(ForwardPointer(fp.fieldIndex, th));
+      if (!th.isNull()) {
+        m_workspace->getObject(th)->getImpl<WorkspaceObject_Impl>()->setReversePointer(m_handle, fp.fieldIndex);
+        m_workspace->forwardReferences(m_handle, fp.fieldIndex, th);
+      }
+
+      Handle oldHandle;
+      auto oldIt = getConstIteratorAtFieldIndex<SourceData>(oldPointers, fp.fieldIndex);
+      if (oldIt != oldPointers.end()) {
+        oldHandle = oldIt->targetHandle;
+      }
+      if (oldHandle != th) {
+        m_diffs.push_back(WorkspaceObjectDiff(fp.fieldIndex, toString(oldHandle), toString(th), oldHandle, th));
+      }
+    }
+  }
+
   // Pre-condition:  field index is a pointer, and its targetHandle is either null or valid in
   //                 m_workspace.
   // Post-condition: field index is a pointer with a null targetHandle.
   void WorkspaceObject_Impl::nullifyPointer(unsigned index) {
     OS_ASSERT(!m_handle.isNull());
+    journalChange();
+
     // reverse pointer
     OptionalWorkspaceObject oTarget = getTarget(index);
     if (oTarget) {
@@ -1104,6 +1224,8 @@ namespace detail {
   // Post-condition: Field index points to object targetHandle.
   Handle WorkspaceObject_Impl::setPointerImpl(unsigned index, const Handle& targetHandle) {
     OS_ASSERT(!m_handle.isNull());
+    journalChange();
+
     Handle result;
     // check current status
     auto fpIt = getIteratorAtFieldIndex<SourceData>(m_sourceData->pointers, index);
@@ -1195,6 +1317,7 @@ namespace detail {
     if (m_handle.isNull()) {
       return false;
     }
+    journalChange();
 
     unsigned index = numFields() - 1;
     // last field must be nonextensible, and final size must satisfy minimum number of fields
@@ -1205,6 +1328,7 @@ namespace detail {
       if (m_fieldComments.size() > m_fields.size()) {
         m_fieldComments.resize(m_fields.size());
       }
+      resizeNumericFields();
     } else {
       return false;
     }
@@ -1254,15 +1378,18 @@ namespace detail {
     if (!oName) {
       return true;
     }
-    WorkspaceObjectVector candidates = m_workspace->getObjectsByReference(iddObject().references());
+    StringVector references = iddObject().references();
+    // only objects with the same name can conflict, so start from the workspace's name index
+    WorkspaceObjectVector candidates = m_workspace->getObjectsByName(*oName);
     for (const WorkspaceObject& candidate : candidates) {
       if ((candidate.iddObject().type() == openstudio::IddObjectType::OS_Connection)
           || (candidate.iddObject().type() == openstudio::IddObjectType::OS_PortList)) {
         continue;
       }
-      OptionalString candidateName = candidate.name();
-      OS_ASSERT(candidateName);
-      if ((istringEqual(*oName, *candidateName) && (!initialized() || (getObject<WorkspaceObject>() != candidate)))) {
+      if (!m_workspace->isInReferenceLists(candidate.handle(), references)) {
+        continue;
+      }
+      if (!initialized() || (getObject<WorkspaceObject>() != candidate)) {
         return false;
       }
     }
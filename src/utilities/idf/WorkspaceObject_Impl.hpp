@@ -283,6 +283,9 @@ namespace detail {
     /** Emits signals after batch update and error checking is complete, clears the diffs */
     virtual void emitChangeSignals() override;
 
+    /** Saves the state of this object in its Workspace's journal, if one is open and this is the first change. */
+    virtual void journalChange() override;
+
     //@}
 
     //@}
@@ -308,6 +311,26 @@ namespace detail {
     /** Disconnects this object from its workspace. Nullifies m_workspace and m_handle. */
     void disconnect();
 
+    /** Undoes disconnect() for an object brought back by Workspace_Impl::rollbackJournal. */
+    void reconnect(Workspace_Impl* workspace, const Handle& handle);
+
+    /** Comments, fields and pointers of this object as saved by Workspace_Impl's journal. */
+    struct JournalState
+    {
+      std::string comment;
+      std::vector<std::string> fields;
+      std::vector<std::string> fieldComments;
+      ForwardPointerSet pointers;
+    };
+
+    JournalState journalState() const;
+
+    /** Restores comments and fields from state and nullifies all pointers, returning the ones that were set.
+     *  Call restoreJournalPointers once every journaled object has had its fields restored. */
+    ForwardPointerSet restoreJournalFields(const JournalState& state);
+
+    void restoreJournalPointers(const JournalState& state, const ForwardPointerSet& oldPointers);
+
     /** Mechanics only exposed to Workspace_Impl for use in object removal. */
     void nullifyPointer(unsigned index);
 
@@ -333,6 +356,9 @@ namespace detail {
     /** Checks ObjectList fields, and calls IdfObject_Impl version. */
     virtual bool fieldDataIsCorrectType(unsigned index) const override;
 
+    /** Prints set pointers the same way idfObject does. */
+    virtual const std::string& printedField(unsigned index, std::string& scratch) const override;
+
     virtual bool fieldIsNonnullIfRequired(unsigned index) const override;
 
    private:
@@ -50,6 +50,7 @@
 #include <set>
 #include <map>
 #include <unordered_map>
+#include <functional>
 
 namespace openstudio {
 
@@ -178,6 +179,13 @@ namespace detail {
     /// get all idf objects by full idd type
     std::vector<WorkspaceObject> getObjectsByType(const IddObject& objectType) const;
 
+    typedef std::function<bool(IddObjectType, const std::shared_ptr<WorkspaceObject_Impl>&)> ObjectTypeFilter;
+
+    /** Get the implementations of all objects (except the version object) whose type passes
+     *  typeFilter. typeFilter is called once per IddObjectType in the workspace, with one of the
+     *  objects of that type. */
+    std::vector<std::shared_ptr<WorkspaceObject_Impl>> getObjectImplsByType(const ObjectTypeFilter& typeFilter) const;
+
     /** Returns the first object found of type objectType and named name (case insensitive,
      *  exact match). */
     boost::optional<WorkspaceObject> getObjectByTypeAndName(IddObjectType objectType, const std::string& name) const;
@@ -326,6 +334,26 @@ namespace detail {
      *  targetObject in those reference lists, remove the association. */
     void removeForwardedReferences(const Handle& sourceHandle, unsigned index, const WorkspaceObject& targetObject);
 
+    /** Re-files the object identified by handle in the case-insensitive name index. Called by
+     *  WorkspaceObject_Impl whenever its name field is written. No-op if handle is not in this
+     *  Workspace. */
+    void updateNameIndex(const Handle& handle);
+
+    /** Starts recording changes so that they can be undone by rollbackJournal(). Returns false if a journal
+     *  is already open. */
+    bool startJournal();
+
+    /** Keeps all changes made since startJournal() and stops recording. Returns false if no journal is open. */
+    bool commitJournal();
+
+    /** Undoes all additions, removals and field changes made since startJournal() and stops recording.
+     *  Removed objects come back with their original handles. Returns false if no journal is open. */
+    bool rollbackJournal();
+
+    /** Saves the current state of the object identified by handle if a journal is open and the object
+     *  has not been saved or added since. Called by WorkspaceObject_Impl before any change. */
+    void journalObject(const Handle& handle);
+
     /** Setting fast naming to true reduces the time taken to create names by using a UUID as the name.
      *   This UUID is not the same as the object's handle.
      */
@@ -373,6 +401,10 @@ namespace detail {
     /** True if an \\object-list field referencing the given names can point to this object. */
     bool canBeTarget(const Handle& handle, const std::set<std::string>& referenceListNames) const;
 
+    /** True if handle is listed under any of referenceNames, either directly or through a
+     *  forwarded reference. Unlike canBeTarget, "AllObjects" is not treated specially. */
+    bool isInReferenceLists(const Handle& handle, const std::vector<std::string>& referenceNames) const;
+
     /** True if the IddObject of type is in iddFile(). */
     bool isInIddFile(IddObjectType type) const;
 
@@ -410,10 +442,17 @@ namespace detail {
      *  .idf or modelFileExtension() depending on the underlying IddFileType. */
     virtual bool save(const openstudio::path& p, bool overwrite = false);
 
+    /** Save Workspace to path as gzip compressed text. The path is chosen as by save, then ".gz" is
+     *  appended. */
+    bool saveGzip(const openstudio::path& p, bool overwrite = false);
+
     /** Creates an IdfFile from the collection, naming objects if necessary. To print out IDF text,
      *  use this method, then IdfFile.print(ostream). */
     IdfFile toIdfFile();
 
+    /** Prints the same text as toIdfFile().print(os), without building the IdfFile. */
+    std::ostream& print(std::ostream& os) const;
+
     /// Locates and updates urls in the workspace
     //std::vector<std::pair<openstudio::Url, openstudio::path> > locateUrls(const std::vector<URLSearchPath> &t_paths, bool t_create_relative_paths,
     // const openstudio::path &t_infile, const openstudio::path &t_locationForRemoteUrls = openstudio::path());
@@ -495,6 +534,14 @@ namespace detail {
     typedef std::unordered_map<std::string, WorkspaceObjectMap> IdfReferencesMap;  // , IstringCompare
     IdfReferencesMap m_idfReferencesMap;
 
+    // map of case-folded name to objects with that name, used for exact name lookups
+    typedef std::unordered_multimap<std::string, std::shared_ptr<WorkspaceObject_Impl>> NameIndex;
+    NameIndex m_nameIndex;
+
+    // case-folded name under which each named object is currently filed in m_nameIndex
+    typedef std::unordered_map<Handle, std::string, boost::hash<boost::uuids::uuid>> IndexedNameMap;
+    IndexedNameMap m_indexedNames;
+
     // data object for undos
     struct SavedWorkspaceObject
     {
@@ -506,6 +553,18 @@ namespace detail {
     typedef boost::optional<SavedWorkspaceObject> OptionalSavedWorkspaceObject;
     typedef std::vector<SavedWorkspaceObject> SavedWorkspaceObjectVector;
 
+    // changes recorded since startJournal()
+    struct Journal
+    {
+      // state of each pre-existing object before its first change
+      std::unordered_map<Handle, WorkspaceObject_Impl::JournalState, boost::hash<boost::uuids::uuid>> savedStates;
+      // objects added since startJournal(), never saved
+      std::set<Handle> addedHandles;
+      // additions (no saved object) and removals in the order they happened
+      std::vector<std::pair<Handle, OptionalSavedWorkspaceObject>> events;
+    };
+    boost::optional<Journal> m_journal;
+
     // GETTERS
 
     // Change over from a HandleSet to a std::vector<Handle>.
@@ -522,6 +581,12 @@ namespace detail {
 
     boost::optional<WorkspaceObject> getEquivalentObject(const IdfObject& other) const;
 
+    // SERIALIZATION
+
+    // Formats the IDF text of the collection into a reused buffer, passing it to write in blocks of
+    // about a megabyte. Stops and returns false as soon as write does.
+    bool writeText(const std::function<bool(const std::string&)>& write) const;
+
     // SETTERS
 
     // Replace m_iddFactoryWrapper if workspace remains valid.
@@ -536,6 +601,14 @@ namespace detail {
 
     void insertIntoIdfReferencesMap(const std::shared_ptr<WorkspaceObject_Impl>& object);
 
+    void insertIntoNameIndex(const std::shared_ptr<WorkspaceObject_Impl>& object);
+
+    void eraseFromNameIndex(const Handle& handle);
+
+    /** Returns the objects filed under name in m_nameIndex whose current name matches name
+     *  (case-insensitive). */
+    std::vector<std::shared_ptr<WorkspaceObject_Impl>> nameIndexCandidates(const std::string& name) const;
+
     // note default parameter for toIgnore is empty vector
     bool resolvePotentialNameConflicts(Workspace& other, const std::vector<unsigned>& toIgnore);
 
@@ -570,6 +643,10 @@ namespace detail {
 
     void registerAdditionOfObject(const WorkspaceObject& object);
 
+    void journalAddition(const Handle& handle);
+
+    void journalRemoval(const SavedWorkspaceObject& savedObject);
+
     // QUERIES
 
     /** Returns name with the next available integer suffix. */
@@ -75,6 +75,11 @@ int PreparedStatement::execute() {
   return code;
 }
 
+void PreparedStatement::reset() {
+  sqlite3_reset(m_statement);
+  sqlite3_clear_bindings(m_statement);
+}
+
 boost::optional<double> PreparedStatement::execAndReturnFirstDouble() const {
   boost::optional<double> value;
   if (m_db) {
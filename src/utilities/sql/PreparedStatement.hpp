@@ -138,6 +138,9 @@ class UTILITIES_API PreparedStatement
   // Executes a **SINGLE** statement
   int execute();
 
+  // Resets the statement and clears its bindings so it can be executed again
+  void reset();
+
   [[nodiscard]] boost::optional<double> execAndReturnFirstDouble() const;
 
   [[nodiscard]] boost::optional<int> execAndReturnFirstInt() const;
@@ -1085,6 +1085,15 @@ TimeSeriesVector SqlFile::timeSeries(const SqlFileTimeSeriesQuery& query) {
   return result;
 }
 
+SqlFileTimeSeriesBatch SqlFile::timeSeriesBatch(const std::string& envPeriod, const std::string& reportingFrequency,
+                                                const std::vector<std::pair<std::string, std::string>>& timeSeriesNamesAndKeyValues) {
+  SqlFileTimeSeriesBatch result;
+  if (m_impl) {
+    result = m_impl->timeSeriesBatch(envPeriod, reportingFrequency, timeSeriesNamesAndKeyValues);
+  }
+  return result;
+}
+
 boost::optional<std::pair<DateTime, DateTime>> SqlFile::daylightSavingsPeriod() const {
   boost::optional<std::pair<DateTime, DateTime>> result;
   if (m_impl) {
@@ -1385,4 +1394,31 @@ bool SqlFile::hasIlluminanceMapYear() const {
   return true;
 }
 
+bool SqlFile::loadTabularDataWithStrings() const {
+  if (m_impl) {
+    return m_impl->loadTabularDataWithStrings();
+  }
+
+  return false;
+}
+
+boost::optional<std::string> SqlFile::tabularDataValue(const std::string& reportName, const std::string& reportForString,
+                                                       const std::string& tableName, const std::string& rowName, const std::string& columnName) const {
+  if (m_impl) {
+    return m_impl->tabularDataValue(reportName, reportForString, tableName, rowName, columnName);
+  }
+
+  return boost::none;
+}
+
+boost::optional<std::string> SqlFile::tabularDataValue(const std::string& reportName, const std::string& reportForString,
+                                                       const std::string& tableName, const std::string& rowName, const std::string& columnName,
+                                                       const std::string& units) const {
+  if (m_impl) {
+    return m_impl->tabularDataValue(reportName, reportForString, tableName, rowName, columnName, units);
+  }
+
+  return boost::none;
+}
+
 }  // namespace openstudio
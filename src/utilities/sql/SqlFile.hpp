@@ -35,6 +35,7 @@
 #include "SummaryData.hpp"
 #include "SqlFileDataDictionary.hpp"
 #include "SqlFileEnums.hpp"
+#include "SqlFileTimeSeriesBatch.hpp"
 #include "SqlFile_Impl.hpp"
 
 #include "../data/Vector.hpp"
@@ -111,6 +112,17 @@ class UTILITIES_API SqlFile
   // Check if the SqlFile contains 'Year' field for DaylightMapHourlyReports (added Year in 9.2.0)
   bool hasIlluminanceMapYear() const;
 
+  /// Loads all of TabularDataWithStrings into memory so that tabularDataValue lookups do not query the database
+  bool loadTabularDataWithStrings() const;
+
+  /// Value of the TabularDataWithStrings row matching all fields, loads the table on first use
+  boost::optional<std::string> tabularDataValue(const std::string& reportName, const std::string& reportForString, const std::string& tableName,
+                                                const std::string& rowName, const std::string& columnName) const;
+
+  /// Value of the TabularDataWithStrings row matching all fields and units, loads the table on first use
+  boost::optional<std::string> tabularDataValue(const std::string& reportName, const std::string& reportForString, const std::string& tableName,
+                                                const std::string& rowName, const std::string& columnName, const std::string& units) const;
+
   /// close the file
   bool close();
 
@@ -690,6 +702,13 @@ class UTILITIES_API SqlFile
    *  down by ReportingFrequency and determine how many TimeSeries will be returned. */
   std::vector<TimeSeries> timeSeries(const SqlFileTimeSeriesQuery& query);
 
+  /** Returns the time series for each (timeSeriesName, keyValue) pair reported at reportingFrequency
+   *  for envPeriod, read together in one pass over the report data. The series share a single time
+   *  axis; pairs that are not in the data dictionary are left out of the batch. Prefer this to
+   *  repeated calls to timeSeries when many series of the same frequency are needed. */
+  SqlFileTimeSeriesBatch timeSeriesBatch(const std::string& envPeriod, const std::string& reportingFrequency,
+                                         const std::vector<std::pair<std::string, std::string>>& timeSeriesNamesAndKeyValues);
+
   //@}
   /** @name Illuminance Map Interface */
   //@{
@@ -782,6 +801,7 @@ class UTILITIES_API SqlFile
 
   /// execute a statement and return the first (if any) value as a double
   // Variadic arguments are the bind arguments if any, to replace '?' placeholders in the statement string
+  // The execAndReturn methods may be called from several threads at once, statements are prepared once per connection and reused
   template <typename... Args>
   boost::optional<double> execAndReturnFirstDouble(const std::string& statement, Args&&... args) const {
     boost::optional<double> result;
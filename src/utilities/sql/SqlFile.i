@@ -8,6 +8,7 @@
   #include <utilities/sql/SqlFile.hpp>
   #include <utilities/sql/SqlFileEnums.hpp>
   #include <utilities/sql/SqlFileTimeSeriesQuery.hpp>
+  #include <utilities/sql/SqlFileTimeSeriesBatch.hpp>
   #include <utilities/sql/SummaryData.hpp>
 
   #include <utilities/units/Unit.hpp>
@@ -51,6 +52,7 @@
 %template(SqlTimeSeriesQueryVector) std::vector<openstudio::SqlFileTimeSeriesQuery>;
 
 %include <utilities/sql/SummaryData.hpp>
+%include <utilities/sql/SqlFileTimeSeriesBatch.hpp>
 %include <utilities/sql/SqlFile.hpp>
 %include <utilities/sql/SqlFileTimeSeriesQuery.hpp>
 %include <utilities/sql/SqlFileEnums.hpp>
@@ -0,0 +1,176 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2021, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+
+#include "SqlFileTimeSeriesBatch.hpp"
+
+#include "../core/Assert.hpp"
+#include "../data/Vector.hpp"
+
+namespace openstudio {
+
+namespace detail {
+
+  SqlFileReportTimeAxis::SqlFileReportTimeAxis(const std::vector<SqlFileReportTime>& reportTimes, bool isIntervalFrequency,
+                                               const boost::optional<DateTime>& runPeriodDateTime) {
+    bool isIntervalTimeSeries = isIntervalFrequency;
+    long cumulativeSeconds = 0;
+    secondsFromFirstReport.reserve(reportTimes.size());
+
+    for (const SqlFileReportTime& reportTime : reportTimes) {
+      if (!firstReportDateTime) {
+        if ((reportTime.month == 0) || (reportTime.day == 0)) {
+          // gets called for RunPeriod reports
+          firstReportDateTime = runPeriodDateTime;
+        } else {
+          // DLM: get standard time zone?
+          if (reportTime.intervalMinutes >= 24 * 60) {
+            // Daily or Monthly
+            OS_ASSERT(reportTime.intervalMinutes % (24 * 60) == 0);
+            firstReportDateTime = reportTime.year ? DateTime(Date(reportTime.month, reportTime.day, *reportTime.year), Time(1, 0, 0, 0))
+                                                  : DateTime(Date(reportTime.month, reportTime.day), Time(1, 0, 0, 0));
+          } else {
+            firstReportDateTime = reportTime.year
+                                    ? DateTime(Date(reportTime.month, reportTime.day, *reportTime.year), Time(0, 0, reportTime.intervalMinutes, 0))
+                                    : DateTime(Date(reportTime.month, reportTime.day), Time(0, 0, reportTime.intervalMinutes, 0));
+          }
+        }
+      }
+
+      // Use the new way to create the time series with nonzero first entry
+      cumulativeSeconds += 60 * reportTime.intervalMinutes;
+      secondsFromFirstReport.push_back(cumulativeSeconds);
+
+      // check if this interval is same as the others
+      if (isIntervalTimeSeries && !intervalMinutes) {
+        intervalMinutes = reportTime.intervalMinutes;
+      } else if (intervalMinutes && (intervalMinutes.get() != reportTime.intervalMinutes)) {
+        isIntervalTimeSeries = false;
+        intervalMinutes.reset();
+      }
+    }
+  }
+
+  boost::optional<TimeSeries> SqlFileReportTimeAxis::timeSeries(const std::vector<double>& values, const std::string& units) const {
+    boost::optional<TimeSeries> result;
+    if (firstReportDateTime && !secondsFromFirstReport.empty()) {
+      OS_ASSERT(values.size() == secondsFromFirstReport.size());
+      if (intervalMinutes) {
+        Time intervalTime(0, 0, *intervalMinutes, 0);
+        result = TimeSeries(*firstReportDateTime, intervalTime, createVector(values), units);
+      } else {
+        result = TimeSeries(*firstReportDateTime, secondsFromFirstReport, createVector(values), units);
+      }
+    }
+    return result;
+  }
+
+}  // namespace detail
+
+SqlFileTimeSeriesBatch::SqlFileTimeSeriesBatch() : m_isIntervalFrequency(false) {}
+
+std::string SqlFileTimeSeriesBatch::environmentPeriod() const {
+  return m_environmentPeriod;
+}
+
+std::string SqlFileTimeSeriesBatch::reportingFrequency() const {
+  return m_reportingFrequency;
+}
+
+unsigned SqlFileTimeSeriesBatch::numSeries() const {
+  return m_series.size();
+}
+
+unsigned SqlFileTimeSeriesBatch::numReports() const {
+  return m_reportTimes.size();
+}
+
+boost::optional<DateTime> SqlFileTimeSeriesBatch::firstReportDateTime() const {
+  if (m_timeAxis) {
+    return m_timeAxis->firstReportDateTime;
+  }
+  return boost::none;
+}
+
+std::vector<long> SqlFileTimeSeriesBatch::secondsFromFirstReport() const {
+  if (m_timeAxis) {
+    return m_timeAxis->secondsFromFirstReport;
+  }
+  return std::vector<long>();
+}
+
+boost::optional<Time> SqlFileTimeSeriesBatch::intervalLength() const {
+  if (m_timeAxis && m_timeAxis->intervalMinutes) {
+    return Time(0, 0, *m_timeAxis->intervalMinutes, 0);
+  }
+  return boost::none;
+}
+
+std::string SqlFileTimeSeriesBatch::name(unsigned seriesIndex) const {
+  return m_series.at(seriesIndex).name;
+}
+
+std::string SqlFileTimeSeriesBatch::keyValue(unsigned seriesIndex) const {
+  return m_series.at(seriesIndex).keyValue;
+}
+
+std::string SqlFileTimeSeriesBatch::units(unsigned seriesIndex) const {
+  return m_series.at(seriesIndex).units;
+}
+
+bool SqlFileTimeSeriesBatch::isComplete(unsigned seriesIndex) const {
+  return m_series.at(seriesIndex).present.empty();
+}
+
+const std::vector<double>& SqlFileTimeSeriesBatch::values(unsigned seriesIndex) const {
+  return m_series.at(seriesIndex).values;
+}
+
+boost::optional<TimeSeries> SqlFileTimeSeriesBatch::timeSeries(unsigned seriesIndex) const {
+  const Series& series = m_series.at(seriesIndex);
+  if (series.present.empty()) {
+    if (!m_timeAxis) {
+      return boost::none;
+    }
+    return m_timeAxis->timeSeries(series.values, series.units);
+  }
+
+  // the series has its own axis made of the reports it has values for
+  std::vector<detail::SqlFileReportTime> reportTimes;
+  std::vector<double> values;
+  for (unsigned i = 0, n = m_reportTimes.size(); i < n; ++i) {
+    if (series.present[i]) {
+      reportTimes.push_back(m_reportTimes[i]);
+      values.push_back(series.values[i]);
+    }
+  }
+  return detail::SqlFileReportTimeAxis(reportTimes, m_isIntervalFrequency, m_runPeriodDateTime).timeSeries(values, series.units);
+}
+
+}  // namespace openstudio
@@ -0,0 +1,156 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2021, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+
+#ifndef UTILITIES_SQL_SQLFILETIMESERIESBATCH_HPP
+#define UTILITIES_SQL_SQLFILETIMESERIESBATCH_HPP
+
+#include "../UtilitiesAPI.hpp"
+#include "../data/TimeSeries.hpp"
+#include "../time/DateTime.hpp"
+
+#include <boost/optional.hpp>
+
+#include <string>
+#include <vector>
+
+namespace openstudio {
+
+namespace detail {
+
+  class SqlFile_Impl;
+
+  /// one row of the Time table, reduced to what is needed to place a report on a TimeSeries axis
+  struct UTILITIES_API SqlFileReportTime
+  {
+    boost::optional<unsigned> year;
+    unsigned month;
+    unsigned day;
+    // length of the reporting interval ending at this report
+    unsigned intervalMinutes;
+  };
+
+  /// time axis of a series of reports, as SqlFile builds it for its TimeSeries
+  struct UTILITIES_API SqlFileReportTimeAxis
+  {
+    /** Builds the axis from consecutive reports. runPeriodDateTime is used as the first report date time
+     *  when the first report has no month or day. If isIntervalFrequency and every report has the same
+     *  interval, intervalMinutes is set. */
+    SqlFileReportTimeAxis(const std::vector<SqlFileReportTime>& reportTimes, bool isIntervalFrequency,
+                          const boost::optional<DateTime>& runPeriodDateTime);
+
+    /// TimeSeries of values on this axis, values must have one entry per report
+    boost::optional<TimeSeries> timeSeries(const std::vector<double>& values, const std::string& units) const;
+
+    boost::optional<DateTime> firstReportDateTime;
+    std::vector<long> secondsFromFirstReport;
+    boost::optional<unsigned> intervalMinutes;
+  };
+
+}  // namespace detail
+
+/** SqlFileTimeSeriesBatch holds several time series read from an SqlFile in a single pass over the
+ *  report data, see SqlFile::timeSeriesBatch. All series are for the same environment period and
+ *  reporting frequency and share one time axis, which is decoded and stored once; the values of each
+ *  series are kept in their own contiguous column. */
+class UTILITIES_API SqlFileTimeSeriesBatch
+{
+ public:
+  /** @name Constructors and Destructors */
+  //@{
+
+  /// empty batch
+  SqlFileTimeSeriesBatch();
+
+  //@}
+  /** @name Getters */
+  //@{
+
+  std::string environmentPeriod() const;
+
+  std::string reportingFrequency() const;
+
+  /// number of series in the batch
+  unsigned numSeries() const;
+
+  /// number of reports on the shared time axis
+  unsigned numReports() const;
+
+  /// date and time of the first report on the shared time axis
+  boost::optional<DateTime> firstReportDateTime() const;
+
+  /// seconds from the first report to each report on the shared time axis, starting with the interval of the first report
+  std::vector<long> secondsFromFirstReport() const;
+
+  /// interval between reports, if they are evenly spaced
+  boost::optional<Time> intervalLength() const;
+
+  std::string name(unsigned seriesIndex) const;
+
+  std::string keyValue(unsigned seriesIndex) const;
+
+  std::string units(unsigned seriesIndex) const;
+
+  /// true if seriesIndex has a value for every report on the shared time axis
+  bool isComplete(unsigned seriesIndex) const;
+
+  /** Values of seriesIndex, one per report on the shared time axis. Reports missing from an incomplete
+   *  series are zero, as a NULL value would be. */
+  const std::vector<double>& values(unsigned seriesIndex) const;
+
+  /** TimeSeries of seriesIndex, identical to the one returned by SqlFile::timeSeries for the same
+   *  name and key value. */
+  boost::optional<TimeSeries> timeSeries(unsigned seriesIndex) const;
+
+  //@}
+ private:
+  friend class detail::SqlFile_Impl;
+
+  struct Series
+  {
+    std::string name;
+    std::string keyValue;
+    std::string units;
+    std::vector<double> values;
+    // reports present in values, left empty when the series is complete
+    std::vector<bool> present;
+  };
+
+  std::string m_environmentPeriod;
+  std::string m_reportingFrequency;
+  bool m_isIntervalFrequency;
+  std::vector<detail::SqlFileReportTime> m_reportTimes;
+  boost::optional<DateTime> m_runPeriodDateTime;
+  boost::optional<detail::SqlFileReportTimeAxis> m_timeAxis;
+  std::vector<Series> m_series;
+};
+
+}  // namespace openstudio
+
+#endif  // UTILITIES_SQL_SQLFILETIMESERIESBATCH_HPP
@@ -39,6 +39,8 @@
 
 #include <sqlite3.h>
 
+#include <boost/algorithm/string/join.hpp>
+
 using boost::multi_index_container;
 using boost::multi_index::indexed_by;
 using boost::multi_index::ordered_unique;
@@ -431,6 +433,11 @@ namespace detail {
   }
 
   bool SqlFile_Impl::close() {
+    closeConnections();
+    {
+      std::lock_guard<std::mutex> lock(m_tabularDataMutex);
+      m_tabularData.reset();
+    }
     if (m_connectionOpen) {
       sqlite3_close(m_db);
       m_connectionOpen = false;
@@ -438,6 +445,93 @@ namespace detail {
     return true;
   }
 
+  SqlFile_Impl::StatementLease::StatementLease(const SqlFile_Impl& sqlFile, const std::string& statement) : m_sqlFile(sqlFile) {
+    if (!sqlFile.m_db) {
+      return;
+    }
+
+    m_connection = sqlFile.acquireConnection();
+    if (!m_connection) {
+      m_uncached = std::make_unique<PreparedStatement>(statement, sqlFile.m_db);
+      m_statement = m_uncached.get();
+      return;
+    }
+
+    try {
+      auto it = m_connection->statements.find(statement);
+      if (it == m_connection->statements.end()) {
+        // queries are expected to use '?' placeholders, this only guards against unbounded growth when they do not
+        constexpr size_t maxCachedStatements = 256;
+        if (m_connection->statements.size() >= maxCachedStatements) {
+          m_connection->statements.clear();
+        }
+        it = m_connection->statements.emplace(statement, std::make_unique<PreparedStatement>(statement, m_connection->db)).first;
+      }
+      m_statement = it->second.get();
+    } catch (...) {
+      sqlFile.releaseConnection(m_connection);
+      throw;
+    }
+  }
+
+  SqlFile_Impl::StatementLease::~StatementLease() {
+    if (m_connection) {
+      if (m_statement) {
+        m_statement->reset();
+      }
+      m_sqlFile.releaseConnection(m_connection);
+    }
+  }
+
+  SqlFile_Impl::Connection* SqlFile_Impl::acquireConnection() const {
+    std::lock_guard<std::mutex> lock(m_connectionsMutex);
+    if (!m_mainConnectionInUse) {
+      m_mainConnectionInUse = true;
+      m_mainConnection.db = m_db;
+      return &m_mainConnection;
+    }
+
+    if (!m_freeReadOnlyConnections.empty()) {
+      Connection* result = m_freeReadOnlyConnections.back();
+      m_freeReadOnlyConnections.pop_back();
+      return result;
+    }
+
+    sqlite3* db = nullptr;
+    int code = sqlite3_open_v2(m_sqliteFilename.c_str(), &db, SQLITE_OPEN_READONLY, nullptr);
+    if (code != SQLITE_OK) {
+      LOG(Warn, "Could not open read only connection to '" << m_sqliteFilename << "', query will not be cached");
+      sqlite3_close(db);
+      return nullptr;
+    }
+    sqlite3_busy_timeout(db, 1000);
+
+    m_readOnlyConnections.push_back(std::make_unique<Connection>());
+    m_readOnlyConnections.back()->db = db;
+    return m_readOnlyConnections.back().get();
+  }
+
+  void SqlFile_Impl::releaseConnection(Connection* connection) const {
+    std::lock_guard<std::mutex> lock(m_connectionsMutex);
+    if (connection == &m_mainConnection) {
+      m_mainConnectionInUse = false;
+    } else {
+      m_freeReadOnlyConnections.push_back(connection);
+    }
+  }
+
+  void SqlFile_Impl::closeConnections() {
+    std::lock_guard<std::mutex> lock(m_connectionsMutex);
+    m_mainConnection.statements.clear();
+    m_mainConnection.db = nullptr;
+    m_freeReadOnlyConnections.clear();
+    for (auto& connection : m_readOnlyConnections) {
+      connection->statements.clear();
+      sqlite3_close(connection->db);
+    }
+    m_readOnlyConnections.clear();
+  }
+
   bool SqlFile_Impl::reopen() {
     bool result = true;
     try {
@@ -459,6 +553,7 @@ namespace detail {
     m_connectionOpen = (code == 0);
     if (m_connectionOpen) {  // create index on dictionaryIndex for large table reportvariabledata
       if (!isValidConnection()) {
+        closeConnections();
         sqlite3_close(m_db);
         m_connectionOpen = false;
         throw openstudio::Exception("OpenStudio is not compatible with this file.");
@@ -488,6 +583,104 @@ namespace detail {
     return m_hasIlluminanceMapYear;
   }
 
+  static std::string tabularDataKey(const std::string& reportName, const std::string& reportForString, const std::string& tableName,
+                                    const std::string& rowName, const std::string& columnName) {
+    std::string result;
+    result.reserve(reportName.size() + reportForString.size() + tableName.size() + rowName.size() + columnName.size() + 4);
+    for (const std::string* part : {&reportName, &reportForString, &tableName, &rowName, &columnName}) {
+      if (!result.empty()) {
+        result += '\x1f';
+      }
+      result += *part;
+    }
+    return result;
+  }
+
+  static std::string nullableColumnText(sqlite3_stmt* sqlStmtPtr, int column) {
+    const unsigned char* text = sqlite3_column_text(sqlStmtPtr, column);
+    return text ? columnText(text) : std::string();
+  }
+
+  bool SqlFile_Impl::loadTabularDataWithStrings() const {
+    if (!m_db) {
+      return false;
+    }
+
+    auto tabularData = std::make_shared<TabularDataIndex>();
+
+    sqlite3_stmt* sqlStmtPtr = nullptr;
+    int code = sqlite3_prepare_v2(m_db, "SELECT ReportName, ReportForString, TableName, RowName, ColumnName, Units, Value FROM TabularDataWithStrings",
+                                  -1, &sqlStmtPtr, nullptr);
+    if (code != SQLITE_OK) {
+      LOG(Error, "Could not read TabularDataWithStrings: " << sqlite3_errmsg(m_db));
+      sqlite3_finalize(sqlStmtPtr);
+      return false;
+    }
+
+    while ((code = sqlite3_step(sqlStmtPtr)) == SQLITE_ROW) {
+      (*tabularData)[tabularDataKey(nullableColumnText(sqlStmtPtr, 0), nullableColumnText(sqlStmtPtr, 1), nullableColumnText(sqlStmtPtr, 2),
+                                    nullableColumnText(sqlStmtPtr, 3), nullableColumnText(sqlStmtPtr, 4))]
+        .emplace_back(nullableColumnText(sqlStmtPtr, 5), nullableColumnText(sqlStmtPtr, 6));
+    }
+    sqlite3_finalize(sqlStmtPtr);
+
+    if (code != SQLITE_DONE) {
+      LOG(Error, "Could not read TabularDataWithStrings: " << sqlite3_errmsg(m_db));
+      return false;
+    }
+
+    std::lock_guard<std::mutex> lock(m_tabularDataMutex);
+    m_tabularData = std::move(tabularData);
+    return true;
+  }
+
+  std::shared_ptr<const SqlFile_Impl::TabularDataIndex> SqlFile_Impl::tabularData() const {
+    {
+      std::lock_guard<std::mutex> lock(m_tabularDataMutex);
+      if (m_tabularData) {
+        return m_tabularData;
+      }
+    }
+    loadTabularDataWithStrings();
+    std::lock_guard<std::mutex> lock(m_tabularDataMutex);
+    return m_tabularData;
+  }
+
+  boost::optional<std::string> SqlFile_Impl::tabularDataValue(const std::string& reportName, const std::string& reportForString,
+                                                              const std::string& tableName, const std::string& rowName,
+                                                              const std::string& columnName) const {
+    std::shared_ptr<const TabularDataIndex> tabularData = this->tabularData();
+    if (!tabularData) {
+      return boost::none;
+    }
+
+    auto it = tabularData->find(tabularDataKey(reportName, reportForString, tableName, rowName, columnName));
+    if (it == tabularData->end()) {
+      return boost::none;
+    }
+    return it->second.front().second;
+  }
+
+  boost::optional<std::string> SqlFile_Impl::tabularDataValue(const std::string& reportName, const std::string& reportForString,
+                                                              const std::string& tableName, const std::string& rowName, const std::string& columnName,
+                                                              const std::string& units) const {
+    std::shared_ptr<const TabularDataIndex> tabularData = this->tabularData();
+    if (!tabularData) {
+      return boost::none;
+    }
+
+    auto it = tabularData->find(tabularDataKey(reportName, reportForString, tableName, rowName, columnName));
+    if (it == tabularData->end()) {
+      return boost::none;
+    }
+    for (const auto& unitsAndValue : it->second) {
+      if (unitsAndValue.first == units) {
+        return unitsAndValue.second;
+      }
+    }
+    return boost::none;
+  }
+
   bool SqlFile_Impl::isValidConnection() {
     std::string energyPlusVersion = this->energyPlusVersion();
     if (energyPlusVersion.empty()) {
@@ -1007,12 +1200,13 @@ namespace detail {
       std::string meterName = boost::to_upper_copy(fuel.valueDescription()) + ":FACILITY";
 
       auto rowName = execAndReturnFirstString("SELECT RowName FROM TabularDataWithStrings WHERE ReportName='Economics Results Summary Report' AND "
-                                              "ReportForString='Entire Facility' AND TableName='Tariff Summary' AND Value='"
-                                              + meterName + "'");
+                                              "ReportForString='Entire Facility' AND TableName='Tariff Summary' AND Value=?",
+                                              meterName);
       if (rowName) {
         return execAndReturnFirstDouble("SELECT Value FROM TabularDataWithStrings WHERE ReportName='Economics Results Summary Report' AND "
-                                        "ReportForString='Entire Facility' AND TableName='Tariff Summary' AND RowName='"
-                                        + rowName.get() + "' AND ColumnName='Annual Cost (~~$~~)'");
+                                        "ReportForString='Entire Facility' AND TableName='Tariff Summary' AND RowName=? AND "
+                                        "ColumnName='Annual Cost (~~$~~)'",
+                                        rowName.get());
       } else {
         return boost::none;  // Return an empty optional double, indicating that there is no annual cost for this energy type
       }
@@ -1199,10 +1393,9 @@ namespace detail {
     }
     if (name.size() == 0) return result;
 
-    query = "SELECT value from TabularDataWithStrings where ReportName = 'Tariff Report' and ReportForString = '";
-    query += name;
-    query += "' and TableName = 'Native Variables' and ColumnName = 'Sum' and RowName = 'TotalEnergy'";
-    result = execAndReturnFirstDouble(query);
+    query = "SELECT value from TabularDataWithStrings where ReportName = 'Tariff Report' and ReportForString = ? and TableName = 'Native "
+            "Variables' and ColumnName = 'Sum' and RowName = 'TotalEnergy'";
+    result = execAndReturnFirstDouble(query, name);
 
     return result;
   }
@@ -1210,30 +1403,28 @@ namespace detail {
   OptionalDouble SqlFile_Impl::getElecOrGasCost(bool bGetGas) const {
     std::string fuelType;
     if (bGetGas) {
-      fuelType = "'Natural Gas'";
+      fuelType = "Natural Gas";
     } else {
-      fuelType = "'Electricity'";
+      fuelType = "Electricity";
     }
 
-    std::string query("select value from TabularDataWithStrings where TableName = 'Annual Cost' and (((RowName = 'Cost') and (Units = '~~$~~')) or "
-                      "(RowName = 'Cost (~~$~~)')) and ColumnName = ");
-    query += fuelType;
-
-    return execAndReturnFirstDouble(query);
+    return execAndReturnFirstDouble("select value from TabularDataWithStrings where TableName = 'Annual Cost' and (((RowName = 'Cost') and (Units "
+                                    "= '~~$~~')) or (RowName = 'Cost (~~$~~)')) and ColumnName = ?",
+                                    fuelType);
   }
 
   boost::optional<EndUses> SqlFile_Impl::endUses() const {
     EndUses result;
 
+    const std::string query = "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and "
+                              "(ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName = ?) and (RowName = ?) and "
+                              "(Units = ?)";
+
     for (EndUseFuelType fuelType : result.fuelTypes()) {
       std::string units = result.getUnitsForFuelType(fuelType);
       for (EndUseCategoryType category : result.categories()) {
 
-        std::string query = "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and "
-                            "(ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='"
-                            + fuelType.valueDescription() + "') and (RowName ='" + category.valueDescription() + "') and (Units = '" + units + "')";
-
-        boost::optional<double> value = execAndReturnFirstDouble(query);
+        boost::optional<double> value = execAndReturnFirstDouble(query, fuelType.valueDescription(), category.valueDescription(), units);
         OS_ASSERT(value);
 
         if (*value != 0.0) {
@@ -2149,13 +2340,11 @@ namespace detail {
     openstudio::OptionalTimeSeries ts;
     std::string units = dataDictionary.units;
 
-    boost::optional<openstudio::DateTime> firstReportDateTime;
-    std::vector<long> stdSecondsFromFirstReport;
-    stdSecondsFromFirstReport.reserve(8760);
+    std::vector<SqlFileReportTime> reportTimes;
+    reportTimes.reserve(8760);
 
     std::vector<double> stdValues;
     stdValues.reserve(8760);
-    boost::optional<unsigned> reportingIntervalMinutes;
 
     ReportingFrequency reportingFrequency(ReportingFrequency::RunPeriod);
     bool isIntervalTimeSeries = false;
@@ -2170,6 +2359,7 @@ namespace detail {
     if (m_db) {
       std::string energyPlusVersion = this->energyPlusVersion();
       VersionString version(energyPlusVersion);
+      bool isEnergyPlus83 = (version.major() == 8) && (version.minor() == 3);
 
       std::stringstream s;
       // v8.9.0 added the 'Year' field
@@ -2204,115 +2394,253 @@ namespace detail {
       s2 << code;
       LOG(Debug, s2.str());
 
-      long cumulativeSeconds = 0;
-
       while (code == SQLITE_ROW) {
         int b = 0;
         double value = sqlite3_column_double(sqlStmtPtr, b++);
         stdValues.push_back(value);
 
-        boost::optional<unsigned> year;
-        if (hasYear()) {
-          year = sqlite3_column_int(sqlStmtPtr, b++);
-          // As of EnergyPlus 9.4 and perhaps earlier, the anual run periods will have a valid year,
-          // however the sizing periods will have year = 0
-          if (year.get() == 0) {
-            year.reset();
-          }
+        reportTimes.push_back(reportTime(sqlStmtPtr, b, reportingFrequency, dataDictionary.envPeriodIndex, isEnergyPlus83));
+
+        // step to next row
+        code = sqlite3_step(sqlStmtPtr);
+      }
+
+      // must finalize to prevent memory leaks
+      sqlite3_finalize(sqlStmtPtr);
+
+      boost::optional<DateTime> runPeriodDateTime;
+      if (!reportTimes.empty() && ((reportTimes.front().month == 0) || (reportTimes.front().day == 0))) {
+        runPeriodDateTime = lastDateTime(false, dataDictionary.envPeriodIndex);
+      }
+      ts = SqlFileReportTimeAxis(reportTimes, isIntervalTimeSeries, runPeriodDateTime).timeSeries(stdValues, units);
+    }
+
+    return ts;
+  }
+
+  SqlFileReportTime SqlFile_Impl::reportTime(sqlite3_stmt* sqlStmtPtr, int column, const ReportingFrequency& reportingFrequency, int envPeriodIndex,
+                                             bool isEnergyPlus83) {
+    SqlFileReportTime result;
+
+    int b = column;
+    if (hasYear()) {
+      result.year = sqlite3_column_int(sqlStmtPtr, b++);
+      // As of EnergyPlus 9.4 and perhaps earlier, the anual run periods will have a valid year,
+      // however the sizing periods will have year = 0
+      if (result.year.get() == 0) {
+        result.year.reset();
+      }
+    }
+
+    result.month = sqlite3_column_int(sqlStmtPtr, b++);
+    result.day = sqlite3_column_int(sqlStmtPtr, b++);
+
+    // In cases where you report the same meter key for eg at Daily and at Timestep frequency
+    // the intervalMinutes will be reported by E+ for the Timestep one, so you get the wrong one for Daily...
+    // And since we can compute this easily, might as well do it
+    unsigned intervalMinutes;
+    if (reportingFrequency == ReportingFrequency::Hourly) {
+      intervalMinutes = 60;
+    } else if (reportingFrequency == ReportingFrequency::Daily) {
+      intervalMinutes = 24 * 60;
+    } else if (reportingFrequency == ReportingFrequency::Monthly) {
+      intervalMinutes = result.day * 24 * 60;
+    } else {
+      // If Detailed, Timestep, RunPeriod, or Annual: it varies
+      intervalMinutes = sqlite3_column_int(sqlStmtPtr, b);
+
+      if (reportingFrequency == ReportingFrequency::Annual) {
+        // Annual actually reports blank for Month, Day, Minute **and Interval** up to 9.3.0 at least
+        // We cannot let it be zero (when blank), since it will make the firstReportDateTime creation fail below
+        // cf https://github.com/NREL/EnergyPlus/issues/7939
+        if (intervalMinutes == 0) {
+          intervalMinutes = 365 * 24 * 60;
+        } else if ((intervalMinutes != 365 * 24 * 60) && (intervalMinutes != 366 * 24 * 60)) {
+          // Issue a Debug log, but retain value. Technically Annual reports on 12/31, regardless of when the start date was
+          LOG(Debug, "For an 'Annual' frequency, intervalMinutes (= " << intervalMinutes << ") doesn't correspond to 365 or 366 days");
         }
+      }
+    }
 
-        unsigned month = sqlite3_column_int(sqlStmtPtr, b++);
-        unsigned day = sqlite3_column_int(sqlStmtPtr, b++);
-
-        // In cases where you report the same meter key for eg at Daily and at Timestep frequency
-        // the intervalMinutes will be reported by E+ for the Timestep one, so you get the wrong one for Daily...
-        // And since we can compute this easily, might as well do it
-        unsigned intervalMinutes;
-        if (reportingFrequency == ReportingFrequency::Hourly) {
-          intervalMinutes = 60;
-        } else if (reportingFrequency == ReportingFrequency::Daily) {
-          intervalMinutes = 24 * 60;
-        } else if (reportingFrequency == ReportingFrequency::Monthly) {
-          intervalMinutes = day * 24 * 60;
-        } else {
-          // If Detailed, Timestep, RunPeriod, or Annual: it varies
-          intervalMinutes = sqlite3_column_int(sqlStmtPtr, b);  // Notice I'm not incrementing the counter here on purpose
-
-          if (reportingFrequency == ReportingFrequency::Annual) {
-            // Annual actually reports blank for Month, Day, Minute **and Interval** up to 9.3.0 at least
-            // We cannot let it be zero (when blank), since it will make the firstReportDateTime creation fail below
-            // cf https://github.com/NREL/EnergyPlus/issues/7939
-            if (intervalMinutes == 0) {
-              intervalMinutes = 365 * 24 * 60;
-            } else if ((intervalMinutes != 365 * 24 * 60) && (intervalMinutes != 366 * 24 * 60)) {
-              // Issue a Debug log, but retain value. Technically Annual reports on 12/31, regardless of when the start date was
-              LOG(Debug, "For an 'Annual' frequency, intervalMinutes (= " << intervalMinutes << ") doesn't correspond to 365 or 366 days");
-            }
-          }
+    if (isEnergyPlus83) {
+      // workaround for bug in E+ 8.3, issue #1692
+      if (reportingFrequency == ReportingFrequency::RunPeriod) {
+        DateTime firstDateTime = this->firstDateTime(false, envPeriodIndex);
+        DateTime lastDateTime = this->lastDateTime(false, envPeriodIndex);
+        Time deltaT = lastDateTime - firstDateTime;
+        intervalMinutes = (unsigned)deltaT.totalMinutes() + 60;
+      }
+    }
+
+    result.intervalMinutes = intervalMinutes;
+    return result;
+  }
+
+  SqlFileTimeSeriesBatch SqlFile_Impl::timeSeriesBatch(const std::string& envPeriod, const std::string& reportingFrequency,
+                                                       const std::vector<std::pair<std::string, std::string>>& timeSeriesNamesAndKeyValues) {
+    SqlFileTimeSeriesBatch result;
+    std::string queryEnvPeriod = boost::to_upper_copy(envPeriod);
+    result.m_environmentPeriod = queryEnvPeriod;
+    result.m_reportingFrequency = reportingFrequency;
+
+    // the frequency may be given as stored in the database or as its description
+    std::vector<std::string> queryReportingFrequencies(1, reportingFrequency);
+    if (openstudio::OptionalReportingFrequency freq = reportingFrequencyFromDB(reportingFrequency)) {
+      if (freq->valueDescription() != reportingFrequency) {
+        queryReportingFrequencies.push_back(freq->valueDescription());
+      }
+    }
+
+    auto& dictionary = m_dataDictionary.get<envPeriodReportingFrequencyNameKeyValue>();
+    std::vector<const DataDictionaryItem*> items;
+    for (const std::pair<std::string, std::string>& nameAndKeyValue : timeSeriesNamesAndKeyValues) {
+      const DataDictionaryItem* item = nullptr;
+      for (const std::string& queryReportingFrequency : queryReportingFrequencies) {
+        auto it = dictionary.find(boost::make_tuple(queryEnvPeriod, queryReportingFrequency, nameAndKeyValue.first, nameAndKeyValue.second));
+        if (it == dictionary.end()) {
+          it = dictionary.find(
+            boost::make_tuple(queryEnvPeriod, queryReportingFrequency, nameAndKeyValue.first, boost::to_upper_copy(nameAndKeyValue.second)));
         }
-        // Don't forget to increment the counter anyway, no matter whether we did call sqlite3_column_int or not
-        ++b;
-
-        if ((version.major() == 8) && (version.minor() == 3)) {
-          // workaround for bug in E+ 8.3, issue #1692
-          if (reportingFrequency == ReportingFrequency::RunPeriod) {
-            DateTime firstDateTime = this->firstDateTime(false, dataDictionary.envPeriodIndex);
-            DateTime lastDateTime = this->lastDateTime(false, dataDictionary.envPeriodIndex);
-            Time deltaT = lastDateTime - firstDateTime;
-            intervalMinutes = (unsigned)deltaT.totalMinutes() + 60;
-          }
+        if (it != dictionary.end()) {
+          item = &(*it);
+          break;
         }
+      }
+      if (item) {
+        items.push_back(item);
+      } else {
+        LOG(Debug, "Tuple: " << queryEnvPeriod << ", " << reportingFrequency << ", " << nameAndKeyValue.first << ", " << nameAndKeyValue.second
+                             << " not found in data dictionary.");
+      }
+    }
 
-        if (!firstReportDateTime) {
-          if ((month == 0) || (day == 0)) {
-            // gets called for RunPeriod reports
-            firstReportDateTime = lastDateTime(false, dataDictionary.envPeriodIndex);
-          } else {
-            // DLM: get standard time zone?
-            if (intervalMinutes >= 24 * 60) {
-              // Daily or Monthly
-              OS_ASSERT(intervalMinutes % (24 * 60) == 0);
-              firstReportDateTime = year ? openstudio::DateTime(openstudio::Date(month, day, *year), openstudio::Time(1, 0, 0, 0))
-                                         : openstudio::DateTime(openstudio::Date(month, day), openstudio::Time(1, 0, 0, 0));
-            } else {
-              firstReportDateTime = year ? openstudio::DateTime(openstudio::Date(month, day, *year), openstudio::Time(0, 0, intervalMinutes, 0))
-                                         : openstudio::DateTime(openstudio::Date(month, day), openstudio::Time(0, 0, intervalMinutes, 0));
-            }
-          }
-        }
+    if (!m_db || items.empty()) {
+      return result;
+    }
 
-        // Use the new way to create the time series with nonzero first entry
-        cumulativeSeconds += 60 * intervalMinutes;
-        stdSecondsFromFirstReport.push_back(cumulativeSeconds);
+    ReportingFrequency rf(ReportingFrequency::RunPeriod);
+    try {
+      rf = ReportingFrequency(items.front()->reportingFrequency);
+      result.m_isIntervalFrequency =
+        (rf == ReportingFrequency::Timestep) || (rf == ReportingFrequency::Hourly) || (rf == ReportingFrequency::Daily);
+    } catch (const std::exception&) {
+    }
 
-        // check if this interval is same as the others
-        if (isIntervalTimeSeries && !reportingIntervalMinutes) {
-          reportingIntervalMinutes = intervalMinutes;
-        } else if (reportingIntervalMinutes && (reportingIntervalMinutes.get() != intervalMinutes)) {
-          isIntervalTimeSeries = false;
-          reportingIntervalMinutes.reset();
-        }
+    VersionString version(energyPlusVersion());
+    bool isEnergyPlus83 = (version.major() == 8) && (version.minor() == 3);
+    int envPeriodIndex = items.front()->envPeriodIndex;
 
-        // step to next row
-        code = sqlite3_step(sqlStmtPtr);
+    // series are filed under their table and dictionary index, the same index may be requested more than once
+    std::map<std::pair<int, int>, std::vector<unsigned>> seriesByIndex;
+    std::stringstream meterIndices;
+    std::stringstream variableIndices;
+    for (unsigned i = 0, n = items.size(); i < n; ++i) {
+      const DataDictionaryItem& item = *items[i];
+      int tableNumber = (item.table == "ReportMeterData") ? 0 : 1;
+      std::vector<unsigned>& seriesIndices = seriesByIndex[std::make_pair(tableNumber, item.recordIndex)];
+      if (seriesIndices.empty()) {
+        std::stringstream& indices = (tableNumber == 0) ? meterIndices : variableIndices;
+        indices << (indices.tellp() > 0 ? ", " : "") << item.recordIndex;
       }
+      seriesIndices.push_back(i);
 
-      // must finalize to prevent memory leaks
+      SqlFileTimeSeriesBatch::Series series;
+      series.name = item.name;
+      series.keyValue = item.keyValue;
+      series.units = item.units;
+      result.m_series.push_back(series);
+    }
+
+    // one scan over the report data of all series in time order, each row of the Time table is decoded once
+    std::vector<std::string> selects;
+    if (meterIndices.tellp() > 0) {
+      selects.push_back("SELECT 0 AS TableNumber, ReportMeterDataDictionaryIndex AS DictionaryIndex, TimeIndex, VariableValue FROM ReportMeterData"
+                        " WHERE ReportMeterDataDictionaryIndex IN ("
+                        + meterIndices.str() + ")");
+    }
+    if (variableIndices.tellp() > 0) {
+      selects.push_back(
+        "SELECT 1 AS TableNumber, ReportVariableDataDictionaryIndex AS DictionaryIndex, TimeIndex, VariableValue FROM ReportVariableData"
+        " WHERE ReportVariableDataDictionaryIndex IN ("
+        + variableIndices.str() + ")");
+    }
+
+    std::stringstream s;
+    s << "SELECT dt.TableNumber, dt.DictionaryIndex, dt.TimeIndex, dt.VariableValue, ";
+    if (hasYear()) {
+      s << "Time.Year, ";
+    }
+    s << "Time.Month, Time.Day, Time.Interval FROM (" << boost::algorithm::join(selects, " UNION ALL ") << ") dt";
+    s << " INNER JOIN Time ON Time.TimeIndex = dt.TimeIndex WHERE Time.EnvironmentPeriodIndex = ? ORDER BY dt.TimeIndex";
+
+    sqlite3_stmt* sqlStmtPtr;
+    int code = sqlite3_prepare_v2(m_db, s.str().c_str(), -1, &sqlStmtPtr, nullptr);
+    if (code != SQLITE_OK) {
+      LOG(Error, "Unable to prepare time series batch query: " << sqlite3_errmsg(m_db));
       sqlite3_finalize(sqlStmtPtr);
+      result.m_series.clear();
+      return result;
+    }
+    sqlite3_bind_int(sqlStmtPtr, 1, envPeriodIndex);
 
-      if (firstReportDateTime && !stdSecondsFromFirstReport.empty()) {
-        if (isIntervalTimeSeries) {
-          openstudio::Time intervalTime(0, 0, *reportingIntervalMinutes, 0);
-          openstudio::Vector values = createVector(stdValues);
-          ts = openstudio::TimeSeries(*firstReportDateTime, intervalTime, values, units);
-        } else {
-          openstudio::Vector values = createVector(stdValues);
-          ts = openstudio::TimeSeries(*firstReportDateTime, stdSecondsFromFirstReport, values, units);
+    std::vector<unsigned> numPresent(result.m_series.size(), 0);
+    int lastTimeIndex = 0;
+    code = sqlite3_step(sqlStmtPtr);
+    while (code == SQLITE_ROW) {
+      int tableNumber = sqlite3_column_int(sqlStmtPtr, 0);
+      int dictionaryIndex = sqlite3_column_int(sqlStmtPtr, 1);
+      int timeIndex = sqlite3_column_int(sqlStmtPtr, 2);
+      double value = sqlite3_column_double(sqlStmtPtr, 3);
+
+      if (result.m_reportTimes.empty() || (timeIndex != lastTimeIndex)) {
+        result.m_reportTimes.push_back(reportTime(sqlStmtPtr, 4, rf, envPeriodIndex, isEnergyPlus83));
+        lastTimeIndex = timeIndex;
+      }
+      unsigned report = result.m_reportTimes.size() - 1;
+
+      auto it = seriesByIndex.find(std::make_pair(tableNumber, dictionaryIndex));
+      OS_ASSERT(it != seriesByIndex.end());
+      for (unsigned seriesIndex : it->second) {
+        SqlFileTimeSeriesBatch::Series& series = result.m_series[seriesIndex];
+        if (series.values.size() > report) {
+          LOG(Warn, "More than one value for '" << series.name << "', '" << series.keyValue << "' at time index " << timeIndex
+                                                << ", keeping the last one.");
+          series.values[report] = value;
+          continue;
         }
+        series.values.resize(report, 0.0);
+        series.present.resize(report, false);
+        series.values.push_back(value);
+        series.present.push_back(true);
+        ++numPresent[seriesIndex];
       }
+
+      code = sqlite3_step(sqlStmtPtr);
     }
 
-    return ts;
+    // must finalize to prevent memory leaks
+    sqlite3_finalize(sqlStmtPtr);
+
+    unsigned numReports = result.m_reportTimes.size();
+    for (unsigned i = 0, n = result.m_series.size(); i < n; ++i) {
+      SqlFileTimeSeriesBatch::Series& series = result.m_series[i];
+      series.values.resize(numReports, 0.0);
+      if (numPresent[i] == numReports) {
+        std::vector<bool>().swap(series.present);
+      } else {
+        series.present.resize(numReports, false);
+      }
+    }
+
+    for (const SqlFileReportTime& reportTime : result.m_reportTimes) {
+      if ((reportTime.month == 0) || (reportTime.day == 0)) {
+        result.m_runPeriodDateTime = lastDateTime(false, envPeriodIndex);
+        break;
+      }
+    }
+    result.m_timeAxis = SqlFileReportTimeAxis(result.m_reportTimes, result.m_isIntervalFrequency, result.m_runPeriodDateTime);
+
+    return result;
   }
 
   openstudio::DateTimeVector SqlFile_Impl::dateTimeVec(const DataDictionaryItem& dataDictionary) {
@@ -35,6 +35,7 @@
 #include "SummaryData.hpp"
 #include "SqlFileEnums.hpp"
 #include "SqlFileDataDictionary.hpp"
+#include "SqlFileTimeSeriesBatch.hpp"
 #include "PreparedStatement.hpp"
 #include "../data/DataEnums.hpp"
 #include "../data/EndUses.hpp"
@@ -43,7 +44,11 @@
 
 #include <boost/optional.hpp>
 
+#include <memory>
+#include <mutex>
+#include <stdexcept>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 struct sqlite3;
@@ -657,6 +662,10 @@ namespace detail {
        *  down by ReportingFrequency and determine how many TimeSeries will be returned. */
     std::vector<TimeSeries> timeSeries(const SqlFileTimeSeriesQuery& query);
 
+    // return the timeseries for each (timeSeriesName, keyValue) pair at envPeriod and reportingFrequency, read in one pass
+    SqlFileTimeSeriesBatch timeSeriesBatch(const std::string& envPeriod, const std::string& reportingFrequency,
+                                           const std::vector<std::pair<std::string, std::string>>& timeSeriesNamesAndKeyValues);
+
     // returns an optional pair of date times for begin and end of daylight savings time
     boost::optional<std::pair<openstudio::DateTime, openstudio::DateTime>> daylightSavingsPeriod() const;
 
@@ -743,9 +752,9 @@ namespace detail {
     // Variadic arguments are the bind arguments if any, to replace '?' placeholders in the statement string
     template <typename... Args>
     boost::optional<double> execAndReturnFirstDouble(const std::string& statement, Args&&... args) const {
-      if (m_db) {
-        PreparedStatement stmt(statement, m_db, false, args...);
-        return stmt.execAndReturnFirstDouble();
+      StatementLease lease(*this, statement);
+      if (lease) {
+        return lease.bind(statement, args...).execAndReturnFirstDouble();
       }
       return boost::none;
     }
@@ -754,9 +763,9 @@ namespace detail {
     // Variadic arguments are the bind arguments if any, to replace '?' placeholders in the statement string
     template <typename... Args>
     boost::optional<int> execAndReturnFirstInt(const std::string& statement, Args&&... args) const {
-      if (m_db) {
-        PreparedStatement stmt(statement, m_db, false, args...);
-        return stmt.execAndReturnFirstInt();
+      StatementLease lease(*this, statement);
+      if (lease) {
+        return lease.bind(statement, args...).execAndReturnFirstInt();
       }
       return boost::none;
     }
@@ -765,9 +774,9 @@ namespace detail {
     // Variadic arguments are the bind arguments if any, to replace '?' placeholders in the statement string
     template <typename... Args>
     boost::optional<std::string> execAndReturnFirstString(const std::string& statement, Args&&... args) const {
-      if (m_db) {
-        PreparedStatement stmt(statement, m_db, false, args...);
-        return stmt.execAndReturnFirstString();
+      StatementLease lease(*this, statement);
+      if (lease) {
+        return lease.bind(statement, args...).execAndReturnFirstString();
       }
       return boost::none;
     }
@@ -776,9 +785,9 @@ namespace detail {
     // Variadic arguments are the bind arguments if any, to replace '?' placeholders in the statement string
     template <typename... Args>
     boost::optional<std::vector<double>> execAndReturnVectorOfDouble(const std::string& statement, Args&&... args) const {
-      if (m_db) {
-        PreparedStatement stmt(statement, m_db, false, args...);
-        return stmt.execAndReturnVectorOfDouble();
+      StatementLease lease(*this, statement);
+      if (lease) {
+        return lease.bind(statement, args...).execAndReturnVectorOfDouble();
       }
       return boost::none;
     }
@@ -787,9 +796,9 @@ namespace detail {
     // Variadic arguments are the bind arguments if any, to replace '?' placeholders in the statement string
     template <typename... Args>
     boost::optional<std::vector<int>> execAndReturnVectorOfInt(const std::string& statement, Args&&... args) const {
-      if (m_db) {
-        PreparedStatement stmt(statement, m_db, false, args...);
-        return stmt.execAndReturnVectorOfInt();
+      StatementLease lease(*this, statement);
+      if (lease) {
+        return lease.bind(statement, args...).execAndReturnVectorOfInt();
       }
       return boost::none;
     }
@@ -798,9 +807,9 @@ namespace detail {
     // Variadic arguments are the bind arguments if any, to replace '?' placeholders in the statement string
     template <typename... Args>
     boost::optional<std::vector<std::string>> execAndReturnVectorOfString(const std::string& statement, Args&&... args) const {
-      if (m_db) {
-        PreparedStatement stmt(statement, m_db, false, args...);
-        return stmt.execAndReturnVectorOfString();
+      StatementLease lease(*this, statement);
+      if (lease) {
+        return lease.bind(statement, args...).execAndReturnVectorOfString();
       }
       return boost::none;
     }
@@ -847,7 +856,68 @@ namespace detail {
     // DaylightMapHourlyReports added Year in 9.2.0
     bool hasIlluminanceMapYear() const;
 
+    /// Loads all of TabularDataWithStrings into memory, indexed for the tabularDataValue lookups
+    bool loadTabularDataWithStrings() const;
+
+    /// Value of the TabularDataWithStrings row matching all fields, loads the table on first use
+    boost::optional<std::string> tabularDataValue(const std::string& reportName, const std::string& reportForString, const std::string& tableName,
+                                                  const std::string& rowName, const std::string& columnName) const;
+
+    /// Value of the TabularDataWithStrings row matching all fields and units, loads the table on first use
+    boost::optional<std::string> tabularDataValue(const std::string& reportName, const std::string& reportForString, const std::string& tableName,
+                                                  const std::string& rowName, const std::string& columnName, const std::string& units) const;
+
    private:
+    // TabularDataWithStrings (units, value) pairs in row order, keyed by report, for, table, row and column names
+    using TabularDataIndex = std::unordered_map<std::string, std::vector<std::pair<std::string, std::string>>>;
+
+    // A connection to the database along with the statements prepared on it, keyed by statement string
+    struct Connection
+    {
+      sqlite3* db = nullptr;
+      std::unordered_map<std::string, std::unique_ptr<PreparedStatement>> statements;
+    };
+
+    // Lends the prepared statement for one query on a free connection: the main connection if no other query is
+    // using it, otherwise a read only connection opened on demand. The statement is reset when the lease ends.
+    class StatementLease
+    {
+     public:
+      StatementLease(const SqlFile_Impl& sqlFile, const std::string& statement);
+      ~StatementLease();
+
+      StatementLease(const StatementLease&) = delete;
+      StatementLease& operator=(const StatementLease&) = delete;
+
+      explicit operator bool() const {
+        return m_statement != nullptr;
+      }
+
+      template <typename... Args>
+      PreparedStatement& bind(const std::string& statement, Args&&... args) {
+        if (!m_statement->bindAll(args...)) {
+          throw std::runtime_error("Error bindings args with statement: " + statement);
+        }
+        return *m_statement;
+      }
+
+     private:
+      const SqlFile_Impl& m_sqlFile;
+      Connection* m_connection = nullptr;
+      // used when no connection can be lent
+      std::unique_ptr<PreparedStatement> m_uncached;
+      PreparedStatement* m_statement = nullptr;
+    };
+
+    Connection* acquireConnection() const;
+    void releaseConnection(Connection* connection) const;
+
+    // finalizes all cached statements and closes the read only connections
+    void closeConnections();
+
+    // the loaded TabularDataWithStrings, loading it if needed; null if it could not be read
+    std::shared_ptr<const TabularDataIndex> tabularData() const;
+
     void init();
 
     void retrieveDataDictionary();
@@ -872,6 +942,11 @@ namespace detail {
 
     // return a single timeseries matching recordIndex - internally used to retrieve timeseries
     boost::optional<TimeSeries> timeSeries(const DataDictionaryItem& dataDictionary);
+
+    // decode the Time columns (Year if hasYear, Month, Day, Interval) of the current row of sqlStmtPtr, starting at column
+    SqlFileReportTime reportTime(sqlite3_stmt* sqlStmtPtr, int column, const ReportingFrequency& reportingFrequency, int envPeriodIndex,
+                                 bool isEnergyPlus83);
+
     std::vector<double> timeSeriesValues(const DataDictionaryItem& dataDictionary);
     boost::optional<Date> timeSeriesStartDate(const DataDictionaryItem& dataDictionary);
 
@@ -902,6 +977,15 @@ namespace detail {
 
     bool m_hasIlluminanceMapYear;
 
+    mutable std::mutex m_connectionsMutex;
+    mutable Connection m_mainConnection;
+    mutable bool m_mainConnectionInUse = false;
+    mutable std::vector<std::unique_ptr<Connection>> m_readOnlyConnections;
+    mutable std::vector<Connection*> m_freeReadOnlyConnections;
+
+    mutable std::mutex m_tabularDataMutex;
+    mutable std::shared_ptr<const TabularDataIndex> m_tabularData;
+
     REGISTER_LOGGER("openstudio.energyplus.SqlFile");
   };
 
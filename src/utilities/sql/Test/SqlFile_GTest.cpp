@@ -50,6 +50,8 @@
 #include <boost/regex.hpp>
 #include <resources.hxx>
 #include <stdexcept>
+#include <atomic>
+#include <thread>
 
 using namespace std;
 using namespace boost;
@@ -184,6 +186,117 @@ TEST_F(SqlFileFixture, TimeSeries) {
   EXPECT_DOUBLE_EQ(365 - 1.0 / 24.0, duration.totalDays());
 }
 
+// every series read in a batch matches the same series read on its own
+void checkTimeSeriesBatch(SqlFile& sql) {
+  for (const std::string& envPeriod : sql.availableEnvPeriods()) {
+    for (const std::string& reportingFrequency : sql.availableReportingFrequencies(envPeriod)) {
+      std::vector<std::pair<std::string, std::string>> namesAndKeyValues;
+      for (const std::string& name : sql.availableVariableNames(envPeriod, reportingFrequency)) {
+        for (const std::string& keyValue : sql.availableKeyValues(envPeriod, reportingFrequency, name)) {
+          namesAndKeyValues.push_back(std::make_pair(name, keyValue));
+        }
+      }
+      namesAndKeyValues.push_back(std::make_pair("NotAVariable:Facility", ""));
+
+      SCOPED_TRACE(envPeriod + ", " + reportingFrequency);
+      SqlFileTimeSeriesBatch batch = sql.timeSeriesBatch(envPeriod, reportingFrequency, namesAndKeyValues);
+      ASSERT_EQ(namesAndKeyValues.size() - 1, batch.numSeries());
+
+      for (unsigned i = 0; i < batch.numSeries(); ++i) {
+        EXPECT_EQ(namesAndKeyValues[i].first, batch.name(i));
+        EXPECT_EQ(batch.numReports(), batch.values(i).size());
+
+        OptionalTimeSeries expected = sql.timeSeries(envPeriod, reportingFrequency, batch.name(i), batch.keyValue(i));
+        OptionalTimeSeries actual = batch.timeSeries(i);
+        ASSERT_EQ(expected.is_initialized(), actual.is_initialized());
+        if (!expected) {
+          continue;
+        }
+        EXPECT_EQ(expected->firstReportDateTime(), actual->firstReportDateTime());
+        EXPECT_EQ(expected->intervalLength().is_initialized(), actual->intervalLength().is_initialized());
+        EXPECT_EQ(expected->secondsFromFirstReport(), actual->secondsFromFirstReport());
+        EXPECT_EQ(expected->units(), actual->units());
+        Vector expectedValues = expected->values();
+        Vector actualValues = actual->values();
+        ASSERT_EQ(expectedValues.size(), actualValues.size());
+        for (unsigned j = 0; j < expectedValues.size(); ++j) {
+          EXPECT_EQ(expectedValues[j], actualValues[j]);
+        }
+      }
+    }
+  }
+}
+
+TEST_F(SqlFileFixture, TimeSeriesBatch) {
+  checkTimeSeriesBatch(sqlFile);
+  checkTimeSeriesBatch(sqlFile2);
+
+  SqlFileTimeSeriesBatch batch = sqlFile.timeSeriesBatch("RUNPERIOD 1", "Hourly", {{"Electricity:Facility", ""}, {"NaturalGas:Facility", ""}});
+  ASSERT_EQ(2u, batch.numSeries());
+  EXPECT_EQ(8760u, batch.numReports());
+  EXPECT_TRUE(batch.isComplete(0));
+  EXPECT_TRUE(batch.isComplete(1));
+  ASSERT_TRUE(batch.intervalLength());
+  EXPECT_EQ(Time(0, 1, 0, 0), *batch.intervalLength());
+  ASSERT_TRUE(batch.firstReportDateTime());
+  EXPECT_EQ(batch.numReports(), batch.secondsFromFirstReport().size());
+}
+
+TEST_F(SqlFileFixture, TimeSeriesBatch_Incomplete) {
+  openstudio::path outfile = openstudio::tempDir() / openstudio::toPath("OpenStudioSqlFileTimeSeriesBatch.sql");
+  if (openstudio::filesystem::exists(outfile)) {
+    openstudio::filesystem::remove(outfile);
+  }
+
+  openstudio::Calendar c(2012);
+
+  std::vector<double> values = {100, 10, 1, 100.5};
+  TimeSeries full(c.startDate(), openstudio::Time(0, 1), openstudio::createVector(values), "lux");
+
+  // starts one hour later and stops one hour earlier
+  std::vector<double> partialValues = {5, 6};
+  TimeSeries partial(DateTime(c.startDate(), openstudio::Time(0, 2)), openstudio::Time(0, 1), openstudio::createVector(partialValues), "lux");
+
+  {
+    openstudio::SqlFile sql(outfile, openstudio::EpwFile(resourcesPath() / toPath("utilities/Filetypes/USA_CO_Golden-NREL.724666_TMY3.epw")),
+                            openstudio::DateTime::now(), c);
+    ASSERT_TRUE(sql.connectionOpen());
+    sql.insertTimeSeriesData("Sum", "Zone", "Zone", "WINDOW 1", "Daylight Luminance", openstudio::ReportingFrequency::Hourly,
+                             boost::optional<std::string>(), "lux", full);
+    sql.insertTimeSeriesData("Sum", "Zone", "Zone", "WINDOW 2", "Daylight Luminance", openstudio::ReportingFrequency::Hourly,
+                             boost::optional<std::string>(), "lux", partial);
+  }
+
+  openstudio::SqlFile sql(outfile);
+  ASSERT_TRUE(sql.connectionOpen());
+  std::vector<std::string> envPeriods = sql.availableEnvPeriods();
+  ASSERT_EQ(1u, envPeriods.size());
+  std::vector<std::string> reportingFrequencies = sql.availableReportingFrequencies(envPeriods[0]);
+  ASSERT_EQ(1u, reportingFrequencies.size());
+
+  SqlFileTimeSeriesBatch batch =
+    sql.timeSeriesBatch(envPeriods[0], reportingFrequencies[0], {{"Daylight Luminance", "WINDOW 2"}, {"Daylight Luminance", "WINDOW 1"}});
+  ASSERT_EQ(2u, batch.numSeries());
+  EXPECT_EQ("WINDOW 2", batch.keyValue(0));
+  EXPECT_EQ("WINDOW 1", batch.keyValue(1));
+  EXPECT_EQ(4u, batch.numReports());
+  EXPECT_FALSE(batch.isComplete(0));
+  EXPECT_TRUE(batch.isComplete(1));
+  EXPECT_EQ(std::vector<double>({0, 5, 6, 0}), batch.values(0));
+  EXPECT_EQ(values, batch.values(1));
+
+  for (unsigned i = 0; i < batch.numSeries(); ++i) {
+    boost::optional<TimeSeries> expected = sql.timeSeries(envPeriods[0], reportingFrequencies[0], batch.name(i), batch.keyValue(i));
+    boost::optional<TimeSeries> actual = batch.timeSeries(i);
+    ASSERT_TRUE(expected);
+    ASSERT_TRUE(actual);
+    EXPECT_EQ(expected->firstReportDateTime(), actual->firstReportDateTime());
+    EXPECT_EQ(expected->secondsFromFirstReport(), actual->secondsFromFirstReport());
+    EXPECT_EQ(openstudio::toStandardVector(expected->values()), openstudio::toStandardVector(actual->values()));
+  }
+  EXPECT_EQ(partialValues, openstudio::toStandardVector(batch.timeSeries(0)->values()));
+}
+
 TEST_F(SqlFileFixture, BadStatement) {
   const std::string query = "SELECT * FROM NonExistantTable;";
   try {
@@ -196,6 +309,78 @@ TEST_F(SqlFileFixture, BadStatement) {
   }
 }
 
+TEST_F(SqlFileFixture, CachedStatements_Threaded) {
+  const std::string query = "SELECT Value from TabularDataWithStrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and "
+                            "(ReportForString = 'Entire Facility') and (TableName = 'End Uses') and (ColumnName = ?) and (RowName = ?)";
+
+  std::vector<std::pair<std::string, std::string>> keys;
+  for (const auto& fuelTypeDescription : {"Electricity", "Natural Gas"}) {
+    for (const auto& categoryDescription : {"Heating", "Cooling", "Interior Lighting", "Interior Equipment", "Fans"}) {
+      keys.emplace_back(fuelTypeDescription, categoryDescription);
+    }
+  }
+
+  std::vector<boost::optional<double>> expected;
+  for (const auto& key : keys) {
+    expected.push_back(sqlFile.execAndReturnFirstDouble(query, key.first, key.second));
+    ASSERT_TRUE(expected.back());
+    // the cached statement is reset and rebound on each use
+    EXPECT_EQ(expected.back(), sqlFile.execAndReturnFirstDouble(query, key.first, key.second));
+  }
+  boost::optional<EndUses> expectedEndUses = sqlFile.endUses();
+  ASSERT_TRUE(expectedEndUses);
+
+  std::atomic<unsigned> mismatches(0);
+  std::vector<std::thread> threads;
+  for (unsigned t = 0; t < 4; ++t) {
+    threads.emplace_back([&]() {
+      for (unsigned repeat = 0; repeat < 10; ++repeat) {
+        for (size_t i = 0; i < keys.size(); ++i) {
+          if (sqlFile.execAndReturnFirstDouble(query, keys[i].first, keys[i].second) != expected[i]) {
+            ++mismatches;
+          }
+        }
+        boost::optional<EndUses> endUses = sqlFile.endUses();
+        if (!endUses || endUses->getEndUse(EndUseFuelType::Electricity, EndUseCategoryType::InteriorLights)
+                          != expectedEndUses->getEndUse(EndUseFuelType::Electricity, EndUseCategoryType::InteriorLights)) {
+          ++mismatches;
+        }
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  EXPECT_EQ(0u, mismatches.load());
+}
+
+TEST_F(SqlFileFixture, TabularDataValue) {
+  EXPECT_TRUE(sqlFile.loadTabularDataWithStrings());
+
+  const std::string query = "SELECT Value from TabularDataWithStrings where ReportName = ? and ReportForString = ? and TableName = ? and "
+                            "RowName = ? and ColumnName = ?";
+  for (const auto& rowName : {"Total Site Energy", "Net Site Energy", "Total Source Energy"}) {
+    boost::optional<std::string> expected =
+      sqlFile.execAndReturnFirstString(query, "AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "Site and Source Energy", rowName, "Total Energy");
+    ASSERT_TRUE(expected);
+    EXPECT_EQ(expected, sqlFile.tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "Site and Source Energy", rowName,
+                                                 "Total Energy"));
+    EXPECT_EQ(expected, sqlFile.tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "Site and Source Energy", rowName,
+                                                 "Total Energy", "GJ"));
+    EXPECT_FALSE(sqlFile.tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "Site and Source Energy", rowName,
+                                          "Total Energy", "kBtu"));
+  }
+  EXPECT_FALSE(sqlFile.tabularDataValue("NotAReport", "Entire Facility", "Site and Source Energy", "Total Site Energy", "Total Energy"));
+
+  // loaded lazily after a reopen
+  EXPECT_TRUE(sqlFile2.close());
+  EXPECT_TRUE(sqlFile2.reopen());
+  EXPECT_EQ(sqlFile2.execAndReturnFirstString(query, "AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "Site and Source Energy",
+                                              "Total Site Energy", "Total Energy"),
+            sqlFile2.tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "Site and Source Energy", "Total Site Energy",
+                                      "Total Energy"));
+}
+
 TEST_F(SqlFileFixture, CreateSqlFile) {
   openstudio::path outfile = openstudio::tempDir() / openstudio::toPath("OpenStudioSqlFileTest.sql");
   if (openstudio::filesystem::exists(outfile)) {